@@ -34,13 +34,28 @@ extern "C" {
 extern DMA2D_HandleTypeDef hdma2d;
 
 /* USER CODE BEGIN Private defines */
-
+/**
+  * @brief  DMA2D 寄存器配置缓存统计
+  */
+typedef struct
+{
+  uint32_t OutputConfigs;  /* 输出配置请求次数 */
+  uint32_t InitSkipped;    /* 配置未变化而省去的HAL_DMA2D_Init次数 */
+  uint32_t LayerConfigs;   /* 输入层配置请求次数 */
+  uint32_t LayerSkipped;   /* 配置未变化而省去的HAL_DMA2D_ConfigLayer次数 */
+  uint32_t RegWrites;      /* 实际写入的寄存器个数 */
+}DMA2D_CacheStatsTypeDef;
 /* USER CODE END Private defines */
 
 void MX_DMA2D_Init(void);
 
 /* USER CODE BEGIN Prototypes */
-
+void DMA2D_CacheInvalidate(void);
+void DMA2D_ConfigOutput(uint32_t Mode, uint32_t ColorMode, uint32_t OutputOffset);
+void DMA2D_ConfigInput(uint32_t LayerIdx, uint32_t ColorMode, uint32_t InputOffset, uint32_t AlphaMode, uint32_t InputAlpha);
+void DMA2D_ConfigCLUT(uint32_t LayerIdx, uint32_t ColorMode, uint32_t Size);
+void DMA2D_GetCacheStats(DMA2D_CacheStatsTypeDef *pStats);
+void DMA2D_ResetCacheStats(void);
 /* USER CODE END Prototypes */
 
 #ifdef __cplusplus
@@ -0,0 +1,43 @@
+#ifndef __DSP_BENCH_H__
+#define __DSP_BENCH_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "main.h"
+
+/* 置1在启动时运行CMSIS-DSP缓存性能测试(make BENCH=1)，需要链接CMSIS-DSP库 */
+#ifndef DSP_BENCH
+#define DSP_BENCH                  0
+#endif
+
+/* 每个测试重复的次数，取最少的周期数 */
+#ifndef DSP_BENCH_RUNS
+#define DSP_BENCH_RUNS             ((uint32_t)8)
+#endif
+
+/* 缓存配置 */
+#define DSP_BENCH_NO_CACHE         ((uint32_t)0)   /* I-Cache和D-Cache都关闭 */
+#define DSP_BENCH_ICACHE           ((uint32_t)1)   /* 只打开I-Cache */
+#define DSP_BENCH_IDCACHE          ((uint32_t)2)   /* 都打开 */
+#define DSP_BENCH_CONFIGS          ((uint32_t)3)
+
+/**
+  * @brief  一个测试在各缓存配置下的结果
+  */
+typedef struct
+{
+  const char *Name;
+  uint32_t    Cycles[DSP_BENCH_CONFIGS];   /* 最少周期数 */
+}DSP_BenchResultTypeDef;
+
+#if DSP_BENCH
+uint32_t DSP_Bench_Run(DSP_BenchResultTypeDef *pResult, uint32_t Count);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __DSP_BENCH_H__ */
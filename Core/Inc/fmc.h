@@ -27,7 +27,7 @@
 #include "main.h"
 
 /* USER CODE BEGIN Includes */
-
+#include "sdram_tune.h"
 /* USER CODE END Includes */
 
 extern SDRAM_HandleTypeDef hsdram2;
@@ -41,7 +41,8 @@ void HAL_SDRAM_MspInit(SDRAM_HandleTypeDef* hsdram);
 void HAL_SDRAM_MspDeInit(SDRAM_HandleTypeDef* hsdram);
 
 /* USER CODE BEGIN Prototypes */
-
+void FMC_SDRAM_GetConfig(SDRAM_ConfigTypeDef *pConfig);
+HAL_StatusTypeDef FMC_SDRAM_Reconfigure(const SDRAM_ConfigTypeDef *pConfig);
 /* USER CODE END Prototypes */
 
 #ifdef __cplusplus
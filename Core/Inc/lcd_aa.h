@@ -0,0 +1,43 @@
+#ifndef __LCD_AA_H__
+#define __LCD_AA_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "main.h"
+
+/* 一次光栅化的行数，每一条带生成一块A8覆盖率掩码交给DMA2D混合 */
+#ifndef LCD_AA_BAND_ROWS
+#define LCD_AA_BAND_ROWS     ((uint32_t)8)
+#endif
+
+/* 图元外接矩形的最大宽度(像素)，超出部分被裁掉 */
+#ifndef LCD_AA_MAX_WIDTH
+#define LCD_AA_MAX_WIDTH     ((uint32_t)800)
+#endif
+
+/* 圆弧、圆转换为多边形时的最大顶点数 */
+#ifndef LCD_AA_MAX_POINTS
+#define LCD_AA_MAX_POINTS    ((uint32_t)256)
+#endif
+
+/**
+  * @brief  亚像素精度的点，像素(x, y)覆盖[x, x+1)×[y, y+1)
+  */
+typedef struct
+{
+  float X;
+  float Y;
+}LCD_AA_PointTypeDef;
+
+void LCD_DrawLineAA(float x1, float y1, float x2, float y2, float Width);
+void LCD_DrawArcAA(float Xpos, float Ypos, float Radius, float StartAngle, float EndAngle, float Width);
+void LCD_FillCircleAA(float Xpos, float Ypos, float Radius);
+void LCD_FillPolygonAA(const LCD_AA_PointTypeDef *Points, uint16_t PointCount);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __LCD_AA_H__ */
@@ -0,0 +1,58 @@
+#ifndef __LCD_BACKEND_H__
+#define __LCD_BACKEND_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "main.h"
+#include "lcd_dma2d.h"
+
+/* 层配置的生效方式，后两种与HAL_LTDC_Reload的参数相同 */
+#define LCD_RELOAD_NONE         ((uint32_t)0)
+#define LCD_RELOAD_IMMEDIATE    LTDC_RELOAD_IMMEDIATE
+#define LCD_RELOAD_VBLANK       LTDC_RELOAD_VERTICAL_BLANKING
+
+/* 未调用LCD_SetBackend时使用的后端，主机上编译时定义为LCD_SoftBackend */
+#ifndef LCD_BACKEND_DEFAULT
+#define LCD_BACKEND_DEFAULT     LCD_HardwareBackend
+#endif
+
+/**
+  * @brief  显示后端，LCD驱动对LTDC和DMA2D的全部操作都通过这些函数完成
+  * @note   层参数保存在hltdc.LayerCfg中，与HAL相同；垂直消隐重载生效后后端调用
+  *         HAL_LTDC_ReloadEventCallback，行中断调用HAL_LTDC_LineEventCallback，
+  *         DMA2D命令完成后调用LCD_DMA2D_Complete
+  */
+typedef struct
+{
+  const char *Name;
+
+  /* LTDC */
+  HAL_StatusTypeDef (*ConfigLayer)(LTDC_LayerCfgTypeDef *pLayerCfg, uint32_t LayerIndex, uint32_t Reload); /* 写入层参数 */
+  void     (*EnableLayer)(uint32_t LayerIndex, FunctionalState State, uint32_t Reload);    /* 打开或关闭层 */
+  HAL_StatusTypeDef (*ConfigCLUT)(uint32_t *pCLUT, uint32_t Count, uint32_t LayerIndex); /* 加载并使能层的CLUT */
+  void     (*ColorKey)(uint32_t LayerIndex, FunctionalState State, uint32_t RGBValue);   /* 色键，不重载 */
+  void     (*Reload)(uint32_t Reload);                  /* 使之前写入的层参数生效 */
+  uint32_t (*ReloadPending)(void);                      /* 垂直消隐重载尚未生效 */
+  void     (*Display)(FunctionalState State);           /* 开关显示和背光 */
+  uint32_t (*GetLine)(void);                            /* 当前行计数值，同LTDC_CPSR的CYPOS */
+  void     (*LineEvent)(uint32_t Line);                 /* 行计数值到达Line时产生一次行中断 */
+  void     (*Idle)(void);                               /* 在忙等待循环中调用 */
+
+  /* DMA2D */
+  void     (*Dma2dInit)(void);                                /* 初始化，在LCD_DMA2D_Init中调用 */
+  HAL_StatusTypeDef (*Dma2dStart)(const LCD_DMA2D_CmdTypeDef *pCmd); /* 启动一条命令 */
+  void     (*Dma2dPoll)(void);                                /* 中断被屏蔽时处理完成标志 */
+}LCD_BackendTypeDef;
+
+extern const LCD_BackendTypeDef LCD_BACKEND_DEFAULT;
+
+void LCD_SetBackend(const LCD_BackendTypeDef *pBackend);
+const LCD_BackendTypeDef *LCD_GetBackend(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __LCD_BACKEND_H__ */
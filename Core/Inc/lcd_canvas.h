@@ -0,0 +1,45 @@
+#ifndef __LCD_CANVAS_H__
+#define __LCD_CANVAS_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "main.h"
+
+/* 滚动方向 */
+#define LCD_CANVAS_VERTICAL     ((uint32_t)0)   /* 上下滚动，例如日志 */
+#define LCD_CANVAS_HORIZONTAL   ((uint32_t)1)   /* 左右滚动，例如曲线 */
+
+/**
+  * @brief  绘制回调：在当前层的矩形(Xpos, Ypos, Width, Height)中绘制虚拟画布的内容
+  * @note   Virtual为矩形第一行(上下滚动)或第一列(左右滚动)在虚拟画布中的坐标，
+  *         另一个方向上画布坐标与层坐标相同
+  */
+typedef void (*LCD_CanvasDrawTypeDef)(void *pArg, int32_t Virtual, uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height);
+
+/**
+  * @brief  虚拟画布统计
+  */
+typedef struct
+{
+  uint32_t Scrolls;         /* 滚动次数 */
+  uint32_t LinesDrawn;      /* 调用绘制回调绘制的行数(上下滚动)或列数(左右滚动) */
+  uint32_t LinesMirrored;   /* 由DMA2D复制到镜像的行数或列数 */
+  uint32_t FullRedraws;     /* 一次滚动超过一屏、整屏重绘的次数 */
+}LCD_CanvasStatsTypeDef;
+
+HAL_StatusTypeDef LCD_Canvas_Init(uint32_t LayerIndex, uint32_t Address, uint32_t PixelFormat, uint32_t Direction,
+                                  uint16_t CrossSize, LCD_CanvasDrawTypeDef pDraw, void *pArg);
+void LCD_Canvas_Scroll(int32_t Delta);
+void LCD_Canvas_ScrollTo(int32_t Position);
+void LCD_Canvas_Pan(uint16_t Offset);
+void LCD_Canvas_Invalidate(int32_t Virtual, uint16_t Length);
+int32_t LCD_Canvas_GetPosition(void);
+void LCD_Canvas_GetStats(LCD_CanvasStatsTypeDef *pStats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __LCD_CANVAS_H__ */
@@ -0,0 +1,86 @@
+#ifndef __LCD_CHART_H__
+#define __LCD_CHART_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "main.h"
+
+/* 扫描光标前面清空的列数，用于区分新旧数据 */
+#ifndef LCD_CHART_GAP
+#define LCD_CHART_GAP        ((uint32_t)4)
+#endif
+
+/* 一次批量绘制的最大列数 */
+#ifndef LCD_CHART_BATCH
+#define LCD_CHART_BATCH      ((uint32_t)64)
+#endif
+
+/**
+  * @brief  单生产者单消费者无锁环形缓冲区，生产者(中断)只写Head，消费者只写Tail
+  */
+typedef struct
+{
+  int16_t           *pBuffer;   /* 采样缓冲区 */
+  uint32_t          Size;       /* 采样个数，必须为2的幂 */
+  volatile uint32_t Head;       /* 已写入的采样计数 */
+  volatile uint32_t Tail;       /* 已读出的采样计数 */
+  volatile uint32_t Overruns;   /* 缓冲区满时丢弃的采样数 */
+}LCD_RingTypeDef;
+
+/**
+  * @brief  滚动曲线统计
+  */
+typedef struct
+{
+  uint32_t Samples;         /* 已处理的采样数 */
+  uint32_t Skipped;         /* 积压超过一屏时直接跳过的采样数 */
+  uint32_t Columns;         /* 已绘制的列数 */
+  uint32_t Updates;         /* LCD_Chart_Update调用次数 */
+  uint32_t MaxBacklog;      /* 环形缓冲区中最多积压的采样数 */
+}LCD_ChartStatsTypeDef;
+
+/**
+  * @brief  扫描式曲线：光标从左到右逐列绘制，到右边后回到左边覆盖旧数据
+  */
+typedef struct
+{
+  LCD_RingTypeDef Ring;
+  uint32_t Layer;
+  uint16_t X, Y;                /* 绘图区左上角 */
+  uint16_t Width, Height;       /* 绘图区大小 */
+  int16_t  Min, Max;            /* 纵轴范围 */
+  uint32_t SamplesPerColumn;    /* 每列抽取的采样数 */
+  uint32_t LineColor;
+  uint32_t BackColor;
+
+  /* 抽取状态 */
+  uint32_t Count;               /* 当前列已累计的采样数 */
+  int16_t  ColumnMin;
+  int16_t  ColumnMax;
+  int16_t  Last;                /* 上一个采样，用于连接相邻两列 */
+  uint8_t  HasLast;
+  uint16_t Cursor;              /* 下一列的位置 */
+
+  /* 待绘制的列，像素坐标 */
+  uint32_t BatchCount;
+  uint16_t BatchTop[LCD_CHART_BATCH];
+  uint16_t BatchBottom[LCD_CHART_BATCH];
+
+  LCD_ChartStatsTypeDef Stats;
+}LCD_ChartTypeDef;
+
+HAL_StatusTypeDef LCD_Chart_Init(LCD_ChartTypeDef *pChart, int16_t *pBuffer, uint32_t Size, uint32_t LayerIndex,
+                                 uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height);
+void LCD_Chart_SetRange(LCD_ChartTypeDef *pChart, int16_t Min, int16_t Max, uint32_t SamplesPerColumn);
+void LCD_Chart_SetColors(LCD_ChartTypeDef *pChart, uint32_t LineColor, uint32_t BackColor);
+uint32_t LCD_Chart_Push(LCD_ChartTypeDef *pChart, int16_t Sample);
+void LCD_Chart_Update(LCD_ChartTypeDef *pChart);
+void LCD_Chart_GetStats(const LCD_ChartTypeDef *pChart, LCD_ChartStatsTypeDef *pStats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __LCD_CHART_H__ */
@@ -0,0 +1,53 @@
+#ifndef __LCD_DIRTY_H__
+#define __LCD_DIRTY_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+/* 每个列表最多保存的矩形个数，超出后合并浪费面积最小的一对 */
+#ifndef LCD_DIRTY_MAX_RECTS
+#define LCD_DIRTY_MAX_RECTS     ((uint32_t)16)
+#endif
+
+/* 合并两个矩形时允许多覆盖的像素数 */
+#ifndef LCD_DIRTY_MERGE_SLACK
+#define LCD_DIRTY_MERGE_SLACK   ((uint32_t)1024)
+#endif
+
+/**
+  * @brief  矩形区域，X1/Y1不包含在区域内
+  */
+typedef struct
+{
+  uint16_t X0;
+  uint16_t Y0;
+  uint16_t X1;
+  uint16_t Y1;
+}LCD_RectTypeDef;
+
+/**
+  * @brief  脏矩形列表，添加时自动合并，矩形之间互不重叠
+  */
+typedef struct
+{
+  uint32_t        Count;
+  LCD_RectTypeDef Rect[LCD_DIRTY_MAX_RECTS];
+}LCD_DirtyListTypeDef;
+
+void     LCD_Dirty_Clear(LCD_DirtyListTypeDef *pList);
+void     LCD_Dirty_Add(LCD_DirtyListTypeDef *pList, uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height);
+void     LCD_Dirty_AddRect(LCD_DirtyListTypeDef *pList, const LCD_RectTypeDef *pRect);
+void     LCD_Dirty_Merge(LCD_DirtyListTypeDef *pDst, const LCD_DirtyListTypeDef *pSrc);
+uint32_t LCD_Dirty_Area(const LCD_DirtyListTypeDef *pList);
+uint32_t LCD_Rect_Area(const LCD_RectTypeDef *pRect);
+uint32_t LCD_Rect_Intersect(const LCD_RectTypeDef *pA, const LCD_RectTypeDef *pB, LCD_RectTypeDef *pOut);
+void     LCD_Rect_Union(const LCD_RectTypeDef *pA, const LCD_RectTypeDef *pB, LCD_RectTypeDef *pOut);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __LCD_DIRTY_H__ */
@@ -7,6 +7,8 @@ extern "C" {
 
 #include "main.h"
 #include "stm32f7xx.h"
+#include "lcd_dirty.h"
+#include "lcd_font.h"
 
 #define ABS(X)  ((X) > 0 ? (X) : -(X))
 /* LCD 层像素格式*/
@@ -15,12 +17,15 @@ extern "C" {
 #define RGB565 		LTDC_PIXEL_FORMAT_RGB565    /*!< RGB565 LTDC像素格式   */
 #define ARGB1555 	LTDC_PIXEL_FORMAT_ARGB1555  /*!< ARGB1555 LTDC像素格式 */
 #define ARGB4444 	LTDC_PIXEL_FORMAT_ARGB4444  /*!< ARGB4444 LTDC像素格式 */
+#define L8 		LTDC_PIXEL_FORMAT_L8        /*!< L8 LTDC像素格式，8位调色板索引 */
+#define AL44 		LTDC_PIXEL_FORMAT_AL44      /*!< AL44 LTDC像素格式，4位透明度+4位索引 */
+#define AL88 		LTDC_PIXEL_FORMAT_AL88      /*!< AL88 LTDC像素格式 */
 
 typedef struct 
 { 
   uint32_t TextColor; 
   uint32_t BackColor;  
-  // sFONT    *pFont;
+  sFONT    *pFont;
 }LCD_DrawPropTypeDef;   
    
 typedef struct 
@@ -39,10 +44,57 @@ typedef enum
   LEFT_MODE               = 0x03     /* 左对齐   */
 }Text_AlignModeTypdef;
 
+/**
+  * @brief  帧时间统计，单位ms
+  */
+typedef struct
+{
+  uint32_t Frames;         /* 已显示的帧数 */
+  uint32_t LastFrameTime;  /* 最近一帧的时间 */
+  uint32_t MinFrameTime;   /* 最短帧时间 */
+  uint32_t MaxFrameTime;   /* 最长帧时间 */
+  uint32_t AvgFrameTime;   /* 平均帧时间 */
+  uint32_t VSyncWaits;     /* 等待垂直消隐的次数 */
+}LCD_FrameStatsTypeDef;
+
+/**
+  * @brief  脏区域统计，单位像素
+  */
+typedef struct
+{
+  uint32_t Frames;           /* 已交换的帧数 */
+  uint32_t LastDirtyPixels;  /* 最近一帧绘制的像素 */
+  uint32_t LastCopiedPixels; /* 最近一次交换时复制到新后台缓冲区的像素 */
+  uint32_t LastSavedPixels;  /* 最近一次交换比整屏复制少搬运的像素 */
+  uint32_t TotalSavedPixels; /* 累计少搬运的像素 */
+}LCD_DirtyStatsTypeDef;
+
 #define MAX_LAYER_NUMBER       ((uint32_t)2)
 
+/* 直线、圆等图元中像素数不少于该值的段交给DMA2D填充，更短的段由CPU直接写 */
+#ifndef LCD_SPAN_DMA2D_MIN
+#define LCD_SPAN_DMA2D_MIN         ((uint32_t)64)
+#endif
+
+/* L8/AL44层颜色到调色板索引的缓存项数，2的幂且不超过32 */
+#ifndef LCD_PALETTE_CACHE_SIZE
+#define LCD_PALETTE_CACHE_SIZE     ((uint32_t)32)
+#endif
+
+/* 交换链最多缓冲区个数(三缓冲) */
+#define LCD_SWAPCHAIN_MAX_BUFFERS  ((uint32_t)3)
+
+/* FMC SDRAM Bank2 地址范围，32MB */
+#define LCD_SDRAM_START_ADDRESS    ((uint32_t)0xD0000000)
+#define LCD_SDRAM_END_ADDRESS      ((uint32_t)0xD2000000)
+
 #define LTDC_ACTIVE_LAYER	     ((uint32_t)1) /* Layer 1 */
 
+#define LCD_DEFAULT_FONT        Font16
+
+/* 第x行文字的Y坐标 */
+#define LINE(x) ((x) * (((sFONT *)LCD_GetFont())->Height))
+
 
 #define LCD_COLOR_BLUE          ((uint32_t)0xFF0000FF)
 #define LCD_COLOR_GREEN         ((uint32_t)0xFF00FF00)
@@ -69,21 +121,61 @@ typedef enum
 #define LCD_COLOR_BLACK         ((uint32_t)0xFF000000)
 #define LCD_COLOR_BROWN         ((uint32_t)0xFFA52A2A)
 #define LCD_COLOR_ORANGE        ((uint32_t)0xFFFFA500)
-#define LCD_COLOR_TRANSPARENT   ((uint32_t)0xFF000000)
+#define LCD_COLOR_TRANSPARENT   ((uint32_t)0x00000000)
 
 uint32_t LCD_GetXSize(void);
 uint32_t LCD_GetYSize(void);
 void LCD_SelectLayer(uint32_t LayerIndex);
 void LCD_DisplayOn(void);
 void LCD_DisplayOff(void);
+uint32_t LCD_ReadPixel(uint16_t Xpos, uint16_t Ypos);
 void LCD_DrawPixel(uint16_t Xpos, uint16_t Ypos, uint32_t RGB_Code);
 void LCD_Clear(uint32_t Color);
 void LCD_DrawHLine(uint16_t Xpos, uint16_t Ypos, uint16_t Length);
 void LCD_DrawVLine(uint16_t Xpos, uint16_t Ypos, uint16_t Length);
 void LCD_DrawLine(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2);
 void LCD_SetColors(uint32_t TextColor, uint32_t BackColor);
+void LCD_SetTextColor(uint32_t Color);
+uint32_t LCD_GetTextColor(void);
+void LCD_SetBackColor(uint32_t Color);
+uint32_t LCD_GetBackColor(void);
 void LCD_FillRect(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height);
 void LCD_DrawCircle(uint16_t Xpos, uint16_t Ypos, uint16_t Radius);
+void LCD_FillCircle(uint16_t Xpos, uint16_t Ypos, uint16_t Radius);
+void LCD_DrawRoundRect(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height, uint16_t Radius);
+void LCD_FillRoundRect(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height, uint16_t Radius);
+void LCD_DrawPolyline(const Point *Points, uint16_t PointCount);
+void LCD_DrawPolygon(const Point *Points, uint16_t PointCount);
+void LCD_SetFont(sFONT *fonts);
+sFONT *LCD_GetFont(void);
+void LCD_DisplayChar(uint16_t Xpos, uint16_t Ypos, uint32_t Char);
+void LCD_DisplayStringAt(uint16_t Xpos, uint16_t Ypos, const uint8_t *Text, Text_AlignModeTypdef Mode);
+void LCD_DisplayStringAtLine(uint16_t Line, const uint8_t *ptr);
+void LCD_LayerInit(uint16_t LayerIndex, uint32_t FB_Address,uint32_t PixelFormat);
+void LCD_LayerInitSize(uint16_t LayerIndex, uint32_t FB_Address, uint32_t PixelFormat, uint16_t Width, uint16_t Height);
+void LCD_SetLayerAddress(uint32_t LayerIndex, uint32_t Address);
+void LCD_SetLayerVisible(uint32_t LayerIndex, FunctionalState State);
+void LCD_SetTransparency(uint32_t LayerIndex, uint8_t Transparency);
+void LCD_SetLayerWindow(uint16_t LayerIndex, uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height);
+HAL_StatusTypeDef LCD_SetPalette(uint32_t LayerIndex, const uint32_t *pCLUT, uint32_t Count);
+void LCD_SetBlitPalette(const uint32_t *pCLUT, uint32_t Count);
+HAL_StatusTypeDef LCD_SwapChainInit(uint32_t LayerIndex, uint32_t BaseAddress, uint32_t BufferCount);
+uint32_t LCD_GetDrawAddress(uint32_t LayerIndex);
+uint32_t LCD_GetActiveLayer(void);
+uint32_t LCD_GetStride(uint32_t LayerIndex);
+uint32_t LCD_GetPixelAddress(uint32_t LayerIndex, uint16_t Xpos, uint16_t Ypos);
+void LCD_BlendSpan(uint16_t Xpos, uint16_t Ypos, const uint8_t *pAlpha, uint16_t Length, uint32_t Color);
+uint32_t LCD_BlitImage(const void *pSrc, uint32_t SrcFormat, uint32_t SrcStride,
+                       int16_t Xpos, int16_t Ypos, uint16_t Width, uint16_t Height);
+void LCD_SwapBuffers(void);
+void LCD_WaitVSync(uint32_t LayerIndex);
+void LCD_GetFrameStats(LCD_FrameStatsTypeDef *pStats);
+void LCD_ResetFrameStats(void);
+const LCD_DirtyListTypeDef *LCD_GetDirtyList(uint32_t LayerIndex);
+void LCD_ClearDirty(uint32_t LayerIndex);
+void LCD_InvalidateRect(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height);
+void LCD_GetDirtyStats(LCD_DirtyStatsTypeDef *pStats);
+void LCD_ResetDirtyStats(void);
 #ifdef __cplusplus
 }
 #endif
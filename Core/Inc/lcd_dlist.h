@@ -0,0 +1,55 @@
+#ifndef __LCD_DLIST_H__
+#define __LCD_DLIST_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "main.h"
+#include "lcd_display.h"
+
+/**
+  * @brief  显示列表，按顺序保存绘图命令，之后可以反复重放
+  * @note   命令以32位字保存在调用者提供的缓冲区中，记录时合并相邻的同色填充和
+  *         首尾相接的共线线段，并省去没有变化的颜色设置
+  */
+typedef struct
+{
+  uint32_t        *pBuffer;      /* 命令缓冲区 */
+  uint32_t        Size;          /* 缓冲区字数 */
+  uint32_t        Used;          /* 已使用字数 */
+  uint32_t        Last;          /* 最后一条命令的位置，合并时使用 */
+  uint32_t        TextColor;     /* 记录到当前位置时的文字颜色 */
+  uint32_t        BackColor;     /* 记录到当前位置时的背景颜色 */
+  sFONT           *pFont;        /* 记录到当前位置时的字体，用于计算文字的范围 */
+  uint8_t         ColorsValid;   /* 已记录过颜色设置 */
+  uint8_t         Overflow;      /* 缓冲区已满，之后的命令被丢弃 */
+  uint32_t        Recorded;      /* 调用记录函数的次数 */
+  uint32_t        Merged;        /* 被合并或省去的命令数 */
+  LCD_RectTypeDef Bounds;        /* 所有命令的外接矩形 */
+  uint32_t        CacheAddress;  /* 预光栅化图像地址，0表示没有缓存 */
+  uint32_t        CacheFormat;   /* 预光栅化图像的像素格式 */
+}LCD_DisplayListTypeDef;
+
+void LCD_DL_Init(LCD_DisplayListTypeDef *pList, uint32_t *pBuffer, uint32_t Size);
+void LCD_DL_Reset(LCD_DisplayListTypeDef *pList);
+HAL_StatusTypeDef LCD_DL_SetColors(LCD_DisplayListTypeDef *pList, uint32_t TextColor, uint32_t BackColor);
+HAL_StatusTypeDef LCD_DL_SetTextColor(LCD_DisplayListTypeDef *pList, uint32_t Color);
+HAL_StatusTypeDef LCD_DL_SetFont(LCD_DisplayListTypeDef *pList, sFONT *fonts);
+HAL_StatusTypeDef LCD_DL_Clear(LCD_DisplayListTypeDef *pList, uint32_t Color);
+HAL_StatusTypeDef LCD_DL_FillRect(LCD_DisplayListTypeDef *pList, uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height);
+HAL_StatusTypeDef LCD_DL_DrawHLine(LCD_DisplayListTypeDef *pList, uint16_t Xpos, uint16_t Ypos, uint16_t Length);
+HAL_StatusTypeDef LCD_DL_DrawVLine(LCD_DisplayListTypeDef *pList, uint16_t Xpos, uint16_t Ypos, uint16_t Length);
+HAL_StatusTypeDef LCD_DL_DrawLine(LCD_DisplayListTypeDef *pList, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2);
+HAL_StatusTypeDef LCD_DL_DrawCircle(LCD_DisplayListTypeDef *pList, uint16_t Xpos, uint16_t Ypos, uint16_t Radius);
+HAL_StatusTypeDef LCD_DL_FillCircle(LCD_DisplayListTypeDef *pList, uint16_t Xpos, uint16_t Ypos, uint16_t Radius);
+HAL_StatusTypeDef LCD_DL_DisplayStringAt(LCD_DisplayListTypeDef *pList, uint16_t Xpos, uint16_t Ypos, const uint8_t *Text, Text_AlignModeTypdef Mode);
+void LCD_DL_Replay(const LCD_DisplayListTypeDef *pList);
+HAL_StatusTypeDef LCD_DL_Cache(LCD_DisplayListTypeDef *pList, uint32_t Address);
+void LCD_DL_DropCache(LCD_DisplayListTypeDef *pList);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __LCD_DLIST_H__ */
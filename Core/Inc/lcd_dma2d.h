@@ -0,0 +1,70 @@
+#ifndef __LCD_DMA2D_H__
+#define __LCD_DMA2D_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "main.h"
+
+/* 命令队列深度，必须为2的幂 */
+#ifndef LCD_DMA2D_QUEUE_SIZE
+#define LCD_DMA2D_QUEUE_SIZE   ((uint32_t)32)
+#endif
+
+/* 命令模式：把CLUT从存储器加载到DMA2D前景层，FgAddress为CLUT地址，Width为项数 */
+#define LCD_DMA2D_CLUT_LOAD    ((uint32_t)0xFFFFFFFF)
+
+/**
+  * @brief  DMA2D 命令，提交后由传输完成中断按顺序执行
+  */
+typedef struct
+{
+  uint32_t Mode;          /* DMA2D_R2M / DMA2D_M2M / DMA2D_M2M_PFC / DMA2D_M2M_BLEND / LCD_DMA2D_CLUT_LOAD */
+  uint32_t OutColorMode;  /* 输出颜色格式 DMA2D_OUTPUT_xxx */
+  uint32_t OutOffset;     /* 输出行偏移(像素) */
+  uint32_t DstAddress;    /* 目标地址 */
+  uint32_t FgAddress;     /* 前景层地址，R2M模式下为ARGB8888填充颜色 */
+  uint32_t FgColorMode;   /* 前景层颜色格式 DMA2D_INPUT_xxx */
+  uint32_t FgOffset;      /* 前景层行偏移 */
+  uint32_t FgAlphaMode;   /* 前景层透明度模式 */
+  uint32_t FgAlpha;       /* 前景层透明度，A8/A4格式时为RGB颜色 */
+  uint32_t BgAddress;     /* 背景层地址，仅混合模式使用 */
+  uint32_t BgColorMode;   /* 背景层颜色格式 */
+  uint32_t BgOffset;      /* 背景层行偏移 */
+  uint32_t BgAlphaMode;   /* 背景层透明度模式 */
+  uint32_t BgAlpha;       /* 背景层透明度 */
+  uint16_t Width;         /* 每行像素个数 */
+  uint16_t Height;        /* 行数 */
+}LCD_DMA2D_CmdTypeDef;
+
+/**
+  * @brief  命令队列统计
+  */
+typedef struct
+{
+  uint32_t Submitted;     /* 已提交命令数 */
+  uint32_t Completed;     /* 已完成命令数 */
+  uint32_t Errors;        /* 传输或配置错误次数 */
+  uint32_t FullStalls;    /* 队列满时提交者等待的次数 */
+  uint32_t MaxDepth;      /* 队列最大深度 */
+}LCD_DMA2D_StatsTypeDef;
+
+void     LCD_DMA2D_Init(void);
+uint32_t LCD_DMA2D_Submit(const LCD_DMA2D_CmdTypeDef *pCmd);
+uint32_t LCD_DMA2D_Fill(uint32_t DstAddress, uint32_t Width, uint32_t Height, uint32_t OffLine, uint32_t ColorMode, uint32_t Color);
+uint32_t LCD_DMA2D_LoadCLUT(const uint32_t *pCLUT, uint32_t Count);
+uint32_t LCD_DMA2D_Address(const volatile void *pBuffer);
+uint32_t LCD_DMA2D_Fence(void);
+uint32_t LCD_DMA2D_IsDone(uint32_t Fence);
+void     LCD_DMA2D_Wait(uint32_t Fence);
+void     LCD_DMA2D_Flush(void);
+void     LCD_DMA2D_GetStats(LCD_DMA2D_StatsTypeDef *pStats);
+void     LCD_DMA2D_ResetStats(void);
+void     LCD_DMA2D_Complete(uint32_t Error);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __LCD_DMA2D_H__ */
@@ -0,0 +1,112 @@
+#ifndef __LCD_FONT_H__
+#define __LCD_FONT_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "main.h"
+
+/* 字模缓存位于SDRAM末尾，字模首次使用时展开为A8格式存放，供DMA2D直接读取 */
+#ifndef LCD_FONT_CACHE_ADDRESS
+#define LCD_FONT_CACHE_ADDRESS   ((uint32_t)0xD1F00000)
+#endif
+#ifndef LCD_FONT_CACHE_SIZE
+#define LCD_FONT_CACHE_SIZE      ((uint32_t)0x00100000)
+#endif
+
+/* 缓存按块分配，不超过一块的字模(默认24×24像素)占用一块，空间用尽时淘汰最久未使用的字模 */
+#ifndef LCD_FONT_CACHE_SLOT
+#define LCD_FONT_CACHE_SLOT      ((uint32_t)576)
+#endif
+
+/* 缓存末尾留给大于一块的字模的临时区，分两半交替使用，每次绘制都重新展开 */
+#ifndef LCD_FONT_CACHE_LARGE
+#define LCD_FONT_CACHE_LARGE     ((uint32_t)16384)
+#endif
+
+/* 散列表桶数，必须为2的幂 */
+#ifndef LCD_FONT_CACHE_BUCKETS
+#define LCD_FONT_CACHE_BUCKETS   ((uint32_t)1024)
+#endif
+
+#define LCD_FONT_CACHE_SLOTS     ((LCD_FONT_CACHE_SIZE - LCD_FONT_CACHE_LARGE) / LCD_FONT_CACHE_SLOT)
+
+/* 字模点阵的存储方式 */
+#define LCD_FONT_RAW             ((uint8_t)0)   /* 每行按字节对齐的A4/A8点阵 */
+#define LCD_FONT_RLE             ((uint8_t)1)   /* 与上一行的差值按游程压缩，见LCD_Font_Decode */
+
+/**
+  * @brief  单个字符的字模信息
+  */
+typedef struct
+{
+  uint32_t Offset;    /* 字模在点阵表中的字节偏移 */
+  uint8_t  Width;     /* 字模宽度(像素)，空白字符为0 */
+  uint8_t  Height;    /* 字模高度(像素) */
+  int8_t   XOffset;   /* 字模左边相对于笔位置的偏移 */
+  int8_t   YOffset;   /* 字模上边相对于行顶部的偏移 */
+  uint8_t  Advance;   /* 绘制后笔位置前进的像素数 */
+}LCD_GlyphTypeDef;
+
+/**
+  * @brief  字距调整对
+  */
+typedef struct
+{
+  uint16_t Left;      /* 左边字符的编码 */
+  uint16_t Right;     /* 右边字符的编码 */
+  int16_t  Adjust;    /* 两字符之间加上的像素数，通常为负 */
+}LCD_KernTypeDef;
+
+/**
+  * @brief  抗锯齿点阵字体，A4格式每行按字节对齐，高4位为左边的像素
+  * @note   Encoding之后的成员可以省略：省略时为连续编码、未压缩、没有字距调整的字体
+  */
+typedef struct _tFont
+{
+  const uint8_t          *table;      /* 字模点阵 */
+  uint16_t               Width;       /* 最大字符宽度，等宽字体即字符宽度 */
+  uint16_t               Height;      /* 行高 */
+  const LCD_GlyphTypeDef *Glyphs;     /* 字模信息，按字符编码排列 */
+  uint16_t               Ascent;      /* 行顶部到基线的距离 */
+  uint16_t               FirstChar;   /* 第一个字符的编码，Codes不为NULL时不使用 */
+  uint16_t               GlyphCount;  /* 字符个数 */
+  uint8_t                Bpp;         /* 每像素位数，4或8 */
+  uint8_t                Encoding;    /* LCD_FONT_RAW / LCD_FONT_RLE */
+  const uint16_t         *Codes;      /* 升序排列的字符编码，与Glyphs一一对应，NULL表示从FirstChar开始连续 */
+  const LCD_KernTypeDef  *Kerning;    /* 按(Left, Right)升序排列的字距调整表，可以为NULL */
+  uint16_t               KernCount;   /* 字距调整对个数 */
+}sFONT;
+
+/**
+  * @brief  字模缓存统计
+  */
+typedef struct
+{
+  uint32_t Hits;       /* 命中次数 */
+  uint32_t Misses;     /* 未命中，需要展开字模的次数 */
+  uint32_t Evictions;  /* 淘汰最久未使用字模的次数 */
+  uint32_t Large;      /* 大于一块、在临时区展开的次数 */
+  uint32_t BytesUsed;  /* 当前缓存的字模字节数 */
+  uint32_t HitRate;    /* 命中率(千分比)，读取统计时计算 */
+}LCD_FontCacheStatsTypeDef;
+
+extern sFONT Font16;
+extern sFONT Font24;
+
+const LCD_GlyphTypeDef *LCD_Font_GetGlyph(const sFONT *pFont, uint32_t Char);
+uint32_t LCD_Font_GetGlyphA8(const sFONT *pFont, uint32_t Char);
+int32_t  LCD_Font_GetKerning(const sFONT *pFont, uint32_t Left, uint32_t Right);
+uint32_t LCD_Font_DecodeUTF8(const uint8_t **pText);
+void     LCD_Font_Decode(const sFONT *pFont, const LCD_GlyphTypeDef *pGlyph, uint8_t *pDst);
+uint32_t LCD_Font_GetStringWidth(const sFONT *pFont, const uint8_t *Text);
+void     LCD_Font_CacheFlush(void);
+void     LCD_Font_GetCacheStats(LCD_FontCacheStatsTypeDef *pStats);
+void     LCD_Font_ResetCacheStats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __LCD_FONT_H__ */
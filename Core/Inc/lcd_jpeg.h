@@ -0,0 +1,135 @@
+#ifndef __LCD_JPEG_H__
+#define __LCD_JPEG_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "main.h"
+
+/* 输入缓冲区大小(字节)，两块交替使用，必须为4的倍数 */
+#ifndef LCD_JPEG_IN_CHUNK
+#define LCD_JPEG_IN_CHUNK        ((uint32_t)4096)
+#endif
+
+/* 输出缓冲区大小(字节)，两块交替使用，必须为768(各种MCU大小的公倍数)的倍数 */
+#ifndef LCD_JPEG_OUT_CHUNK
+#define LCD_JPEG_OUT_CHUNK       ((uint32_t)768 * 4)
+#endif
+
+/* 一次显示的最大宽度(像素)，超出的部分不转换，不小于层的宽度即可 */
+#ifndef LCD_JPEG_MAX_WIDTH
+#define LCD_JPEG_MAX_WIDTH       ((uint32_t)800)
+#endif
+
+/* 两条ARGB8888行带缓冲区位于SDRAM中字模缓存之前，每条为一行MCU(最多16行像素) */
+#ifndef LCD_JPEG_STRIP_ADDRESS
+#define LCD_JPEG_STRIP_ADDRESS   ((uint32_t)0xD1E00000)
+#endif
+
+/* 解码器无进展超过该时间(ms)时中止 */
+#ifndef LCD_JPEG_TIMEOUT
+#define LCD_JPEG_TIMEOUT         ((uint32_t)1000)
+#endif
+
+/* 未调用LCD_JPEG_SetCodec时使用的解码器，主机上编译时定义为LCD_JPEG_SoftCodec */
+#ifndef LCD_JPEG_CODEC_DEFAULT
+#define LCD_JPEG_CODEC_DEFAULT   LCD_JPEG_HardwareCodec
+#endif
+
+/* 颜色空间，取值与JPEG_ConfTypeDef无关 */
+#define LCD_JPEG_GRAYSCALE       ((uint32_t)0)
+#define LCD_JPEG_YCBCR           ((uint32_t)1)
+#define LCD_JPEG_CMYK            ((uint32_t)2)
+
+/* 色度抽样 */
+#define LCD_JPEG_444             ((uint32_t)0)
+#define LCD_JPEG_422             ((uint32_t)1)
+#define LCD_JPEG_420             ((uint32_t)2)
+
+/* 暂停/恢复的方向，与JPEG_PAUSE_RESUME_xxx相同 */
+#define LCD_JPEG_INPUT           ((uint32_t)1)
+#define LCD_JPEG_OUTPUT          ((uint32_t)2)
+
+/**
+  * @brief  图像信息，解码器解析完文件头后给出
+  */
+typedef struct
+{
+  uint32_t Width;               /* 图像宽度(像素) */
+  uint32_t Height;              /* 图像高度(像素) */
+  uint32_t ColorSpace;          /* LCD_JPEG_GRAYSCALE/LCD_JPEG_YCBCR/LCD_JPEG_CMYK */
+  uint32_t ChromaSubsampling;   /* LCD_JPEG_444/LCD_JPEG_422/LCD_JPEG_420 */
+}LCD_JPEG_InfoTypeDef;
+
+/**
+  * @brief  JPEG解码器，输出按MCU排列的YCbCr/灰度/CMYK数据
+  * @note   解码器在需要输入时调用LCD_JPEG_GetData，输出缓冲区写满或解码结束时调用
+  *         LCD_JPEG_DataReady，解析完文件头调用LCD_JPEG_InfoReady，结束时调用LCD_JPEG_DecodeDone。
+  *         这些回调中调用Input/Output给出下一块缓冲区，来不及准备时调用Pause
+  */
+typedef struct
+{
+  const char *Name;
+
+  void     (*Init)(void);                                      /* 初始化，在LCD_JPEG_Init中调用 */
+  HAL_StatusTypeDef (*Start)(uint8_t *pIn, uint32_t InLength,
+                             uint8_t *pOut, uint32_t OutLength);  /* 以中断方式开始解码 */
+  void     (*Input)(uint8_t *pIn, uint32_t Length);            /* 设置下一块输入，长度为0表示没有更多数据 */
+  void     (*Output)(uint8_t *pOut, uint32_t Length);          /* 设置下一块输出缓冲区 */
+  void     (*Pause)(uint32_t Direction);                       /* 暂停输入或输出 */
+  void     (*Resume)(uint32_t Direction);                      /* 恢复输入或输出 */
+  void     (*Abort)(void);                                     /* 中止解码 */
+  void     (*Idle)(void);                                      /* 在等待循环中调用 */
+}LCD_JPEG_CodecTypeDef;
+
+/**
+  * @brief  读取JPEG文件数据
+  * @param  pArg: LCD_JPEG_Draw传入的参数
+  * @param  pBuffer: 输出缓冲区
+  * @param  Size: 最多读取的字节数
+  * @retval 实际读取的字节数，0表示文件结束
+  */
+typedef uint32_t (*LCD_JPEG_ReadTypeDef)(void *pArg, uint8_t *pBuffer, uint32_t Size);
+
+/**
+  * @brief  JPEG解码统计
+  */
+typedef struct
+{
+  uint32_t Images;          /* 完成的图像数 */
+  uint32_t Errors;          /* 解码错误或超时次数 */
+  uint32_t InputBytes;      /* 送入解码器的字节数 */
+  uint32_t InputChunks;     /* 读取的输入块数 */
+  uint32_t OutputChunks;    /* 解码器交出的输出块数 */
+  uint32_t Mcus;            /* 转换的MCU数 */
+  uint32_t McusSkipped;     /* 完全在层外、没有转换的MCU数 */
+  uint32_t Strips;          /* 提交给DMA2D的行带数 */
+  uint32_t InputStalls;     /* 输入缓冲区未准备好、解码器暂停输入的次数 */
+  uint32_t OutputStalls;    /* 输出缓冲区未转换完、解码器暂停输出的次数 */
+}LCD_JPEG_StatsTypeDef;
+
+extern const LCD_JPEG_CodecTypeDef LCD_JPEG_CODEC_DEFAULT;
+
+void LCD_JPEG_Init(void);
+void LCD_JPEG_SetCodec(const LCD_JPEG_CodecTypeDef *pCodec);
+HAL_StatusTypeDef LCD_JPEG_Draw(int16_t Xpos, int16_t Ypos, LCD_JPEG_ReadTypeDef Read, void *pArg,
+                                LCD_JPEG_InfoTypeDef *pInfo);
+HAL_StatusTypeDef LCD_JPEG_DrawMemory(int16_t Xpos, int16_t Ypos, const uint8_t *pData, uint32_t Size,
+                                      LCD_JPEG_InfoTypeDef *pInfo);
+void LCD_JPEG_ConvertMCU(const LCD_JPEG_InfoTypeDef *pInfo, const uint8_t *pMcu, uint32_t *pDst,
+                         uint32_t Stride, uint32_t Width, uint32_t Height);
+void LCD_JPEG_GetStats(LCD_JPEG_StatsTypeDef *pStats);
+void LCD_JPEG_ResetStats(void);
+
+/* 解码器回调，在中断中调用 */
+void LCD_JPEG_InfoReady(const LCD_JPEG_InfoTypeDef *pInfo);
+void LCD_JPEG_GetData(uint32_t Consumed);
+void LCD_JPEG_DataReady(uint8_t *pData, uint32_t Length);
+void LCD_JPEG_DecodeDone(uint32_t Error);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __LCD_JPEG_H__ */
@@ -0,0 +1,126 @@
+#ifndef __LCD_PROF_H__
+#define __LCD_PROF_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "main.h"
+
+/* 置1打开绘图性能计数，为0时所有计数宏展开为空，不占用代码和时间 */
+#ifndef LCD_PROFILE
+#define LCD_PROFILE                0
+#endif
+
+/* 每隔多少帧通过USART1(printf)输出一次最近一帧的统计，0表示不输出 */
+#ifndef LCD_PROF_REPORT_PERIOD
+#define LCD_PROF_REPORT_PERIOD     ((uint32_t)60)
+#endif
+
+/**
+  * @brief  计数的绘图函数
+  */
+typedef enum
+{
+  LCD_PROF_CLEAR = 0,
+  LCD_PROF_PIXEL,
+  LCD_PROF_HLINE,
+  LCD_PROF_VLINE,
+  LCD_PROF_LINE,
+  LCD_PROF_FILL_RECT,
+  LCD_PROF_CIRCLE,
+  LCD_PROF_FILL_CIRCLE,
+  LCD_PROF_ROUND_RECT,
+  LCD_PROF_FILL_ROUND_RECT,
+  LCD_PROF_POLYLINE,
+  LCD_PROF_POLYGON,
+  LCD_PROF_CHAR,
+  LCD_PROF_STRING,
+  LCD_PROF_BLEND_SPAN,
+  LCD_PROF_BLIT,
+  LCD_PROF_SWAP,
+  LCD_PROF_LINE_AA,
+  LCD_PROF_ARC_AA,
+  LCD_PROF_CIRCLE_AA,
+  LCD_PROF_POLYGON_AA,
+  LCD_PROF_SPRITE,
+  LCD_PROF_DLIST,
+  LCD_PROF_TILE,
+  LCD_PROF_SCAN,
+  LCD_PROF_WINDOW,
+  LCD_PROF_CANVAS,
+  LCD_PROF_CHART,
+  LCD_PROF_JPEG,
+  LCD_PROF_COUNT
+}LCD_ProfIdTypeDef;
+
+/**
+  * @brief  一个绘图函数的计数，时间单位为LCD_Prof_Now的计数值
+  * @note   调用次数包括嵌套调用(如LCD_DisplayStringAt内部的每个字符)；耗时和像素只计入最外层的函数，
+  *         嵌套调用的耗时为0，各项耗时之和即为绘图总耗时
+  */
+typedef struct
+{
+  uint32_t Calls;    /* 调用次数，包括嵌套调用 */
+  uint32_t Pixels;   /* 由DMA2D或CPU写入的像素，只计入最外层 */
+  uint32_t Ticks;    /* 耗时，包括等待DMA2D的时间，只计入最外层 */
+}LCD_ProfCounterTypeDef;
+
+/**
+  * @brief  一帧的统计
+  */
+typedef struct
+{
+  uint32_t               Frame;        /* 帧序号 */
+  uint32_t               FrameTicks;   /* 帧时间 */
+  uint32_t               Dma2dBusy;    /* DMA2D执行命令的时间 */
+  uint32_t               Dma2dStall;   /* CPU等待DMA2D命令完成的时间 */
+  uint32_t               VSyncStall;   /* CPU等待垂直消隐或重载生效的时间 */
+  LCD_ProfCounterTypeDef Counter[LCD_PROF_COUNT];
+}LCD_ProfFrameTypeDef;
+
+#if LCD_PROFILE
+
+#define LCD_PROF_INIT()             LCD_Prof_Init()
+#define LCD_PROF_BEGIN(Id)          LCD_Prof_Begin(Id)
+#define LCD_PROF_END()              LCD_Prof_End()
+#define LCD_PROF_PIXELS(Count)      LCD_Prof_Pixels(Count)
+#define LCD_PROF_DMA2D_START()      LCD_Prof_Dma2dStart()
+#define LCD_PROF_DMA2D_DONE()       LCD_Prof_Dma2dDone()
+#define LCD_PROF_STALL_BEGIN()      LCD_Prof_StallBegin()
+#define LCD_PROF_STALL_END(VSync)   LCD_Prof_StallEnd(VSync)
+#define LCD_PROF_FRAME()            LCD_Prof_FrameEnd()
+
+void     LCD_Prof_Init(void);
+uint32_t LCD_Prof_Now(void);
+uint32_t LCD_Prof_TicksPerUs(void);
+void     LCD_Prof_Begin(LCD_ProfIdTypeDef Id);
+void     LCD_Prof_End(void);
+void     LCD_Prof_Pixels(uint32_t Count);
+void     LCD_Prof_Dma2dStart(void);
+void     LCD_Prof_Dma2dDone(void);
+void     LCD_Prof_StallBegin(void);
+void     LCD_Prof_StallEnd(uint32_t VSync);
+void     LCD_Prof_FrameEnd(void);
+void     LCD_Prof_GetLastFrame(LCD_ProfFrameTypeDef *pFrame);
+void     LCD_Prof_Report(const LCD_ProfFrameTypeDef *pFrame);
+
+#else
+
+#define LCD_PROF_INIT()             ((void)0)
+#define LCD_PROF_BEGIN(Id)          ((void)0)
+#define LCD_PROF_END()              ((void)0)
+#define LCD_PROF_PIXELS(Count)      ((void)0)
+#define LCD_PROF_DMA2D_START()      ((void)0)
+#define LCD_PROF_DMA2D_DONE()       ((void)0)
+#define LCD_PROF_STALL_BEGIN()      ((void)0)
+#define LCD_PROF_STALL_END(VSync)   ((void)0)
+#define LCD_PROF_FRAME()            ((void)0)
+
+#endif /* LCD_PROFILE */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __LCD_PROF_H__ */
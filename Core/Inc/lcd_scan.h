@@ -0,0 +1,72 @@
+#ifndef __LCD_SCAN_H__
+#define __LCD_SCAN_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "main.h"
+
+/* 等待扫描线经过的更新请求个数 */
+#ifndef LCD_SCAN_QUEUE_SIZE
+#define LCD_SCAN_QUEUE_SIZE       ((uint32_t)32)
+#endif
+
+/* 大区域按此行数拆成条带，扫描线经过一条就更新一条 */
+#ifndef LCD_SCAN_BAND_ROWS
+#define LCD_SCAN_BAND_ROWS        ((uint32_t)32)
+#endif
+
+/* 一行扫描时间内CPU能从SDRAM复制到SDRAM的像素数，用于估计更新耗时，应按实测值保守设置 */
+#ifndef LCD_SCAN_PIXELS_PER_LINE
+#define LCD_SCAN_PIXELS_PER_LINE  ((uint32_t)1024)
+#endif
+
+/**
+  * @brief  绘制回调，在行中断中被调用，只能修改[Y0, Y1)行
+  * @note   只能由CPU直接写显存：不能调用LCD_*和LCD_DMA2D_*函数，也不能改变当前层、颜色和字体，
+  *         否则会打断主程序正在进行的绘图；DMA2D命令在回调返回后才完成，撕裂检查也无法覆盖
+  */
+typedef void (*LCD_ScanDrawTypeDef)(void *pArg, uint16_t Y0, uint16_t Y1);
+
+/**
+  * @brief  扫描时序，行计数值与LTDC_CPSR的CYPOS和HAL_LTDC_ProgramLineEvent的参数相同
+  * @note   主机上测试时可以用模拟的扫描线时钟代替GetLine和SetLineEvent
+  */
+typedef struct
+{
+  uint16_t ActiveStart;                    /* 第一行有效显示的行计数值 */
+  uint16_t ActiveHeight;                   /* 有效显示的行数 */
+  uint16_t TotalLines;                     /* 每帧总行数，包括同步和消隐 */
+  uint32_t PixelsPerLine;                  /* 一行时间内能更新的像素数 */
+  uint32_t (*GetLine)(void);               /* 读取当前行计数值 */
+  void     (*SetLineEvent)(uint32_t Line); /* 行计数值到达Line时产生一次行中断 */
+}LCD_ScanTimingTypeDef;
+
+/**
+  * @brief  扫描线调度统计
+  */
+typedef struct
+{
+  uint32_t Submitted;       /* 提交的条带数 */
+  uint32_t Dispatched;      /* 已更新的条带数 */
+  uint32_t Events;          /* 行中断次数 */
+  uint32_t Deferred;        /* 扫描线经过后剩余时间不够、推迟到下一帧的条带数 */
+  uint32_t Tears;           /* 更新结束时扫描线已回到该条带，可能出现撕裂的次数 */
+  uint32_t MaxLatency;      /* 从提交到更新的最大行数 */
+}LCD_ScanStatsTypeDef;
+
+HAL_StatusTypeDef LCD_Scan_Init(uint32_t LayerIndex);
+void LCD_Scan_Config(uint32_t LayerIndex, const LCD_ScanTimingTypeDef *pTiming);
+HAL_StatusTypeDef LCD_Scan_Update(uint16_t Ypos, uint16_t Height, uint16_t Width, LCD_ScanDrawTypeDef pDraw, void *pArg);
+HAL_StatusTypeDef LCD_Scan_Copy(const void *pSrc, uint32_t SrcStride, uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height);
+uint32_t LCD_Scan_Pending(void);
+void LCD_Scan_LineEvent(void);
+void LCD_Scan_GetStats(LCD_ScanStatsTypeDef *pStats);
+void LCD_Scan_ResetStats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __LCD_SCAN_H__ */
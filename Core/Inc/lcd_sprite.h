@@ -0,0 +1,46 @@
+#ifndef __LCD_SPRITE_H__
+#define __LCD_SPRITE_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "main.h"
+#include "lcd_dirty.h"
+
+/* 最多同时存在的精灵个数 */
+#ifndef LCD_SPRITE_MAX
+#define LCD_SPRITE_MAX       ((uint32_t)16)
+#endif
+
+/**
+  * @brief  精灵合成统计，单位字节，按DMA2D读写显存/SDRAM的数据量计算
+  */
+typedef struct
+{
+  uint32_t Frames;          /* 已合成的帧数 */
+  uint32_t LastRects;       /* 最近一帧重绘的矩形个数 */
+  uint32_t LastBlends;      /* 最近一帧的混合命令个数 */
+  uint32_t LastBytes;       /* 最近一帧搬运的字节数 */
+  uint32_t LastFullBytes;   /* 最近一帧整屏重绘需要搬运的字节数 */
+  uint32_t TotalBytes;      /* 累计搬运的字节数 */
+}LCD_SpriteStatsTypeDef;
+
+HAL_StatusTypeDef LCD_Sprite_Init(uint32_t LayerIndex, uint32_t Background);
+int32_t  LCD_Sprite_Create(uint32_t Address, uint32_t ColorMode, uint16_t Width, uint16_t Height);
+void     LCD_Sprite_Destroy(int32_t Id);
+void     LCD_Sprite_SetImage(int32_t Id, uint32_t Address);
+void     LCD_Sprite_SetPosition(int32_t Id, int16_t Xpos, int16_t Ypos);
+void     LCD_Sprite_SetZOrder(int32_t Id, uint8_t Z);
+void     LCD_Sprite_SetAlpha(int32_t Id, uint8_t Alpha);
+void     LCD_Sprite_SetVisible(int32_t Id, FunctionalState State);
+void     LCD_Sprite_Invalidate(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height);
+void     LCD_Sprite_Render(void);
+void     LCD_Sprite_GetStats(LCD_SpriteStatsTypeDef *pStats);
+void     LCD_Sprite_ResetStats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __LCD_SPRITE_H__ */
@@ -0,0 +1,68 @@
+#ifndef __LCD_TILE_H__
+#define __LCD_TILE_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "main.h"
+#include "lcd_font.h"
+
+/* 图块大小(像素)，图块缓冲区为ARGB8888格式，位于内部RAM(DTCM) */
+#ifndef LCD_TILE_WIDTH
+#define LCD_TILE_WIDTH       ((uint32_t)64)
+#endif
+#ifndef LCD_TILE_HEIGHT
+#define LCD_TILE_HEIGHT      ((uint32_t)32)
+#endif
+
+/* 支持的最大层尺寸，决定分箱表的大小 */
+#ifndef LCD_TILE_MAX_XSIZE
+#define LCD_TILE_MAX_XSIZE   ((uint32_t)800)
+#endif
+#ifndef LCD_TILE_MAX_YSIZE
+#define LCD_TILE_MAX_YSIZE   ((uint32_t)480)
+#endif
+
+/* 一帧最多记录的图元个数和分箱表项数，用尽时先把已记录的部分绘制出来 */
+#ifndef LCD_TILE_MAX_PRIMS
+#define LCD_TILE_MAX_PRIMS   ((uint32_t)256)
+#endif
+#ifndef LCD_TILE_MAX_BINS
+#define LCD_TILE_MAX_BINS    ((uint32_t)2048)
+#endif
+
+/**
+  * @brief  分块绘制统计，从LCD_Tile_ResetStats开始累计
+  */
+typedef struct
+{
+  uint32_t Frames;          /* 已完成的帧数 */
+  uint32_t Primitives;      /* 记录的图元个数 */
+  uint32_t Flushes;         /* 图元或分箱表用尽，提前绘制的次数 */
+  uint32_t TilesWritten;    /* 写回显存的图块数 */
+  uint32_t TilesLoaded;     /* 需要先从显存读入的图块数 */
+  uint32_t TilesCovered;    /* 被不透明图元完全覆盖、跳过读入和之前图元的图块数 */
+  uint32_t PixelsShaded;    /* 在图块缓冲区中绘制的像素数，含重叠部分 */
+  uint32_t PixelsWritten;   /* 写回显存的像素数，PixelsShaded / PixelsWritten 即重绘倍数 */
+  uint32_t BytesRead;       /* 读显存的字节数 */
+  uint32_t BytesWritten;    /* 写显存的字节数 */
+  uint32_t DirectBytes;     /* 估算：直接在显存中绘制同样的图元需要读写的字节数 */
+}LCD_TileStatsTypeDef;
+
+HAL_StatusTypeDef LCD_Tile_Begin(uint32_t LayerIndex);
+void LCD_Tile_End(void);
+void LCD_Tile_Clear(uint32_t Color);
+void LCD_Tile_FillRect(int16_t Xpos, int16_t Ypos, uint16_t Width, uint16_t Height, uint32_t Color);
+void LCD_Tile_FillCircle(int16_t Xpos, int16_t Ypos, uint16_t Radius, uint32_t Color);
+void LCD_Tile_BlendImage(const uint32_t *pSrc, uint32_t SrcStride, int16_t Xpos, int16_t Ypos,
+                         uint16_t Width, uint16_t Height, uint8_t Alpha);
+void LCD_Tile_DisplayString(int16_t Xpos, int16_t Ypos, const uint8_t *Text, const sFONT *pFont, uint32_t Color);
+void LCD_Tile_GetStats(LCD_TileStatsTypeDef *pStats);
+void LCD_Tile_ResetStats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __LCD_TILE_H__ */
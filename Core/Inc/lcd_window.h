@@ -0,0 +1,38 @@
+#ifndef __LCD_WINDOW_H__
+#define __LCD_WINDOW_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "main.h"
+
+/**
+  * @brief  窗口合成统计
+  */
+typedef struct
+{
+  uint32_t Commits;        /* 提交次数 */
+  uint32_t LayerUpdates;   /* 重新设置层寄存器的次数 */
+  uint32_t ReloadWaits;    /* 提交时上一次重载尚未生效、需要等待的次数 */
+}LCD_WindowStatsTypeDef;
+
+HAL_StatusTypeDef LCD_Window_Create(uint32_t LayerIndex, uint32_t Address, uint32_t PixelFormat, uint16_t Width, uint16_t Height);
+void LCD_Window_SetPosition(uint32_t LayerIndex, int16_t Xpos, int16_t Ypos);
+void LCD_Window_SetSize(uint32_t LayerIndex, uint16_t Width, uint16_t Height);
+void LCD_Window_Scroll(uint32_t LayerIndex, uint16_t Xoffset, uint16_t Yoffset);
+void LCD_Window_SetAlpha(uint32_t LayerIndex, uint8_t Alpha);
+void LCD_Window_SetColorKey(uint32_t LayerIndex, uint32_t RGBValue, FunctionalState State);
+void LCD_Window_SetVisible(uint32_t LayerIndex, FunctionalState State);
+void LCD_Window_SetAddress(uint32_t LayerIndex, uint32_t Address);
+void LCD_Window_Commit(void);
+uint32_t LCD_Window_IsActive(uint32_t LayerIndex);
+void LCD_Window_Update(uint32_t LayerIndex, uint32_t Reload);
+void LCD_Window_Release(uint32_t LayerIndex);
+void LCD_Window_GetStats(LCD_WindowStatsTypeDef *pStats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __LCD_WINDOW_H__ */
@@ -0,0 +1,117 @@
+#ifndef __MEMHEAP_H__
+#define __MEMHEAP_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "main.h"
+
+/* 置1编译TLSF通用分配器，为0时只有区域分配器和固定块内存池 */
+#ifndef MEM_TLSF
+#define MEM_TLSF                   1
+#endif
+
+/* MEM_Heap_Init在SDRAM(.sdram_bss)中保留的字节数，其中MEM_FRAME_ARENA_SIZE给每帧的临时区域，其余给TLSF */
+#ifndef MEM_SDRAM_HEAP_SIZE
+#define MEM_SDRAM_HEAP_SIZE        ((uint32_t)8 * 1024 * 1024)
+#endif
+
+#ifndef MEM_FRAME_ARENA_SIZE
+#define MEM_FRAME_ARENA_SIZE       ((uint32_t)1024 * 1024)
+#endif
+
+/* 所有分配器返回的地址至少按8字节对齐 */
+#define MEM_ALIGN                  ((uint32_t)8)
+
+/* TLSF二级索引：每个2的幂区间再分为2^MEM_TLSF_SL_LOG2个大小类；一级索引覆盖小于2^MEM_TLSF_FL_MAX的块 */
+#define MEM_TLSF_SL_LOG2           4U
+#define MEM_TLSF_SL_COUNT          (1U << MEM_TLSF_SL_LOG2)
+#define MEM_TLSF_FL_SHIFT          (MEM_TLSF_SL_LOG2 + 3U)
+#define MEM_TLSF_FL_MAX            26U
+#define MEM_TLSF_FL_COUNT          (MEM_TLSF_FL_MAX - MEM_TLSF_FL_SHIFT + 1U)
+
+/**
+  * @brief  分配器统计，字节数为实际占用的大小(包括对齐，不包括块头)
+  */
+typedef struct
+{
+  uint32_t Size;        /* 可分配的字节数 */
+  uint32_t Used;        /* 当前使用的字节数 */
+  uint32_t HighWater;   /* 使用的最大字节数 */
+  uint32_t Allocs;      /* 成功分配的次数 */
+  uint32_t Frees;       /* 释放次数，区域分配器为复位次数 */
+  uint32_t Failures;    /* 分配失败或释放了无效地址的次数 */
+}MEM_HeapStatsTypeDef;
+
+/**
+  * @brief  区域分配器：顺序分配，整体复位，适合每帧用完即弃的临时缓冲区
+  * @note   没有加锁，只能在一个线程(主循环)中使用
+  */
+typedef struct
+{
+  uint8_t              *Base;
+  uint32_t              Offset;     /* 下一次分配的位置 */
+  MEM_HeapStatsTypeDef  Stats;
+}MEM_ArenaTypeDef;
+
+/**
+  * @brief  固定块内存池：分配和释放一个BlockSize大小的块，可以在中断中调用
+  */
+typedef struct
+{
+  uint8_t              *Base;
+  uint32_t              BlockSize;  /* 块大小，按MEM_ALIGN向上取整 */
+  uint32_t              Count;      /* 块数 */
+  uint32_t              Fresh;      /* 从未分配过的块从这里开始，初始化时不必串起所有块 */
+  void                 *FreeList;   /* 释放的块，链表指针存放在块中 */
+  MEM_HeapStatsTypeDef  Stats;
+}MEM_PoolTypeDef;
+
+#if MEM_TLSF
+/**
+  * @brief  TLSF(两级分离适配)通用分配器，分配和释放的时间与块数无关，可以在中断中调用
+  * @note   块之间用相对Base的偏移连接，块头8字节，主机和目标板上的布局相同
+  */
+typedef struct
+{
+  uint8_t              *Base;
+  uint32_t              FlBitmap;                                  /* 一级索引中非空的区间 */
+  uint32_t              SlBitmap[MEM_TLSF_FL_COUNT];               /* 二级索引中非空的大小类 */
+  uint32_t              Head[MEM_TLSF_FL_COUNT][MEM_TLSF_SL_COUNT]; /* 各大小类空闲链表的第一块 */
+  MEM_HeapStatsTypeDef  Stats;
+}MEM_TlsfTypeDef;
+#endif
+
+extern MEM_ArenaTypeDef MEM_FrameArena;
+#if MEM_TLSF
+extern MEM_TlsfTypeDef  MEM_SdramHeap;
+#endif
+
+void     MEM_Arena_Init(MEM_ArenaTypeDef *pArena, void *pBase, uint32_t Size);
+void    *MEM_Arena_Alloc(MEM_ArenaTypeDef *pArena, uint32_t Size, uint32_t Align);
+uint32_t MEM_Arena_Mark(const MEM_ArenaTypeDef *pArena);
+void     MEM_Arena_Release(MEM_ArenaTypeDef *pArena, uint32_t Mark);
+void     MEM_Arena_Reset(MEM_ArenaTypeDef *pArena);
+
+uint32_t MEM_Pool_Init(MEM_PoolTypeDef *pPool, void *pBase, uint32_t Size, uint32_t BlockSize);
+void    *MEM_Pool_Alloc(MEM_PoolTypeDef *pPool);
+void     MEM_Pool_Free(MEM_PoolTypeDef *pPool, void *pBlock);
+
+#if MEM_TLSF
+HAL_StatusTypeDef MEM_TLSF_Init(MEM_TlsfTypeDef *pHeap, void *pBase, uint32_t Size);
+void    *MEM_TLSF_Alloc(MEM_TlsfTypeDef *pHeap, uint32_t Size);
+void     MEM_TLSF_Free(MEM_TlsfTypeDef *pHeap, void *pData);
+uint32_t MEM_TLSF_BlockSize(const MEM_TlsfTypeDef *pHeap, const void *pData);
+HAL_StatusTypeDef MEM_TLSF_Check(const MEM_TlsfTypeDef *pHeap, uint32_t *pFree, uint32_t *pLargest);
+#endif
+
+HAL_StatusTypeDef MEM_Heap_Init(void);
+void     MEM_Heap_FrameEnd(void);
+void     MEM_Heap_Report(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __MEMHEAP_H__ */
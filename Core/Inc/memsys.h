@@ -0,0 +1,54 @@
+#ifndef __MEMSYS_H__
+#define __MEMSYS_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "main.h"
+
+/* D-Cache行大小(字节)，按地址维护缓存时以行为单位 */
+#define MEM_CACHE_LINE           ((uint32_t)32)
+
+/* FMC SDRAM Bank2，显存等CPU与DMA2D/LTDC共同访问的数据，MPU设为不经过缓存 */
+#define MEM_SDRAM_ADDRESS        ((uint32_t)0xD0000000)
+#define MEM_SDRAM_REGION_SIZE    MPU_REGION_SIZE_32MB
+
+/* SDRAM末尾2MB(JPEG行带和字模缓存)只由CPU写、DMA2D读，MPU设为写通，写入后不需要清理 */
+#define MEM_SDRAM_WT_ADDRESS     ((uint32_t)0xD1E00000)
+#define MEM_SDRAM_WT_REGION_SIZE MPU_REGION_SIZE_2MB
+
+/* 经过写回D-Cache的内部SRAM(SRAM1和SRAM2)；DTCM不经过缓存，DMA直接访问总是一致的 */
+#define MEM_SRAM_WB_START        ((uint32_t)0x20020000)
+#define MEM_SRAM_WB_END          ((uint32_t)0x20080000)
+
+/* 把函数或变量放到指定的存储器，段由STM32F767IGTx_FLASH.ld定义：
+ *   MEM_ITCM_TEXT  函数在ITCM中执行，启动代码从Flash复制
+ *   MEM_DTCM_DATA  有初值的变量放在DTCM，启动代码从Flash复制
+ *   MEM_DTCM_BSS   清零的变量放在DTCM，启动代码清零
+ *   MEM_SDRAM_BSS  大块缓冲区放在SDRAM(不经过缓存)，由MEM_ClearSdramBss清零
+ * 主机仿真时展开为空 */
+#if defined(__arm__)
+#define MEM_ITCM_TEXT            __attribute__((section(".itcm_text"), noinline))
+#define MEM_DTCM_DATA            __attribute__((section(".dtcm_data")))
+#define MEM_DTCM_BSS             __attribute__((section(".dtcm_bss")))
+#define MEM_SDRAM_BSS            __attribute__((section(".sdram_bss")))
+#else
+#define MEM_ITCM_TEXT
+#define MEM_DTCM_DATA
+#define MEM_DTCM_BSS
+#define MEM_SDRAM_BSS
+#endif
+
+void     MEM_Init(void);
+void     MEM_ClearSdramBss(void);
+uint32_t MEM_IsWriteBack(uint32_t Address, uint32_t Size);
+void     MEM_CleanDCache(uint32_t Address, uint32_t Size);
+void     MEM_InvalidateDCache(uint32_t Address, uint32_t Size);
+void     MEM_CleanInvalidateDCache(uint32_t Address, uint32_t Size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __MEMSYS_H__ */
@@ -0,0 +1,68 @@
+#ifndef __SDRAM_BENCH_H__
+#define __SDRAM_BENCH_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "main.h"
+
+/* 置1在启动时测量SDRAM带宽和延迟并调整FMC时序(make BENCH=1)，会破坏SDRAM中的全部数据 */
+#ifndef SDRAM_BENCH
+#define SDRAM_BENCH                0
+#endif
+
+/* 顺序测试的窗口，复制时目标紧接在源之后 */
+#ifndef SDRAM_BENCH_SIZE
+#define SDRAM_BENCH_SIZE           ((uint32_t)1024 * 1024)
+#endif
+
+/* 随机访问的范围，覆盖所有Bank和大量的行 */
+#ifndef SDRAM_BENCH_RANDOM_SIZE
+#define SDRAM_BENCH_RANDOM_SIZE    ((uint32_t)8 * 1024 * 1024)
+#endif
+
+/* 随机访问的块数，每块一个缓存行(32字节) */
+#ifndef SDRAM_BENCH_RANDOM_COUNT
+#define SDRAM_BENCH_RANDOM_COUNT   ((uint32_t)4096)
+#endif
+
+/* 每次校验读写的字节数 */
+#ifndef SDRAM_BENCH_VERIFY_SIZE
+#define SDRAM_BENCH_VERIFY_SIZE    ((uint32_t)64 * 1024)
+#endif
+
+/* 访问SDRAM的主机 */
+#define SDRAM_BENCH_CPU            0U
+#define SDRAM_BENCH_DMA            1U   /* DMA2存储器到存储器 */
+#define SDRAM_BENCH_DMA2D          2U
+#define SDRAM_BENCH_ENGINES        3U
+
+/* 测试项，SDRAM_BenchResultTypeDef.Bandwidth的下标 */
+#define SDRAM_BENCH_SEQ_READ       0U
+#define SDRAM_BENCH_SEQ_WRITE      1U
+#define SDRAM_BENCH_SEQ_COPY       2U
+#define SDRAM_BENCH_RND_READ       3U
+#define SDRAM_BENCH_RND_WRITE      4U
+#define SDRAM_BENCH_RND_COPY       5U
+#define SDRAM_BENCH_TESTS          6U
+
+/**
+  * @brief  一个主机的测量结果
+  */
+typedef struct
+{
+  uint32_t Bandwidth[SDRAM_BENCH_TESTS];  /* KB/s */
+  uint32_t Latency;                       /* 一次32字节读取从发出到数据可用的时间(ns) */
+}SDRAM_BenchResultTypeDef;
+
+#if SDRAM_BENCH
+void SDRAM_Bench_Run(SDRAM_BenchResultTypeDef *pResult);
+HAL_StatusTypeDef SDRAM_Bench_Tune(void);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __SDRAM_BENCH_H__ */
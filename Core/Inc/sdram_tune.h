@@ -0,0 +1,93 @@
+#ifndef __SDRAM_TUNE_H__
+#define __SDRAM_TUNE_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "main.h"
+
+/* SDRAM_ConfigTypeDef.Timing的下标，顺序与FMC_SDRAM_TimingTypeDef的成员相同，单位为SDCLK周期 */
+#define SDRAM_TMRD                 0U   /* LoadToActiveDelay */
+#define SDRAM_TXSR                 1U   /* ExitSelfRefreshDelay */
+#define SDRAM_TRAS                 2U   /* SelfRefreshTime */
+#define SDRAM_TRC                  3U   /* RowCycleDelay */
+#define SDRAM_TWR                  4U   /* WriteRecoveryTime */
+#define SDRAM_TRP                  5U   /* RPDelay */
+#define SDRAM_TRCD                 6U   /* RCDDelay */
+#define SDRAM_TIMINGS              7U
+
+/* FMC_SDTR每个时序参数的取值范围 */
+#define SDRAM_TIMING_MIN           1U
+#define SDRAM_TIMING_MAX           16U
+
+/* 每个候选配置需要连续通过校验的次数，只偶尔出错的配置也要排除 */
+#ifndef SDRAM_TUNE_REPEAT
+#define SDRAM_TUNE_REPEAT          ((uint32_t)3)
+#endif
+
+/* 最终配置的校验次数 */
+#ifndef SDRAM_TUNE_SOAK
+#define SDRAM_TUNE_SOAK            ((uint32_t)16)
+#endif
+
+/* 找到的最小时序再加上的周期数，留给温度和电压的余量 */
+#ifndef SDRAM_TUNE_MARGIN
+#define SDRAM_TUNE_MARGIN          1U
+#endif
+
+/* 每个候选配置测量的次数，取最少的周期数 */
+#ifndef SDRAM_TUNE_RUNS
+#define SDRAM_TUNE_RUNS            ((uint32_t)3)
+#endif
+
+/* 搜索的模式寄存器突发长度上限(1/2/4/8) */
+#ifndef SDRAM_TUNE_MAX_BURST
+#define SDRAM_TUNE_MAX_BURST       2U
+#endif
+
+/**
+  * @brief  SDRAM的时序和读取方式
+  */
+typedef struct
+{
+  uint8_t Timing[SDRAM_TIMINGS];  /* 时序参数，1~16个SDCLK周期 */
+  uint8_t CASLatency;             /* CAS延迟，1~3个SDCLK周期，同时写入FMC_SDCR和模式寄存器 */
+  uint8_t ReadBurst;              /* 非0时FMC把连续的读取合并为突发读 */
+  uint8_t ReadPipeDelay;          /* CAS延迟之后再延迟的HCLK周期，0~2 */
+  uint8_t BurstLength;            /* 模式寄存器的突发长度，1/2/4/8 */
+}SDRAM_ConfigTypeDef;
+
+/**
+  * @brief  调整时使用的操作，目标板上改写FMC并读写SDRAM，主机上可以换成时序模型
+  */
+typedef struct
+{
+  HAL_StatusTypeDef (*Apply)(const SDRAM_ConfigTypeDef *pConfig);   /* 改用一个配置 */
+  uint32_t          (*Verify)(void);    /* 读写测试，返回出错的字数 */
+  uint32_t          (*Measure)(void);   /* 运行参考负载，返回周期数 */
+}SDRAM_TuneOpsTypeDef;
+
+/**
+  * @brief  调整结果
+  */
+typedef struct
+{
+  SDRAM_ConfigTypeDef Best;       /* 最快的稳定配置(已加余量) */
+  uint32_t BaselineCycles;        /* 原来配置的参考负载周期数 */
+  uint32_t BestCycles;            /* Best的参考负载周期数 */
+  uint32_t Candidates;            /* 通过长时间校验的候选配置数 */
+  uint32_t Applied;               /* 应用过的配置数 */
+  uint32_t Failed;                /* 校验失败的配置数 */
+}SDRAM_TuneResultTypeDef;
+
+uint32_t SDRAM_Tune_IsLegal(const SDRAM_ConfigTypeDef *pConfig);
+HAL_StatusTypeDef SDRAM_Tune(const SDRAM_TuneOpsTypeDef *pOps, const SDRAM_ConfigTypeDef *pBaseline,
+                             SDRAM_TuneResultTypeDef *pResult);
+void     SDRAM_Tune_Print(const SDRAM_ConfigTypeDef *pConfig);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __SDRAM_TUNE_H__ */
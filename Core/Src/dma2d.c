@@ -21,7 +21,26 @@
 #include "dma2d.h"
 
 /* USER CODE BEGIN 0 */
+/**
+  * @brief  DMA2D 寄存器影子副本，只写入发生变化的寄存器
+  */
+typedef struct
+{
+  uint32_t Valid;
+  uint32_t Mode;           /* CR MODE 字段 */
+  uint32_t Opfccr;
+  uint32_t Oor;
+  uint32_t Pfccr[2];       /* BGPFCCR / FGPFCCR */
+  uint32_t Or[2];          /* BGOR / FGOR */
+  uint32_t Colr[2];        /* BGCOLR / FGCOLR */
+  uint32_t Clut[2];        /* PFCCR中CLUT大小和格式字段，写PFCCR时保留 */
+}DMA2D_ShadowTypeDef;
 
+/* 影子寄存器无效标记，各寄存器的保留位保证该值不会与实际配置相同 */
+#define DMA2D_SHADOW_INVALID    0xFFFFFFFFU
+
+static DMA2D_ShadowTypeDef     DMA2D_Shadow;
+static DMA2D_CacheStatsTypeDef DMA2D_CacheStats;
 /* USER CODE END 0 */
 
 DMA2D_HandleTypeDef hdma2d;
@@ -56,7 +75,7 @@ void MX_DMA2D_Init(void)
     Error_Handler();
   }
   /* USER CODE BEGIN DMA2D_Init 2 */
-
+  DMA2D_CacheInvalidate();
   /* USER CODE END DMA2D_Init 2 */
 
 }
@@ -71,6 +90,10 @@ void HAL_DMA2D_MspInit(DMA2D_HandleTypeDef* dma2dHandle)
   /* USER CODE END DMA2D_MspInit 0 */
     /* DMA2D clock enable */
     __HAL_RCC_DMA2D_CLK_ENABLE();
+
+    /* DMA2D interrupt Init */
+    HAL_NVIC_SetPriority(DMA2D_IRQn, 0, 0);
+    HAL_NVIC_EnableIRQ(DMA2D_IRQn);
   /* USER CODE BEGIN DMA2D_MspInit 1 */
 
   /* USER CODE END DMA2D_MspInit 1 */
@@ -87,6 +110,9 @@ void HAL_DMA2D_MspDeInit(DMA2D_HandleTypeDef* dma2dHandle)
   /* USER CODE END DMA2D_MspDeInit 0 */
     /* Peripheral clock disable */
     __HAL_RCC_DMA2D_CLK_DISABLE();
+
+    /* DMA2D interrupt Deinit */
+    HAL_NVIC_DisableIRQ(DMA2D_IRQn);
   /* USER CODE BEGIN DMA2D_MspDeInit 1 */
 
   /* USER CODE END DMA2D_MspDeInit 1 */
@@ -94,7 +120,201 @@ void HAL_DMA2D_MspDeInit(DMA2D_HandleTypeDef* dma2dHandle)
 }
 
 /* USER CODE BEGIN 1 */
+/**
+  * @brief  使寄存器缓存失效，直接调用HAL_DMA2D_Init等函数后必须调用
+  * @retval None
+  */
+void DMA2D_CacheInvalidate(void)
+{
+  DMA2D_Shadow.Valid = 0;
+}
+
+/**
+  * @brief  配置DMA2D传输模式和输出格式，只写入变化的寄存器
+  * @note   同步更新hdma2d.Init，HAL_DMA2D_Start在R2M模式下依赖输出颜色格式
+  * @param  Mode: 传输模式 DMA2D_R2M/DMA2D_M2M/DMA2D_M2M_PFC/DMA2D_M2M_BLEND
+  * @param  ColorMode: 输出颜色格式
+  * @param  OutputOffset: 输出行偏移
+  * @retval None
+  */
+void DMA2D_ConfigOutput(uint32_t Mode, uint32_t ColorMode, uint32_t OutputOffset)
+{
+  uint32_t opfccr;
+  uint32_t writes = 0;
+
+  hdma2d.Init.Mode         = Mode;
+  hdma2d.Init.ColorMode    = ColorMode;
+  hdma2d.Init.OutputOffset = OutputOffset;
+
+  opfccr = ColorMode | (hdma2d.Init.AlphaInverted << DMA2D_OPFCCR_AI_Pos) |
+           (hdma2d.Init.RedBlueSwap << DMA2D_OPFCCR_RBS_Pos);
+
+  DMA2D_CacheStats.OutputConfigs++;
+
+  if((DMA2D_Shadow.Valid == 0U) || (DMA2D_Shadow.Mode != Mode))
+  {
+    MODIFY_REG(hdma2d.Instance->CR, DMA2D_CR_MODE, Mode);
+    DMA2D_Shadow.Mode = Mode;
+    writes++;
+  }
+  if((DMA2D_Shadow.Valid == 0U) || (DMA2D_Shadow.Opfccr != opfccr))
+  {
+    MODIFY_REG(hdma2d.Instance->OPFCCR, DMA2D_OPFCCR_CM | DMA2D_OPFCCR_AI | DMA2D_OPFCCR_RBS, opfccr);
+    DMA2D_Shadow.Opfccr = opfccr;
+    writes++;
+  }
+  if((DMA2D_Shadow.Valid == 0U) || (DMA2D_Shadow.Oor != OutputOffset))
+  {
+    MODIFY_REG(hdma2d.Instance->OOR, DMA2D_OOR_LO, OutputOffset);
+    DMA2D_Shadow.Oor = OutputOffset;
+    writes++;
+  }
+
+  if(writes == 0U)
+  {
+    DMA2D_CacheStats.InitSkipped++;
+  }
+  DMA2D_CacheStats.RegWrites += writes;
+
+  /* 输出寄存器已同步，输入层影子在首次配置时写入 */
+  if(DMA2D_Shadow.Valid == 0U)
+  {
+    DMA2D_Shadow.Valid = 1;
+    DMA2D_Shadow.Pfccr[0] = DMA2D_Shadow.Pfccr[1] = DMA2D_SHADOW_INVALID;
+    DMA2D_Shadow.Or[0]    = DMA2D_Shadow.Or[1]    = DMA2D_SHADOW_INVALID;
+    DMA2D_Shadow.Colr[0]  = DMA2D_Shadow.Colr[1]  = DMA2D_SHADOW_INVALID;
+  }
+}
+
+/**
+  * @brief  配置DMA2D前景层或背景层，只写入变化的寄存器
+  * @param  LayerIdx: DMA2D_BACKGROUND_LAYER 或 DMA2D_FOREGROUND_LAYER
+  * @param  ColorMode: 输入颜色格式
+  * @param  InputOffset: 输入行偏移
+  * @param  AlphaMode: 透明度模式
+  * @param  InputAlpha: 透明度，A8/A4格式时为ARGB颜色
+  * @retval None
+  */
+void DMA2D_ConfigInput(uint32_t LayerIdx, uint32_t ColorMode, uint32_t InputOffset, uint32_t AlphaMode, uint32_t InputAlpha)
+{
+  DMA2D_LayerCfgTypeDef *pLayerCfg = &hdma2d.LayerCfg[LayerIdx];
+  uint32_t pfccr;
+  uint32_t colr = DMA2D_SHADOW_INVALID;
+  uint32_t writes = 0;
 
+  pLayerCfg->InputColorMode = ColorMode;
+  pLayerCfg->InputOffset    = InputOffset;
+  pLayerCfg->AlphaMode      = AlphaMode;
+  pLayerCfg->InputAlpha     = InputAlpha;
+
+  /* 与HAL_DMA2D_ConfigLayer相同的寄存器取值 */
+  pfccr = ColorMode | (AlphaMode << DMA2D_BGPFCCR_AM_Pos) |
+          (pLayerCfg->AlphaInverted << DMA2D_BGPFCCR_AI_Pos) | (pLayerCfg->RedBlueSwap << DMA2D_BGPFCCR_RBS_Pos) |
+          DMA2D_Shadow.Clut[LayerIdx];
+  if((ColorMode == DMA2D_INPUT_A4) || (ColorMode == DMA2D_INPUT_A8))
+  {
+    pfccr |= (InputAlpha & DMA2D_BGPFCCR_ALPHA);
+    colr   = InputAlpha & (DMA2D_BGCOLR_BLUE | DMA2D_BGCOLR_GREEN | DMA2D_BGCOLR_RED);
+  }
+  else
+  {
+    pfccr |= (InputAlpha << DMA2D_BGPFCCR_ALPHA_Pos);
+  }
+
+  DMA2D_CacheStats.LayerConfigs++;
+
+  if(DMA2D_Shadow.Valid == 0U)
+  {
+    /* 输出配置尚未建立影子，本次全部写入 */
+    DMA2D_Shadow.Pfccr[LayerIdx] = DMA2D_SHADOW_INVALID;
+    DMA2D_Shadow.Or[LayerIdx]    = DMA2D_SHADOW_INVALID;
+    DMA2D_Shadow.Colr[LayerIdx]  = DMA2D_SHADOW_INVALID;
+  }
+
+  if(DMA2D_Shadow.Pfccr[LayerIdx] != pfccr)
+  {
+    if(LayerIdx == DMA2D_BACKGROUND_LAYER)
+    {
+      WRITE_REG(hdma2d.Instance->BGPFCCR, pfccr);
+    }
+    else
+    {
+      WRITE_REG(hdma2d.Instance->FGPFCCR, pfccr);
+    }
+    DMA2D_Shadow.Pfccr[LayerIdx] = pfccr;
+    writes++;
+  }
+  if(DMA2D_Shadow.Or[LayerIdx] != InputOffset)
+  {
+    if(LayerIdx == DMA2D_BACKGROUND_LAYER)
+    {
+      WRITE_REG(hdma2d.Instance->BGOR, InputOffset);
+    }
+    else
+    {
+      WRITE_REG(hdma2d.Instance->FGOR, InputOffset);
+    }
+    DMA2D_Shadow.Or[LayerIdx] = InputOffset;
+    writes++;
+  }
+  /* 颜色寄存器只在A8/A4格式下使用 */
+  if((colr != DMA2D_SHADOW_INVALID) && (DMA2D_Shadow.Colr[LayerIdx] != colr))
+  {
+    if(LayerIdx == DMA2D_BACKGROUND_LAYER)
+    {
+      WRITE_REG(hdma2d.Instance->BGCOLR, colr);
+    }
+    else
+    {
+      WRITE_REG(hdma2d.Instance->FGCOLR, colr);
+    }
+    DMA2D_Shadow.Colr[LayerIdx] = colr;
+    writes++;
+  }
+
+  if(writes == 0U)
+  {
+    DMA2D_CacheStats.LayerSkipped++;
+  }
+  DMA2D_CacheStats.RegWrites += writes;
+}
+
+/**
+  * @brief  记录前景层或背景层的CLUT大小和格式，在HAL_DMA2D_CLUTStartLoad之前调用
+  * @note   DMA2D_ConfigInput整体写入PFCCR，需要带上这两个字段才不会改掉已加载的CLUT配置
+  * @param  LayerIdx: DMA2D_BACKGROUND_LAYER 或 DMA2D_FOREGROUND_LAYER
+  * @param  ColorMode: CLUT格式 DMA2D_CCM_ARGB8888/DMA2D_CCM_RGB888
+  * @param  Size: CLUT项数减1
+  * @retval None
+  */
+void DMA2D_ConfigCLUT(uint32_t LayerIdx, uint32_t ColorMode, uint32_t Size)
+{
+  DMA2D_Shadow.Clut[LayerIdx] = (Size << DMA2D_BGPFCCR_CS_Pos) | (ColorMode << DMA2D_BGPFCCR_CCM_Pos);
+  DMA2D_Shadow.Pfccr[LayerIdx] = DMA2D_SHADOW_INVALID;
+}
+
+/**
+  * @brief  读取寄存器缓存统计
+  * @param  pStats: 输出统计数据
+  * @retval None
+  */
+void DMA2D_GetCacheStats(DMA2D_CacheStatsTypeDef *pStats)
+{
+  *pStats = DMA2D_CacheStats;
+}
+
+/**
+  * @brief  清除寄存器缓存统计
+  * @retval None
+  */
+void DMA2D_ResetCacheStats(void)
+{
+  DMA2D_CacheStats.OutputConfigs = 0;
+  DMA2D_CacheStats.InitSkipped   = 0;
+  DMA2D_CacheStats.LayerConfigs  = 0;
+  DMA2D_CacheStats.LayerSkipped  = 0;
+  DMA2D_CacheStats.RegWrites     = 0;
+}
 /* USER CODE END 1 */
 
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
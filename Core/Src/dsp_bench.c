@@ -0,0 +1,292 @@
+#include "dsp_bench.h"
+#include "memsys.h"
+
+#if DSP_BENCH
+
+#include <stdio.h>
+#include <string.h>
+#include "arm_math.h"
+#include "arm_const_structs.h"
+
+#define BENCH_FIR_TAPS      ((uint32_t)64)
+#define BENCH_FIR_BLOCK     ((uint32_t)256)
+#define BENCH_FFT_LENGTH    ((uint32_t)1024)
+#define BENCH_MAT_SIZE      ((uint32_t)32)
+#define BENCH_DOT_LENGTH    ((uint32_t)1024)
+#define BENCH_COPY_BYTES    ((uint32_t)16384)
+
+typedef uint32_t (*BENCH_FuncTypeDef)(void *pData);
+
+/**
+  * @brief  FIR滤波器的状态和输入输出，分别放在DTCM和SRAM中比较
+  */
+typedef struct
+{
+  arm_fir_instance_f32 Instance;
+  float32_t State[BENCH_FIR_TAPS + BENCH_FIR_BLOCK - 1U];
+  float32_t In[BENCH_FIR_BLOCK];
+  float32_t Out[BENCH_FIR_BLOCK];
+}BENCH_FirTypeDef;
+
+/* 系数和FFT输入只在准备数据时读取，留在SRAM中 */
+static float32_t FirCoeffs[BENCH_FIR_TAPS];
+static float32_t FftIn[BENCH_FFT_LENGTH * 2U];
+
+/* 反复访问的状态和工作缓冲区放在DTCM中，不经过D-Cache也没有等待周期 */
+static BENCH_FirTypeDef FirDtcm MEM_DTCM_BSS;
+static float32_t FftDtcm[BENCH_FFT_LENGTH * 2U] MEM_DTCM_BSS;
+static float32_t MatA[BENCH_MAT_SIZE * BENCH_MAT_SIZE] MEM_DTCM_BSS;
+static float32_t MatB[BENCH_MAT_SIZE * BENCH_MAT_SIZE] MEM_DTCM_BSS;
+static float32_t MatC[BENCH_MAT_SIZE * BENCH_MAT_SIZE] MEM_DTCM_BSS;
+static float32_t DotA[BENCH_DOT_LENGTH] MEM_DTCM_BSS;
+static float32_t DotB[BENCH_DOT_LENGTH] MEM_DTCM_BSS;
+
+/* 同样的数据放在写回缓存的SRAM中，对比D-Cache的作用 */
+static BENCH_FirTypeDef FirSram;
+static float32_t FftSram[BENCH_FFT_LENGTH * 2U];
+static uint8_t   CopySrc[BENCH_COPY_BYTES] __attribute__((aligned(4)));
+static uint8_t   CopyDst[BENCH_COPY_BYTES] __attribute__((aligned(4)));
+
+static volatile float32_t Sink;   /* 防止点积结果被优化掉 */
+
+static uint32_t BENCH_Fir(void *pData);
+static uint32_t BENCH_Fft(void *pData);
+static uint32_t BENCH_MatMult(void *pData);
+static uint32_t BENCH_DotProd(void *pData);
+static uint32_t BENCH_Memcpy(void *pData);
+static void BENCH_Fill(float32_t *pData, uint32_t Count, uint32_t *pSeed);
+static void BENCH_SetCache(uint32_t ICache, uint32_t DCache);
+static const char *BENCH_Region(const void *pData);
+
+static const struct
+{
+  const char       *Name;
+  BENCH_FuncTypeDef Func;
+  void             *Data;     /* 测试使用的数据，同时用于输出所在的存储器 */
+}Tests[] =
+{
+  {"fir_f32 64x256",    BENCH_Fir,     &FirDtcm},
+  {"fir_f32 64x256",    BENCH_Fir,     &FirSram},
+  {"cfft_f32 1024",     BENCH_Fft,     FftDtcm},
+  {"cfft_f32 1024",     BENCH_Fft,     FftSram},
+  {"mat_mult_f32 32",   BENCH_MatMult, MatA},
+  {"dot_prod_f32 1024", BENCH_DotProd, DotA},
+  {"memcpy 16K",        BENCH_Memcpy,  CopySrc},
+};
+
+static const char *const ConfigNames[DSP_BENCH_CONFIGS] = {"no cache", "I-Cache", "I+D-Cache"};
+
+/**
+  * @brief  在关闭缓存、只打开I-Cache、打开I-Cache和D-Cache三种配置下测量CMSIS-DSP函数的周期数，
+  *         通过printf(USART1)输出，结束后恢复原来的缓存配置
+  * @note   在初始化USART1之后、启动DMA2D等DMA之前调用；测试期间关闭D-Cache会写回并丢弃全部缓存
+  * @param  pResult: 输出结果，可以为NULL
+  * @param  Count: pResult的项数
+  * @retval 测试的个数
+  */
+uint32_t DSP_Bench_Run(DSP_BenchResultTypeDef *pResult, uint32_t Count)
+{
+  uint32_t ccr = SCB->CCR;
+  uint32_t seed = 1U;
+  uint32_t cycles[sizeof(Tests) / sizeof(Tests[0])][DSP_BENCH_CONFIGS];
+  uint32_t config, test, run, ticks;
+
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->LAR = 0xC5ACCE55U;
+  DWT->CYCCNT = 0;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+  BENCH_Fill(FirCoeffs, BENCH_FIR_TAPS, &seed);
+  BENCH_Fill(FirDtcm.In, BENCH_FIR_BLOCK, &seed);
+  memcpy(FirSram.In, FirDtcm.In, sizeof(FirSram.In));
+  BENCH_Fill(FftIn, BENCH_FFT_LENGTH * 2U, &seed);
+  BENCH_Fill(MatA, BENCH_MAT_SIZE * BENCH_MAT_SIZE, &seed);
+  BENCH_Fill(MatB, BENCH_MAT_SIZE * BENCH_MAT_SIZE, &seed);
+  BENCH_Fill(DotA, BENCH_DOT_LENGTH, &seed);
+  BENCH_Fill(DotB, BENCH_DOT_LENGTH, &seed);
+  memset(CopySrc, 0x5A, sizeof(CopySrc));
+  arm_fir_init_f32(&FirDtcm.Instance, (uint16_t)BENCH_FIR_TAPS, FirCoeffs, FirDtcm.State, BENCH_FIR_BLOCK);
+  arm_fir_init_f32(&FirSram.Instance, (uint16_t)BENCH_FIR_TAPS, FirCoeffs, FirSram.State, BENCH_FIR_BLOCK);
+
+  for(config = 0; config < DSP_BENCH_CONFIGS; config++)
+  {
+    BENCH_SetCache((config != DSP_BENCH_NO_CACHE) ? 1U : 0U, (config == DSP_BENCH_IDCACHE) ? 1U : 0U);
+    for(test = 0; test < (sizeof(Tests) / sizeof(Tests[0])); test++)
+    {
+      cycles[test][config] = 0xFFFFFFFFU;
+      for(run = 0; run < DSP_BENCH_RUNS; run++)
+      {
+        ticks = Tests[test].Func(Tests[test].Data);
+        if(ticks < cycles[test][config])
+        {
+          cycles[test][config] = ticks;
+        }
+      }
+    }
+  }
+
+  BENCH_SetCache(ccr & SCB_CCR_IC_Msk, ccr & SCB_CCR_DC_Msk);
+
+  printf("dsp bench @ %lu MHz, cycles (min of %lu runs):\r\n",
+         (unsigned long)(SystemCoreClock / 1000000U), (unsigned long)DSP_BENCH_RUNS);
+  printf("  %-18s %-5s %10s %10s %10s %7s\r\n", "kernel", "data",
+         ConfigNames[0], ConfigNames[1], ConfigNames[2], "speedup");
+  for(test = 0; test < (sizeof(Tests) / sizeof(Tests[0])); test++)
+  {
+    printf("  %-18s %-5s %10lu %10lu %10lu %4lu.%02lux\r\n", Tests[test].Name, BENCH_Region(Tests[test].Data),
+           (unsigned long)cycles[test][0], (unsigned long)cycles[test][1], (unsigned long)cycles[test][2],
+           (unsigned long)(cycles[test][0] / cycles[test][2]),
+           (unsigned long)(((cycles[test][0] % cycles[test][2]) * 100U) / cycles[test][2]));
+    if((pResult != NULL) && (test < Count))
+    {
+      pResult[test].Name = Tests[test].Name;
+      memcpy(pResult[test].Cycles, cycles[test], sizeof(pResult[test].Cycles));
+    }
+  }
+
+  return sizeof(Tests) / sizeof(Tests[0]);
+}
+
+/**
+  * @brief  64阶FIR滤波一块256个采样
+  * @retval 周期数
+  */
+static uint32_t BENCH_Fir(void *pData)
+{
+  BENCH_FirTypeDef *fir = (BENCH_FirTypeDef *)pData;
+  uint32_t start = DWT->CYCCNT;
+
+  arm_fir_f32(&fir->Instance, fir->In, fir->Out, BENCH_FIR_BLOCK);
+  return DWT->CYCCNT - start;
+}
+
+/**
+  * @brief  1024点复数FFT，原位计算，每次先复制输入(不计时)
+  * @retval 周期数
+  */
+static uint32_t BENCH_Fft(void *pData)
+{
+  uint32_t start;
+
+  memcpy(pData, FftIn, sizeof(FftIn));
+  start = DWT->CYCCNT;
+  arm_cfft_f32(&arm_cfft_sR_f32_len1024, (float32_t *)pData, 0, 1);
+  return DWT->CYCCNT - start;
+}
+
+/**
+  * @brief  32x32矩阵乘法
+  * @retval 周期数
+  */
+static uint32_t BENCH_MatMult(void *pData)
+{
+  arm_matrix_instance_f32 a, b, c;
+  uint32_t start;
+
+  arm_mat_init_f32(&a, (uint16_t)BENCH_MAT_SIZE, (uint16_t)BENCH_MAT_SIZE, MatA);
+  arm_mat_init_f32(&b, (uint16_t)BENCH_MAT_SIZE, (uint16_t)BENCH_MAT_SIZE, MatB);
+  arm_mat_init_f32(&c, (uint16_t)BENCH_MAT_SIZE, (uint16_t)BENCH_MAT_SIZE, MatC);
+  start = DWT->CYCCNT;
+  (void)arm_mat_mult_f32(&a, &b, &c);
+  return DWT->CYCCNT - start;
+}
+
+/**
+  * @brief  1024点点积
+  * @retval 周期数
+  */
+static uint32_t BENCH_DotProd(void *pData)
+{
+  float32_t result;
+  uint32_t start = DWT->CYCCNT;
+
+  arm_dot_prod_f32(DotA, DotB, BENCH_DOT_LENGTH, &result);
+  start = DWT->CYCCNT - start;
+  Sink = result;
+  return start;
+}
+
+/**
+  * @brief  复制16KB，作为存储器带宽的参照
+  * @retval 周期数
+  */
+static uint32_t BENCH_Memcpy(void *pData)
+{
+  uint32_t start = DWT->CYCCNT;
+
+  memcpy(CopyDst, pData, BENCH_COPY_BYTES);
+  return DWT->CYCCNT - start;
+}
+
+/**
+  * @brief  用线性同余序列填充-1~1之间的数据
+  * @param  pData: 输出
+  * @param  Count: 个数
+  * @param  pSeed: 随机数状态
+  * @retval 无
+  */
+static void BENCH_Fill(float32_t *pData, uint32_t Count, uint32_t *pSeed)
+{
+  uint32_t i;
+
+  for(i = 0; i < Count; i++)
+  {
+    *pSeed = (*pSeed * 1664525U) + 1013904223U;
+    pData[i] = ((float32_t)(int32_t)*pSeed) * (1.0f / 2147483648.0f);
+  }
+}
+
+/**
+  * @brief  打开或关闭I-Cache和D-Cache
+  * @note   SCB_EnableDCache会先丢弃整个D-Cache，已经打开时再调用会丢失未写回的数据，所以先检查状态
+  * @param  ICache: 非0打开I-Cache
+  * @param  DCache: 非0打开D-Cache
+  * @retval 无
+  */
+static void BENCH_SetCache(uint32_t ICache, uint32_t DCache)
+{
+  uint32_t ccr = SCB->CCR;
+
+  if((DCache == 0U) && ((ccr & SCB_CCR_DC_Msk) != 0U))
+  {
+    SCB_DisableDCache();
+  }
+  if((ICache == 0U) && ((ccr & SCB_CCR_IC_Msk) != 0U))
+  {
+    SCB_DisableICache();
+  }
+  if((ICache != 0U) && ((ccr & SCB_CCR_IC_Msk) == 0U))
+  {
+    SCB_EnableICache();
+  }
+  if((DCache != 0U) && ((ccr & SCB_CCR_DC_Msk) == 0U))
+  {
+    SCB_EnableDCache();
+  }
+}
+
+/**
+  * @brief  数据所在的存储器；DTCM不经过D-Cache，位于DTCM的测试只反映I-Cache的作用
+  * @param  pData: 地址
+  * @retval 名称
+  */
+static const char *BENCH_Region(const void *pData)
+{
+  uint32_t address = (uint32_t)pData;
+
+  if((address >= 0x20000000U) && (address < 0x20020000U))
+  {
+    return "DTCM";
+  }
+  if((address >= 0x20020000U) && (address < 0x20080000U))
+  {
+    return "SRAM";
+  }
+  if((address >= 0xC0000000U) && (address < 0xE0000000U))
+  {
+    return "SDRAM";
+  }
+  return "other";
+}
+
+#endif /* DSP_BENCH */
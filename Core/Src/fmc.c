@@ -112,6 +112,96 @@ static void SDRAM_InitSequence(void)
   /* Set the device refresh rate */
   HAL_SDRAM_ProgramRefreshRate(&hsdram2, 824);
 }    
+
+/* SDRAM_InitSequence写入模式寄存器的突发长度，模式寄存器不能读回 */
+static uint8_t SdramBurstLength = 2U;
+
+/**
+  * @brief  从FMC寄存器读出当前的SDRAM时序和读取方式
+  * @param  pConfig: 输出配置
+  * @retval 无
+  */
+void FMC_SDRAM_GetConfig(SDRAM_ConfigTypeDef *pConfig)
+{
+  uint32_t sdtr = FMC_SDRAM_DEVICE->SDTR[FMC_SDRAM_BANK2];
+  uint32_t sdtr1 = FMC_SDRAM_DEVICE->SDTR[FMC_SDRAM_BANK1];
+  uint32_t i;
+
+  /* 每个参数4位，寄存器中为周期数减1；两个Bank共用SDTR1中的TRC和TRP */
+  for(i = 0; i < SDRAM_TIMINGS; i++)
+  {
+    pConfig->Timing[i] = (uint8_t)(((sdtr >> (i * 4U)) & 0xFU) + 1U);
+  }
+  pConfig->Timing[SDRAM_TRC] = (uint8_t)(((sdtr1 >> FMC_SDTR1_TRC_Pos) & 0xFU) + 1U);
+  pConfig->Timing[SDRAM_TRP] = (uint8_t)(((sdtr1 >> FMC_SDTR1_TRP_Pos) & 0xFU) + 1U);
+  pConfig->CASLatency    = (uint8_t)((FMC_SDRAM_DEVICE->SDCR[FMC_SDRAM_BANK2] & FMC_SDCR1_CAS_Msk) >> FMC_SDCR1_CAS_Pos);
+  pConfig->ReadBurst     = (uint8_t)((FMC_SDRAM_DEVICE->SDCR[FMC_SDRAM_BANK1] & FMC_SDCR1_RBURST) != 0U);
+  pConfig->ReadPipeDelay = (uint8_t)((FMC_SDRAM_DEVICE->SDCR[FMC_SDRAM_BANK1] & FMC_SDCR1_RPIPE_Msk) >> FMC_SDCR1_RPIPE_Pos);
+  pConfig->BurstLength   = SdramBurstLength;
+}
+
+/**
+  * @brief  SDRAM工作时改用另一组时序和读取方式：预充电所有Bank，改写FMC_SDCR/FMC_SDTR，
+  *         再按新的CAS延迟和突发长度加载模式寄存器；SDCLK和刷新计数不变
+  * @note   调用期间不能有其他主机(DMA2D、LTDC等)访问SDRAM；不稳定的配置会破坏SDRAM中的数据
+  * @param  pConfig: 配置，由SDRAM_Tune_IsLegal检查
+  * @retval HAL_OK: 成功  HAL_ERROR: 配置不合法或命令超时
+  */
+HAL_StatusTypeDef FMC_SDRAM_Reconfigure(const SDRAM_ConfigTypeDef *pConfig)
+{
+  FMC_SDRAM_TimingTypeDef timing;
+  FMC_SDRAM_CommandTypeDef command;
+  uint32_t length;
+
+  if(SDRAM_Tune_IsLegal(pConfig) == 0U)
+  {
+    return HAL_ERROR;
+  }
+
+  hsdram2.Init.CASLatency    = (uint32_t)pConfig->CASLatency << FMC_SDCR1_CAS_Pos;
+  hsdram2.Init.ReadBurst     = (pConfig->ReadBurst != 0U) ? FMC_SDRAM_RBURST_ENABLE : FMC_SDRAM_RBURST_DISABLE;
+  hsdram2.Init.ReadPipeDelay = (uint32_t)pConfig->ReadPipeDelay << FMC_SDCR1_RPIPE_Pos;
+  timing.LoadToActiveDelay    = pConfig->Timing[SDRAM_TMRD];
+  timing.ExitSelfRefreshDelay = pConfig->Timing[SDRAM_TXSR];
+  timing.SelfRefreshTime      = pConfig->Timing[SDRAM_TRAS];
+  timing.RowCycleDelay        = pConfig->Timing[SDRAM_TRC];
+  timing.WriteRecoveryTime    = pConfig->Timing[SDRAM_TWR];
+  timing.RPDelay              = pConfig->Timing[SDRAM_TRP];
+  timing.RCDDelay             = pConfig->Timing[SDRAM_TRCD];
+
+  /* 等待写缓冲中的访问完成，并关闭所有行 */
+  __DSB();
+  while(__FMC_SDRAM_GET_FLAG(FMC_SDRAM_DEVICE, FMC_SDRAM_FLAG_BUSY))
+  {
+  }
+  command.CommandMode = FMC_SDRAM_CMD_PALL;
+  command.CommandTarget = FMC_SDRAM_CMD_TARGET_BANK2;
+  command.AutoRefreshNumber = 1;
+  command.ModeRegisterDefinition = 0;
+  if(HAL_SDRAM_SendCommand(&hsdram2, &command, 0xFFFF) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  (void)FMC_SDRAM_Init(hsdram2.Instance, &hsdram2.Init);
+  (void)FMC_SDRAM_Timing_Init(hsdram2.Instance, &timing, hsdram2.Init.SDBank);
+
+  /* 模式寄存器的突发长度字段为log2(长度) */
+  for(length = 0; (1U << length) < pConfig->BurstLength; length++)
+  {
+  }
+  command.CommandMode = FMC_SDRAM_CMD_LOAD_MODE;
+  command.ModeRegisterDefinition = length | SDRAM_MODEREG_BURST_TYPE_SEQUENTIAL |
+                                   ((uint32_t)pConfig->CASLatency << 4) |
+                                   SDRAM_MODEREG_OPERATING_MODE_STANDARD |
+                                   SDRAM_MODEREG_WRITEBURST_MODE_SINGLE;
+  if(HAL_SDRAM_SendCommand(&hsdram2, &command, 0xFFFF) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+  SdramBurstLength = pConfig->BurstLength;
+  return HAL_OK;
+}
 /* USER CODE END 0 */
 
 SDRAM_HandleTypeDef hsdram2;
@@ -0,0 +1,302 @@
+/**
+  ******************************************************************************
+  * @file    font16.c
+  * @brief   16像素行高A4抗锯齿字体，字符0x20~0x7E
+  *          由Tools/ttf2font.py从SourceCodePro-Regular.ttf生成，请勿手工修改
+  *          Copyright 2010, 2012 Adobe Systems Incorporated (http://www.adobe.com/), with Reserved Font Name 'Source'
+  ******************************************************************************
+  */
+#include "lcd_font.h"
+
+static const uint8_t Font16_Table[] =
+{
+  0x05, 0x30, 0x0A, 0x50, 0x0A, 0x40, 0x09, 0x40, 0x09, 0x30, 0x08, 0x30, 0x00, 0x00, 0x0A, 0x60,
+  0x1E, 0xA0, 0x01, 0x00, 0x4B, 0x15, 0xB0, 0x5F, 0x16, 0xE0, 0x3E, 0x04, 0xD0, 0x2D, 0x03, 0xB0,
+  0x06, 0x01, 0x50, 0x01, 0x20, 0x30, 0x04, 0x60, 0xA0, 0x06, 0x41, 0xA0, 0x7D, 0xCC, 0xD7, 0x0A,
+  0x14, 0x60, 0x4C, 0x59, 0x82, 0x5C, 0x6B, 0x72, 0x0A, 0x0A, 0x10, 0x28, 0x0A, 0x00, 0x00, 0x42,
+  0x00, 0x00, 0x74, 0x00, 0x08, 0xDD, 0x70, 0x6A, 0x11, 0x71, 0x7A, 0x10, 0x00, 0x19, 0xE8, 0x20,
+  0x00, 0x28, 0xE3, 0x00, 0x00, 0x97, 0xAA, 0x56, 0xD3, 0x05, 0xB9, 0x20, 0x00, 0x74, 0x00, 0x00,
+  0x32, 0x00, 0x02, 0x30, 0x00, 0x00, 0x4A, 0x88, 0x00, 0x91, 0x92, 0x0C, 0x08, 0x70, 0x84, 0x1B,
+  0x37, 0x00, 0x2A, 0xA4, 0x00, 0x00, 0x00, 0x20, 0xAA, 0xA0, 0x03, 0xA3, 0x90, 0x84, 0x3B, 0x13,
+  0x90, 0x84, 0x32, 0x00, 0xB8, 0xB0, 0x00, 0x00, 0x02, 0x00, 0x00, 0x47, 0x20, 0x00, 0x03, 0xC5,
+  0xC0, 0x00, 0x07, 0x70, 0xD0, 0x00, 0x04, 0xA9, 0x60, 0x00, 0x02, 0xF7, 0x00, 0x61, 0x1D, 0x7C,
+  0x11, 0xD0, 0x69, 0x08, 0xB8, 0x70, 0x5B, 0x00, 0xAF, 0x30, 0x0A, 0xCB, 0xC6, 0xD3, 0x00, 0x12,
+  0x00, 0x00, 0xA6, 0xD7, 0xB6, 0xA4, 0x42, 0x00, 0x02, 0x00, 0x00, 0x6B, 0x00, 0x03, 0xC1, 0x00,
+  0x0B, 0x40, 0x00, 0x2D, 0x00, 0x00, 0x4A, 0x00, 0x00, 0x59, 0x00, 0x00, 0x4A, 0x00, 0x00, 0x1D,
+  0x00, 0x00, 0x0B, 0x40, 0x00, 0x02, 0xC1, 0x00, 0x00, 0x5B, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x2C, 0x20, 0x04, 0xC0, 0x00, 0x96, 0x00, 0x3B, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x4B,
+  0x00, 0xA5, 0x04, 0xB0, 0x3C, 0x10, 0x01, 0x00, 0x00, 0x10, 0x00, 0x00, 0x82, 0x00, 0x30, 0x83,
+  0x12, 0x6C, 0xDC, 0xA3, 0x02, 0xDB, 0x00, 0x0B, 0x27, 0x60, 0x14, 0x00, 0x50, 0x00, 0x10, 0x00,
+  0x00, 0x94, 0x00, 0x00, 0x94, 0x00, 0x89, 0xDA, 0x95, 0x33, 0xA6, 0x32, 0x00, 0x94, 0x00, 0x00,
+  0x62, 0x00, 0x1D, 0xA0, 0x1D, 0xF0, 0x00, 0xD0, 0x19, 0x70, 0x45, 0x00, 0x89, 0x99, 0x95, 0x33,
+  0x33, 0x32, 0x1E, 0x90, 0x2F, 0xB0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC3, 0x00, 0x02,
+  0xC0, 0x00, 0x08, 0x60, 0x00, 0x0D, 0x10, 0x00, 0x4A, 0x00, 0x00, 0xA4, 0x00, 0x01, 0xD0, 0x00,
+  0x06, 0x80, 0x00, 0x0C, 0x20, 0x00, 0x2C, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x14, 0x30, 0x00, 0x02, 0xD9, 0xBA, 0x00, 0x0A, 0x60, 0x0B, 0x50, 0x0E, 0x00, 0x06, 0x90, 0x1D,
+  0x0D, 0x74, 0xB0, 0x1E, 0x08, 0x44, 0xB0, 0x0E, 0x10, 0x06, 0x90, 0x09, 0x70, 0x0C, 0x40, 0x01,
+  0xCB, 0xD8, 0x00, 0x00, 0x02, 0x10, 0x00, 0x00, 0x11, 0x00, 0x1A, 0xE9, 0x00, 0x02, 0x89, 0x00,
+  0x00, 0x79, 0x00, 0x00, 0x79, 0x00, 0x00, 0x79, 0x00, 0x00, 0x79, 0x00, 0x00, 0x79, 0x00, 0xAD,
+  0xEE, 0xD9, 0x00, 0x24, 0x20, 0x00, 0x08, 0xC9, 0xC8, 0x00, 0x05, 0x00, 0x1E, 0x20, 0x00, 0x00,
+  0x0D, 0x20, 0x00, 0x00, 0x4C, 0x00, 0x00, 0x02, 0xD3, 0x00, 0x00, 0x2D, 0x40, 0x00, 0x03, 0xD4,
+  0x00, 0x00, 0x1E, 0xED, 0xEE, 0x90, 0x00, 0x24, 0x30, 0x00, 0x08, 0xC9, 0xCB, 0x00, 0x03, 0x00,
+  0x0D, 0x40, 0x00, 0x00, 0x1D, 0x20, 0x00, 0x4A, 0xD4, 0x00, 0x00, 0x14, 0x7C, 0x20, 0x00, 0x00,
+  0x08, 0x80, 0x16, 0x00, 0x0B, 0x70, 0x19, 0xDB, 0xDA, 0x10, 0x00, 0x12, 0x10, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x00, 0x01, 0xDA, 0x00, 0x00, 0x0B, 0x9A, 0x00, 0x00, 0x79, 0x5A, 0x00, 0x04, 0xB0,
+  0x5A, 0x00, 0x2D, 0x31, 0x6B, 0x10, 0x6B, 0xBB, 0xDE, 0xB0, 0x00, 0x00, 0x5A, 0x00, 0x00, 0x00,
+  0x5A, 0x00, 0x01, 0x22, 0x22, 0x00, 0x06, 0xEC, 0xCC, 0x30, 0x07, 0x80, 0x00, 0x00, 0x08, 0x62,
+  0x10, 0x00, 0x09, 0xCA, 0xCB, 0x10, 0x00, 0x00, 0x0A, 0x70, 0x00, 0x00, 0x07, 0x90, 0x16, 0x00,
+  0x1C, 0x60, 0x19, 0xDB, 0xD9, 0x00, 0x00, 0x12, 0x10, 0x00, 0x00, 0x02, 0x41, 0x00, 0x00, 0xAC,
+  0x9D, 0x50, 0x07, 0xA0, 0x00, 0x10, 0x0C, 0x30, 0x00, 0x00, 0x0F, 0x5B, 0xCA, 0x10, 0x0F, 0x70,
+  0x08, 0x90, 0x0D, 0x10, 0x03, 0xC0, 0x08, 0x80, 0x07, 0x90, 0x01, 0xAC, 0xBB, 0x10, 0x00, 0x01,
+  0x20, 0x00, 0x02, 0x22, 0x22, 0x10, 0x1C, 0xCC, 0xCD, 0xA0, 0x00, 0x00, 0x1C, 0x10, 0x00, 0x00,
+  0xA5, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x08, 0x70, 0x00, 0x00, 0x0C, 0x30, 0x00, 0x00, 0x0F,
+  0x10, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x14, 0x30, 0x00, 0x02, 0xD8, 0x9C, 0x10, 0x09, 0x60,
+  0x09, 0x50, 0x07, 0x90, 0x0A, 0x40, 0x00, 0xBC, 0x98, 0x00, 0x07, 0x83, 0x8D, 0x30, 0x1D, 0x00,
+  0x05, 0xA0, 0x1E, 0x10, 0x06, 0xA0, 0x05, 0xDA, 0xAC, 0x20, 0x00, 0x02, 0x20, 0x00, 0x00, 0x14,
+  0x20, 0x00, 0x06, 0xD9, 0xC8, 0x00, 0x1E, 0x10, 0x0C, 0x40, 0x2D, 0x00, 0x06, 0x90, 0x0D, 0x40,
+  0x3C, 0xA0, 0x03, 0xBC, 0x97, 0x90, 0x00, 0x00, 0x09, 0x70, 0x02, 0x00, 0x3D, 0x10, 0x09, 0xDB,
+  0xD4, 0x00, 0x00, 0x12, 0x00, 0x00, 0x07, 0x40, 0x3F, 0xC0, 0x07, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x1E, 0x90, 0x2F, 0xB0, 0x01, 0x00, 0x07, 0x40, 0x3F, 0xC0, 0x07, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x1D, 0xA0, 0x1D, 0xF0, 0x00, 0xD0, 0x19, 0x70, 0x45, 0x00, 0x00, 0x00, 0x53, 0x00, 0x1A, 0xA1,
+  0x04, 0xC5, 0x00, 0x6C, 0x20, 0x00, 0x2C, 0x70, 0x00, 0x00, 0x8C, 0x30, 0x00, 0x03, 0xC3, 0x00,
+  0x00, 0x01, 0xBC, 0xCC, 0xC7, 0x00, 0x00, 0x00, 0x34, 0x44, 0x42, 0x78, 0x88, 0x85, 0x62, 0x00,
+  0x00, 0x4C, 0x60, 0x00, 0x01, 0x9B, 0x20, 0x00, 0x04, 0xD1, 0x00, 0x2B, 0x90, 0x06, 0xC4, 0x00,
+  0x89, 0x10, 0x00, 0x20, 0x00, 0x00, 0x06, 0xA9, 0x20, 0x58, 0x37, 0xD0, 0x00, 0x00, 0xE1, 0x00,
+  0x08, 0x90, 0x00, 0x7A, 0x00, 0x00, 0xE1, 0x00, 0x00, 0x10, 0x00, 0x02, 0xB4, 0x00, 0x03, 0xF7,
+  0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x8B, 0xAB, 0x20, 0x08, 0x70, 0x02, 0xA0,
+  0x1C, 0x00, 0x00, 0xB0, 0x48, 0x02, 0x9A, 0xE0, 0x57, 0x1C, 0x20, 0xC0, 0x57, 0x2C, 0x02, 0xD0,
+  0x39, 0x08, 0xB8, 0x80, 0x0C, 0x10, 0x00, 0x00, 0x04, 0xA1, 0x01, 0x20, 0x00, 0x4A, 0xB9, 0x20,
+  0x00, 0x04, 0x20, 0x00, 0x00, 0x1D, 0xB0, 0x00, 0x00, 0x68, 0xD1, 0x00, 0x00, 0xB3, 0x96, 0x00,
+  0x01, 0xD0, 0x4B, 0x00, 0x06, 0xC6, 0x6F, 0x10, 0x0B, 0x87, 0x7C, 0x60, 0x1E, 0x00, 0x05, 0xB0,
+  0x6A, 0x00, 0x01, 0xE1, 0x45, 0x54, 0x10, 0xAA, 0x79, 0xD2, 0xA6, 0x00, 0xA7, 0xA6, 0x00, 0xC4,
+  0xAD, 0xCE, 0x90, 0xA6, 0x01, 0x99, 0xA6, 0x00, 0x2E, 0xA6, 0x00, 0x7B, 0xAE, 0xDD, 0xA2, 0x00,
+  0x05, 0x75, 0x00, 0x01, 0xDA, 0x7A, 0x90, 0x0A, 0x80, 0x00, 0x10, 0x1F, 0x20, 0x00, 0x00, 0x2E,
+  0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0E, 0x30, 0x00, 0x00, 0x07, 0xC1, 0x01, 0x70, 0x00,
+  0x8E, 0xCD, 0x70, 0x00, 0x01, 0x21, 0x00, 0x55, 0x52, 0x00, 0xE9, 0x8C, 0xA0, 0xE2, 0x00, 0xB8,
+  0xE2, 0x00, 0x4D, 0xE2, 0x00, 0x2F, 0xE2, 0x00, 0x2E, 0xE2, 0x00, 0x6B, 0xE2, 0x03, 0xE4, 0xED,
+  0xDC, 0x50, 0x35, 0x55, 0x53, 0x8C, 0x88, 0x85, 0x88, 0x00, 0x00, 0x88, 0x00, 0x00, 0x8E, 0xDD,
+  0xC0, 0x88, 0x11, 0x10, 0x88, 0x00, 0x00, 0x88, 0x00, 0x00, 0x8E, 0xEE, 0xEA, 0x15, 0x55, 0x54,
+  0x4D, 0x88, 0x87, 0x4C, 0x00, 0x00, 0x4C, 0x00, 0x00, 0x4E, 0x99, 0x92, 0x4C, 0x44, 0x41, 0x4C,
+  0x00, 0x00, 0x4C, 0x00, 0x00, 0x4C, 0x00, 0x00, 0x00, 0x16, 0x74, 0x00, 0x03, 0xE9, 0x7B, 0x70,
+  0x0C, 0x60, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x5C, 0x00, 0x45, 0x40, 0x4C, 0x00, 0x7A, 0xC0,
+  0x2F, 0x10, 0x03, 0xC0, 0x0A, 0xA0, 0x04, 0xC0, 0x01, 0xAE, 0xCD, 0x60, 0x00, 0x01, 0x20, 0x00,
+  0x50, 0x00, 0x23, 0xF1, 0x00, 0x79, 0xF1, 0x00, 0x79, 0xF1, 0x00, 0x79, 0xFD, 0xDD, 0xE9, 0xF2,
+  0x11, 0x79, 0xF1, 0x00, 0x79, 0xF1, 0x00, 0x79, 0xF1, 0x00, 0x79, 0x45, 0x55, 0x52, 0x68, 0xDB,
+  0x83, 0x00, 0xB5, 0x00, 0x00, 0xB5, 0x00, 0x00, 0xB5, 0x00, 0x00, 0xB5, 0x00, 0x00, 0xB5, 0x00,
+  0x00, 0xB5, 0x00, 0xBE, 0xFE, 0xE6, 0x25, 0x55, 0x51, 0x28, 0x88, 0xD4, 0x00, 0x00, 0xC4, 0x00,
+  0x00, 0xC4, 0x00, 0x00, 0xC4, 0x00, 0x00, 0xC4, 0x00, 0x00, 0xC4, 0x82, 0x02, 0xE2, 0x5E, 0xCE,
+  0x70, 0x00, 0x21, 0x00, 0x42, 0x00, 0x15, 0x00, 0xB5, 0x01, 0xC5, 0x00, 0xB5, 0x0A, 0x80, 0x00,
+  0xB5, 0x8B, 0x00, 0x00, 0xBA, 0xEC, 0x00, 0x00, 0xBE, 0x2B, 0x60, 0x00, 0xB6, 0x03, 0xD1, 0x00,
+  0xB5, 0x00, 0xA8, 0x00, 0xB5, 0x00, 0x2E, 0x20, 0x24, 0x00, 0x00, 0x4B, 0x00, 0x00, 0x4B, 0x00,
+  0x00, 0x4B, 0x00, 0x00, 0x4B, 0x00, 0x00, 0x4B, 0x00, 0x00, 0x4B, 0x00, 0x00, 0x4B, 0x00, 0x00,
+  0x4F, 0xEE, 0xEC, 0x51, 0x00, 0x33, 0xE7, 0x00, 0xC9, 0xCB, 0x03, 0xC9, 0xD9, 0x28, 0x89, 0xD4,
+  0x7B, 0x59, 0xD0, 0xC8, 0x49, 0xD0, 0x73, 0x49, 0xD0, 0x00, 0x49, 0xD0, 0x00, 0x49, 0x51, 0x00,
+  0x23, 0xE9, 0x00, 0x69, 0xDC, 0x20, 0x69, 0xE5, 0x90, 0x69, 0xE1, 0xC2, 0x69, 0xE1, 0x5A, 0x69,
+  0xE1, 0x0C, 0x89, 0xE1, 0x04, 0xD9, 0xE1, 0x00, 0xB9, 0x00, 0x37, 0x61, 0x00, 0x05, 0xD7, 0x9D,
+  0x10, 0x1E, 0x30, 0x09, 0x90, 0x4D, 0x00, 0x03, 0xE0, 0x6B, 0x00, 0x01, 0xF0, 0x5B, 0x00, 0x02,
+  0xF0, 0x3E, 0x00, 0x05, 0xC0, 0x0C, 0x70, 0x1C, 0x60, 0x02, 0xCC, 0xE9, 0x00, 0x00, 0x02, 0x10,
+  0x00, 0x45, 0x55, 0x20, 0xBA, 0x89, 0xD6, 0xB5, 0x00, 0x3D, 0xB5, 0x00, 0x3E, 0xB7, 0x34, 0xB8,
+  0xBC, 0xAA, 0x60, 0xB5, 0x00, 0x00, 0xB5, 0x00, 0x00, 0xB5, 0x00, 0x00, 0x00, 0x37, 0x61, 0x00,
+  0x05, 0xD7, 0x9D, 0x10, 0x1E, 0x30, 0x09, 0x80, 0x4D, 0x00, 0x04, 0xD0, 0x5B, 0x00, 0x02, 0xE0,
+  0x5B, 0x00, 0x02, 0xE0, 0x2E, 0x00, 0x05, 0xB0, 0x0C, 0x70, 0x1C, 0x60, 0x02, 0xCC, 0xD8, 0x00,
+  0x00, 0x08, 0xB0, 0x00, 0x00, 0x00, 0x9E, 0xC0, 0x00, 0x00, 0x00, 0x10, 0x45, 0x55, 0x10, 0x00,
+  0xBA, 0x89, 0xE4, 0x00, 0xB5, 0x00, 0x5B, 0x00, 0xB5, 0x00, 0x5B, 0x00, 0xB9, 0x67, 0xD4, 0x00,
+  0xBA, 0x8F, 0x30, 0x00, 0xB5, 0x09, 0x90, 0x00, 0xB5, 0x01, 0xE3, 0x00, 0xB5, 0x00, 0x7B, 0x00,
+  0x00, 0x37, 0x73, 0x00, 0x05, 0xD7, 0x7C, 0x50, 0x0B, 0x60, 0x00, 0x00, 0x08, 0xB2, 0x00, 0x00,
+  0x01, 0x9E, 0xA3, 0x00, 0x00, 0x01, 0x7E, 0x60, 0x00, 0x00, 0x05, 0xC0, 0x08, 0x20, 0x07, 0xA0,
+  0x06, 0xEC, 0xDC, 0x20, 0x00, 0x02, 0x20, 0x00, 0x25, 0x55, 0x55, 0x51, 0x48, 0x8D, 0xB8, 0x81,
+  0x00, 0x0B, 0x50, 0x00, 0x00, 0x0B, 0x50, 0x00, 0x00, 0x0B, 0x50, 0x00, 0x00, 0x0B, 0x50, 0x00,
+  0x00, 0x0B, 0x50, 0x00, 0x00, 0x0B, 0x50, 0x00, 0x00, 0x0B, 0x50, 0x00, 0x50, 0x00, 0x23, 0xF1,
+  0x00, 0x69, 0xF1, 0x00, 0x69, 0xF1, 0x00, 0x69, 0xF1, 0x00, 0x69, 0xF1, 0x00, 0x69, 0xE2, 0x00,
+  0x79, 0xB7, 0x00, 0xC5, 0x2D, 0xCD, 0xA0, 0x00, 0x21, 0x00, 0x24, 0x00, 0x00, 0x50, 0x3E, 0x00,
+  0x04, 0xC0, 0x0D, 0x30, 0x08, 0x80, 0x08, 0x80, 0x0D, 0x30, 0x03, 0xC0, 0x2D, 0x00, 0x00, 0xD2,
+  0x68, 0x00, 0x00, 0x96, 0xB4, 0x00, 0x00, 0x4B, 0xD0, 0x00, 0x00, 0x0E, 0x90, 0x00, 0x51, 0x00,
+  0x00, 0x33, 0xB4, 0x00, 0x00, 0x96, 0x96, 0x02, 0x10, 0xB4, 0x68, 0x0B, 0x70, 0xD1, 0x4A, 0x1B,
+  0xB0, 0xE0, 0x2C, 0x47, 0xC2, 0xC0, 0x0D, 0x83, 0x97, 0xA0, 0x0C, 0xB0, 0x5C, 0x70, 0x0A, 0xA0,
+  0x1F, 0x50, 0x05, 0x10, 0x02, 0x40, 0x0A, 0x70, 0x0C, 0x40, 0x02, 0xE1, 0x5B, 0x00, 0x00, 0x89,
+  0xC3, 0x00, 0x00, 0x1E, 0x90, 0x00, 0x00, 0x4C, 0xD0, 0x00, 0x00, 0xD3, 0x97, 0x00, 0x07, 0xA0,
+  0x2E, 0x20, 0x1E, 0x20, 0x08, 0xA0, 0x24, 0x00, 0x00, 0x50, 0x2E, 0x10, 0x05, 0xB0, 0x08, 0x80,
+  0x0D, 0x30, 0x01, 0xE1, 0x5A, 0x00, 0x00, 0x88, 0xC2, 0x00, 0x00, 0x1E, 0x90, 0x00, 0x00, 0x0B,
+  0x50, 0x00, 0x00, 0x0B, 0x50, 0x00, 0x00, 0x0B, 0x50, 0x00, 0x04, 0x55, 0x55, 0x40, 0x06, 0x88,
+  0x8D, 0x90, 0x00, 0x00, 0x3D, 0x10, 0x00, 0x00, 0xC4, 0x00, 0x00, 0x08, 0x90, 0x00, 0x00, 0x3D,
+  0x10, 0x00, 0x01, 0xD3, 0x00, 0x00, 0x09, 0x80, 0x00, 0x00, 0x2F, 0xEE, 0xEE, 0xC0, 0x00, 0x00,
+  0x00, 0x2D, 0x99, 0x40, 0x2B, 0x00, 0x00, 0x2B, 0x00, 0x00, 0x2B, 0x00, 0x00, 0x2B, 0x00, 0x00,
+  0x2B, 0x00, 0x00, 0x2B, 0x00, 0x00, 0x2B, 0x00, 0x00, 0x2B, 0x00, 0x00, 0x2B, 0x00, 0x00, 0x2D,
+  0x99, 0x40, 0x00, 0x00, 0x00, 0x86, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x0C, 0x20, 0x00, 0x06, 0x80,
+  0x00, 0x01, 0xD0, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x4A, 0x00, 0x00, 0x0D, 0x10, 0x00, 0x08, 0x60,
+  0x00, 0x02, 0xC0, 0x00, 0x00, 0xC3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x9C, 0x00, 0x1C, 0x00,
+  0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x79,
+  0x9B, 0x00, 0x63, 0x00, 0x01, 0xDA, 0x00, 0x07, 0x6B, 0x10, 0x0C, 0x16, 0x70, 0x4A, 0x01, 0xC0,
+  0x32, 0x00, 0x41, 0x02, 0x22, 0x22, 0x20, 0x3C, 0xCC, 0xCC, 0xA0, 0x21, 0x00, 0x2C, 0x10, 0x05,
+  0x50, 0x01, 0x45, 0x10, 0x6C, 0x8A, 0xD2, 0x10, 0x00, 0x97, 0x05, 0xAA, 0xD8, 0xA8, 0x10, 0x78,
+  0xE2, 0x01, 0xA8, 0x7D, 0xBB, 0x88, 0x01, 0x20, 0x00, 0x10, 0x00, 0x00, 0xC3, 0x00, 0x00, 0xC3,
+  0x00, 0x00, 0xC3, 0x35, 0x10, 0xCB, 0xA9, 0xE3, 0xC5, 0x00, 0x7A, 0xC3, 0x00, 0x3D, 0xC3, 0x00,
+  0x4C, 0xC5, 0x00, 0xA8, 0xC9, 0xCD, 0xB1, 0x00, 0x12, 0x00, 0x00, 0x35, 0x30, 0x1C, 0xB8, 0xC7,
+  0xA8, 0x00, 0x01, 0xE2, 0x00, 0x00, 0xE3, 0x00, 0x00, 0x9A, 0x00, 0x03, 0x1A, 0xDB, 0xD6, 0x00,
+  0x12, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x09, 0x70, 0x00, 0x00, 0x09, 0x70, 0x00, 0x25,
+  0x29, 0x70, 0x05, 0xE9, 0xAD, 0x70, 0x0E, 0x30, 0x09, 0x70, 0x3D, 0x00, 0x09, 0x70, 0x3D, 0x00,
+  0x09, 0x70, 0x0E, 0x40, 0x1C, 0x70, 0x05, 0xEB, 0xCA, 0x70, 0x00, 0x12, 0x00, 0x00, 0x00, 0x14,
+  0x41, 0x00, 0x03, 0xD9, 0x8D, 0x20, 0x0C, 0x40, 0x05, 0xA0, 0x1F, 0x99, 0x9A, 0xC0, 0x1F, 0x32,
+  0x22, 0x20, 0x0B, 0x70, 0x00, 0x10, 0x01, 0xBC, 0xBC, 0x40, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01,
+  0x32, 0x00, 0x00, 0x5D, 0xAB, 0x30, 0x00, 0xC4, 0x00, 0x00, 0x12, 0xE4, 0x32, 0x00, 0x7A, 0xFB,
+  0xA7, 0x00, 0x00, 0xE2, 0x00, 0x00, 0x00, 0xE2, 0x00, 0x00, 0x00, 0xE2, 0x00, 0x00, 0x00, 0xE2,
+  0x00, 0x00, 0x00, 0xE2, 0x00, 0x00, 0x00, 0x15, 0x43, 0x30, 0x03, 0xD7, 0xBD, 0x92, 0x0A, 0x50,
+  0x0D, 0x10, 0x09, 0x70, 0x1E, 0x10, 0x03, 0xEA, 0xC5, 0x00, 0x0A, 0x40, 0x00, 0x00, 0x06, 0xEC,
+  0xBB, 0x70, 0x0C, 0x21, 0x23, 0xE3, 0x1E, 0x20, 0x04, 0xD1, 0x04, 0xBB, 0xB8, 0x20, 0x10, 0x00,
+  0x00, 0xC3, 0x00, 0x00, 0xC3, 0x00, 0x00, 0xC3, 0x25, 0x20, 0xC9, 0xB9, 0xE4, 0xC7, 0x00, 0x89,
+  0xC3, 0x00, 0x6A, 0xC3, 0x00, 0x6A, 0xC3, 0x00, 0x6A, 0xC3, 0x00, 0x6A, 0x00, 0x01, 0x00, 0x00,
+  0x5F, 0x30, 0x00, 0x27, 0x10, 0x23, 0x33, 0x00, 0x9A, 0xAF, 0x10, 0x00, 0x0F, 0x10, 0x00, 0x0F,
+  0x10, 0x00, 0x0F, 0x10, 0x00, 0x0F, 0x10, 0x00, 0x0F, 0x10, 0x00, 0x00, 0x10, 0x00, 0x05, 0xF3,
+  0x00, 0x02, 0x71, 0x02, 0x33, 0x30, 0x09, 0xAA, 0xF1, 0x00, 0x00, 0xF1, 0x00, 0x00, 0xF1, 0x00,
+  0x00, 0xF1, 0x00, 0x00, 0xF1, 0x00, 0x00, 0xF1, 0x00, 0x00, 0xF1, 0x04, 0x27, 0xC0, 0x19, 0xB9,
+  0x20, 0x10, 0x00, 0x00, 0x00, 0xA6, 0x00, 0x00, 0x00, 0xA6, 0x00, 0x00, 0x00, 0xA6, 0x00, 0x12,
+  0x00, 0xA6, 0x01, 0xC5, 0x00, 0xA6, 0x2C, 0x50, 0x00, 0xA8, 0xDB, 0x00, 0x00, 0xAE, 0x4B, 0x60,
+  0x00, 0xA7, 0x01, 0xD3, 0x00, 0xA6, 0x00, 0x4D, 0x10, 0x11, 0x10, 0x00, 0xBC, 0xF3, 0x00, 0x00,
+  0xD3, 0x00, 0x00, 0xD3, 0x00, 0x00, 0xD3, 0x00, 0x00, 0xD3, 0x00, 0x00, 0xD3, 0x00, 0x00, 0xD3,
+  0x00, 0x00, 0xC4, 0x00, 0x00, 0x6E, 0xB9, 0x00, 0x01, 0x20, 0x12, 0x33, 0x04, 0x20, 0x4D, 0xAD,
+  0xAA, 0xD0, 0x4D, 0x08, 0x60, 0xE1, 0x4C, 0x07, 0x50, 0xE1, 0x4C, 0x07, 0x50, 0xE1, 0x4C, 0x07,
+  0x50, 0xE1, 0x4C, 0x07, 0x50, 0xE1, 0x20, 0x25, 0x20, 0xC8, 0xB9, 0xE4, 0xC7, 0x00, 0x89, 0xC3,
+  0x00, 0x6A, 0xC3, 0x00, 0x6A, 0xC3, 0x00, 0x6A, 0xC3, 0x00, 0x6A, 0x00, 0x15, 0x40, 0x00, 0x05,
+  0xD9, 0xAC, 0x10, 0x0E, 0x30, 0x09, 0x90, 0x3D, 0x00, 0x04, 0xD0, 0x3E, 0x00, 0x04, 0xC0, 0x0D,
+  0x50, 0x0A, 0x80, 0x03, 0xDB, 0xDA, 0x00, 0x00, 0x02, 0x10, 0x00, 0x20, 0x35, 0x10, 0xCB, 0xA9,
+  0xE3, 0xC5, 0x00, 0x7A, 0xC3, 0x00, 0x3D, 0xC3, 0x00, 0x4C, 0xC5, 0x00, 0xA8, 0xCB, 0xCD, 0xB1,
+  0xC3, 0x12, 0x00, 0xC3, 0x00, 0x00, 0x72, 0x00, 0x00, 0x00, 0x25, 0x21, 0x10, 0x05, 0xE9, 0xAC,
+  0x70, 0x0E, 0x30, 0x09, 0x70, 0x3D, 0x00, 0x09, 0x70, 0x3D, 0x00, 0x09, 0x70, 0x0E, 0x40, 0x1C,
+  0x70, 0x05, 0xEB, 0xCB, 0x70, 0x00, 0x12, 0x09, 0x70, 0x00, 0x00, 0x09, 0x70, 0x00, 0x00, 0x05,
+  0x40, 0x02, 0x02, 0x53, 0x2B, 0x7C, 0x98, 0x2E, 0x80, 0x00, 0x2E, 0x00, 0x00, 0x2E, 0x00, 0x00,
+  0x2E, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x25, 0x41, 0x00, 0x06, 0xD8, 0x8C, 0x20, 0x0A, 0x70,
+  0x00, 0x00, 0x02, 0xCB, 0x72, 0x00, 0x00, 0x02, 0x6D, 0x60, 0x04, 0x00, 0x07, 0xA0, 0x08, 0xCA,
+  0xBC, 0x30, 0x00, 0x02, 0x20, 0x00, 0x00, 0x39, 0x00, 0x00, 0x02, 0x6B, 0x33, 0x20, 0x1A, 0xCD,
+  0xAA, 0x70, 0x00, 0x6A, 0x00, 0x00, 0x00, 0x6A, 0x00, 0x00, 0x00, 0x6A, 0x00, 0x00, 0x00, 0x4C,
+  0x00, 0x00, 0x00, 0x0B, 0xCB, 0xA0, 0x00, 0x00, 0x22, 0x00, 0x03, 0x00, 0x02, 0x10, 0x0F, 0x10,
+  0x09, 0x60, 0x0F, 0x10, 0x09, 0x60, 0x0F, 0x10, 0x09, 0x60, 0x0F, 0x10, 0x09, 0x60, 0x0E, 0x30,
+  0x2D, 0x60, 0x07, 0xEC, 0xA8, 0x60, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x30, 0x1E, 0x10,
+  0x04, 0xB0, 0x0A, 0x60, 0x0B, 0x40, 0x03, 0xC0, 0x2D, 0x00, 0x00, 0xC3, 0x87, 0x00, 0x00, 0x69,
+  0xD1, 0x00, 0x00, 0x0E, 0xA0, 0x00, 0x21, 0x00, 0x00, 0x11, 0xB5, 0x09, 0x50, 0x96, 0x88, 0x0A,
+  0x90, 0xC3, 0x4B, 0x28, 0xB1, 0xE0, 0x1E, 0x65, 0xA5, 0xB0, 0x0D, 0xB1, 0x6A, 0x80, 0x09, 0xD0,
+  0x3F, 0x40, 0x03, 0x10, 0x01, 0x20, 0x08, 0xA0, 0x1D, 0x30, 0x00, 0xB5, 0x97, 0x00, 0x00, 0x2E,
+  0xB0, 0x00, 0x00, 0x5C, 0xD1, 0x00, 0x02, 0xD1, 0x7A, 0x00, 0x0C, 0x40, 0x0B, 0x60, 0x12, 0x00,
+  0x00, 0x30, 0x1E, 0x10, 0x04, 0xB0, 0x09, 0x60, 0x0A, 0x50, 0x02, 0xD0, 0x1D, 0x00, 0x00, 0xA5,
+  0x68, 0x00, 0x00, 0x3B, 0xC2, 0x00, 0x00, 0x0B, 0xA0, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x03, 0x7C,
+  0x00, 0x00, 0x1A, 0x81, 0x00, 0x00, 0x02, 0x33, 0x33, 0x20, 0x06, 0xAA, 0xAF, 0x70, 0x00, 0x00,
+  0x9A, 0x00, 0x00, 0x07, 0xB0, 0x00, 0x00, 0x6C, 0x10, 0x00, 0x04, 0xD1, 0x00, 0x00, 0x1E, 0xED,
+  0xDD, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x5B, 0x94, 0x00, 0xB3, 0x00, 0x00, 0xB3, 0x00, 0x00, 0xA3,
+  0x00, 0x00, 0xB2, 0x00, 0x5D, 0xA0, 0x00, 0x00, 0xB3, 0x00, 0x00, 0xA3, 0x00, 0x00, 0xB2, 0x00,
+  0x00, 0xB3, 0x00, 0x00, 0x4B, 0x94, 0x52, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4,
+  0xA4, 0xA4, 0xA4, 0x21, 0x00, 0x00, 0x00, 0x79, 0xB1, 0x00, 0x00, 0x85, 0x00, 0x00, 0x85, 0x00,
+  0x00, 0x84, 0x00, 0x00, 0x87, 0x00, 0x00, 0x2D, 0xB1, 0x00, 0x86, 0x00, 0x00, 0x84, 0x00, 0x00,
+  0x85, 0x00, 0x00, 0x85, 0x00, 0x7A, 0xA1, 0x00, 0x00, 0x10, 0x00, 0x00, 0x07, 0xBC, 0x46, 0x70,
+  0x07, 0x02, 0x99, 0x10,
+};
+
+static const LCD_GlyphTypeDef Font16_Glyphs[] =
+{
+  /* Offset, Width, Height, XOffset, YOffset, Advance */
+  {    0,  0,  0,   0,   0,  8},  /*   */
+  {    0,  3, 10,   2,   4,  8},  /* ! */
+  {   20,  5,  5,   1,   4,  8},  /* " */
+  {   35,  6,  9,   1,   4,  8},  /* # */
+  {   62,  6, 12,   1,   3,  8},  /* $ */
+  {   98,  8, 10,   0,   4,  8},  /* % */
+  {  138,  8, 10,   0,   4,  8},  /* & */
+  {  178,  2,  5,   3,   4,  8},  /* ' */
+  {  183,  5, 13,   2,   3,  8},  /* ( */
+  {  222,  4, 13,   1,   3,  8},  /* ) */
+  {  248,  6,  7,   1,   5,  8},  /* 0x2A */
+  {  269,  6,  7,   1,   5,  8},  /* + */
+  {  290,  4,  5,   2,  11,  8},  /* , */
+  {  300,  6,  2,   1,   8,  8},  /* - */
+  {  306,  3,  3,   2,  11,  8},  /* . */
+  {  312,  6, 13,   1,   3,  8},  /* 0x2F */
+  {  351,  7, 10,   0,   4,  8},  /* 0 */
+  {  391,  6,  9,   1,   4,  8},  /* 1 */
+  {  418,  7,  9,   0,   4,  8},  /* 2 */
+  {  454,  7, 10,   0,   4,  8},  /* 3 */
+  {  494,  7,  9,   0,   4,  8},  /* 4 */
+  {  530,  7, 10,   0,   4,  8},  /* 5 */
+  {  570,  7, 10,   0,   4,  8},  /* 6 */
+  {  610,  7,  9,   0,   4,  8},  /* 7 */
+  {  646,  7, 10,   0,   4,  8},  /* 8 */
+  {  686,  7, 10,   0,   4,  8},  /* 9 */
+  {  726,  3,  8,   2,   6,  8},  /* : */
+  {  742,  4, 10,   2,   6,  8},  /* ; */
+  {  762,  6,  8,   1,   5,  8},  /* < */
+  {  786,  6,  4,   1,   7,  8},  /* = */
+  {  798,  6,  8,   1,   5,  8},  /* > */
+  {  822,  6, 10,   1,   4,  8},  /* ? */
+  {  852,  7, 11,   0,   4,  8},  /* @ */
+  {  896,  8,  9,   0,   4,  8},  /* A */
+  {  932,  6,  9,   1,   4,  8},  /* B */
+  {  959,  8, 10,   0,   4,  8},  /* C */
+  {  999,  6,  9,   1,   4,  8},  /* D */
+  { 1026,  6,  9,   1,   4,  8},  /* E */
+  { 1053,  6,  9,   1,   4,  8},  /* F */
+  { 1080,  7, 10,   0,   4,  8},  /* G */
+  { 1120,  6,  9,   1,   4,  8},  /* H */
+  { 1147,  6,  9,   1,   4,  8},  /* I */
+  { 1174,  6, 10,   1,   4,  8},  /* J */
+  { 1204,  7,  9,   1,   4,  8},  /* K */
+  { 1240,  6,  9,   1,   4,  8},  /* L */
+  { 1267,  6,  9,   1,   4,  8},  /* M */
+  { 1294,  6,  9,   1,   4,  8},  /* N */
+  { 1321,  8, 10,   0,   4,  8},  /* O */
+  { 1361,  6,  9,   1,   4,  8},  /* P */
+  { 1388,  8, 12,   0,   4,  8},  /* Q */
+  { 1436,  7,  9,   1,   4,  8},  /* R */
+  { 1472,  7, 10,   0,   4,  8},  /* S */
+  { 1512,  8,  9,   0,   4,  8},  /* T */
+  { 1548,  6, 10,   1,   4,  8},  /* U */
+  { 1578,  8,  9,   0,   4,  8},  /* V */
+  { 1614,  8,  9,   0,   4,  8},  /* W */
+  { 1650,  7,  9,   0,   4,  8},  /* X */
+  { 1686,  8,  9,   0,   4,  8},  /* Y */
+  { 1722,  7,  9,   0,   4,  8},  /* Z */
+  { 1758,  5, 12,   2,   3,  8},  /* [ */
+  { 1794,  6, 13,   1,   3,  8},  /* 0x5C */
+  { 1833,  4, 12,   1,   3,  8},  /* ] */
+  { 1857,  6,  6,   1,   4,  8},  /* ^ */
+  { 1875,  7,  2,   0,  13,  8},  /* _ */
+  { 1883,  3,  3,   2,   3,  8},  /* ` */
+  { 1889,  6,  8,   1,   6,  8},  /* a */
+  { 1913,  6, 11,   1,   3,  8},  /* b */
+  { 1946,  6,  8,   1,   6,  8},  /* c */
+  { 1970,  7, 11,   0,   3,  8},  /* d */
+  { 2014,  7,  8,   0,   6,  8},  /* e */
+  { 2046,  7, 10,   1,   3,  8},  /* f */
+  { 2086,  8, 10,   0,   6,  8},  /* g */
+  { 2126,  6, 10,   1,   3,  8},  /* h */
+  { 2156,  5, 10,   1,   3,  8},  /* i */
+  { 2186,  6, 13,   0,   3,  8},  /* j */
+  { 2225,  7, 10,   1,   3,  8},  /* k */
+  { 2265,  6, 11,   1,   3,  8},  /* l */
+  { 2298,  8,  7,   0,   6,  8},  /* m */
+  { 2326,  6,  7,   1,   6,  8},  /* n */
+  { 2347,  7,  8,   0,   6,  8},  /* o */
+  { 2379,  6, 10,   1,   6,  8},  /* p */
+  { 2409,  7, 10,   0,   6,  8},  /* q */
+  { 2449,  6,  7,   1,   6,  8},  /* r */
+  { 2470,  7,  8,   0,   6,  8},  /* s */
+  { 2502,  7,  9,   0,   5,  8},  /* t */
+  { 2538,  7,  8,   0,   6,  8},  /* u */
+  { 2570,  7,  7,   0,   6,  8},  /* v */
+  { 2598,  8,  7,   0,   6,  8},  /* w */
+  { 2626,  7,  7,   0,   6,  8},  /* x */
+  { 2654,  8, 10,   0,   6,  8},  /* y */
+  { 2694,  7,  7,   0,   6,  8},  /* z */
+  { 2722,  6, 12,   1,   3,  8},  /* { */
+  { 2758,  2, 14,   3,   3,  8},  /* | */
+  { 2772,  6, 12,   1,   3,  8},  /* } */
+  { 2808,  7,  3,   0,   7,  8},  /* ~ */
+};
+
+sFONT Font16 =
+{
+  Font16_Table,
+  8,    /* Width */
+  16,    /* Height */
+  Font16_Glyphs,
+  13,    /* Ascent */
+  0x20,  /* FirstChar */
+  95,    /* GlyphCount */
+  4,     /* Bpp */
+};
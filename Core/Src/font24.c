@@ -0,0 +1,1325 @@
+/**
+  ******************************************************************************
+  * @file    font24.c
+  * @brief   24像素行高A8抗锯齿字体，字符0x20~0x7E
+  *          由Tools/ttf2font.py从Lato-Regular.ttf生成，请勿手工修改
+  *          Copyright (c) 2010-2013 by tyPoland Lukasz Dziedzic with Reserved Font Name "Lato". Licensed under the SIL Open Font License, Version 1.1.
+  ******************************************************************************
+  */
+#include "lcd_font.h"
+
+static const uint8_t Font24_Table[] =
+{
+  0x21, 0x54, 0x19, 0x63, 0xFF, 0x4C, 0x63, 0xFF, 0x4C, 0x63, 0xFF, 0x4C, 0x63, 0xFF, 0x4C, 0x63,
+  0xFF, 0x4C, 0x63, 0xFF, 0x4C, 0x5D, 0xFF, 0x46, 0x4D, 0xFF, 0x36, 0x34, 0xFF, 0x1D, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x13, 0x52, 0x09, 0xB7, 0xFF, 0x91, 0x9F, 0xFF, 0x78, 0x02, 0x1D, 0x00,
+  0x28, 0x54, 0x06, 0x0D, 0x54, 0x22, 0x7A, 0xFF, 0x12, 0x26, 0xFF, 0x66, 0x7A, 0xFF, 0x12, 0x26,
+  0xFF, 0x66, 0x78, 0xFF, 0x0F, 0x24, 0xFF, 0x64, 0x62, 0xF8, 0x01, 0x0E, 0xFF, 0x4E, 0x2A, 0xA1,
+  0x00, 0x00, 0xAC, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x25, 0x43, 0x00, 0x00, 0x3E, 0x29, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xCA, 0xAA, 0x00, 0x00, 0xDD, 0x9D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
+  0xF9, 0x77, 0x00, 0x11, 0xFE, 0x6B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xFF, 0x44, 0x00, 0x43,
+  0xFF, 0x37, 0x00, 0x00, 0x00, 0x0C, 0x1C, 0x75, 0xFF, 0x2E, 0x1C, 0x83, 0xFC, 0x24, 0x1C, 0x01,
+  0x00, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xED, 0x01, 0x00, 0x32, 0x33, 0xCC,
+  0xC6, 0x33, 0x33, 0xD8, 0xBA, 0x33, 0x1E, 0x00, 0x00, 0x00, 0x01, 0xEC, 0x8A, 0x00, 0x05, 0xF7,
+  0x7B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0xFF, 0x57, 0x00, 0x30, 0xFF, 0x48, 0x00, 0x00, 0x00,
+  0x37, 0x8A, 0xAA, 0xFF, 0xA1, 0x8A, 0xB1, 0xFF, 0x9A, 0x8A, 0x2A, 0x00, 0x4F, 0xC4, 0xE4, 0xFB,
+  0xC4, 0xC4, 0xE7, 0xF8, 0xC4, 0xC4, 0x41, 0x00, 0x00, 0x00, 0xA7, 0xD0, 0x00, 0x00, 0xB8, 0xC1,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDB, 0x9D, 0x00, 0x00, 0xEB, 0x8E, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x10, 0xFE, 0x6A, 0x00, 0x21, 0xFF, 0x5B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0xF6, 0x2A,
+  0x00, 0x39, 0xFE, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4D, 0x16, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33,
+  0x6B, 0xFE, 0x69, 0x14, 0x00, 0x00, 0x00, 0x13, 0xB9, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x7F, 0x02,
+  0x00, 0xBC, 0xFA, 0x78, 0x47, 0xF8, 0x38, 0xA6, 0xEB, 0x15, 0x2D, 0xFF, 0x8A, 0x00, 0x39, 0xE7,
+  0x00, 0x00, 0x07, 0x00, 0x4F, 0xFF, 0x63, 0x00, 0x4A, 0xD5, 0x00, 0x00, 0x00, 0x00, 0x31, 0xFF,
+  0xC5, 0x0A, 0x5B, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0xFF, 0xDE, 0xB7, 0xB4, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0B, 0x8F, 0xF4, 0xFF, 0xFE, 0xC9, 0x66, 0x04, 0x00, 0x00, 0x00, 0x00, 0x0C,
+  0xAD, 0xDF, 0xF3, 0xFF, 0xBF, 0x07, 0x00, 0x00, 0x00, 0x00, 0xA1, 0x7D, 0x12, 0xB7, 0xFF, 0x68,
+  0x00, 0x00, 0x00, 0x00, 0xB3, 0x6C, 0x00, 0x27, 0xFF, 0x96, 0x00, 0x00, 0x00, 0x00, 0xC5, 0x5B,
+  0x00, 0x28, 0xFF, 0x84, 0x60, 0x8E, 0x08, 0x00, 0xD7, 0x49, 0x00, 0x97, 0xFF, 0x39, 0xA3, 0xFF,
+  0xDE, 0x7C, 0xEF, 0x90, 0xBC, 0xFF, 0x9A, 0x00, 0x01, 0x5F, 0xCF, 0xFE, 0xFF, 0xFF, 0xE2, 0x70,
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x19, 0xFF, 0x2B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C,
+  0xFE, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x29, 0x6F, 0x67, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x4B, 0x00, 0x00,
+  0x5F, 0xFB, 0xC3, 0xD3, 0xF0, 0x34, 0x00, 0x00, 0x00, 0x00, 0x47, 0xFD, 0x66, 0x00, 0x0B, 0xF1,
+  0x7F, 0x00, 0x01, 0xB4, 0xC5, 0x00, 0x00, 0x00, 0x1A, 0xE9, 0xA7, 0x00, 0x00, 0x3C, 0xFF, 0x2B,
+  0x00, 0x00, 0x5E, 0xFD, 0x08, 0x00, 0x03, 0xBF, 0xDA, 0x0E, 0x00, 0x00, 0x42, 0xFF, 0x24, 0x00,
+  0x00, 0x57, 0xFF, 0x0C, 0x00, 0x82, 0xF8, 0x31, 0x00, 0x00, 0x00, 0x16, 0xFB, 0x5F, 0x00, 0x00,
+  0x94, 0xD7, 0x00, 0x43, 0xFD, 0x6B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8D, 0xF1, 0x8D, 0x9D, 0xFA,
+  0x50, 0x18, 0xE7, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x5E, 0xA7, 0x9D, 0x3C, 0x02,
+  0xBC, 0xDD, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0xF9,
+  0x34, 0x1D, 0xB3, 0xF6, 0xE8, 0x80, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFC, 0x6F, 0x02,
+  0xD0, 0xC5, 0x3D, 0x59, 0xF2, 0x76, 0x00, 0x00, 0x00, 0x00, 0x16, 0xE5, 0xAF, 0x01, 0x38, 0xFF,
+  0x33, 0x00, 0x00, 0x8B, 0xDB, 0x00, 0x00, 0x00, 0x02, 0xB8, 0xE0, 0x11, 0x00, 0x57, 0xFF, 0x0F,
+  0x00, 0x00, 0x66, 0xFA, 0x00, 0x00, 0x00, 0x79, 0xFA, 0x38, 0x00, 0x00, 0x43, 0xFF, 0x25, 0x00,
+  0x00, 0x7D, 0xE5, 0x00, 0x00, 0x3C, 0xFB, 0x73, 0x00, 0x00, 0x00, 0x08, 0xE5, 0xA4, 0x0F, 0x2A,
+  0xE2, 0x8A, 0x00, 0x14, 0xE3, 0xAF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x37, 0xDF, 0xFF, 0xFE, 0xA7,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x25, 0x16, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0E, 0x5B, 0x7B, 0x62, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x39, 0xE9, 0xFE, 0xEA, 0xFC, 0xEE, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xE1,
+  0xE8, 0x2F, 0x00, 0x22, 0xDD, 0xE8, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0xFF, 0x7E, 0x00,
+  0x00, 0x00, 0x50, 0xB6, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xFF, 0x7B, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xED, 0xD8, 0x07, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xA3, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x27, 0xBF, 0xFE, 0xFF, 0x9C, 0x02, 0x00, 0x00, 0x05, 0x5F, 0x24, 0x00,
+  0x00, 0x2C, 0xEE, 0xD0, 0x26, 0xAB, 0xFF, 0x98, 0x01, 0x00, 0x31, 0xFF, 0x4F, 0x00, 0x00, 0xC7,
+  0xF4, 0x1B, 0x00, 0x05, 0xAC, 0xFF, 0x94, 0x01, 0x6E, 0xFF, 0x1D, 0x00, 0x1C, 0xFF, 0xB1, 0x00,
+  0x00, 0x00, 0x05, 0xAE, 0xFF, 0x90, 0xD1, 0xC6, 0x00, 0x00, 0x28, 0xFF, 0xAD, 0x00, 0x00, 0x00,
+  0x00, 0x06, 0xB0, 0xFF, 0xFF, 0x48, 0x00, 0x00, 0x05, 0xEC, 0xF3, 0x20, 0x00, 0x00, 0x00, 0x00,
+  0x65, 0xFF, 0xFF, 0x88, 0x00, 0x00, 0x00, 0x62, 0xFF, 0xE5, 0x71, 0x4D, 0x68, 0xBF, 0xFF, 0x97,
+  0xB2, 0xFF, 0x85, 0x00, 0x00, 0x00, 0x58, 0xDC, 0xFF, 0xFF, 0xFB, 0xBD, 0x46, 0x00, 0x07, 0xAE,
+  0xFF, 0x81, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x25, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x28, 0x54, 0x06, 0x7A, 0xFF, 0x12, 0x7A, 0xFF, 0x12, 0x78, 0xFF, 0x0F, 0x62, 0xF8, 0x01, 0x2A,
+  0xA1, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x85, 0xFA, 0x0F, 0x00, 0x16, 0xF5, 0x9B,
+  0x00, 0x00, 0x7E, 0xFE, 0x26, 0x00, 0x00, 0xDC, 0xC2, 0x00, 0x00, 0x27, 0xFF, 0x74, 0x00, 0x00,
+  0x60, 0xFF, 0x37, 0x00, 0x00, 0x86, 0xFF, 0x0C, 0x00, 0x00, 0x9E, 0xEF, 0x00, 0x00, 0x00, 0xA7,
+  0xE4, 0x00, 0x00, 0x00, 0xA4, 0xE9, 0x00, 0x00, 0x00, 0x92, 0xFA, 0x03, 0x00, 0x00, 0x72, 0xFF,
+  0x23, 0x00, 0x00, 0x41, 0xFF, 0x59, 0x00, 0x00, 0x09, 0xF5, 0xA1, 0x00, 0x00, 0x00, 0xA9, 0xF0,
+  0x0A, 0x00, 0x00, 0x40, 0xFF, 0x69, 0x00, 0x00, 0x00, 0xC1, 0xE1, 0x07, 0x00, 0x00, 0x31, 0xAB,
+  0x09, 0x00, 0x48, 0x02, 0x00, 0x00, 0x2C, 0xFF, 0x63, 0x00, 0x00, 0x00, 0xBC, 0xE3, 0x07, 0x00,
+  0x00, 0x46, 0xFF, 0x5D, 0x00, 0x00, 0x02, 0xE2, 0xBB, 0x00, 0x00, 0x00, 0x95, 0xFA, 0x0C, 0x00,
+  0x00, 0x58, 0xFF, 0x3E, 0x00, 0x00, 0x2C, 0xFF, 0x65, 0x00, 0x00, 0x11, 0xFF, 0x7D, 0x00, 0x00,
+  0x06, 0xFF, 0x86, 0x00, 0x00, 0x0B, 0xFF, 0x82, 0x00, 0x00, 0x1F, 0xFF, 0x71, 0x00, 0x00, 0x44,
+  0xFF, 0x51, 0x00, 0x00, 0x7A, 0xFF, 0x20, 0x00, 0x00, 0xC2, 0xDD, 0x00, 0x00, 0x1F, 0xFD, 0x88,
+  0x00, 0x00, 0x8A, 0xFC, 0x22, 0x00, 0x16, 0xF3, 0xA0, 0x00, 0x00, 0x16, 0xB4, 0x1B, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0x6B, 0x00, 0x00, 0x00, 0x9A,
+  0x38, 0x75, 0x6B, 0x3D, 0x92, 0x00, 0x38, 0xC9, 0xD7, 0xD7, 0xC4, 0x34, 0x00, 0x09, 0x7D, 0xF1,
+  0xF0, 0x77, 0x07, 0x00, 0xC0, 0x85, 0x80, 0x78, 0x8C, 0xBA, 0x00, 0x07, 0x00, 0x75, 0x6B, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x2B, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x56, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xF2, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0x82, 0x00, 0x00, 0x00, 0x00,
+  0x63, 0x63, 0x63, 0x63, 0xF7, 0xB3, 0x63, 0x63, 0x63, 0x3A, 0xF5, 0xF5, 0xF5, 0xF5, 0xFE, 0xFA,
+  0xF5, 0xF5, 0xF5, 0x8E, 0x00, 0x00, 0x00, 0x00, 0xF2, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xF2, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0x82, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x3F, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x44, 0x00, 0x07, 0xF5, 0xFF, 0x3F, 0x01, 0xC5,
+  0xFF, 0x51, 0x00, 0x06, 0xE0, 0x15, 0x00, 0x87, 0x87, 0x00, 0x00, 0x75, 0x04, 0x00, 0xBF, 0xBF,
+  0xBF, 0xBF, 0xB4, 0xC2, 0xC2, 0xC2, 0xC2, 0xB6, 0x00, 0x2C, 0x42, 0x00, 0x0E, 0xF5, 0xFF, 0x44,
+  0x08, 0xE3, 0xF9, 0x32, 0x00, 0x0B, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x9F,
+  0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0xFB, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xBD, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xFE, 0x4A, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x8B, 0xE0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xEA, 0x7D, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x58, 0xFB, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xB0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x27, 0xFE, 0x4A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xE1, 0x03, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0xEB, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5A, 0xFB, 0x1B,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC1, 0xB1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xFE,
+  0x4B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8E, 0xE1, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+  0xD1, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x50, 0x79, 0x6E, 0x2D,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xA5, 0x08, 0x00, 0x00, 0x1B,
+  0xED, 0xF0, 0x59, 0x0D, 0x20, 0x9F, 0xFF, 0x9F, 0x00, 0x00, 0x99, 0xFF, 0x56, 0x00, 0x00, 0x00,
+  0x01, 0xBE, 0xFE, 0x31, 0x06, 0xF1, 0xE1, 0x02, 0x00, 0x00, 0x00, 0x00, 0x4D, 0xFF, 0x90, 0x35,
+  0xFF, 0xA1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFD, 0xCD, 0x57, 0xFF, 0x7F, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xE7, 0xEF, 0x64, 0xFF, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDA, 0xFD,
+  0x62, 0xFF, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDD, 0xFB, 0x4E, 0xFF, 0x87, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xF0, 0xE7, 0x24, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF,
+  0xBD, 0x00, 0xDC, 0xF4, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x6B, 0xFF, 0x75, 0x00, 0x70, 0xFF, 0x8F,
+  0x00, 0x00, 0x00, 0x15, 0xE3, 0xF2, 0x15, 0x00, 0x05, 0xC1, 0xFF, 0xAD, 0x61, 0x74, 0xDF, 0xFE,
+  0x5E, 0x00, 0x00, 0x00, 0x0B, 0x91, 0xF3, 0xFF, 0xFF, 0xD5, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x05, 0x22, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x53, 0x43, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x09, 0xAC, 0xFF, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x16, 0xC7, 0xFF, 0xFF, 0xBA,
+  0x00, 0x00, 0x00, 0x28, 0xDD, 0xFA, 0x6E, 0xFF, 0xBA, 0x00, 0x00, 0x00, 0xC0, 0xEF, 0x44, 0x0D,
+  0xFF, 0xBA, 0x00, 0x00, 0x00, 0x1C, 0x22, 0x00, 0x0D, 0xFF, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0D, 0xFF, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xBA, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0D, 0xFF, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xBA, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF,
+  0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xBA, 0x00, 0x00, 0x00, 0x0C, 0x5C, 0x5C,
+  0x64, 0xFF, 0xD3, 0x5C, 0x5C, 0x32, 0x21, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8C, 0x00,
+  0x00, 0x04, 0x47, 0x75, 0x76, 0x46, 0x03, 0x00, 0x00, 0x00, 0x2A, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xD3, 0x21, 0x00, 0x0C, 0xE1, 0xF5, 0x66, 0x14, 0x1B, 0x82, 0xFF, 0xCC, 0x01, 0x69, 0xFF, 0x6A,
+  0x00, 0x00, 0x00, 0x00, 0xB5, 0xFF, 0x31, 0x61, 0xAF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x85, 0xFF,
+  0x4D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA2, 0xFF, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x14, 0xF2, 0xD7, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAD, 0xFD, 0x45, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x8D, 0xFF, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0xFF, 0x86,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84,
+  0xFF, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0xFF, 0x97, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x7E, 0xFF, 0xED, 0xA3, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0x57, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x99, 0x00, 0x00, 0x00, 0x38, 0x70, 0x79, 0x54, 0x0B, 0x00, 0x00, 0x00,
+  0x14, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF, 0xE8, 0x3D, 0x00, 0x00, 0xBC, 0xFE, 0x84, 0x1C, 0x13, 0x62,
+  0xF7, 0xEA, 0x0D, 0x39, 0xFF, 0x9C, 0x00, 0x00, 0x00, 0x00, 0x89, 0xFF, 0x4F, 0x42, 0xB1, 0x2B,
+  0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0x5C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0xFE,
+  0x28, 0x00, 0x00, 0x00, 0x00, 0x02, 0x20, 0x7E, 0xFB, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
+  0xFF, 0xFE, 0x8C, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x63, 0xA7, 0xFD, 0xBC, 0x07, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1E, 0xFF, 0xAB, 0xA7, 0xDA, 0x07, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xFF, 0xA6, 0x80, 0xFF, 0x7F,
+  0x00, 0x00, 0x00, 0x01, 0xA3, 0xFF, 0x62, 0x0E, 0xDB, 0xFF, 0xAB, 0x63, 0x6A, 0xC1, 0xFF, 0xC2,
+  0x05, 0x00, 0x1A, 0xA9, 0xF9, 0xFF, 0xFF, 0xEE, 0x8B, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x09, 0x24,
+  0x20, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x54, 0x03, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0xFD, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x19, 0xE8, 0xFA, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xBF, 0xE5,
+  0x9C, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0xFC, 0x41, 0x8A, 0xFF, 0x08, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x47, 0xFD, 0x83, 0x00, 0x8A, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x1B,
+  0xEA, 0xC3, 0x04, 0x00, 0x8A, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x04, 0xC2, 0xED, 0x1D, 0x00, 0x00,
+  0x8A, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x87, 0xFE, 0x4F, 0x00, 0x00, 0x00, 0x8A, 0xFF, 0x08, 0x00,
+  0x00, 0x49, 0xFE, 0xB2, 0x2B, 0x2B, 0x2B, 0x2B, 0x9E, 0xFF, 0x32, 0x2B, 0x09, 0x7B, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x33, 0x0C, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+  0xA5, 0xFF, 0x41, 0x3A, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8A, 0xFF, 0x08, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8A, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x8A, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x03, 0x54, 0x54, 0x54, 0x54, 0x54,
+  0x54, 0x42, 0x00, 0x00, 0x27, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x53, 0xFF,
+  0x6F, 0x52, 0x52, 0x52, 0x51, 0x1F, 0x00, 0x00, 0x7F, 0xFC, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xAC, 0xD8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD8, 0xAB, 0x14, 0x27,
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFC, 0xFB, 0xFF, 0xFF, 0xFF, 0xDB, 0x5A, 0x00, 0x00, 0x0E,
+  0x90, 0x8C, 0x5E, 0x55, 0x7F, 0xE9, 0xFF, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21,
+  0xF3, 0xE9, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA9, 0xFF, 0x2B, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x98, 0xFF, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC6, 0xFC,
+  0x11, 0x1C, 0x37, 0x00, 0x00, 0x00, 0x00, 0x51, 0xFF, 0xAE, 0x00, 0xB2, 0xFF, 0xB8, 0x6D, 0x64,
+  0x9F, 0xFB, 0xE2, 0x1C, 0x00, 0x14, 0x92, 0xEE, 0xFF, 0xFF, 0xF5, 0x9F, 0x18, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0x20, 0x23, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x52,
+  0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xCE, 0xFF, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x94, 0xFF, 0x8D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xFF, 0xBF, 0x04, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x21, 0xEF, 0xE2, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xC8, 0xF8, 0x36,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0xFF, 0xB2, 0xA9, 0xC5, 0xAA, 0x52, 0x00, 0x00, 0x27,
+  0xFB, 0xFF, 0xDF, 0x9D, 0xA2, 0xE9, 0xFF, 0x9C, 0x00, 0x93, 0xFF, 0xA3, 0x06, 0x00, 0x00, 0x0E,
+  0xC6, 0xFF, 0x4E, 0xD7, 0xF4, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x3C, 0xFF, 0xA3, 0xE8, 0xCF, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xBB, 0xCB, 0xE8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x2D, 0xFF,
+  0xA0, 0x7D, 0xFF, 0x5B, 0x00, 0x00, 0x00, 0x02, 0xAA, 0xFF, 0x4A, 0x0D, 0xD8, 0xFA, 0x93, 0x57,
+  0x65, 0xC2, 0xFF, 0xA3, 0x00, 0x00, 0x16, 0xA3, 0xF8, 0xFF, 0xFF, 0xE5, 0x75, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x08, 0x25, 0x1D, 0x01, 0x00, 0x00, 0x00, 0x4C, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
+  0x54, 0x54, 0x47, 0xE5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD4, 0x3E, 0x52, 0x52,
+  0x52, 0x52, 0x52, 0x52, 0x7A, 0xFF, 0x8E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB6, 0xF6,
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xFF, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xBB, 0xF7, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0xFF, 0x94, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0xFF, 0x96,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC4, 0xF9, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x47, 0xFF, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC8, 0xFA, 0x1F, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x4C, 0xFF, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xCD, 0xFA, 0x21,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFE, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0C, 0x55, 0x79, 0x70, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0xEA, 0xFF, 0xE9,
+  0xF4, 0xFF, 0xB6, 0x0E, 0x00, 0x00, 0x1B, 0xF3, 0xDD, 0x2D, 0x00, 0x04, 0x71, 0xFF, 0xA3, 0x00,
+  0x00, 0x72, 0xFF, 0x57, 0x00, 0x00, 0x00, 0x00, 0xC2, 0xFB, 0x0B, 0x00, 0x85, 0xFF, 0x38, 0x00,
+  0x00, 0x00, 0x00, 0xA3, 0xFF, 0x1A, 0x00, 0x55, 0xFF, 0x73, 0x00, 0x00, 0x00, 0x04, 0xDB, 0xE7,
+  0x02, 0x00, 0x04, 0xBE, 0xF5, 0x6C, 0x29, 0x39, 0xAE, 0xFC, 0x58, 0x00, 0x00, 0x00, 0x10, 0xC8,
+  0xFF, 0xFF, 0xFF, 0xFD, 0x6F, 0x00, 0x00, 0x00, 0x22, 0xDD, 0xF1, 0x83, 0x4F, 0x5C, 0xB4, 0xFF,
+  0x94, 0x00, 0x00, 0xB8, 0xFE, 0x3B, 0x00, 0x00, 0x00, 0x00, 0xA5, 0xFF, 0x4D, 0x03, 0xFA, 0xD9,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0xFF, 0x92, 0x05, 0xFD, 0xD8, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x44, 0xFF, 0x97, 0x00, 0xC9, 0xFE, 0x38, 0x00, 0x00, 0x00, 0x00, 0xA2, 0xFF, 0x5D, 0x00, 0x3F,
+  0xF9, 0xEF, 0x7C, 0x47, 0x54, 0xAE, 0xFF, 0xC6, 0x05, 0x00, 0x00, 0x38, 0xBE, 0xFC, 0xFF, 0xFF,
+  0xED, 0x8D, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x26, 0x1F, 0x02, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x33, 0x6F, 0x79, 0x54, 0x0A, 0x00, 0x00, 0x00, 0x11, 0xB5, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xE7, 0x40, 0x00, 0x01, 0xBD, 0xFD, 0x7D, 0x15, 0x06, 0x49, 0xE4, 0xF2, 0x1D, 0x41, 0xFF, 0x96,
+  0x00, 0x00, 0x00, 0x00, 0x42, 0xFF, 0x87, 0x7B, 0xFF, 0x4B, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF5,
+  0xBC, 0x7D, 0xFF, 0x51, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF9, 0xC2, 0x48, 0xFF, 0xAA, 0x00, 0x00,
+  0x00, 0x00, 0x6C, 0xFF, 0x9D, 0x02, 0xC3, 0xFF, 0xA7, 0x4E, 0x48, 0x91, 0xFC, 0xFF, 0x48, 0x00,
+  0x10, 0xA0, 0xF8, 0xFF, 0xF8, 0xBC, 0xFC, 0xC4, 0x01, 0x00, 0x00, 0x00, 0x07, 0x1C, 0x0A, 0xBA,
+  0xF7, 0x2B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0xFF, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x46, 0xFD, 0xBE, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xEA, 0xF0, 0x1E, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x05, 0xC5, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8E, 0xFE, 0xA1,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0xD3, 0x59, 0xAE, 0xFF, 0xBB, 0x31, 0x9D, 0x37, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x53, 0x0F, 0x9E, 0xFF, 0xAA,
+  0x85, 0xFF, 0x91, 0x00, 0x1E, 0x01, 0x51, 0xD3, 0x59, 0xAE, 0xFF, 0xBB, 0x31, 0x9D, 0x37, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x54, 0x10, 0x96, 0xFF,
+  0xA5, 0x64, 0xFB, 0xB7, 0x00, 0x88, 0x74, 0x2C, 0xD5, 0x0D, 0x4D, 0x2D, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xBC, 0x38, 0x00,
+  0x00, 0x00, 0x00, 0x30, 0xB3, 0xFF, 0xD8, 0x1A, 0x00, 0x00, 0x28, 0xA9, 0xFE, 0xDC, 0x5F, 0x03,
+  0x00, 0x1F, 0xA0, 0xFC, 0xDE, 0x62, 0x04, 0x00, 0x00, 0x00, 0x67, 0xFD, 0xEC, 0x5C, 0x02, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x2D, 0xB0, 0xFE, 0xD4, 0x55, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36,
+  0xBA, 0xFF, 0xD1, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC3, 0xFF, 0x34, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x22, 0x0B, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17,
+  0x02, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x17, 0x21, 0x42, 0x42, 0x42, 0x42,
+  0x42, 0x42, 0x42, 0x42, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E,
+  0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0x11, 0x4E, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C,
+  0x9C, 0x9C, 0x0E, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x93, 0x87, 0x12, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0xF6, 0xF0, 0x7D, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A,
+  0x92, 0xF8, 0xEB, 0x74, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x96, 0xF9, 0xE5, 0x6A, 0x04,
+  0x00, 0x00, 0x00, 0x00, 0x16, 0x9D, 0xFE, 0xE9, 0x13, 0x00, 0x00, 0x14, 0x89, 0xF4, 0xEE, 0x7A,
+  0x0C, 0x00, 0x12, 0x86, 0xF2, 0xF3, 0x84, 0x10, 0x00, 0x00, 0x00, 0x9A, 0xF7, 0x8E, 0x16, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x4F, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x4A,
+  0x77, 0x72, 0x34, 0x00, 0x00, 0x37, 0xDB, 0xFF, 0xFB, 0xFE, 0xFF, 0x9E, 0x01, 0x4E, 0xBF, 0x37,
+  0x01, 0x16, 0xAE, 0xFF, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0x94, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x2B, 0xFF, 0x86, 0x00, 0x00, 0x00, 0x00, 0x05, 0xB5, 0xFA, 0x2B, 0x00, 0x00, 0x00,
+  0x1A, 0xC2, 0xF8, 0x5B, 0x00, 0x00, 0x00, 0x07, 0xDB, 0xE5, 0x33, 0x00, 0x00, 0x00, 0x00, 0x1F,
+  0xFF, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
+  0x53, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+  0xFF, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x06, 0x4B, 0x81, 0x95, 0x88, 0x5B, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x64, 0xE6, 0xEB, 0xAF, 0x98, 0xA5, 0xD5, 0xF7, 0x8C, 0x09, 0x00, 0x00, 0x00, 0x00, 0x03,
+  0x9F, 0xEF, 0x66, 0x06, 0x00, 0x00, 0x00, 0x00, 0x33, 0xCA, 0xC8, 0x0D, 0x00, 0x00, 0x00, 0x87,
+  0xE8, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xC9, 0xA1, 0x00, 0x00, 0x2F, 0xFC,
+  0x45, 0x00, 0x00, 0x00, 0x0A, 0x4E, 0x6F, 0x68, 0x30, 0x00, 0x31, 0xFD, 0x26, 0x00, 0xA0, 0xBC,
+  0x00, 0x00, 0x00, 0x56, 0xEA, 0xDC, 0xB3, 0xE9, 0xC7, 0x00, 0x00, 0xD4, 0x75, 0x01, 0xEC, 0x65,
+  0x00, 0x00, 0x4F, 0xFC, 0x6F, 0x01, 0x00, 0xD3, 0x85, 0x00, 0x00, 0xAB, 0x9B, 0x18, 0xFF, 0x38,
+  0x00, 0x03, 0xE0, 0x9A, 0x00, 0x00, 0x16, 0xFE, 0x44, 0x00, 0x00, 0xA7, 0x9F, 0x22, 0xFF, 0x2D,
+  0x00, 0x33, 0xFF, 0x36, 0x00, 0x00, 0x57, 0xF8, 0x09, 0x00, 0x00, 0xCA, 0x7E, 0x12, 0xFF, 0x3F,
+  0x00, 0x4A, 0xFF, 0x1F, 0x00, 0x00, 0xAC, 0xD3, 0x00, 0x00, 0x25, 0xFC, 0x30, 0x00, 0xE5, 0x71,
+  0x00, 0x23, 0xFE, 0x81, 0x16, 0x70, 0xEB, 0xEB, 0x16, 0x1F, 0xCA, 0xA2, 0x00, 0x00, 0x97, 0xCB,
+  0x00, 0x00, 0x85, 0xFC, 0xFF, 0xC1, 0x22, 0xC7, 0xFF, 0xF9, 0x96, 0x07, 0x00, 0x00, 0x27, 0xFA,
+  0x5C, 0x00, 0x00, 0x0F, 0x14, 0x00, 0x00, 0x01, 0x1F, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78,
+  0xF5, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x80, 0xFB, 0x9A, 0x2E, 0x01, 0x00, 0x00, 0x00, 0x14, 0x63, 0xD4, 0x61, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x3A, 0xB7, 0xFC, 0xEC, 0xCF, 0xCD, 0xE2, 0xFE, 0xD8, 0x6F, 0x07, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x12, 0x45, 0x5F, 0x60, 0x4D, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x14, 0x54, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x80, 0xFF, 0xFE, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE3, 0xEE,
+  0xFF, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4D, 0xFF, 0x84, 0xE1, 0xE8,
+  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFE, 0x25, 0x82, 0xFF, 0x55, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xFC, 0xC1, 0x00, 0x21, 0xFD, 0xBA, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x5E, 0x00, 0x00, 0xBC, 0xFD, 0x23, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xE3, 0xF0, 0x0A, 0x00, 0x00, 0x5A, 0xFF, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4D,
+  0xFF, 0x98, 0x00, 0x00, 0x00, 0x08, 0xEE, 0xE8, 0x05, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0x81,
+  0x52, 0x52, 0x52, 0x52, 0xC1, 0xFF, 0x54, 0x00, 0x00, 0x00, 0x1D, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x77, 0x14, 0x14, 0x14, 0x14, 0x14,
+  0x14, 0xCE, 0xFD, 0x23, 0x00, 0x03, 0xE2, 0xF8, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6B,
+  0xFF, 0x87, 0x00, 0x4D, 0xFF, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0xF6, 0xE8,
+  0x05, 0xB3, 0xFB, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9B, 0xFF, 0x54, 0x16,
+  0x54, 0x54, 0x54, 0x54, 0x53, 0x43, 0x17, 0x00, 0x00, 0x00, 0x42, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFE, 0xB7, 0x1F, 0x00, 0x42, 0xFF, 0xBE, 0x33, 0x33, 0x35, 0x50, 0xB3, 0xFF, 0xD8, 0x05,
+  0x42, 0xFF, 0xAD, 0x00, 0x00, 0x00, 0x00, 0x02, 0xCD, 0xFF, 0x42, 0x42, 0xFF, 0xAD, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x95, 0xFF, 0x58, 0x42, 0xFF, 0xAD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBA, 0xFE,
+  0x28, 0x42, 0xFF, 0xAD, 0x00, 0x00, 0x00, 0x11, 0x82, 0xFF, 0x86, 0x00, 0x42, 0xFF, 0xF8, 0xE8,
+  0xE8, 0xEB, 0xFD, 0xF7, 0x6D, 0x00, 0x00, 0x42, 0xFF, 0xD4, 0x78, 0x78, 0x78, 0x84, 0xC3, 0xFE,
+  0xA8, 0x09, 0x42, 0xFF, 0xAD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0xFF, 0x87, 0x42, 0xFF, 0xAD,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xFF, 0xCD, 0x42, 0xFF, 0xAD, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x25, 0xFF, 0xCA, 0x42, 0xFF, 0xAD, 0x00, 0x00, 0x00, 0x00, 0x03, 0x9F, 0xFF, 0x86, 0x42, 0xFF,
+  0xD9, 0x8A, 0x8A, 0x8A, 0x97, 0xD8, 0xFF, 0xD1, 0x0F, 0x42, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7,
+  0xD0, 0x7C, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x56, 0x76, 0x79, 0x5F, 0x1F, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x16, 0xA1, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xA8, 0x17, 0x00, 0x00,
+  0x24, 0xE2, 0xFF, 0xD1, 0x6A, 0x39, 0x35, 0x5A, 0xB6, 0xFF, 0xA3, 0x00, 0x06, 0xD4, 0xFF, 0x91,
+  0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4A, 0x18, 0x00, 0x69, 0xFF, 0xBF, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC7, 0xFF, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0xFA, 0xF9, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17,
+  0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xFF, 0xE8, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF2, 0xFE, 0x11, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0xFF, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xDE, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0xB7, 0xFF, 0xC5, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xC1, 0x6E, 0x00, 0x00, 0x10,
+  0xC3, 0xFF, 0xF8, 0xB1, 0x87, 0x89, 0xB1, 0xF7, 0xFB, 0x66, 0x00, 0x00, 0x00, 0x04, 0x6B, 0xD3,
+  0xFF, 0xFF, 0xFF, 0xF6, 0xAF, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x26, 0x20,
+  0x05, 0x00, 0x00, 0x00, 0x16, 0x54, 0x54, 0x54, 0x54, 0x54, 0x51, 0x36, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x42, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0x92, 0x13, 0x00, 0x00, 0x00,
+  0x42, 0xFF, 0xC3, 0x3D, 0x3D, 0x3D, 0x42, 0x68, 0xC4, 0xFF, 0xE2, 0x27, 0x00, 0x00, 0x42, 0xFF,
+  0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0xFF, 0xDB, 0x0B, 0x00, 0x42, 0xFF, 0xB0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA6, 0xFF, 0x77, 0x00, 0x42, 0xFF, 0xB0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x31, 0xFF, 0xD6, 0x00, 0x42, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0xEF, 0xFF, 0x0F, 0x42, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xD7, 0xFF, 0x26, 0x42, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDB,
+  0xFF, 0x22, 0x42, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0xF9, 0x07,
+  0x42, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xBD, 0x00, 0x42, 0xFF,
+  0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xD3, 0xFF, 0x4F, 0x00, 0x42, 0xFF, 0xB0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1F, 0xBF, 0xFF, 0xA9, 0x00, 0x00, 0x42, 0xFF, 0xDD, 0x91, 0x91, 0x91,
+  0x96, 0xBC, 0xFA, 0xFF, 0xA1, 0x07, 0x00, 0x00, 0x42, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xE1,
+  0xA5, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x16, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x30,
+  0x42, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x91, 0x42, 0xFF, 0xC4, 0x40, 0x40, 0x40,
+  0x40, 0x40, 0x40, 0x24, 0x42, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0xFF,
+  0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x42, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0xFF, 0xFE, 0xFC,
+  0xFC, 0xFC, 0xFC, 0xFC, 0x42, 0x00, 0x42, 0xFF, 0xDA, 0x87, 0x87, 0x87, 0x87, 0x87, 0x23, 0x00,
+  0x42, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0xFF, 0xB0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x42, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0xFF,
+  0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0xFF, 0xDE, 0x94, 0x94, 0x94, 0x94, 0x94,
+  0x94, 0x54, 0x42, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x91, 0x16, 0x54, 0x54, 0x54,
+  0x54, 0x54, 0x54, 0x54, 0x54, 0x30, 0x42, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x91,
+  0x42, 0xFF, 0xC4, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x24, 0x42, 0xFF, 0xB0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x42, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0xFF,
+  0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x42, 0xFF, 0xEA, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0x6C, 0x00, 0x42, 0xFF, 0xF2, 0xD6,
+  0xD6, 0xD6, 0xD6, 0xD6, 0x7A, 0x00, 0x42, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x42, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0xFF, 0xB0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x42, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0xFF,
+  0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x53, 0x75, 0x7B, 0x68, 0x35, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x18, 0xA2, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDA, 0x4F, 0x00, 0x00, 0x00,
+  0x29, 0xE5, 0xFF, 0xCF, 0x6B, 0x3B, 0x33, 0x4E, 0x95, 0xF4, 0xFC, 0x1E, 0x00, 0x09, 0xD9, 0xFF,
+  0x8C, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x53, 0x00, 0x00, 0x6E, 0xFF, 0xBA, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCA, 0xFF, 0x42, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFA, 0xF9, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x17, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x12, 0xFF, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDA, 0xE3, 0xE3, 0xE3, 0x64,
+  0x01, 0xF0, 0xFE, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x96, 0xB8, 0xFF, 0x70, 0x00, 0xAD,
+  0xFF, 0x5D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xFF, 0x70, 0x00, 0x42, 0xFF, 0xDB,
+  0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xFF, 0x70, 0x00, 0x00, 0xA1, 0xFF, 0xC1, 0x19,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0xFF, 0x70, 0x00, 0x00, 0x07, 0xA8, 0xFF, 0xF4, 0xA3, 0x72,
+  0x6B, 0x83, 0xBF, 0xFD, 0xFD, 0x55, 0x00, 0x00, 0x00, 0x00, 0x51, 0xC1, 0xFB, 0xFF, 0xFF, 0xFF,
+  0xE9, 0xA0, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x24, 0x26, 0x14, 0x00, 0x00,
+  0x00, 0x00, 0x16, 0x54, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x54, 0x1E, 0x42,
+  0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0xFF, 0x5C, 0x42, 0xFF, 0xB0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0xFF, 0x5C, 0x42, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x96, 0xFF, 0x5C, 0x42, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x96, 0xFF, 0x5C, 0x42, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0xFF, 0x5C,
+  0x42, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0xFF, 0x5C, 0x42, 0xFF, 0xFA,
+  0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF9, 0xFF, 0x5C, 0x42, 0xFF, 0xD6, 0x7A, 0x7A, 0x7A,
+  0x7A, 0x7A, 0x7A, 0x7A, 0xC9, 0xFF, 0x5C, 0x42, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x96, 0xFF, 0x5C, 0x42, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0xFF,
+  0x5C, 0x42, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0xFF, 0x5C, 0x42, 0xFF,
+  0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0xFF, 0x5C, 0x42, 0xFF, 0xB0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0xFF, 0x5C, 0x42, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x96, 0xFF, 0x5C, 0x4C, 0x54, 0x03, 0xE5, 0xFF, 0x0A, 0xE5, 0xFF, 0x0A, 0xE5, 0xFF,
+  0x0A, 0xE5, 0xFF, 0x0A, 0xE5, 0xFF, 0x0A, 0xE5, 0xFF, 0x0A, 0xE5, 0xFF, 0x0A, 0xE5, 0xFF, 0x0A,
+  0xE5, 0xFF, 0x0A, 0xE5, 0xFF, 0x0A, 0xE5, 0xFF, 0x0A, 0xE5, 0xFF, 0x0A, 0xE5, 0xFF, 0x0A, 0xE5,
+  0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x54, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCC,
+  0xFF, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCC, 0xFF, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCC,
+  0xFF, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCC, 0xFF, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCC,
+  0xFF, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCC, 0xFF, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCC,
+  0xFF, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCC, 0xFF, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCC,
+  0xFF, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF1,
+  0xF9, 0x06, 0x00, 0x00, 0x00, 0x00, 0x64, 0xFF, 0xB8, 0x00, 0x28, 0x93, 0x78, 0xA4, 0xFC, 0xF9,
+  0x36, 0x00, 0x56, 0xFF, 0xFF, 0xFF, 0xD0, 0x40, 0x00, 0x00, 0x00, 0x11, 0x27, 0x16, 0x00, 0x00,
+  0x00, 0x00, 0x05, 0x54, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x53, 0x48, 0x00, 0x0F,
+  0xFF, 0xDE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xD9, 0xFA, 0x48, 0x00, 0x0F, 0xFF, 0xDE, 0x00,
+  0x00, 0x00, 0x00, 0x09, 0xC5, 0xFE, 0x62, 0x00, 0x00, 0x0F, 0xFF, 0xDE, 0x00, 0x00, 0x00, 0x03,
+  0xAE, 0xFF, 0x7E, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xDE, 0x00, 0x00, 0x00, 0x93, 0xFF, 0x9B, 0x00,
+  0x00, 0x00, 0x00, 0x0F, 0xFF, 0xDE, 0x00, 0x00, 0x75, 0xFF, 0xB5, 0x04, 0x00, 0x00, 0x00, 0x00,
+  0x0F, 0xFF, 0xE0, 0x0E, 0x65, 0xFE, 0xCB, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF8, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xEC, 0x70, 0xA3, 0xFF,
+  0xD9, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xDE, 0x00, 0x00, 0x9B, 0xFF, 0xBD, 0x05,
+  0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xDE, 0x00, 0x00, 0x04, 0xB8, 0xFF, 0x9A, 0x00, 0x00, 0x00,
+  0x00, 0x0F, 0xFF, 0xDE, 0x00, 0x00, 0x00, 0x0D, 0xD0, 0xFF, 0x71, 0x00, 0x00, 0x00, 0x0F, 0xFF,
+  0xDE, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xE3, 0xFC, 0x4B, 0x00, 0x00, 0x0F, 0xFF, 0xDE, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x2E, 0xF1, 0xF1, 0x2C, 0x00, 0x0F, 0xFF, 0xDE, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x46, 0xF4, 0xDF, 0x16, 0x16, 0x54, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0xFF,
+  0xAD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0xFF, 0xAD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x42, 0xFF, 0xAD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0xFF, 0xAD, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x42, 0xFF, 0xAD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0xFF, 0xAD, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x42, 0xFF, 0xAD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0xFF, 0xAD,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0xFF, 0xAD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42,
+  0xFF, 0xAD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0xFF, 0xAD, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x42, 0xFF, 0xAD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0xFF, 0xE1, 0xA1, 0xA1, 0xA1,
+  0xA1, 0xA1, 0x8D, 0x42, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x16, 0x54, 0x3A, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x54, 0x37, 0x42, 0xFF, 0xF9, 0x25,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB9, 0xFF, 0xA6, 0x42, 0xFF, 0xFF, 0xAE,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0xFF, 0xFF, 0xA6, 0x42, 0xFF, 0xF0, 0xFF,
+  0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD0, 0xF1, 0xFF, 0xA6, 0x42, 0xFF, 0x8A, 0xF4,
+  0xCB, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0x81, 0xFF, 0xA6, 0x42, 0xFF, 0x70, 0x80,
+  0xFF, 0x5D, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xE3, 0xE0, 0x15, 0xFF, 0xA6, 0x42, 0xFF, 0x70, 0x0B,
+  0xE5, 0xE3, 0x0A, 0x00, 0x00, 0x00, 0x7A, 0xFF, 0x5C, 0x0D, 0xFF, 0xA6, 0x42, 0xFF, 0x70, 0x00,
+  0x63, 0xFF, 0x7C, 0x00, 0x00, 0x15, 0xF1, 0xCE, 0x02, 0x0D, 0xFF, 0xA6, 0x42, 0xFF, 0x70, 0x00,
+  0x03, 0xD1, 0xF3, 0x19, 0x00, 0x94, 0xFF, 0x44, 0x00, 0x0D, 0xFF, 0xA6, 0x42, 0xFF, 0x70, 0x00,
+  0x00, 0x45, 0xFF, 0x9C, 0x26, 0xFA, 0xB7, 0x00, 0x00, 0x0D, 0xFF, 0xA6, 0x42, 0xFF, 0x70, 0x00,
+  0x00, 0x00, 0xB5, 0xFC, 0xB8, 0xFD, 0x2E, 0x00, 0x00, 0x0D, 0xFF, 0xA6, 0x42, 0xFF, 0x70, 0x00,
+  0x00, 0x00, 0x2B, 0xFB, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xA6, 0x42, 0xFF, 0x70, 0x00,
+  0x00, 0x00, 0x00, 0x8A, 0xE0, 0x1C, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xA6, 0x42, 0xFF, 0x70, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xA6, 0x42, 0xFF, 0x70, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xA6, 0x16, 0x54, 0x14, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x54, 0x1E, 0x42, 0xFF, 0xC5, 0x05, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x57, 0xFF, 0x5C, 0x42, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x57, 0xFF, 0x5C, 0x42, 0xFF, 0xFD, 0xFF, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0xFF, 0x5C,
+  0x42, 0xFF, 0x96, 0xF2, 0xF2, 0x27, 0x00, 0x00, 0x00, 0x00, 0x57, 0xFF, 0x5C, 0x42, 0xFF, 0x70,
+  0x57, 0xFF, 0xD3, 0x0B, 0x00, 0x00, 0x00, 0x57, 0xFF, 0x5C, 0x42, 0xFF, 0x70, 0x00, 0x92, 0xFF,
+  0xA2, 0x00, 0x00, 0x00, 0x57, 0xFF, 0x5C, 0x42, 0xFF, 0x70, 0x00, 0x06, 0xC7, 0xFF, 0x67, 0x00,
+  0x00, 0x57, 0xFF, 0x5C, 0x42, 0xFF, 0x70, 0x00, 0x00, 0x1D, 0xEB, 0xF8, 0x34, 0x00, 0x57, 0xFF,
+  0x5C, 0x42, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x46, 0xFD, 0xDF, 0x12, 0x57, 0xFF, 0x5C, 0x42, 0xFF,
+  0x70, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xB4, 0x58, 0xFF, 0x5C, 0x42, 0xFF, 0x70, 0x00, 0x00,
+  0x00, 0x00, 0x02, 0xB8, 0xFF, 0xC7, 0xFF, 0x5C, 0x42, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x14, 0xE1, 0xFF, 0xFF, 0x5C, 0x42, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0xF9,
+  0xFF, 0x5C, 0x42, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0xFD, 0x5C, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1A, 0x5A, 0x78, 0x77, 0x58, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x19, 0xA7, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xA3, 0x16, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x26, 0xE5, 0xFF, 0xC5, 0x62, 0x37, 0x38, 0x64, 0xC9, 0xFF, 0xE1, 0x22, 0x00, 0x00, 0x00,
+  0x06, 0xD5, 0xFF, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x88, 0xFF, 0xCF, 0x04, 0x00, 0x00,
+  0x67, 0xFF, 0xB5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBE, 0xFF, 0x5F, 0x00, 0x00,
+  0xC3, 0xFF, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 0xFF, 0xBB, 0x00, 0x02,
+  0xF7, 0xFB, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xF2, 0x00, 0x11,
+  0xFF, 0xE9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0x0A, 0x0D,
+  0xFF, 0xED, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFE, 0x06, 0x00,
+  0xEC, 0xFF, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xFF, 0xE4, 0x00, 0x00,
+  0xAA, 0xFF, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6B, 0xFF, 0xA2, 0x00, 0x00,
+  0x40, 0xFF, 0xDD, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xE3, 0xFF, 0x39, 0x00, 0x00,
+  0x00, 0xA1, 0xFF, 0xC6, 0x21, 0x00, 0x00, 0x00, 0x00, 0x24, 0xCB, 0xFF, 0x99, 0x00, 0x00, 0x00,
+  0x00, 0x07, 0xAA, 0xFF, 0xFA, 0xB8, 0x8E, 0x8E, 0xBA, 0xFB, 0xFF, 0xA4, 0x05, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x53, 0xC1, 0xFB, 0xFF, 0xFF, 0xFA, 0xBE, 0x4E, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x21, 0x21, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+  0x54, 0x54, 0x54, 0x54, 0x52, 0x3C, 0x0C, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xF7, 0x97, 0x0C, 0x00, 0x0F, 0xFF, 0xE4, 0x33, 0x33, 0x37, 0x5C, 0xCA, 0xFF, 0xBB, 0x01,
+  0x0F, 0xFF, 0xDE, 0x00, 0x00, 0x00, 0x00, 0x08, 0xD5, 0xFF, 0x40, 0x0F, 0xFF, 0xDE, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x7E, 0xFF, 0x78, 0x0F, 0xFF, 0xDE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xFF,
+  0x7C, 0x0F, 0xFF, 0xDE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x4E, 0x0F, 0xFF, 0xDE, 0x00,
+  0x00, 0x00, 0x18, 0x99, 0xFF, 0xD4, 0x05, 0x0F, 0xFF, 0xFC, 0xE6, 0xE6, 0xEA, 0xFE, 0xFF, 0xCE,
+  0x21, 0x00, 0x0F, 0xFF, 0xF3, 0xA3, 0xA3, 0xA0, 0x88, 0x48, 0x02, 0x00, 0x00, 0x0F, 0xFF, 0xDE,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xDE, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0F, 0xFF, 0xDE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
+  0xDE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xDE, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x5A, 0x78, 0x77, 0x58, 0x18, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0xA7, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xA3,
+  0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0xE5, 0xFF, 0xC5, 0x62, 0x37, 0x38, 0x64, 0xC9, 0xFF,
+  0xE1, 0x22, 0x00, 0x00, 0x00, 0x06, 0xD5, 0xFF, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x88,
+  0xFF, 0xCF, 0x04, 0x00, 0x00, 0x67, 0xFF, 0xB5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0xBE, 0xFF, 0x5F, 0x00, 0x00, 0xC3, 0xFF, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x4C, 0xFF, 0xBB, 0x00, 0x02, 0xF7, 0xFB, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0D, 0xFF, 0xF2, 0x00, 0x11, 0xFF, 0xE9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xF3, 0xFF, 0x0A, 0x0D, 0xFF, 0xED, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xF7, 0xFE, 0x06, 0x00, 0xEC, 0xFF, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1D, 0xFF, 0xE4, 0x00, 0x00, 0xAA, 0xFF, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x6B, 0xFF, 0xA2, 0x00, 0x00, 0x40, 0xFF, 0xDD, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12,
+  0xE3, 0xFE, 0x38, 0x00, 0x00, 0x00, 0xA1, 0xFF, 0xC6, 0x21, 0x00, 0x00, 0x00, 0x00, 0x24, 0xCB,
+  0xFF, 0x98, 0x00, 0x00, 0x00, 0x00, 0x07, 0xAA, 0xFF, 0xFA, 0xB8, 0x8E, 0x8E, 0xBA, 0xFB, 0xFF,
+  0xA2, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xC1, 0xFB, 0xFF, 0xFF, 0xF9, 0xE6, 0xFF,
+  0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x21, 0x21, 0x07, 0x10, 0xD0,
+  0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
+  0xDC, 0xFE, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x23, 0xD3, 0xF1, 0x47, 0x05, 0x54, 0x54, 0x54, 0x54, 0x50, 0x39, 0x0A, 0x00, 0x00, 0x00, 0x00,
+  0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x90, 0x08, 0x00, 0x00, 0x0F, 0xFF, 0xE4, 0x33,
+  0x33, 0x39, 0x63, 0xD4, 0xFF, 0xA4, 0x00, 0x00, 0x0F, 0xFF, 0xDE, 0x00, 0x00, 0x00, 0x00, 0x0F,
+  0xE9, 0xFD, 0x18, 0x00, 0x0F, 0xFF, 0xDE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAC, 0xFF, 0x3A, 0x00,
+  0x0F, 0xFF, 0xDE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0xFF, 0x25, 0x00, 0x0F, 0xFF, 0xDE, 0x00,
+  0x00, 0x00, 0x00, 0x42, 0xFD, 0xCA, 0x00, 0x00, 0x0F, 0xFF, 0xEB, 0x63, 0x63, 0x6D, 0xA4, 0xFA,
+  0xE1, 0x26, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x75, 0x0E, 0x00, 0x00, 0x00,
+  0x0F, 0xFF, 0xDF, 0x05, 0x0B, 0xAD, 0xFF, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xDE, 0x00,
+  0x00, 0x10, 0xE0, 0xFB, 0x3D, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xDE, 0x00, 0x00, 0x00, 0x3B, 0xFB,
+  0xE2, 0x12, 0x00, 0x00, 0x0F, 0xFF, 0xDE, 0x00, 0x00, 0x00, 0x00, 0x7D, 0xFF, 0xB0, 0x01, 0x00,
+  0x0F, 0xFF, 0xDE, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0xFF, 0x6D, 0x00, 0x0F, 0xFF, 0xDE, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1C, 0xE5, 0xF8, 0x31, 0x00, 0x00, 0x00, 0x16, 0x60, 0x7B, 0x6D, 0x36,
+  0x00, 0x00, 0x00, 0x00, 0x65, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xC6, 0x23, 0x00, 0x40, 0xFE, 0xDB,
+  0x51, 0x22, 0x36, 0x96, 0xFC, 0x4A, 0x00, 0xAA, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00,
+  0x00, 0xCA, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAC, 0xFF, 0x78, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0xFF, 0xC4, 0x62, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x4C, 0xDC, 0xFF, 0xFF, 0xF9, 0xA7, 0x25, 0x00, 0x00, 0x00, 0x00, 0x02, 0x40, 0x92, 0xE7, 0xFF,
+  0xF2, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x99, 0xFF, 0xB1, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x08, 0xFA, 0xDB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFB, 0xCA,
+  0x0C, 0xC6, 0x59, 0x00, 0x00, 0x00, 0x00, 0x78, 0xFF, 0x80, 0x2F, 0xF0, 0xFF, 0xC6, 0x7F, 0x79,
+  0xB5, 0xFF, 0xD8, 0x0F, 0x00, 0x20, 0xA0, 0xF3, 0xFF, 0xFF, 0xF6, 0x9F, 0x15, 0x00, 0x00, 0x00,
+  0x00, 0x04, 0x21, 0x24, 0x07, 0x00, 0x00, 0x00, 0x3D, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
+  0x54, 0x54, 0x54, 0x2A, 0xB8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
+  0x37, 0x4C, 0x4C, 0x4C, 0x59, 0xFF, 0xE8, 0x4C, 0x4C, 0x4C, 0x4C, 0x26, 0x00, 0x00, 0x00, 0x00,
+  0x12, 0xFF, 0xDE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xFF, 0xDE, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xFF, 0xDE, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x12, 0xFF, 0xDE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x12, 0xFF, 0xDE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xFF, 0xDE, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xFF, 0xDE, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x12, 0xFF, 0xDE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x12, 0xFF, 0xDE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xFF, 0xDE, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xFF, 0xDE, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x12, 0xFF, 0xDE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x54, 0x2D, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4D, 0x54, 0x01, 0x66, 0xFF, 0x87, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xEB, 0xFF, 0x03, 0x66, 0xFF, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xEB, 0xFF, 0x03, 0x66, 0xFF, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEB, 0xFF, 0x03,
+  0x66, 0xFF, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEB, 0xFF, 0x03, 0x66, 0xFF, 0x87,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEB, 0xFF, 0x03, 0x66, 0xFF, 0x87, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xEB, 0xFF, 0x03, 0x66, 0xFF, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xEB, 0xFF, 0x03, 0x66, 0xFF, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEB, 0xFF,
+  0x03, 0x64, 0xFF, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEC, 0xFF, 0x02, 0x4E, 0xFF,
+  0xA6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFD, 0xEA, 0x00, 0x14, 0xFA, 0xEF, 0x10, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x62, 0xFF, 0xAB, 0x00, 0x00, 0x9C, 0xFF, 0xB3, 0x0C, 0x00, 0x00, 0x00,
+  0x34, 0xEC, 0xFE, 0x3A, 0x00, 0x00, 0x0F, 0xCD, 0xFF, 0xE9, 0x9F, 0x8D, 0xB5, 0xFC, 0xFF, 0x7A,
+  0x00, 0x00, 0x00, 0x00, 0x0A, 0x84, 0xE9, 0xFF, 0xFF, 0xFE, 0xCA, 0x4D, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x1E, 0x29, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x51, 0x08, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x54, 0x25, 0x94, 0xFF, 0x70, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0xD9, 0xFF, 0x2C, 0x2D, 0xFF, 0xD5, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x41, 0xFF, 0xC3, 0x00, 0x00, 0xC4, 0xFF, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xA7, 0xFF, 0x5B, 0x00, 0x00, 0x5C, 0xFF, 0xA3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xF8, 0xEB,
+  0x07, 0x00, 0x00, 0x08, 0xEB, 0xF7, 0x12, 0x00, 0x00, 0x00, 0x00, 0x73, 0xFF, 0x8A, 0x00, 0x00,
+  0x00, 0x00, 0x8B, 0xFF, 0x71, 0x00, 0x00, 0x00, 0x01, 0xD8, 0xFD, 0x24, 0x00, 0x00, 0x00, 0x00,
+  0x24, 0xFE, 0xD6, 0x01, 0x00, 0x00, 0x40, 0xFF, 0xB9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBA,
+  0xFF, 0x3E, 0x00, 0x00, 0xA5, 0xFF, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xFF, 0xA4,
+  0x00, 0x13, 0xF8, 0xE4, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xE5, 0xF7, 0x13, 0x71,
+  0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0xFF, 0x6F, 0xD4, 0xFB, 0x1C,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xFC, 0xD6, 0xFF, 0xB0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xFF, 0xDD, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x53,
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x4E, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x3B, 0x54, 0x0F, 0x99, 0xFF, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0F, 0xFA, 0xF1, 0x07, 0x4A, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x27, 0xFF, 0xFF, 0xA6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0xFF, 0xA8, 0x00, 0x07, 0xF2, 0xFE,
+  0x1E, 0x00, 0x00, 0x00, 0x00, 0x7D, 0xFF, 0xE4, 0xF3, 0x09, 0x00, 0x00, 0x00, 0x00, 0xA2, 0xFF,
+  0x59, 0x00, 0x00, 0xAA, 0xFF, 0x69, 0x00, 0x00, 0x00, 0x00, 0xD4, 0xDA, 0x77, 0xFF, 0x52, 0x00,
+  0x00, 0x00, 0x03, 0xEB, 0xF9, 0x0F, 0x00, 0x00, 0x5A, 0xFF, 0xB5, 0x00, 0x00, 0x00, 0x2B, 0xFF,
+  0x85, 0x23, 0xFF, 0xA8, 0x00, 0x00, 0x00, 0x3B, 0xFF, 0xB8, 0x00, 0x00, 0x00, 0x10, 0xFA, 0xF6,
+  0x0A, 0x00, 0x00, 0x81, 0xFF, 0x30, 0x00, 0xCD, 0xF4, 0x0A, 0x00, 0x00, 0x87, 0xFF, 0x69, 0x00,
+  0x00, 0x00, 0x00, 0xBA, 0xFF, 0x4D, 0x00, 0x00, 0xD7, 0xDA, 0x00, 0x00, 0x78, 0xFF, 0x55, 0x00,
+  0x00, 0xD4, 0xFE, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xFF, 0x99, 0x00, 0x2F, 0xFF, 0x85, 0x00,
+  0x00, 0x24, 0xFF, 0xAB, 0x00, 0x21, 0xFF, 0xC9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFE, 0xE4,
+  0x01, 0x85, 0xFF, 0x30, 0x00, 0x00, 0x00, 0xCE, 0xF5, 0x0B, 0x6D, 0xFF, 0x79, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xCA, 0xFF, 0x32, 0xDB, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x79, 0xFF, 0x57, 0xB9,
+  0xFF, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7B, 0xFF, 0xA5, 0xFF, 0x84, 0x00, 0x00, 0x00,
+  0x00, 0x25, 0xFF, 0xAF, 0xF8, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0xFF, 0xFA,
+  0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFB, 0xFF, 0x8A, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xDB, 0xFF, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7A, 0xFF, 0xFF, 0x3A,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8B, 0xFF, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x25, 0xFF, 0xE7, 0x02, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x54, 0x38, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x35, 0x54, 0x24, 0x24, 0xF4, 0xF7, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26,
+  0xF5, 0xE5, 0x12, 0x00, 0x6B, 0xFF, 0xC4, 0x02, 0x00, 0x00, 0x00, 0x03, 0xC5, 0xFE, 0x47, 0x00,
+  0x00, 0x01, 0xBB, 0xFF, 0x6D, 0x00, 0x00, 0x00, 0x75, 0xFF, 0x95, 0x00, 0x00, 0x00, 0x00, 0x1E,
+  0xF0, 0xF3, 0x20, 0x00, 0x29, 0xF7, 0xDA, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0xFF, 0xBA,
+  0x04, 0xC9, 0xFB, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xBD, 0xFF, 0x83,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0xFF, 0xEE, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0xFF, 0xEC, 0xFF, 0x6A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x32, 0xFA, 0xD9, 0x24, 0xF0, 0xF2, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xD1, 0xFD,
+  0x3B, 0x00, 0x68, 0xFF, 0xBA, 0x01, 0x00, 0x00, 0x00, 0x00, 0x83, 0xFF, 0x8E, 0x00, 0x00, 0x02,
+  0xC3, 0xFF, 0x64, 0x00, 0x00, 0x00, 0x34, 0xFB, 0xD9, 0x0A, 0x00, 0x00, 0x00, 0x28, 0xF8, 0xF0,
+  0x1C, 0x00, 0x07, 0xD3, 0xFD, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0xFF, 0xB5, 0x00, 0x86,
+  0xFF, 0x8B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xD0, 0xFF, 0x5E, 0x45, 0x54, 0x12, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x54, 0x23, 0x6A, 0xFF, 0xAC, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1D, 0xF4, 0xED, 0x15, 0x03, 0xCB, 0xFF, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA8,
+  0xFF, 0x67, 0x00, 0x00, 0x35, 0xFD, 0xD5, 0x05, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xC9, 0x02, 0x00,
+  0x00, 0x00, 0x96, 0xFF, 0x70, 0x00, 0x00, 0x04, 0xD1, 0xFC, 0x32, 0x00, 0x00, 0x00, 0x00, 0x11,
+  0xE9, 0xF0, 0x17, 0x00, 0x6B, 0xFF, 0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0x9D,
+  0x14, 0xED, 0xE7, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC2, 0xFC, 0xA4, 0xFF, 0x5B,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0xFA, 0xFF, 0xBE, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB2, 0xFF, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xAB, 0xFF, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xAB, 0xFF, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAB, 0xFF, 0x42,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAB, 0xFF, 0x42, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAB, 0xFF, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x40, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x3D, 0x00, 0xC2, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAE, 0x00, 0x30, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x57,
+  0xFA, 0xF9, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xB6, 0xFF, 0x76, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6E, 0xFF, 0xBE, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x2C, 0xF7, 0xED, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xD2, 0xFF, 0x54,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0x9D, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x47, 0xFE, 0xDA, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0xE6,
+  0xFA, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB1, 0xFF, 0x7A, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0xFF, 0xC1, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x28, 0xF5, 0xEF, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xCD, 0xFF, 0xCF, 0x94,
+  0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x56, 0x23, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x94, 0x31, 0x54, 0x54, 0x54, 0x08, 0x94, 0xFC, 0xD6, 0xD2, 0x0F, 0x94, 0xEB, 0x00,
+  0x00, 0x00, 0x94, 0xEB, 0x00, 0x00, 0x00, 0x94, 0xEB, 0x00, 0x00, 0x00, 0x94, 0xEB, 0x00, 0x00,
+  0x00, 0x94, 0xEB, 0x00, 0x00, 0x00, 0x94, 0xEB, 0x00, 0x00, 0x00, 0x94, 0xEB, 0x00, 0x00, 0x00,
+  0x94, 0xEB, 0x00, 0x00, 0x00, 0x94, 0xEB, 0x00, 0x00, 0x00, 0x94, 0xEB, 0x00, 0x00, 0x00, 0x94,
+  0xEB, 0x00, 0x00, 0x00, 0x94, 0xEB, 0x00, 0x00, 0x00, 0x94, 0xEB, 0x00, 0x00, 0x00, 0x94, 0xEB,
+  0x00, 0x00, 0x00, 0x94, 0xEB, 0x00, 0x00, 0x00, 0x94, 0xF1, 0x4A, 0x45, 0x01, 0x84, 0xE3, 0xE3,
+  0xE3, 0x16, 0x0D, 0xB4, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0xBA, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x4E, 0xFD, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xE4,
+  0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0xE8, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1E, 0xFC, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0xBC, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x4E, 0xFE, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xE3, 0x89,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0xEA, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1E, 0xFC, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0xBE, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x4E, 0xFE, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE3, 0x8B, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0xEB, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A,
+  0xD2, 0x4C, 0x08, 0x54, 0x54, 0x54, 0x31, 0x0F, 0xD1, 0xD6, 0xFC, 0x94, 0x00, 0x00, 0x00, 0xEB,
+  0x94, 0x00, 0x00, 0x00, 0xEB, 0x94, 0x00, 0x00, 0x00, 0xEB, 0x94, 0x00, 0x00, 0x00, 0xEB, 0x94,
+  0x00, 0x00, 0x00, 0xEB, 0x94, 0x00, 0x00, 0x00, 0xEB, 0x94, 0x00, 0x00, 0x00, 0xEB, 0x94, 0x00,
+  0x00, 0x00, 0xEB, 0x94, 0x00, 0x00, 0x00, 0xEB, 0x94, 0x00, 0x00, 0x00, 0xEB, 0x94, 0x00, 0x00,
+  0x00, 0xEB, 0x94, 0x00, 0x00, 0x00, 0xEB, 0x94, 0x00, 0x00, 0x00, 0xEB, 0x94, 0x00, 0x00, 0x00,
+  0xEB, 0x94, 0x00, 0x00, 0x00, 0xEB, 0x94, 0x01, 0x45, 0x4A, 0xF1, 0x94, 0x16, 0xE3, 0xE3, 0xE3,
+  0x84, 0x00, 0x00, 0x00, 0x00, 0x4E, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 0xFF, 0xC4,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x04, 0xD6, 0xDC, 0xFF, 0x53, 0x00, 0x00, 0x00, 0x00, 0x68, 0xFF,
+  0x43, 0xB8, 0xDA, 0x06, 0x00, 0x00, 0x0D, 0xE8, 0xB6, 0x00, 0x2D, 0xFC, 0x6E, 0x00, 0x00, 0x84,
+  0xFC, 0x2C, 0x00, 0x00, 0x9B, 0xEC, 0x10, 0x1C, 0xF5, 0x9B, 0x00, 0x00, 0x00, 0x19, 0xF2, 0x8A,
+  0x0D, 0x21, 0x06, 0x00, 0x00, 0x00, 0x00, 0x15, 0x1C, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+  0x4F, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xBF, 0x32, 0x7D, 0x55, 0x00, 0x00, 0x04, 0xB4,
+  0xFD, 0x35, 0x00, 0x00, 0x0A, 0xC6, 0xCD, 0x03, 0x00, 0x00, 0x10, 0x5D, 0x16, 0x00, 0x00, 0x00,
+  0x0C, 0x3E, 0x4C, 0x26, 0x00, 0x00, 0x00, 0x07, 0x88, 0xF5, 0xFF, 0xFF, 0xFF, 0xA8, 0x06, 0x00,
+  0x67, 0xFB, 0x8E, 0x32, 0x2B, 0xA1, 0xFF, 0x78, 0x00, 0x03, 0x1D, 0x00, 0x00, 0x00, 0x08, 0xF4,
+  0xCB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDA, 0xE4, 0x00, 0x00, 0x00, 0x2B, 0x6D, 0x94,
+  0xA9, 0xF3, 0xE6, 0x00, 0x21, 0xC1, 0xFC, 0xC2, 0x92, 0x79, 0xEA, 0xE6, 0x00, 0xD2, 0xE7, 0x28,
+  0x00, 0x00, 0x00, 0xD9, 0xE6, 0x11, 0xFF, 0xA7, 0x00, 0x00, 0x00, 0x0C, 0xE7, 0xE6, 0x01, 0xE4,
+  0xED, 0x41, 0x1B, 0x4F, 0xD0, 0xEB, 0xE6, 0x00, 0x44, 0xE8, 0xFF, 0xFF, 0xD6, 0x47, 0x81, 0xE5,
+  0x00, 0x00, 0x04, 0x24, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x59, 0xBA, 0x3A, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x7A, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7A, 0xFF, 0x4F,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7A, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x7A, 0xFF, 0x4F, 0x00, 0x22, 0x47, 0x2F, 0x01, 0x00, 0x00, 0x7A, 0xFF, 0x60, 0xAE, 0xFF,
+  0xFF, 0xFF, 0xC7, 0x17, 0x00, 0x7A, 0xFF, 0xF1, 0x8F, 0x30, 0x2E, 0x98, 0xFF, 0xB6, 0x00, 0x7A,
+  0xFF, 0x7E, 0x00, 0x00, 0x00, 0x01, 0xCB, 0xFF, 0x24, 0x7A, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00,
+  0x7E, 0xFF, 0x5C, 0x7A, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x64, 0xFF, 0x73, 0x7A, 0xFF, 0x4F,
+  0x00, 0x00, 0x00, 0x00, 0x69, 0xFF, 0x6D, 0x7A, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x93, 0xFF,
+  0x46, 0x7A, 0xFF, 0x63, 0x00, 0x00, 0x00, 0x13, 0xEB, 0xEA, 0x08, 0x7A, 0xFF, 0xE9, 0x7A, 0x42,
+  0x5B, 0xD4, 0xFF, 0x5F, 0x00, 0x7A, 0xFC, 0x42, 0xC8, 0xFF, 0xFF, 0xE3, 0x5D, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x17, 0x1C, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x32, 0x48, 0x32,
+  0x03, 0x00, 0x00, 0x00, 0x4E, 0xE2, 0xFF, 0xFF, 0xFF, 0xDF, 0x46, 0x00, 0x44, 0xFC, 0xDB, 0x4D,
+  0x1D, 0x39, 0xAB, 0x78, 0x00, 0xCF, 0xFA, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xFF, 0xBB,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFF, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C,
+  0xFF, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xFE, 0xC5, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xC3, 0xFE, 0x37, 0x00, 0x00, 0x00, 0x0C, 0x18, 0x00, 0x35, 0xF7, 0xEB, 0x6E, 0x40,
+  0x62, 0xD9, 0xBD, 0x00, 0x00, 0x3A, 0xCC, 0xFF, 0xFF, 0xF7, 0xAB, 0x1F, 0x00, 0x00, 0x00, 0x00,
+  0x14, 0x20, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xBA, 0x79, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0xFF, 0xA6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x21, 0xFF, 0xA6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0xFF, 0xA6, 0x00, 0x00, 0x00,
+  0x0D, 0x43, 0x48, 0x16, 0x21, 0xFF, 0xA6, 0x00, 0x00, 0x64, 0xF2, 0xFF, 0xFF, 0xF8, 0x91, 0xFF,
+  0xA6, 0x00, 0x50, 0xFE, 0xD1, 0x41, 0x18, 0x3F, 0xCD, 0xFF, 0xA6, 0x00, 0xD5, 0xF7, 0x1D, 0x00,
+  0x00, 0x00, 0x29, 0xFF, 0xA6, 0x21, 0xFF, 0xB7, 0x00, 0x00, 0x00, 0x00, 0x21, 0xFF, 0xA6, 0x42,
+  0xFF, 0x94, 0x00, 0x00, 0x00, 0x00, 0x21, 0xFF, 0xA6, 0x43, 0xFF, 0x93, 0x00, 0x00, 0x00, 0x00,
+  0x21, 0xFF, 0xA6, 0x28, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x21, 0xFF, 0xA6, 0x02, 0xE6, 0xF5,
+  0x18, 0x00, 0x00, 0x00, 0x6E, 0xFF, 0xA6, 0x00, 0x71, 0xFF, 0xD4, 0x61, 0x55, 0xA1, 0xCF, 0xFE,
+  0xA6, 0x00, 0x01, 0x81, 0xF4, 0xFF, 0xFA, 0xA0, 0x10, 0xDF, 0xA6, 0x00, 0x00, 0x00, 0x07, 0x21,
+  0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x32, 0x48, 0x2C, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x4D, 0xE1, 0xFF, 0xFF, 0xFF, 0xCE, 0x29, 0x00, 0x00, 0x46, 0xFC, 0xBD, 0x2D, 0x08, 0x35,
+  0xD4, 0xE2, 0x0D, 0x00, 0xD3, 0xEB, 0x0E, 0x00, 0x00, 0x00, 0x31, 0xFF, 0x68, 0x22, 0xFF, 0xB3,
+  0x2B, 0x2B, 0x2B, 0x2B, 0x2C, 0xF6, 0x9F, 0x3F, 0xFF, 0xF7, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+  0x97, 0x38, 0xFF, 0x8A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0xFC, 0xBC, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0xFD, 0x39, 0x00, 0x00, 0x00, 0x00, 0x24, 0x01, 0x00,
+  0x27, 0xEE, 0xF0, 0x7B, 0x47, 0x56, 0xA9, 0xFD, 0x54, 0x00, 0x00, 0x28, 0xB6, 0xFC, 0xFF, 0xFF,
+  0xD6, 0x69, 0x02, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x22, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x21, 0x74, 0x86, 0x40, 0x00, 0x00, 0x47, 0xF7, 0xFA, 0xD7, 0x73, 0x00, 0x00, 0xDC, 0xEE, 0x23,
+  0x00, 0x00, 0x00, 0x1A, 0xFF, 0xA5, 0x00, 0x00, 0x00, 0x00, 0x24, 0xFF, 0x96, 0x00, 0x00, 0x00,
+  0xAF, 0xF0, 0xFF, 0xF8, 0xED, 0xED, 0x7B, 0x25, 0x6E, 0xFF, 0xC6, 0x5C, 0x5C, 0x30, 0x00, 0x24,
+  0xFF, 0xA6, 0x00, 0x00, 0x00, 0x00, 0x24, 0xFF, 0xA6, 0x00, 0x00, 0x00, 0x00, 0x24, 0xFF, 0xA6,
+  0x00, 0x00, 0x00, 0x00, 0x24, 0xFF, 0xA6, 0x00, 0x00, 0x00, 0x00, 0x24, 0xFF, 0xA6, 0x00, 0x00,
+  0x00, 0x00, 0x24, 0xFF, 0xA6, 0x00, 0x00, 0x00, 0x00, 0x24, 0xFF, 0xA6, 0x00, 0x00, 0x00, 0x00,
+  0x24, 0xFF, 0xA6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x47, 0x41, 0x0F, 0x00, 0x00, 0x00,
+  0x00, 0x0D, 0xAC, 0xFE, 0xFD, 0xFE, 0xF6, 0xBC, 0xBA, 0xA7, 0x00, 0x9B, 0xFC, 0x5D, 0x05, 0x0E,
+  0x91, 0xFF, 0xB1, 0x4A, 0x00, 0xEC, 0xBD, 0x00, 0x00, 0x00, 0x06, 0xF6, 0xA0, 0x00, 0x00, 0xEA,
+  0xBC, 0x00, 0x00, 0x00, 0x05, 0xF6, 0x9D, 0x00, 0x00, 0x92, 0xFC, 0x5A, 0x03, 0x0A, 0x8E, 0xFE,
+  0x44, 0x00, 0x00, 0x08, 0xC1, 0xFF, 0xF8, 0xFC, 0xED, 0x64, 0x00, 0x00, 0x00, 0x4D, 0xF3, 0x32,
+  0x36, 0x2F, 0x06, 0x00, 0x00, 0x00, 0x00, 0xA2, 0xF9, 0x63, 0x2F, 0x21, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x3F, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xEC, 0x9A, 0x0C, 0x0B, 0xB9, 0xB8, 0x36, 0x44, 0x52,
+  0x6B, 0xBA, 0xFF, 0x88, 0x6C, 0xFF, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFC, 0xA4, 0x67, 0xFF,
+  0x64, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xFF, 0x55, 0x09, 0xBC, 0xFF, 0xD4, 0xAB, 0xAD, 0xDA, 0xFC,
+  0x82, 0x00, 0x00, 0x01, 0x45, 0x88, 0xA2, 0x9F, 0x79, 0x25, 0x00, 0x00, 0x65, 0xBA, 0x2D, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x8A, 0xFF, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8A, 0xFF,
+  0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8A, 0xFF, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x8A, 0xFF, 0x3D, 0x00, 0x2A, 0x48, 0x28, 0x00, 0x00, 0x8A, 0xFF, 0x5D, 0xC2, 0xFF, 0xFF, 0xFF,
+  0xAF, 0x07, 0x8A, 0xFF, 0xF4, 0x87, 0x2E, 0x31, 0xB1, 0xFF, 0x78, 0x8A, 0xFF, 0x62, 0x00, 0x00,
+  0x00, 0x11, 0xFB, 0xC9, 0x8A, 0xFF, 0x3D, 0x00, 0x00, 0x00, 0x00, 0xE5, 0xE2, 0x8A, 0xFF, 0x3D,
+  0x00, 0x00, 0x00, 0x00, 0xE3, 0xE3, 0x8A, 0xFF, 0x3D, 0x00, 0x00, 0x00, 0x00, 0xE3, 0xE3, 0x8A,
+  0xFF, 0x3D, 0x00, 0x00, 0x00, 0x00, 0xE3, 0xE3, 0x8A, 0xFF, 0x3D, 0x00, 0x00, 0x00, 0x00, 0xE3,
+  0xE3, 0x8A, 0xFF, 0x3D, 0x00, 0x00, 0x00, 0x00, 0xE3, 0xE3, 0x8A, 0xFF, 0x3D, 0x00, 0x00, 0x00,
+  0x00, 0xE3, 0xE3, 0x22, 0x8D, 0x32, 0xA6, 0xFF, 0xC9, 0x58, 0xE9, 0x75, 0x00, 0x00, 0x00, 0x0B,
+  0x21, 0x0F, 0x57, 0xFF, 0x70, 0x57, 0xFF, 0x70, 0x57, 0xFF, 0x70, 0x57, 0xFF, 0x70, 0x57, 0xFF,
+  0x70, 0x57, 0xFF, 0x70, 0x57, 0xFF, 0x70, 0x57, 0xFF, 0x70, 0x57, 0xFF, 0x70, 0x57, 0xFF, 0x70,
+  0x00, 0x00, 0x22, 0x8D, 0x32, 0x00, 0x00, 0xA6, 0xFF, 0xC9, 0x00, 0x00, 0x58, 0xE9, 0x75, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x21, 0x0F, 0x00, 0x00, 0x57, 0xFF, 0x70, 0x00, 0x00,
+  0x57, 0xFF, 0x70, 0x00, 0x00, 0x57, 0xFF, 0x70, 0x00, 0x00, 0x57, 0xFF, 0x70, 0x00, 0x00, 0x57,
+  0xFF, 0x70, 0x00, 0x00, 0x57, 0xFF, 0x70, 0x00, 0x00, 0x57, 0xFF, 0x70, 0x00, 0x00, 0x57, 0xFF,
+  0x70, 0x00, 0x00, 0x57, 0xFF, 0x70, 0x00, 0x00, 0x57, 0xFF, 0x70, 0x00, 0x00, 0x57, 0xFF, 0x70,
+  0x00, 0x00, 0x79, 0xFF, 0x5C, 0x58, 0xBD, 0xFA, 0xE6, 0x11, 0x49, 0xA0, 0x85, 0x1D, 0x00, 0x59,
+  0xBA, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7A, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x7A, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7A, 0xFF, 0x4F,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7A, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x02, 0x20, 0x1C,
+  0x00, 0x7A, 0xFF, 0x4F, 0x00, 0x00, 0x02, 0xA6, 0xFC, 0x54, 0x00, 0x7A, 0xFF, 0x4F, 0x00, 0x01,
+  0x97, 0xFE, 0x62, 0x00, 0x00, 0x7A, 0xFF, 0x4F, 0x00, 0x87, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x7A,
+  0xFF, 0x5A, 0x7A, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7A, 0xFF, 0xFF, 0xFF, 0xDF, 0x07, 0x00,
+  0x00, 0x00, 0x00, 0x7A, 0xFF, 0x6B, 0x7D, 0xFF, 0x98, 0x00, 0x00, 0x00, 0x00, 0x7A, 0xFF, 0x4F,
+  0x00, 0xA2, 0xFF, 0x63, 0x00, 0x00, 0x00, 0x7A, 0xFF, 0x4F, 0x00, 0x09, 0xCC, 0xF7, 0x35, 0x00,
+  0x00, 0x7A, 0xFF, 0x4F, 0x00, 0x00, 0x1E, 0xE9, 0xE2, 0x16, 0x00, 0x7A, 0xFF, 0x4F, 0x00, 0x00,
+  0x00, 0x3F, 0xF5, 0xBF, 0x04, 0x3F, 0xBA, 0x52, 0x57, 0xFF, 0x70, 0x57, 0xFF, 0x70, 0x57, 0xFF,
+  0x70, 0x57, 0xFF, 0x70, 0x57, 0xFF, 0x70, 0x57, 0xFF, 0x70, 0x57, 0xFF, 0x70, 0x57, 0xFF, 0x70,
+  0x57, 0xFF, 0x70, 0x57, 0xFF, 0x70, 0x57, 0xFF, 0x70, 0x57, 0xFF, 0x70, 0x57, 0xFF, 0x70, 0x57,
+  0xFF, 0x70, 0x12, 0x19, 0x00, 0x06, 0x3D, 0x3C, 0x04, 0x00, 0x00, 0x14, 0x44, 0x39, 0x05, 0x00,
+  0x00, 0x8A, 0xFC, 0x3A, 0xDE, 0xFF, 0xFF, 0xCB, 0x0B, 0x76, 0xF9, 0xFF, 0xFF, 0xDE, 0x2A, 0x00,
+  0x8A, 0xFF, 0xE6, 0x62, 0x26, 0x69, 0xFD, 0xB6, 0xEB, 0x54, 0x26, 0x74, 0xFE, 0xC8, 0x00, 0x8A,
+  0xFF, 0x53, 0x00, 0x00, 0x00, 0xB7, 0xFF, 0x65, 0x00, 0x00, 0x00, 0xBD, 0xFF, 0x18, 0x8A, 0xFF,
+  0x3D, 0x00, 0x00, 0x00, 0x95, 0xFF, 0x35, 0x00, 0x00, 0x00, 0x98, 0xFF, 0x2F, 0x8A, 0xFF, 0x3D,
+  0x00, 0x00, 0x00, 0x94, 0xFF, 0x33, 0x00, 0x00, 0x00, 0x96, 0xFF, 0x30, 0x8A, 0xFF, 0x3D, 0x00,
+  0x00, 0x00, 0x94, 0xFF, 0x33, 0x00, 0x00, 0x00, 0x96, 0xFF, 0x30, 0x8A, 0xFF, 0x3D, 0x00, 0x00,
+  0x00, 0x94, 0xFF, 0x33, 0x00, 0x00, 0x00, 0x96, 0xFF, 0x30, 0x8A, 0xFF, 0x3D, 0x00, 0x00, 0x00,
+  0x94, 0xFF, 0x33, 0x00, 0x00, 0x00, 0x96, 0xFF, 0x30, 0x8A, 0xFF, 0x3D, 0x00, 0x00, 0x00, 0x94,
+  0xFF, 0x33, 0x00, 0x00, 0x00, 0x96, 0xFF, 0x30, 0x8A, 0xFF, 0x3D, 0x00, 0x00, 0x00, 0x94, 0xFF,
+  0x33, 0x00, 0x00, 0x00, 0x96, 0xFF, 0x30, 0x12, 0x19, 0x00, 0x00, 0x2A, 0x47, 0x28, 0x00, 0x00,
+  0x8A, 0xFC, 0x28, 0xC2, 0xFF, 0xFF, 0xFF, 0xAF, 0x07, 0x8A, 0xFF, 0xEB, 0x87, 0x2E, 0x31, 0xB1,
+  0xFF, 0x78, 0x8A, 0xFF, 0x62, 0x00, 0x00, 0x00, 0x11, 0xFB, 0xC9, 0x8A, 0xFF, 0x3D, 0x00, 0x00,
+  0x00, 0x00, 0xE5, 0xE2, 0x8A, 0xFF, 0x3D, 0x00, 0x00, 0x00, 0x00, 0xE3, 0xE3, 0x8A, 0xFF, 0x3D,
+  0x00, 0x00, 0x00, 0x00, 0xE3, 0xE3, 0x8A, 0xFF, 0x3D, 0x00, 0x00, 0x00, 0x00, 0xE3, 0xE3, 0x8A,
+  0xFF, 0x3D, 0x00, 0x00, 0x00, 0x00, 0xE3, 0xE3, 0x8A, 0xFF, 0x3D, 0x00, 0x00, 0x00, 0x00, 0xE3,
+  0xE3, 0x8A, 0xFF, 0x3D, 0x00, 0x00, 0x00, 0x00, 0xE3, 0xE3, 0x00, 0x00, 0x00, 0x02, 0x30, 0x48,
+  0x35, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xDF, 0xFF, 0xFF, 0xFF, 0xE9, 0x60, 0x00, 0x00,
+  0x00, 0x45, 0xFC, 0xD5, 0x49, 0x1F, 0x3F, 0xC5, 0xFF, 0x5E, 0x00, 0x00, 0xD2, 0xF7, 0x1D, 0x00,
+  0x00, 0x00, 0x0F, 0xEC, 0xE8, 0x05, 0x22, 0xFF, 0xB6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9D, 0xFF,
+  0x3C, 0x43, 0xFF, 0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7A, 0xFF, 0x5C, 0x41, 0xFF, 0x95, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x7C, 0xFF, 0x5A, 0x1B, 0xFF, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA5,
+  0xFF, 0x34, 0x00, 0xC3, 0xFB, 0x2D, 0x00, 0x00, 0x00, 0x1C, 0xF3, 0xDC, 0x02, 0x00, 0x31, 0xF4,
+  0xE8, 0x6D, 0x43, 0x63, 0xDC, 0xFB, 0x47, 0x00, 0x00, 0x00, 0x30, 0xBD, 0xFD, 0xFF, 0xFE, 0xC9,
+  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x22, 0x10, 0x00, 0x00, 0x00, 0x00, 0x12, 0x19,
+  0x00, 0x00, 0x2B, 0x4C, 0x30, 0x00, 0x00, 0x00, 0x8A, 0xFC, 0x21, 0xBB, 0xFF, 0xFF, 0xFF, 0xBF,
+  0x11, 0x00, 0x8A, 0xFF, 0xE3, 0x85, 0x2D, 0x31, 0xA5, 0xFF, 0xA6, 0x00, 0x8A, 0xFF, 0x6C, 0x00,
+  0x00, 0x00, 0x03, 0xDA, 0xFC, 0x15, 0x8A, 0xFF, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0x4A,
+  0x8A, 0xFF, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x76, 0xFF, 0x61, 0x8A, 0xFF, 0x3D, 0x00, 0x00, 0x00,
+  0x00, 0x7B, 0xFF, 0x5C, 0x8A, 0xFF, 0x3D, 0x00, 0x00, 0x00, 0x00, 0xA5, 0xFF, 0x34, 0x8A, 0xFF,
+  0x52, 0x00, 0x00, 0x00, 0x1D, 0xF3, 0xDE, 0x02, 0x8A, 0xFF, 0xEF, 0x73, 0x41, 0x60, 0xDC, 0xFD,
+  0x50, 0x00, 0x8A, 0xFF, 0x79, 0xD8, 0xFF, 0xFF, 0xDE, 0x52, 0x00, 0x00, 0x8A, 0xFF, 0x3D, 0x00,
+  0x1A, 0x1B, 0x01, 0x00, 0x00, 0x00, 0x8A, 0xFF, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x8A, 0xFF, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x6E, 0x1A, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x43, 0x48, 0x16, 0x00, 0x16, 0x16, 0x00, 0x00,
+  0x64, 0xF2, 0xFF, 0xFF, 0xF8, 0x71, 0xEB, 0xA6, 0x00, 0x50, 0xFE, 0xD1, 0x41, 0x18, 0x41, 0xCE,
+  0xFF, 0xA6, 0x00, 0xD5, 0xF7, 0x1D, 0x00, 0x00, 0x00, 0x29, 0xFF, 0xA6, 0x21, 0xFF, 0xB7, 0x00,
+  0x00, 0x00, 0x00, 0x21, 0xFF, 0xA6, 0x42, 0xFF, 0x94, 0x00, 0x00, 0x00, 0x00, 0x21, 0xFF, 0xA6,
+  0x43, 0xFF, 0x93, 0x00, 0x00, 0x00, 0x00, 0x21, 0xFF, 0xA6, 0x28, 0xFF, 0xB3, 0x00, 0x00, 0x00,
+  0x00, 0x21, 0xFF, 0xA6, 0x02, 0xE6, 0xF5, 0x18, 0x00, 0x00, 0x00, 0x6E, 0xFF, 0xA6, 0x00, 0x71,
+  0xFF, 0xD4, 0x61, 0x55, 0xA1, 0xE0, 0xFF, 0xA6, 0x00, 0x01, 0x81, 0xF4, 0xFF, 0xFA, 0xA0, 0x31,
+  0xFF, 0xA6, 0x00, 0x00, 0x00, 0x07, 0x21, 0x0B, 0x00, 0x21, 0xFF, 0xA6, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x21, 0xFF, 0xA6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0xFF, 0xA6,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x6E, 0x47, 0x12, 0x1A, 0x00, 0x01, 0x36, 0x49,
+  0x10, 0x8A, 0xFD, 0x15, 0xBB, 0xFF, 0xFF, 0x8A, 0x8A, 0xFF, 0xB6, 0xD1, 0x79, 0x83, 0x3D, 0x8A,
+  0xFF, 0xCC, 0x09, 0x00, 0x00, 0x00, 0x8A, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x8A, 0xFF, 0x3D,
+  0x00, 0x00, 0x00, 0x00, 0x8A, 0xFF, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x8A, 0xFF, 0x3D, 0x00, 0x00,
+  0x00, 0x00, 0x8A, 0xFF, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x8A, 0xFF, 0x3D, 0x00, 0x00, 0x00, 0x00,
+  0x8A, 0xFF, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x30, 0x48, 0x30, 0x02, 0x00, 0x00,
+  0x29, 0xD4, 0xFF, 0xFF, 0xFF, 0xDC, 0x3F, 0x00, 0xD4, 0xEB, 0x44, 0x0D, 0x30, 0x9A, 0x44, 0x17,
+  0xFF, 0x9D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF0, 0xF0, 0x5B, 0x07, 0x00, 0x00, 0x00, 0x00,
+  0x50, 0xF0, 0xFF, 0xF1, 0xA3, 0x36, 0x00, 0x00, 0x00, 0x0F, 0x63, 0xB5, 0xFB, 0xFD, 0x59, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x2F, 0xF6, 0xC8, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0xE3, 0xC4, 0x24,
+  0xEE, 0x85, 0x2C, 0x28, 0x8C, 0xFF, 0x68, 0x09, 0x88, 0xEE, 0xFF, 0xFF, 0xED, 0x76, 0x01, 0x00,
+  0x00, 0x03, 0x22, 0x22, 0x04, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x90, 0xD1, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB2, 0xD1, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD3, 0xD1,
+  0x00, 0x00, 0x00, 0x6F, 0xDF, 0xFE, 0xFC, 0xED, 0xED, 0xAB, 0x2C, 0x5C, 0xF8, 0xE2, 0x5C, 0x5C,
+  0x42, 0x00, 0x00, 0xF5, 0xD1, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xD1, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xF5, 0xD1, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xD1, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5,
+  0xD1, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xD5, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD4, 0xFC, 0x6C,
+  0x6F, 0x73, 0x00, 0x00, 0x4A, 0xF1, 0xFF, 0xF9, 0x8F, 0x00, 0x00, 0x00, 0x09, 0x26, 0x0C, 0x00,
+  0x1A, 0x21, 0x00, 0x00, 0x00, 0x00, 0x04, 0x21, 0x16, 0xC7, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x21,
+  0xFF, 0xA6, 0xC7, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x21, 0xFF, 0xA6, 0xC7, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x21, 0xFF, 0xA6, 0xC7, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x21, 0xFF, 0xA6, 0xC7, 0xFF, 0x00,
+  0x00, 0x00, 0x00, 0x21, 0xFF, 0xA6, 0xC7, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x21, 0xFF, 0xA6, 0xC5,
+  0xFF, 0x03, 0x00, 0x00, 0x00, 0x21, 0xFF, 0xA6, 0xA7, 0xFF, 0x34, 0x00, 0x00, 0x00, 0x58, 0xFF,
+  0xA6, 0x4E, 0xFF, 0xD7, 0x58, 0x4C, 0x98, 0xDF, 0xFE, 0xA6, 0x00, 0x7A, 0xF5, 0xFF, 0xFD, 0xB1,
+  0x1B, 0xDF, 0xA6, 0x00, 0x00, 0x09, 0x26, 0x11, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x1E, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x14, 0x21, 0x01, 0x90, 0xFF, 0x49, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xED,
+  0xCA, 0x00, 0x28, 0xFE, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0x62, 0x00, 0x00, 0xBF, 0xFB,
+  0x19, 0x00, 0x00, 0x00, 0xC5, 0xEF, 0x0A, 0x00, 0x00, 0x57, 0xFF, 0x79, 0x00, 0x00, 0x2C, 0xFF,
+  0x91, 0x00, 0x00, 0x00, 0x06, 0xE8, 0xDC, 0x01, 0x00, 0x91, 0xFE, 0x2A, 0x00, 0x00, 0x00, 0x00,
+  0x86, 0xFF, 0x43, 0x09, 0xEE, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFD, 0xA7, 0x5D, 0xFF,
+  0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB5, 0xF5, 0xB8, 0xE9, 0x06, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x4D, 0xFF, 0xFD, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE1, 0xFD,
+  0x22, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x0E, 0x00, 0x00,
+  0x00, 0x00, 0x0D, 0x21, 0x06, 0xA7, 0xFE, 0x29, 0x00, 0x00, 0x00, 0x43, 0xFF, 0xB0, 0x00, 0x00,
+  0x00, 0x00, 0xBD, 0xF3, 0x09, 0x55, 0xFF, 0x77, 0x00, 0x00, 0x00, 0x97, 0xFE, 0xF7, 0x0C, 0x00,
+  0x00, 0x12, 0xFB, 0xA9, 0x00, 0x0B, 0xF6, 0xC2, 0x00, 0x00, 0x03, 0xE8, 0xB2, 0xFF, 0x55, 0x00,
+  0x00, 0x5B, 0xFF, 0x56, 0x00, 0x00, 0xAF, 0xFC, 0x13, 0x00, 0x3F, 0xFF, 0x36, 0xDD, 0xA6, 0x00,
+  0x00, 0xA8, 0xF6, 0x0C, 0x00, 0x00, 0x5C, 0xFF, 0x5B, 0x00, 0x92, 0xDF, 0x01, 0x8A, 0xF1, 0x07,
+  0x06, 0xF0, 0xB0, 0x00, 0x00, 0x00, 0x10, 0xF9, 0xA7, 0x02, 0xE4, 0x8B, 0x00, 0x37, 0xFF, 0x4A,
+  0x44, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0xB6, 0xEF, 0x3D, 0xFF, 0x37, 0x00, 0x01, 0xE2, 0x9B,
+  0x91, 0xF9, 0x11, 0x00, 0x00, 0x00, 0x00, 0x63, 0xFF, 0xB7, 0xE1, 0x01, 0x00, 0x00, 0x90, 0xE4,
+  0xD4, 0xB7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xFB, 0xFE, 0x8D, 0x00, 0x00, 0x00, 0x3D, 0xFF,
+  0xFE, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0xFE, 0x36, 0x00, 0x00, 0x00, 0x02, 0xE3,
+  0xFC, 0x16, 0x00, 0x00, 0x00, 0x12, 0x21, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x07, 0x21, 0x14, 0x2C,
+  0xF8, 0xD5, 0x07, 0x00, 0x00, 0x00, 0xAA, 0xFB, 0x36, 0x00, 0x74, 0xFF, 0x84, 0x00, 0x00, 0x59,
+  0xFF, 0x7D, 0x00, 0x00, 0x02, 0xC1, 0xFA, 0x30, 0x1A, 0xED, 0xC5, 0x04, 0x00, 0x00, 0x00, 0x20,
+  0xF1, 0xCD, 0xB1, 0xF2, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0xFF, 0xFF, 0x6F, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xA4, 0xF8, 0xF8, 0xC0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x53, 0xFF, 0x89,
+  0x7D, 0xFF, 0x6E, 0x00, 0x00, 0x00, 0x17, 0xEA, 0xD3, 0x07, 0x06, 0xD3, 0xF5, 0x24, 0x00, 0x00,
+  0xB1, 0xFA, 0x31, 0x00, 0x00, 0x37, 0xFC, 0xC3, 0x02, 0x60, 0xFF, 0x79, 0x00, 0x00, 0x00, 0x00,
+  0x8C, 0xFF, 0x71, 0x1C, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x21, 0x02, 0x95, 0xFF,
+  0x55, 0x00, 0x00, 0x00, 0x00, 0x09, 0xEC, 0xCE, 0x00, 0x27, 0xFD, 0xC3, 0x00, 0x00, 0x00, 0x00,
+  0x61, 0xFF, 0x60, 0x00, 0x00, 0xB4, 0xFF, 0x31, 0x00, 0x00, 0x00, 0xCA, 0xEA, 0x08, 0x00, 0x00,
+  0x45, 0xFF, 0x9D, 0x00, 0x00, 0x35, 0xFF, 0x84, 0x00, 0x00, 0x00, 0x01, 0xD3, 0xF6, 0x13, 0x00,
+  0x9E, 0xFA, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x64, 0xFF, 0x76, 0x12, 0xF6, 0xA7, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x09, 0xEB, 0xE0, 0x73, 0xFF, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0xFF,
+  0xED, 0xCA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xF9, 0xFF, 0x5D, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xCB, 0xE7, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
+  0xFE, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA4, 0xF9, 0x18, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1F, 0xFA, 0xA3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
+  0x6D, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21,
+  0x12, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x85, 0x00, 0x44, 0x45, 0x45, 0x45, 0x46,
+  0xDB, 0xF5, 0x2B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xFF, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x3B, 0xFA, 0xA2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xE2, 0xD6, 0x0C, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0xB4, 0xF5, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0xFF, 0x62, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x3A, 0xFA, 0xA1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xE2, 0xF8, 0x6F, 0x63, 0x63, 0x63,
+  0x63, 0x21, 0x4B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x54, 0x00, 0x00, 0x00, 0x31, 0x52,
+  0x0A, 0x00, 0x0A, 0xBB, 0xFC, 0xD7, 0x14, 0x00, 0x75, 0xFE, 0x3E, 0x00, 0x00, 0x00, 0xAD, 0xE1,
+  0x00, 0x00, 0x00, 0x00, 0xA8, 0xE6, 0x00, 0x00, 0x00, 0x00, 0x81, 0xFE, 0x0B, 0x00, 0x00, 0x00,
+  0x53, 0xFF, 0x34, 0x00, 0x00, 0x00, 0x34, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x5E, 0xFE, 0x2E, 0x00,
+  0x00, 0x71, 0xF6, 0x6F, 0x00, 0x00, 0x00, 0x30, 0xC0, 0xD0, 0x09, 0x00, 0x00, 0x00, 0x3A, 0xFF,
+  0x49, 0x00, 0x00, 0x00, 0x3E, 0xFF, 0x46, 0x00, 0x00, 0x00, 0x67, 0xFF, 0x22, 0x00, 0x00, 0x00,
+  0x95, 0xF5, 0x02, 0x00, 0x00, 0x00, 0xB0, 0xDE, 0x00, 0x00, 0x00, 0x00, 0x9D, 0xF0, 0x05, 0x00,
+  0x00, 0x00, 0x3E, 0xFD, 0xA7, 0x4A, 0x03, 0x00, 0x00, 0x4B, 0xBF, 0xE1, 0x1B, 0x3B, 0x39, 0xB2,
+  0xAD, 0xB2, 0xAD, 0xB2, 0xAD, 0xB2, 0xAD, 0xB2, 0xAD, 0xB2, 0xAD, 0xB2, 0xAD, 0xB2, 0xAD, 0xB2,
+  0xAD, 0xB2, 0xAD, 0xB2, 0xAD, 0xB2, 0xAD, 0xB2, 0xAD, 0xB2, 0xAD, 0xB2, 0xAD, 0xB2, 0xAD, 0xB2,
+  0xAD, 0xB2, 0xAD, 0x4D, 0x4B, 0x0A, 0x52, 0x31, 0x00, 0x00, 0x00, 0x14, 0xD7, 0xFC, 0xBA, 0x09,
+  0x00, 0x00, 0x00, 0x3E, 0xFE, 0x74, 0x00, 0x00, 0x00, 0x00, 0xE1, 0xAD, 0x00, 0x00, 0x00, 0x00,
+  0xE6, 0xA8, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x81, 0x00, 0x00, 0x00, 0x34, 0xFF, 0x53, 0x00, 0x00,
+  0x00, 0x4F, 0xFF, 0x34, 0x00, 0x00, 0x00, 0x2E, 0xFE, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF6,
+  0x71, 0x00, 0x00, 0x09, 0xD0, 0xC0, 0x30, 0x00, 0x00, 0x49, 0xFF, 0x3A, 0x00, 0x00, 0x00, 0x46,
+  0xFF, 0x3E, 0x00, 0x00, 0x00, 0x22, 0xFF, 0x67, 0x00, 0x00, 0x00, 0x02, 0xF5, 0x95, 0x00, 0x00,
+  0x00, 0x00, 0xDE, 0xB0, 0x00, 0x00, 0x00, 0x05, 0xF0, 0x9D, 0x00, 0x03, 0x4A, 0xA7, 0xFD, 0x3D,
+  0x00, 0x1B, 0xE1, 0xBF, 0x4B, 0x00, 0x00, 0x00, 0x01, 0x25, 0x1B, 0x00, 0x00, 0x00, 0x0A, 0xAD,
+  0x46, 0x17, 0xCE, 0xFF, 0xFF, 0xCE, 0x69, 0x28, 0x86, 0xFF, 0x3C, 0x97, 0xF6, 0x6C, 0x66, 0xC2,
+  0xFE, 0xFF, 0xFF, 0xAA, 0x01, 0xB2, 0x91, 0x00, 0x00, 0x00, 0x22, 0x54, 0x3B, 0x01, 0x00,
+};
+
+static const LCD_GlyphTypeDef Font24_Glyphs[] =
+{
+  /* Offset, Width, Height, XOffset, YOffset, Advance */
+  {    0,  0,  0,   0,   0,  4},  /*   */
+  {    0,  3, 16,   2,   5,  7},  /* ! */
+  {   48,  6,  6,   1,   5,  8},  /* " */
+  {   84, 12, 15,   0,   5, 12},  /* # */
+  {  264, 10, 20,   1,   3, 12},  /* $ */
+  {  464, 15, 16,   0,   5, 16},  /* % */
+  {  704, 14, 16,   0,   5, 14},  /* & */
+  {  928,  3,  6,   1,   5,  5},  /* ' */
+  {  946,  5, 19,   1,   4,  6},  /* ( */
+  { 1041,  5, 19,   0,   4,  6},  /* ) */
+  { 1136,  7,  8,   0,   4,  8},  /* 0x2A */
+  { 1192, 10, 11,   1,   8, 12},  /* + */
+  { 1302,  4,  6,   0,  17,  4},  /* , */
+  { 1326,  5,  2,   1,  13,  7},  /* - */
+  { 1336,  4,  4,   0,  17,  4},  /* . */
+  { 1352,  9, 16,  -1,   5,  7},  /* 0x2F */
+  { 1496, 11, 16,   0,   5, 12},  /* 0 */
+  { 1672,  9, 15,   2,   5, 12},  /* 1 */
+  { 1807, 10, 15,   1,   5, 12},  /* 2 */
+  { 1957, 10, 16,   1,   5, 12},  /* 3 */
+  { 2117, 12, 15,   0,   5, 12},  /* 4 */
+  { 2297, 10, 16,   1,   5, 12},  /* 5 */
+  { 2457, 10, 16,   1,   5, 12},  /* 6 */
+  { 2617, 10, 15,   1,   5, 12},  /* 7 */
+  { 2767, 11, 16,   0,   5, 12},  /* 8 */
+  { 2943, 10, 15,   1,   5, 12},  /* 9 */
+  { 3093,  3, 11,   1,  10,  5},  /* : */
+  { 3126,  3, 13,   1,  10,  5},  /* ; */
+  { 3165,  9, 10,   1,   8, 12},  /* < */
+  { 3255, 10,  6,   1,  10, 12},  /* = */
+  { 3315,  9, 10,   2,   8, 12},  /* > */
+  { 3405,  8, 16,   0,   5,  8},  /* ? */
+  { 3533, 16, 17,   0,   6, 16},  /* @ */
+  { 3805, 14, 15,   0,   5, 14},  /* A */
+  { 4015, 11, 15,   1,   5, 13},  /* B */
+  { 4180, 13, 16,   0,   5, 14},  /* C */
+  { 4388, 14, 15,   1,   5, 15},  /* D */
+  { 4598, 10, 15,   1,   5, 12},  /* E */
+  { 4748, 10, 15,   1,   5, 11},  /* F */
+  { 4898, 14, 16,   0,   5, 15},  /* G */
+  { 5122, 13, 15,   1,   5, 15},  /* H */
+  { 5317,  3, 15,   2,   5,  6},  /* I */
+  { 5362,  8, 16,   0,   5,  9},  /* J */
+  { 5490, 13, 15,   1,   5, 14},  /* K */
+  { 5685,  9, 15,   1,   5, 10},  /* L */
+  { 5820, 16, 15,   1,   5, 18},  /* M */
+  { 6060, 13, 15,   1,   5, 15},  /* N */
+  { 6255, 16, 16,   0,   5, 16},  /* O */
+  { 6511, 11, 15,   1,   5, 12},  /* P */
+  { 6676, 16, 18,   0,   5, 16},  /* Q */
+  { 6964, 12, 15,   1,   5, 13},  /* R */
+  { 7144, 10, 16,   0,   5, 11},  /* S */
+  { 7304, 12, 15,   0,   5, 12},  /* T */
+  { 7484, 13, 16,   1,   5, 15},  /* U */
+  { 7692, 14, 15,   0,   5, 14},  /* V */
+  { 7902, 21, 15,   0,   5, 20},  /* W */
+  { 8217, 13, 15,   0,   5, 13},  /* X */
+  { 8412, 13, 15,   0,   5, 13},  /* Y */
+  { 8607, 12, 15,   0,   5, 12},  /* Z */
+  { 8787,  5, 19,   1,   4,  6},  /* [ */
+  { 8882,  9, 16,  -1,   5,  8},  /* 0x5C */
+  { 9026,  5, 19,   0,   4,  6},  /* ] */
+  { 9121,  9,  8,   1,   5, 12},  /* ^ */
+  { 9193,  8,  2,   0,  21,  8},  /* _ */
+  { 9209,  5,  4,   0,   5,  6},  /* ` */
+  { 9229,  9, 12,   0,   9, 10},  /* a */
+  { 9337, 10, 16,   1,   5, 11},  /* b */
+  { 9497,  9, 12,   0,   9,  9},  /* c */
+  { 9605, 10, 16,   0,   5, 11},  /* d */
+  { 9765, 10, 12,   0,   9, 10},  /* e */
+  { 9885,  7, 15,   0,   5,  7},  /* f */
+  { 9990, 10, 15,   0,   9, 10},  /* g */
+  {10140,  9, 15,   1,   5, 11},  /* h */
+  {10275,  3, 15,   1,   5,  5},  /* i */
+  {10320,  5, 19,  -1,   5,  5},  /* j */
+  {10415, 10, 15,   1,   5, 10},  /* k */
+  {10565,  3, 15,   1,   5,  5},  /* l */
+  {10610, 15, 11,   1,   9, 16},  /* m */
+  {10775,  9, 11,   1,   9, 11},  /* n */
+  {10874, 11, 12,   0,   9, 11},  /* o */
+  {11006, 10, 15,   1,   9, 11},  /* p */
+  {11156, 10, 15,   0,   9, 11},  /* q */
+  {11306,  7, 11,   1,   9,  8},  /* r */
+  {11383,  8, 12,   0,   9,  9},  /* s */
+  {11479,  7, 15,   0,   6,  7},  /* t */
+  {11584,  9, 12,   1,   9, 11},  /* u */
+  {11692, 11, 11,   0,   9, 10},  /* v */
+  {11813, 16, 11,   0,   9, 15},  /* w */
+  {11989, 10, 11,   0,   9, 10},  /* x */
+  {12099, 11, 15,   0,   9, 10},  /* y */
+  {12264,  9, 11,   0,   9,  9},  /* z */
+  {12363,  6, 19,   0,   4,  6},  /* { */
+  {12477,  2, 20,   2,   4,  6},  /* | */
+  {12517,  6, 19,   0,   4,  6},  /* } */
+  {12631, 10,  4,   1,  12, 12},  /* ~ */
+};
+
+static const LCD_KernTypeDef Font24_Kerning[] =
+{
+  {0x0022, 0x0026,  -2},
+  {0x0022, 0x002C,  -2},
+  {0x0022, 0x002D,  -2},
+  {0x0022, 0x002E,  -2},
+  {0x0022, 0x002F,  -2},
+  {0x0022, 0x0041,  -2},
+  {0x0022, 0x0061,  -1},
+  {0x0022, 0x0063,  -1},
+  {0x0022, 0x0064,  -1},
+  {0x0022, 0x0065,  -1},
+  {0x0022, 0x006F,  -1},
+  {0x0022, 0x0071,  -1},
+  {0x0027, 0x0026,  -2},
+  {0x0027, 0x002C,  -2},
+  {0x0027, 0x002D,  -2},
+  {0x0027, 0x002E,  -2},
+  {0x0027, 0x002F,  -2},
+  {0x0027, 0x0041,  -2},
+  {0x0027, 0x0061,  -1},
+  {0x0027, 0x0063,  -1},
+  {0x0027, 0x0064,  -1},
+  {0x0027, 0x0065,  -1},
+  {0x0027, 0x006F,  -1},
+  {0x0027, 0x0071,  -1},
+  {0x002A, 0x0026,  -2},
+  {0x002A, 0x002C,  -2},
+  {0x002A, 0x002D,  -2},
+  {0x002A, 0x002E,  -2},
+  {0x002A, 0x002F,  -2},
+  {0x002A, 0x0041,  -2},
+  {0x002A, 0x0061,  -1},
+  {0x002A, 0x0063,  -1},
+  {0x002A, 0x0064,  -1},
+  {0x002A, 0x0065,  -1},
+  {0x002A, 0x006F,  -1},
+  {0x002A, 0x0071,  -1},
+  {0x002C, 0x0022,  -2},
+  {0x002C, 0x0027,  -2},
+  {0x002C, 0x002A,  -2},
+  {0x002C, 0x002D,  -1},
+  {0x002C, 0x0040,  -1},
+  {0x002C, 0x0043,  -1},
+  {0x002C, 0x0047,  -1},
+  {0x002C, 0x004F,  -1},
+  {0x002C, 0x0051,  -1},
+  {0x002C, 0x0054,  -2},
+  {0x002C, 0x0056,  -2},
+  {0x002C, 0x0057,  -1},
+  {0x002C, 0x0059,  -2},
+  {0x002C, 0x005C,  -2},
+  {0x002C, 0x0076,  -1},
+  {0x002C, 0x0077,  -1},
+  {0x002C, 0x0079,  -1},
+  {0x002D, 0x0022,  -2},
+  {0x002D, 0x0026,  -1},
+  {0x002D, 0x0027,  -2},
+  {0x002D, 0x002A,  -2},
+  {0x002D, 0x002C,  -1},
+  {0x002D, 0x002E,  -1},
+  {0x002D, 0x002F,  -1},
+  {0x002D, 0x0041,  -1},
+  {0x002D, 0x0054,  -2},
+  {0x002D, 0x0056,  -1},
+  {0x002D, 0x0058,  -1},
+  {0x002D, 0x0059,  -2},
+  {0x002D, 0x005C,  -1},
+  {0x002E, 0x0022,  -2},
+  {0x002E, 0x0027,  -2},
+  {0x002E, 0x002A,  -2},
+  {0x002E, 0x002D,  -1},
+  {0x002E, 0x0040,  -1},
+  {0x002E, 0x0043,  -1},
+  {0x002E, 0x0047,  -1},
+  {0x002E, 0x004F,  -1},
+  {0x002E, 0x0051,  -1},
+  {0x002E, 0x0054,  -2},
+  {0x002E, 0x0056,  -2},
+  {0x002E, 0x0057,  -1},
+  {0x002E, 0x0059,  -2},
+  {0x002E, 0x005C,  -2},
+  {0x002E, 0x0076,  -1},
+  {0x002E, 0x0077,  -1},
+  {0x002E, 0x0079,  -1},
+  {0x002F, 0x0026,  -1},
+  {0x002F, 0x002C,  -2},
+  {0x002F, 0x002D,  -1},
+  {0x002F, 0x002E,  -2},
+  {0x002F, 0x002F,  -1},
+  {0x002F, 0x003A,  -1},
+  {0x002F, 0x003B,  -1},
+  {0x002F, 0x0040,  -1},
+  {0x002F, 0x0041,  -1},
+  {0x002F, 0x0043,  -1},
+  {0x002F, 0x0047,  -1},
+  {0x002F, 0x004A,  -2},
+  {0x002F, 0x004F,  -1},
+  {0x002F, 0x0051,  -1},
+  {0x002F, 0x0061,  -1},
+  {0x002F, 0x0063,  -1},
+  {0x002F, 0x0064,  -1},
+  {0x002F, 0x0065,  -1},
+  {0x002F, 0x0067,  -1},
+  {0x002F, 0x006D,  -1},
+  {0x002F, 0x006E,  -1},
+  {0x002F, 0x006F,  -1},
+  {0x002F, 0x0070,  -1},
+  {0x002F, 0x0071,  -1},
+  {0x002F, 0x0072,  -1},
+  {0x002F, 0x0073,  -1},
+  {0x002F, 0x0075,  -1},
+  {0x002F, 0x0078,  -1},
+  {0x002F, 0x007A,  -1},
+  {0x0040, 0x002C,  -1},
+  {0x0040, 0x002E,  -1},
+  {0x0040, 0x0054,  -1},
+  {0x0040, 0x0056,  -1},
+  {0x0040, 0x0059,  -1},
+  {0x0040, 0x005A,  -1},
+  {0x0040, 0x005C,  -1},
+  {0x0041, 0x0022,  -2},
+  {0x0041, 0x0027,  -2},
+  {0x0041, 0x002A,  -2},
+  {0x0041, 0x002D,  -1},
+  {0x0041, 0x003F,  -1},
+  {0x0041, 0x0054,  -1},
+  {0x0041, 0x0055,  -1},
+  {0x0041, 0x0056,  -1},
+  {0x0041, 0x0057,  -1},
+  {0x0041, 0x0059,  -2},
+  {0x0041, 0x005C,  -1},
+  {0x0041, 0x0076,  -1},
+  {0x0041, 0x0079,  -1},
+  {0x0043, 0x002D,  -2},
+  {0x0044, 0x002C,  -1},
+  {0x0044, 0x002E,  -1},
+  {0x0044, 0x0054,  -1},
+  {0x0044, 0x0056,  -1},
+  {0x0044, 0x0059,  -1},
+  {0x0044, 0x005A,  -1},
+  {0x0044, 0x005C,  -1},
+  {0x0046, 0x0026,  -1},
+  {0x0046, 0x002C,  -2},
+  {0x0046, 0x002E,  -2},
+  {0x0046, 0x002F,  -1},
+  {0x0046, 0x003A,  -1},
+  {0x0046, 0x003B,  -1},
+  {0x0046, 0x0041,  -1},
+  {0x0046, 0x004A,  -2},
+  {0x0046, 0x0063,  -1},
+  {0x0046, 0x0064,  -1},
+  {0x0046, 0x0065,  -1},
+  {0x0046, 0x006D,  -1},
+  {0x0046, 0x006E,  -1},
+  {0x0046, 0x006F,  -1},
+  {0x0046, 0x0070,  -1},
+  {0x0046, 0x0071,  -1},
+  {0x0046, 0x0072,  -1},
+  {0x0046, 0x0075,  -1},
+  {0x004A, 0x0026,  -1},
+  {0x004A, 0x002F,  -1},
+  {0x004A, 0x0041,  -1},
+  {0x004B, 0x002D,  -1},
+  {0x004B, 0x0066,  -1},
+  {0x004B, 0x0074,  -1},
+  {0x004B, 0x0076,  -1},
+  {0x004B, 0x0077,  -1},
+  {0x004B, 0x0079,  -1},
+  {0x004C, 0x0022,  -3},
+  {0x004C, 0x0027,  -3},
+  {0x004C, 0x002A,  -3},
+  {0x004C, 0x002C,   1},
+  {0x004C, 0x002D,  -2},
+  {0x004C, 0x002E,   1},
+  {0x004C, 0x0040,  -1},
+  {0x004C, 0x0043,  -1},
+  {0x004C, 0x0047,  -1},
+  {0x004C, 0x004F,  -1},
+  {0x004C, 0x0051,  -1},
+  {0x004C, 0x0054,  -2},
+  {0x004C, 0x0056,  -2},
+  {0x004C, 0x0057,  -2},
+  {0x004C, 0x0059,  -2},
+  {0x004C, 0x005C,  -2},
+  {0x004C, 0x0076,  -1},
+  {0x004C, 0x0077,  -1},
+  {0x004C, 0x0079,  -1},
+  {0x004F, 0x002C,  -1},
+  {0x004F, 0x002E,  -1},
+  {0x004F, 0x0054,  -1},
+  {0x004F, 0x0056,  -1},
+  {0x004F, 0x0059,  -1},
+  {0x004F, 0x005A,  -1},
+  {0x004F, 0x005C,  -1},
+  {0x0050, 0x0026,  -1},
+  {0x0050, 0x002C,  -2},
+  {0x0050, 0x002E,  -2},
+  {0x0050, 0x002F,  -1},
+  {0x0050, 0x0041,  -1},
+  {0x0050, 0x004A,  -2},
+  {0x0051, 0x002C,  -1},
+  {0x0051, 0x002E,  -1},
+  {0x0051, 0x0054,  -1},
+  {0x0051, 0x0056,  -1},
+  {0x0051, 0x0059,  -1},
+  {0x0051, 0x005A,  -1},
+  {0x0051, 0x005C,  -1},
+  {0x0052, 0x0054,  -1},
+  {0x0054, 0x0026,  -1},
+  {0x0054, 0x002C,  -2},
+  {0x0054, 0x002D,  -2},
+  {0x0054, 0x002E,  -2},
+  {0x0054, 0x002F,  -1},
+  {0x0054, 0x003A,  -2},
+  {0x0054, 0x003B,  -2},
+  {0x0054, 0x0040,  -1},
+  {0x0054, 0x0041,  -1},
+  {0x0054, 0x0043,  -1},
+  {0x0054, 0x0047,  -1},
+  {0x0054, 0x004A,  -2},
+  {0x0054, 0x004F,  -1},
+  {0x0054, 0x0051,  -1},
+  {0x0054, 0x0061,  -2},
+  {0x0054, 0x0063,  -2},
+  {0x0054, 0x0064,  -2},
+  {0x0054, 0x0065,  -2},
+  {0x0054, 0x0067,  -2},
+  {0x0054, 0x006D,  -2},
+  {0x0054, 0x006E,  -2},
+  {0x0054, 0x006F,  -2},
+  {0x0054, 0x0070,  -2},
+  {0x0054, 0x0071,  -2},
+  {0x0054, 0x0072,  -2},
+  {0x0054, 0x0073,  -2},
+  {0x0054, 0x0075,  -2},
+  {0x0054, 0x0076,  -2},
+  {0x0054, 0x0077,  -1},
+  {0x0054, 0x0078,  -1},
+  {0x0054, 0x0079,  -2},
+  {0x0054, 0x007A,  -1},
+  {0x0055, 0x0026,  -1},
+  {0x0055, 0x002F,  -1},
+  {0x0055, 0x0041,  -1},
+  {0x0056, 0x0026,  -1},
+  {0x0056, 0x002C,  -2},
+  {0x0056, 0x002D,  -1},
+  {0x0056, 0x002E,  -2},
+  {0x0056, 0x002F,  -1},
+  {0x0056, 0x003A,  -1},
+  {0x0056, 0x003B,  -1},
+  {0x0056, 0x0040,  -1},
+  {0x0056, 0x0041,  -1},
+  {0x0056, 0x0043,  -1},
+  {0x0056, 0x0047,  -1},
+  {0x0056, 0x004A,  -2},
+  {0x0056, 0x004F,  -1},
+  {0x0056, 0x0051,  -1},
+  {0x0056, 0x0061,  -1},
+  {0x0056, 0x0063,  -1},
+  {0x0056, 0x0064,  -1},
+  {0x0056, 0x0065,  -1},
+  {0x0056, 0x0067,  -1},
+  {0x0056, 0x006D,  -1},
+  {0x0056, 0x006E,  -1},
+  {0x0056, 0x006F,  -1},
+  {0x0056, 0x0070,  -1},
+  {0x0056, 0x0071,  -1},
+  {0x0056, 0x0072,  -1},
+  {0x0056, 0x0073,  -1},
+  {0x0056, 0x0075,  -1},
+  {0x0056, 0x0078,  -1},
+  {0x0056, 0x007A,  -1},
+  {0x0057, 0x0026,  -1},
+  {0x0057, 0x002C,  -1},
+  {0x0057, 0x002E,  -1},
+  {0x0057, 0x002F,  -1},
+  {0x0057, 0x0041,  -1},
+  {0x0057, 0x004A,  -1},
+  {0x0057, 0x0061,  -1},
+  {0x0057, 0x0067,  -1},
+  {0x0058, 0x002D,  -1},
+  {0x0058, 0x0066,  -1},
+  {0x0058, 0x0074,  -1},
+  {0x0058, 0x0076,  -1},
+  {0x0058, 0x0077,  -1},
+  {0x0058, 0x0079,  -1},
+  {0x0059, 0x0026,  -2},
+  {0x0059, 0x002C,  -2},
+  {0x0059, 0x002D,  -2},
+  {0x0059, 0x002E,  -2},
+  {0x0059, 0x002F,  -2},
+  {0x0059, 0x003A,  -1},
+  {0x0059, 0x003B,  -1},
+  {0x0059, 0x0040,  -1},
+  {0x0059, 0x0041,  -2},
+  {0x0059, 0x0043,  -1},
+  {0x0059, 0x0047,  -1},
+  {0x0059, 0x004A,  -2},
+  {0x0059, 0x004F,  -1},
+  {0x0059, 0x0051,  -1},
+  {0x0059, 0x0061,  -1},
+  {0x0059, 0x0063,  -2},
+  {0x0059, 0x0064,  -2},
+  {0x0059, 0x0065,  -2},
+  {0x0059, 0x0067,  -2},
+  {0x0059, 0x006D,  -1},
+  {0x0059, 0x006E,  -1},
+  {0x0059, 0x006F,  -2},
+  {0x0059, 0x0070,  -1},
+  {0x0059, 0x0071,  -2},
+  {0x0059, 0x0072,  -1},
+  {0x0059, 0x0073,  -1},
+  {0x0059, 0x0075,  -1},
+  {0x0059, 0x0076,  -1},
+  {0x0059, 0x0077,  -1},
+  {0x0059, 0x0078,  -1},
+  {0x0059, 0x0079,  -1},
+  {0x005A, 0x002D,  -1},
+  {0x005A, 0x0040,  -1},
+  {0x005A, 0x0043,  -1},
+  {0x005A, 0x0047,  -1},
+  {0x005A, 0x004F,  -1},
+  {0x005A, 0x0051,  -1},
+  {0x005C, 0x0022,  -2},
+  {0x005C, 0x0027,  -2},
+  {0x005C, 0x002A,  -2},
+  {0x005C, 0x002D,  -1},
+  {0x005C, 0x003F,  -1},
+  {0x005C, 0x0054,  -1},
+  {0x005C, 0x0055,  -1},
+  {0x005C, 0x0056,  -1},
+  {0x005C, 0x0057,  -1},
+  {0x005C, 0x0059,  -2},
+  {0x005C, 0x005C,  -1},
+  {0x005C, 0x0076,  -1},
+  {0x005C, 0x0079,  -1},
+  {0x0061, 0x0022,  -1},
+  {0x0061, 0x0027,  -1},
+  {0x0061, 0x002A,  -1},
+  {0x0062, 0x0022,  -1},
+  {0x0062, 0x0027,  -1},
+  {0x0062, 0x002A,  -1},
+  {0x0062, 0x0056,  -1},
+  {0x0062, 0x005C,  -1},
+  {0x0062, 0x0078,  -1},
+  {0x0065, 0x0022,  -1},
+  {0x0065, 0x0027,  -1},
+  {0x0065, 0x002A,  -1},
+  {0x0065, 0x0056,  -1},
+  {0x0065, 0x005C,  -1},
+  {0x0065, 0x0078,  -1},
+  {0x0066, 0x0022,   1},
+  {0x0066, 0x0027,   1},
+  {0x0066, 0x002A,   1},
+  {0x0066, 0x002C,  -1},
+  {0x0066, 0x002E,  -1},
+  {0x0068, 0x0022,  -1},
+  {0x0068, 0x0027,  -1},
+  {0x0068, 0x002A,  -1},
+  {0x006B, 0x0063,  -1},
+  {0x006B, 0x0064,  -1},
+  {0x006B, 0x0065,  -1},
+  {0x006B, 0x006F,  -1},
+  {0x006B, 0x0071,  -1},
+  {0x006D, 0x0022,  -1},
+  {0x006D, 0x0027,  -1},
+  {0x006D, 0x002A,  -1},
+  {0x006E, 0x0022,  -1},
+  {0x006E, 0x0027,  -1},
+  {0x006E, 0x002A,  -1},
+  {0x006F, 0x0022,  -1},
+  {0x006F, 0x0027,  -1},
+  {0x006F, 0x002A,  -1},
+  {0x006F, 0x0056,  -1},
+  {0x006F, 0x005C,  -1},
+  {0x006F, 0x0078,  -1},
+  {0x0070, 0x0022,  -1},
+  {0x0070, 0x0027,  -1},
+  {0x0070, 0x002A,  -1},
+  {0x0070, 0x0056,  -1},
+  {0x0070, 0x005C,  -1},
+  {0x0070, 0x0078,  -1},
+  {0x0072, 0x002C,  -1},
+  {0x0072, 0x002E,  -1},
+  {0x0076, 0x0026,  -1},
+  {0x0076, 0x002C,  -1},
+  {0x0076, 0x002E,  -1},
+  {0x0076, 0x002F,  -1},
+  {0x0076, 0x0041,  -1},
+  {0x0077, 0x002C,  -1},
+  {0x0077, 0x002E,  -1},
+  {0x0078, 0x0063,  -1},
+  {0x0078, 0x0064,  -1},
+  {0x0078, 0x0065,  -1},
+  {0x0078, 0x006F,  -1},
+  {0x0078, 0x0071,  -1},
+  {0x0079, 0x0026,  -1},
+  {0x0079, 0x002C,  -1},
+  {0x0079, 0x002E,  -1},
+  {0x0079, 0x002F,  -1},
+  {0x0079, 0x0041,  -1},
+};
+
+sFONT Font24 =
+{
+  Font24_Table,
+  20,    /* Width */
+  24,    /* Height */
+  Font24_Glyphs,
+  20,    /* Ascent */
+  0x20,  /* FirstChar */
+  95,    /* GlyphCount */
+  8,     /* Bpp */
+  LCD_FONT_RAW,  /* Encoding */
+  NULL,
+  Font24_Kerning,
+  400,     /* KernCount */
+};
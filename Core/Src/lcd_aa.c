@@ -0,0 +1,445 @@
+#include "lcd_aa.h"
+#include "lcd_display.h"
+#include "lcd_dma2d.h"
+#include "lcd_prof.h"
+#include <math.h>
+
+extern LTDC_HandleTypeDef hltdc;
+
+#define Ltdc_Handler hltdc
+
+#define AA_PI        3.14159265f
+
+static float    AccBuffer[LCD_AA_BAND_ROWS][LCD_AA_MAX_WIDTH + 2];   /* 每个像素边界的有符号面积增量 */
+static uint8_t  MaskBuffer[2][LCD_AA_BAND_ROWS * LCD_AA_MAX_WIDTH];  /* 两块A8覆盖率掩码交替使用 */
+static uint32_t MaskFence[2];                                        /* 使用对应掩码的DMA2D命令 */
+static uint32_t MaskIndex;
+static LCD_AA_PointTypeDef Path[LCD_AA_MAX_POINTS];                  /* 圆弧、直线转换成的多边形 */
+
+static void     AA_FillPath(const LCD_AA_PointTypeDef *pPoints, uint32_t Count);
+static void     AA_AccumulateEdge(float x0, float y0, float x1, float y1, int32_t Width, int32_t Rows, int32_t *pMin, int32_t *pMax);
+static uint32_t AA_ArcSegments(float Radius, float Sweep);
+
+/**
+  * @brief  绘制抗锯齿直线，颜色为当前层的文字颜色
+  * @note   坐标以像素中心为准，两端为平头
+  * @param  x1, y1: 起点
+  * @param  x2, y2: 终点
+  * @param  Width: 线宽(像素)
+  * @retval 无
+  */
+void LCD_DrawLineAA(float x1, float y1, float x2, float y2, float Width)
+{
+  float dx = x2 - x1;
+  float dy = y2 - y1;
+  float len = sqrtf(dx * dx + dy * dy);
+  float nx, ny;
+
+  if(len < 1e-3f)
+  {
+    return;
+  }
+
+  LCD_PROF_BEGIN(LCD_PROF_LINE_AA);
+  /* 法线方向偏移半个线宽，得到一个四边形 */
+  nx = -dy / len * Width * 0.5f;
+  ny =  dx / len * Width * 0.5f;
+
+  Path[0].X = x1 + nx;  Path[0].Y = y1 + ny;
+  Path[1].X = x2 + nx;  Path[1].Y = y2 + ny;
+  Path[2].X = x2 - nx;  Path[2].Y = y2 - ny;
+  Path[3].X = x1 - nx;  Path[3].Y = y1 - ny;
+
+  AA_FillPath(Path, 4);
+  LCD_PROF_END();
+}
+
+/**
+  * @brief  绘制抗锯齿圆弧，颜色为当前层的文字颜色
+  * @note   角度单位为度，0度指向X轴正方向，顺时针增加；扫过360度时为圆环
+  * @param  Xpos, Ypos: 圆心
+  * @param  Radius: 半径(线宽的中心)
+  * @param  StartAngle: 起始角度
+  * @param  EndAngle: 结束角度
+  * @param  Width: 线宽(像素)
+  * @retval 无
+  */
+void LCD_DrawArcAA(float Xpos, float Ypos, float Radius, float StartAngle, float EndAngle, float Width)
+{
+  float outer = Radius + Width * 0.5f;
+  float inner = Radius - Width * 0.5f;
+  float start = StartAngle * AA_PI / 180.0f;
+  float sweep = (EndAngle - StartAngle) * AA_PI / 180.0f;
+  float angle, k;
+  uint32_t n, i;
+
+  LCD_PROF_BEGIN(LCD_PROF_ARC_AA);
+  if(inner < 0.0f)
+  {
+    inner = 0.0f;
+  }
+  if(sweep > 2.0f * AA_PI)
+  {
+    sweep = 2.0f * AA_PI;
+  }
+  else if(sweep < -2.0f * AA_PI)
+  {
+    sweep = -2.0f * AA_PI;
+  }
+
+  /* 外圆弧正向、内圆弧反向连成一个闭合多边形，整圆时首尾两条边相互抵消；
+   * 顶点放在略大的半径上，使弦在圆弧内外的误差相等，不会整体偏细 */
+  n = AA_ArcSegments(outer, sweep);
+  k = 2.0f / (1.0f + cosf(sweep / (float)n * 0.5f));
+  outer *= k;
+  inner *= k;
+  for(i = 0; i <= n; i++)
+  {
+    angle = start + sweep * (float)i / (float)n;
+    Path[i].X              = Xpos + outer * cosf(angle);
+    Path[i].Y              = Ypos + outer * sinf(angle);
+    Path[2 * n + 1 - i].X  = Xpos + inner * cosf(angle);
+    Path[2 * n + 1 - i].Y  = Ypos + inner * sinf(angle);
+  }
+
+  AA_FillPath(Path, 2 * (n + 1));
+  LCD_PROF_END();
+}
+
+/**
+  * @brief  绘制抗锯齿实心圆，颜色为当前层的文字颜色
+  * @param  Xpos, Ypos: 圆心
+  * @param  Radius: 半径
+  * @retval 无
+  */
+void LCD_FillCircleAA(float Xpos, float Ypos, float Radius)
+{
+  float angle, r;
+  uint32_t n, i;
+
+  LCD_PROF_BEGIN(LCD_PROF_CIRCLE_AA);
+  n = AA_ArcSegments(Radius, 2.0f * AA_PI) * 2;
+  if(n > LCD_AA_MAX_POINTS)
+  {
+    n = LCD_AA_MAX_POINTS;
+  }
+  /* 顶点放在略大的半径上，使弦在圆内外的误差相等，面积不会整体偏小 */
+  r = 2.0f * Radius / (1.0f + cosf(AA_PI / (float)n));
+  for(i = 0; i < n; i++)
+  {
+    angle = 2.0f * AA_PI * (float)i / (float)n;
+    Path[i].X = Xpos + r * cosf(angle);
+    Path[i].Y = Ypos + r * sinf(angle);
+  }
+
+  AA_FillPath(Path, n);
+  LCD_PROF_END();
+}
+
+/**
+  * @brief  填充抗锯齿多边形(非零环绕规则)，颜色为当前层的文字颜色
+  * @note   覆盖率是环绕数按面积累加后取绝对值再截到1，自相交路径中环绕数为2的区域与外部在同一像素内相邻时
+  *         该像素覆盖率偏大
+  * @param  Points: 顶点数组，首尾自动相连
+  * @param  PointCount: 顶点个数
+  * @retval 无
+  */
+void LCD_FillPolygonAA(const LCD_AA_PointTypeDef *Points, uint16_t PointCount)
+{
+  if(PointCount < 3)
+  {
+    return;
+  }
+  LCD_PROF_BEGIN(LCD_PROF_POLYGON_AA);
+  AA_FillPath(Points, PointCount);
+  LCD_PROF_END();
+}
+
+/**
+  * @brief  按误差不超过1/4像素计算圆弧需要的线段数
+  * @param  Radius: 半径
+  * @param  Sweep: 扫过的弧度
+  * @retval 线段数，保证2*(线段数+1)不超过LCD_AA_MAX_POINTS
+  */
+static uint32_t AA_ArcSegments(float Radius, float Sweep)
+{
+  float step = AA_PI / 2.0f;
+  uint32_t n;
+
+  if(Radius > 0.25f)
+  {
+    step = 2.0f * acosf(1.0f - 0.25f / Radius);
+  }
+  n = (uint32_t)ceilf(fabsf(Sweep) / step);
+  if(n < 2)
+  {
+    n = 2;
+  }
+  if(n > (LCD_AA_MAX_POINTS / 2 - 1))
+  {
+    n = LCD_AA_MAX_POINTS / 2 - 1;
+  }
+  return n;
+}
+
+/**
+  * @brief  把一条边对条带内各像素的有符号覆盖面积累加到AccBuffer
+  * @note   坐标相对于条带左上角；横向超出[0, Width]的部分投影到边界上，
+  *         不改变其右侧像素的环绕数
+  * @param  x0, y0: 边的起点
+  * @param  x1, y1: 边的终点
+  * @param  Width: 条带宽度
+  * @param  Rows: 条带行数
+  * @param  pMin, pMax: 更新被修改的最小、最大列
+  * @retval 无
+  */
+static void AA_AccumulateEdge(float x0, float y0, float x1, float y1, int32_t Width, int32_t Rows, int32_t *pMin, int32_t *pMax)
+{
+  float dir, dxdy, x, xnext, dy, d, t, xc;
+  float xa, xb, s, a0, a1, a2, am, xaf, xbf, xmf;
+  int32_t y, yend, xai, xbi, xi;
+  float *acc;
+
+  if(y0 == y1)
+  {
+    return;
+  }
+
+  /* 跨过左右边界的边在交点处分成两段，超出的一段投影到边界上是一条竖直边；
+   * 否则同一行内边界外的部分会被当作斜边分摊到边界像素上 */
+  if(((x0 < 0.0f) && (x1 > 0.0f)) || ((x0 > 0.0f) && (x1 < 0.0f)) ||
+     ((x0 < (float)Width) && (x1 > (float)Width)) || ((x0 > (float)Width) && (x1 < (float)Width)))
+  {
+    xc = (((x0 < 0.0f) && (x1 > 0.0f)) || ((x0 > 0.0f) && (x1 < 0.0f))) ? 0.0f : (float)Width;
+    t  = y0 + (y1 - y0) * (xc - x0) / (x1 - x0);
+    AA_AccumulateEdge(x0, y0, xc, t, Width, Rows, pMin, pMax);
+    AA_AccumulateEdge(xc, t, x1, y1, Width, Rows, pMin, pMax);
+    return;
+  }
+  dir = 1.0f;
+  if(y0 > y1)
+  {
+    dir = -1.0f;
+    t = x0; x0 = x1; x1 = t;
+    t = y0; y0 = y1; y1 = t;
+  }
+  if((y1 <= 0.0f) || (y0 >= (float)Rows))
+  {
+    return;
+  }
+
+  dxdy = (x1 - x0) / (y1 - y0);
+  x = x0;
+  if(y0 < 0.0f)
+  {
+    x -= y0 * dxdy;
+    y0 = 0.0f;
+  }
+  yend = (int32_t)ceilf(y1);
+  if(yend > Rows)
+  {
+    yend = Rows;
+  }
+
+  for(y = (int32_t)y0; y < yend; y++)
+  {
+    acc   = AccBuffer[y];
+    dy    = (((float)(y + 1) < y1) ? (float)(y + 1) : y1) - (((float)y > y0) ? (float)y : y0);
+    xnext = x + dxdy * dy;
+    d     = dy * dir;
+
+    xa = (x < xnext) ? x : xnext;
+    xb = (x < xnext) ? xnext : x;
+    xa = (xa < 0.0f) ? 0.0f : ((xa > (float)Width) ? (float)Width : xa);
+    xb = (xb < 0.0f) ? 0.0f : ((xb > (float)Width) ? (float)Width : xb);
+    xai = (int32_t)floorf(xa);
+    xbi = (int32_t)ceilf(xb);
+
+    if(xbi <= xai + 1)
+    {
+      /* 本行只跨一个像素：按中点位置分到该像素和右侧像素 */
+      xmf = 0.5f * (xa + xb) - (float)xai;
+      acc[xai]     += d - d * xmf;
+      acc[xai + 1] += d * xmf;
+    }
+    else
+    {
+      /* 跨多个像素：两端为三角形面积，中间每个像素面积相同 */
+      s   = 1.0f / (xb - xa);
+      xaf = xa - (float)xai;
+      a0  = 0.5f * s * (1.0f - xaf) * (1.0f - xaf);
+      xbf = xb - (float)xbi + 1.0f;
+      am  = 0.5f * s * xbf * xbf;
+      acc[xai] += d * a0;
+      if(xbi == xai + 2)
+      {
+        acc[xai + 1] += d * (1.0f - a0 - am);
+      }
+      else
+      {
+        a1 = s * (1.5f - xaf);
+        acc[xai + 1] += d * (a1 - a0);
+        for(xi = xai + 2; xi < xbi - 1; xi++)
+        {
+          acc[xi] += d * s;
+        }
+        a2 = a1 + (float)(xbi - xai - 3) * s;
+        acc[xbi - 1] += d * (1.0f - a2 - am);
+      }
+      acc[xbi] += d * am;
+    }
+
+    if(xai < *pMin)
+    {
+      *pMin = xai;
+    }
+    if(xbi > *pMax)
+    {
+      *pMax = xbi;
+    }
+    x = xnext;
+  }
+}
+
+/**
+  * @brief  光栅化闭合多边形并混合到当前层
+  * @note   每LCD_AA_BAND_ROWS行生成一块A8掩码，由DMA2D以掩码为前景、显存为背景
+  *         混合回显存；CPU光栅化下一条带时DMA2D混合上一条带。DMA2D不能输出的
+  *         像素格式由CPU逐行混合
+  * @param  pPoints: 顶点数组，坐标以像素中心为准
+  * @param  Count: 顶点个数
+  * @retval 无
+  */
+static void AA_FillPath(const LCD_AA_PointTypeDef *pPoints, uint32_t Count)
+{
+  LCD_DMA2D_CmdTypeDef cmd = {0};
+  uint32_t layer  = LCD_GetActiveLayer();
+  uint32_t format = Ltdc_Handler.LayerCfg[layer].PixelFormat;
+  uint32_t color  = LCD_GetTextColor();
+  uint32_t xsize  = LCD_GetXSize();
+  uint32_t ysize  = LCD_GetYSize();
+  float    minx, miny, maxx, maxy, sum, c;
+  int32_t  bx0, by0, bx1, by1, band, rows, width, m0, m1, ew, r, i;
+  uint32_t k, use_dma2d;
+  uint8_t  *mask;
+
+  /* 外接矩形，像素中心在+0.5处 */
+  minx = maxx = pPoints[0].X;
+  miny = maxy = pPoints[0].Y;
+  for(k = 1; k < Count; k++)
+  {
+    minx = (pPoints[k].X < minx) ? pPoints[k].X : minx;
+    maxx = (pPoints[k].X > maxx) ? pPoints[k].X : maxx;
+    miny = (pPoints[k].Y < miny) ? pPoints[k].Y : miny;
+    maxy = (pPoints[k].Y > maxy) ? pPoints[k].Y : maxy;
+  }
+  bx0 = (int32_t)floorf(minx + 0.5f);
+  by0 = (int32_t)floorf(miny + 0.5f);
+  bx1 = (int32_t)ceilf(maxx + 0.5f);
+  by1 = (int32_t)ceilf(maxy + 0.5f);
+  bx0 = (bx0 < 0) ? 0 : bx0;
+  by0 = (by0 < 0) ? 0 : by0;
+  bx1 = (bx1 > (int32_t)xsize) ? (int32_t)xsize : bx1;
+  by1 = (by1 > (int32_t)ysize) ? (int32_t)ysize : by1;
+  if((bx1 - bx0) > (int32_t)LCD_AA_MAX_WIDTH)
+  {
+    bx1 = bx0 + LCD_AA_MAX_WIDTH;
+  }
+  if((bx0 >= bx1) || (by0 >= by1))
+  {
+    return;
+  }
+  width = bx1 - bx0;
+
+  LCD_InvalidateRect(bx0, by0, width, by1 - by0);
+
+  /* DMA2D只能输出ARGB8888/RGB888/RGB565/ARGB1555/ARGB4444，其余格式由CPU混合 */
+  use_dma2d = (format <= LTDC_PIXEL_FORMAT_ARGB4444) ? 1U : 0U;
+  if(use_dma2d == 0U)
+  {
+    LCD_DMA2D_Flush();
+  }
+
+  for(band = by0; band < by1; band += LCD_AA_BAND_ROWS)
+  {
+    rows = by1 - band;
+    if(rows > (int32_t)LCD_AA_BAND_ROWS)
+    {
+      rows = LCD_AA_BAND_ROWS;
+    }
+
+    /* 累加所有边在本条带内的面积 */
+    for(r = 0; r < rows; r++)
+    {
+      for(i = 0; i < width + 2; i++)
+      {
+        AccBuffer[r][i] = 0.0f;
+      }
+    }
+    m0 = width;
+    m1 = -1;
+    for(k = 0; k < Count; k++)
+    {
+      const LCD_AA_PointTypeDef *p = &pPoints[k];
+      const LCD_AA_PointTypeDef *q = &pPoints[(k + 1 == Count) ? 0 : k + 1];
+
+      AA_AccumulateEdge(p->X + 0.5f - (float)bx0, p->Y + 0.5f - (float)band,
+                        q->X + 0.5f - (float)bx0, q->Y + 0.5f - (float)band,
+                        width, rows, &m0, &m1);
+    }
+    if(m1 > width - 1)
+    {
+      m1 = width - 1;
+    }
+    if(m1 < m0)
+    {
+      continue;
+    }
+    ew = m1 - m0 + 1;
+
+    /* 等待DMA2D用完这块掩码，再由累加值得到覆盖率 */
+    mask = MaskBuffer[MaskIndex];
+    LCD_DMA2D_Wait(MaskFence[MaskIndex]);
+    for(r = 0; r < rows; r++)
+    {
+      sum = 0.0f;
+      for(i = 0; i < ew; i++)
+      {
+        sum += AccBuffer[r][m0 + i];
+        c = fabsf(sum);
+        mask[r * ew + i] = (c >= 1.0f) ? 255 : (uint8_t)(c * 255.0f + 0.5f);
+      }
+    }
+
+    if(use_dma2d != 0U)
+    {
+      /* 前景A8掩码与文字颜色组合透明度，背景和输出都是显存 */
+      cmd.Mode         = DMA2D_M2M_BLEND;
+      cmd.OutColorMode = format;
+      cmd.OutOffset    = xsize - ew;
+      cmd.DstAddress   = LCD_GetPixelAddress(layer, bx0 + m0, band);
+      cmd.FgAddress    = LCD_DMA2D_Address(mask);
+      cmd.FgColorMode  = DMA2D_INPUT_A8;
+      cmd.FgOffset     = 0;
+      cmd.FgAlphaMode  = DMA2D_COMBINE_ALPHA;
+      cmd.FgAlpha      = color;
+      cmd.BgAddress    = cmd.DstAddress;
+      cmd.BgColorMode  = format;
+      cmd.BgOffset     = xsize - ew;
+      cmd.BgAlphaMode  = DMA2D_NO_MODIF_ALPHA;
+      cmd.BgAlpha      = 0xFF;
+      cmd.Width        = (uint16_t)ew;
+      cmd.Height       = (uint16_t)rows;
+      MaskFence[MaskIndex] = LCD_DMA2D_Submit(&cmd);
+      MaskIndex ^= 1U;
+      LCD_PROF_PIXELS(ew * rows);
+    }
+    else
+    {
+      for(r = 0; r < rows; r++)
+      {
+        LCD_BlendSpan(bx0 + m0, band + r, &mask[r * ew], ew, color);
+      }
+    }
+  }
+}
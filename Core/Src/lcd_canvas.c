@@ -0,0 +1,425 @@
+#include "lcd_canvas.h"
+#include "lcd_display.h"
+#include "lcd_window.h"
+#include "lcd_dma2d.h"
+#include "lcd_backend.h"
+#include "lcd_prof.h"
+
+extern LTDC_HandleTypeDef hltdc;
+
+#define Ltdc_Handler hltdc
+
+/* 一次滚动最多产生的镜像复制段数：环形缓冲区回绕处和窗口起点处各断开一次 */
+#define CANVAS_MIRROR_MAX   ((uint32_t)4)
+
+/**
+  * @brief  等待复制到镜像的一段行(列)
+  */
+typedef struct
+{
+  uint16_t From;     /* 已绘制的物理行(列) */
+  uint16_t To;       /* 镜像的物理行(列) */
+  uint16_t Length;
+}CANVAS_MirrorTypeDef;
+
+/*
+ * 画布在滚动方向上的长度为两屏：虚拟坐标v的内容同时保存在物理行(列) v%View 和 v%View+View，
+ * 窗口从物理位置Start(0 ~ View)开始显示连续的一屏，滚动只修改窗口的起始地址。
+ * 新露出的内容先画到当前不可见的那一份，切换地址生效后再由DMA2D复制到另一份。
+ * Start到达View后两份内容相同，先把窗口移回0再继续向后滚动；向前滚动时反之。
+ */
+static uint32_t Layer;
+static uint32_t ScrollDir;
+static uint16_t View;          /* 滚动方向上屏幕的长度 */
+static uint16_t Cross;         /* 另一个方向上画布的长度 */
+static uint16_t CrossView;     /* 另一个方向上屏幕的长度 */
+static uint16_t PanOffset;
+static int32_t  Position;
+static uint16_t Start;         /* 窗口起点的物理位置 */
+static LCD_CanvasDrawTypeDef Draw;
+static void     *DrawArg;
+static uint8_t  Ready;
+static CANVAS_MirrorTypeDef Mirror[CANVAS_MIRROR_MAX];
+static uint32_t MirrorCount;
+static LCD_CanvasStatsTypeDef Stats;
+
+static uint16_t CANVAS_Ring(int32_t Virtual);
+static void CANVAS_Render(int32_t v0, int32_t v1, uint16_t Start, uint8_t Both);
+static void CANVAS_DrawLines(int32_t Virtual, uint16_t Phys, uint16_t Length);
+static void CANVAS_Copy(uint16_t From, uint16_t To, uint16_t Length);
+static void CANVAS_FinishMirror(void);
+static void CANVAS_WaitReload(void);
+static void CANVAS_Apply(void);
+
+/**
+  * @brief  在一个层上建立可以连续滚动的虚拟画布，并绘制虚拟坐标0开始的一屏
+  * @param  LayerIndex: 前景层(层1)或者背景层(层0)
+  * @param  Address: 画布显存首地址，大小为两屏长度乘以CrossSize个像素
+  * @param  PixelFormat: 像素格式
+  * @param  Direction: LCD_CANVAS_VERTICAL 或 LCD_CANVAS_HORIZONTAL
+  * @param  CrossSize: 另一个方向上画布的长度，大于屏幕时可以用LCD_Canvas_Pan平移
+  * @param  pDraw: 绘制回调
+  * @param  pArg: 回调参数
+  * @retval HAL状态
+  */
+HAL_StatusTypeDef LCD_Canvas_Init(uint32_t LayerIndex, uint32_t Address, uint32_t PixelFormat, uint32_t Direction,
+                                  uint16_t CrossSize, LCD_CanvasDrawTypeDef pDraw, void *pArg)
+{
+  uint16_t xsize = (uint16_t)(Ltdc_Handler.Init.AccumulatedActiveW - Ltdc_Handler.Init.AccumulatedHBP);
+  uint16_t ysize = (uint16_t)(Ltdc_Handler.Init.AccumulatedActiveH - Ltdc_Handler.Init.AccumulatedVBP);
+  HAL_StatusTypeDef status;
+
+  if((pDraw == NULL) || (CrossSize == 0U) ||
+     ((Direction != LCD_CANVAS_VERTICAL) && (Direction != LCD_CANVAS_HORIZONTAL)))
+  {
+    return HAL_ERROR;
+  }
+
+  Ready     = 0;
+  Layer     = LayerIndex;
+  ScrollDir = Direction;
+  View      = (ScrollDir == LCD_CANVAS_VERTICAL) ? ysize : xsize;
+  CrossView = (ScrollDir == LCD_CANVAS_VERTICAL) ? xsize : ysize;
+  Cross     = CrossSize;
+
+  if(ScrollDir == LCD_CANVAS_VERTICAL)
+  {
+    status = LCD_Window_Create(LayerIndex, Address, PixelFormat, Cross, (uint16_t)(View * 2U));
+  }
+  else
+  {
+    status = LCD_Window_Create(LayerIndex, Address, PixelFormat, (uint16_t)(View * 2U), Cross);
+  }
+  if(status != HAL_OK)
+  {
+    return status;
+  }
+
+  Draw        = pDraw;
+  DrawArg     = pArg;
+  Position    = 0;
+  Start       = 0;
+  PanOffset   = 0;
+  MirrorCount = 0;
+  Ready       = 1;
+
+  CANVAS_Render(0, View, 0, 1);
+  LCD_DMA2D_Flush();
+  CANVAS_Apply();
+  return HAL_OK;
+}
+
+/**
+  * @brief  滚动画布，只绘制新露出的部分
+  * @note   窗口越过缓冲区末端(起点)时分两步滚动，中间等待一到两次垂直消隐；
+  *         超过一屏的跳转整屏重绘，重绘期间可能显示一帧新旧混合的画面
+  * @param  Delta: 滚动距离，正数向下(右)，负数向上(左)
+  * @retval 无
+  */
+void LCD_Canvas_Scroll(int32_t Delta)
+{
+  int32_t step;
+
+  if(Ready == 0U)
+  {
+    return;
+  }
+
+  LCD_PROF_BEGIN(LCD_PROF_CANVAS);
+  while(Delta != 0)
+  {
+    CANVAS_FinishMirror();
+
+    if((Delta >= (int32_t)View) || (Delta <= -(int32_t)View))
+    {
+      step  = Delta;
+      Start = CANVAS_Ring(Position + step);
+      CANVAS_Render(Position + step, Position + step + View, 0, 1);
+      Stats.FullRedraws++;
+    }
+    else if(Delta > 0)
+    {
+      if(Start == View)
+      {
+        /* 两份内容相同，窗口移回另一份不改变画面 */
+        Start = 0;
+        LCD_DMA2D_Flush();
+        CANVAS_Apply();
+        CANVAS_WaitReload();
+      }
+      step = ((Delta < (int32_t)(View - Start)) ? Delta : (int32_t)(View - Start));
+      CANVAS_Render(Position + View, Position + View + step, Start, 0);
+      Start = (uint16_t)(Start + step);
+    }
+    else
+    {
+      if(Start == 0U)
+      {
+        Start = View;
+        LCD_DMA2D_Flush();
+        CANVAS_Apply();
+        CANVAS_WaitReload();
+      }
+      step = ((Delta > -(int32_t)Start) ? Delta : -(int32_t)Start);
+      CANVAS_Render(Position + step, Position, Start, 0);
+      Start = (uint16_t)(Start + step);
+    }
+
+    Position += step;
+    Delta    -= step;
+
+    /* 新内容必须在地址切换生效前画完 */
+    LCD_DMA2D_Flush();
+    CANVAS_Apply();
+    Stats.Scrolls++;
+  }
+  LCD_PROF_END();
+}
+
+/**
+  * @brief  滚动到指定的虚拟坐标
+  * @param  Pos: 屏幕第一行(列)对应的虚拟坐标
+  * @retval 无
+  */
+void LCD_Canvas_ScrollTo(int32_t Pos)
+{
+  LCD_Canvas_Scroll(Pos - Position);
+}
+
+/**
+  * @brief  在另一个方向上平移画布，只修改地址，不重绘
+  * @param  Offset: 屏幕左边(上边)对应的画布坐标，超出画布时被限制
+  * @retval 无
+  */
+void LCD_Canvas_Pan(uint16_t Offset)
+{
+  if(Ready == 0U)
+  {
+    return;
+  }
+
+  PanOffset = (Cross > CrossView) ? (uint16_t)((Offset < (Cross - CrossView)) ? Offset : (Cross - CrossView)) : 0U;
+  CANVAS_Apply();
+}
+
+/**
+  * @brief  重绘当前屏幕上的一段内容，例如日志最后一行追加了文字
+  * @note   直接在两份中绘制，可见的那一份在绘制期间可能出现撕裂
+  * @param  Virtual: 虚拟坐标
+  * @param  Length: 行数(列数)，超出当前屏幕的部分忽略
+  * @retval 无
+  */
+void LCD_Canvas_Invalidate(int32_t Virtual, uint16_t Length)
+{
+  int32_t v0 = Virtual;
+  int32_t v1 = Virtual + Length;
+
+  if(Ready == 0U)
+  {
+    return;
+  }
+
+  v0 = (v0 < Position) ? Position : v0;
+  v1 = (v1 > (Position + View)) ? (Position + View) : v1;
+  if(v0 >= v1)
+  {
+    return;
+  }
+
+  LCD_PROF_BEGIN(LCD_PROF_CANVAS);
+  CANVAS_FinishMirror();
+  CANVAS_Render(v0, v1, 0, 1);
+  LCD_PROF_END();
+}
+
+/**
+  * @brief  获取屏幕第一行(列)对应的虚拟坐标
+  * @retval 虚拟坐标
+  */
+int32_t LCD_Canvas_GetPosition(void)
+{
+  return Position;
+}
+
+/**
+  * @brief  读取虚拟画布统计
+  * @param  pStats: 输出统计数据
+  * @retval 无
+  */
+void LCD_Canvas_GetStats(LCD_CanvasStatsTypeDef *pStats)
+{
+  *pStats = Stats;
+}
+
+/**
+  * @brief  虚拟坐标对应的环形缓冲区位置
+  * @param  Virtual: 虚拟坐标，可以为负
+  * @retval 0 ~ View-1
+  */
+static uint16_t CANVAS_Ring(int32_t Virtual)
+{
+  int32_t r = Virtual % (int32_t)View;
+
+  return (uint16_t)((r < 0) ? (r + (int32_t)View) : r);
+}
+
+/**
+  * @brief  绘制虚拟坐标[v0, v1)的内容，长度不超过一屏
+  * @param  v0, v1: 虚拟坐标范围
+  * @param  Shown: 当前窗口起点的物理位置，用于判断哪一份不可见
+  * @param  Both: 1: 两份都更新 0: 只画不可见的一份，镜像在地址切换生效后复制
+  * @retval 无
+  */
+static void CANVAS_Render(int32_t v0, int32_t v1, uint16_t Shown, uint8_t Both)
+{
+  uint16_t r, end, len, hidden, shown;
+
+  while(v0 < v1)
+  {
+    r   = CANVAS_Ring(v0);
+    end = View;
+    if((Both == 0U) && (r < Shown))
+    {
+      end = Shown;
+    }
+    len = (uint16_t)(((int32_t)(end - r) < (v1 - v0)) ? (end - r) : (v1 - v0));
+
+    if(Both != 0U)
+    {
+      CANVAS_DrawLines(v0, r, len);
+      CANVAS_Copy(r, (uint16_t)(r + View), len);
+    }
+    else
+    {
+      /* 窗口显示[Shown, Shown+View)：r >= Shown时r可见，否则r+View可见 */
+      hidden = (r >= Shown) ? (uint16_t)(r + View) : r;
+      shown  = (r >= Shown) ? r : (uint16_t)(r + View);
+      CANVAS_DrawLines(v0, hidden, len);
+      Mirror[MirrorCount].From   = hidden;
+      Mirror[MirrorCount].To     = shown;
+      Mirror[MirrorCount].Length = len;
+      MirrorCount++;
+    }
+    v0 += len;
+  }
+}
+
+/**
+  * @brief  调用绘制回调画一段物理行(列)
+  * @param  Virtual: 第一行(列)的虚拟坐标
+  * @param  Phys: 物理行(列)
+  * @param  Length: 行数(列数)
+  * @retval 无
+  */
+static void CANVAS_DrawLines(int32_t Virtual, uint16_t Phys, uint16_t Length)
+{
+  uint32_t active = LCD_GetActiveLayer();
+
+  LCD_SelectLayer(Layer);
+  if(ScrollDir == LCD_CANVAS_VERTICAL)
+  {
+    Draw(DrawArg, Virtual, 0, Phys, Cross, Length);
+  }
+  else
+  {
+    Draw(DrawArg, Virtual, Phys, 0, Length, Cross);
+  }
+  LCD_SelectLayer(active);
+  Stats.LinesDrawn += Length;
+}
+
+/**
+  * @brief  用DMA2D复制一段物理行(列)
+  * @param  From: 源物理行(列)
+  * @param  To: 目标物理行(列)
+  * @param  Length: 行数(列数)
+  * @retval 无
+  */
+static void CANVAS_Copy(uint16_t From, uint16_t To, uint16_t Length)
+{
+  LCD_DMA2D_CmdTypeDef cmd = {0};
+  uint32_t format = Ltdc_Handler.LayerCfg[Layer].PixelFormat;
+  uint32_t width  = Ltdc_Handler.LayerCfg[Layer].ImageWidth;
+
+  cmd.Mode         = DMA2D_M2M;
+  cmd.OutColorMode = DMA2D_OUTPUT_ARGB8888;
+  if(format <= LTDC_PIXEL_FORMAT_ARGB4444)
+  {
+    cmd.OutColorMode = format;
+  }
+  cmd.FgColorMode  = format;
+  cmd.FgAlphaMode  = DMA2D_NO_MODIF_ALPHA;
+  cmd.FgAlpha      = 0xFF;
+
+  if(ScrollDir == LCD_CANVAS_VERTICAL)
+  {
+    cmd.FgAddress  = LCD_GetPixelAddress(Layer, 0, From);
+    cmd.DstAddress = LCD_GetPixelAddress(Layer, 0, To);
+    cmd.Width      = Cross;
+    cmd.Height     = Length;
+  }
+  else
+  {
+    cmd.FgAddress  = LCD_GetPixelAddress(Layer, From, 0);
+    cmd.DstAddress = LCD_GetPixelAddress(Layer, To, 0);
+    cmd.Width      = Length;
+    cmd.Height     = Cross;
+  }
+  cmd.FgOffset  = width - cmd.Width;
+  cmd.OutOffset = width - cmd.Width;
+  LCD_DMA2D_Submit(&cmd);
+  LCD_PROF_PIXELS((uint32_t)cmd.Width * cmd.Height);
+  Stats.LinesMirrored += Length;
+}
+
+/**
+  * @brief  等上一次滚动的地址切换生效后，把新内容复制到镜像
+  * @retval 无
+  */
+static void CANVAS_FinishMirror(void)
+{
+  uint32_t i;
+
+  if(MirrorCount == 0U)
+  {
+    return;
+  }
+
+  CANVAS_WaitReload();
+  for(i = 0; i < MirrorCount; i++)
+  {
+    CANVAS_Copy(Mirror[i].From, Mirror[i].To, Mirror[i].Length);
+  }
+  MirrorCount = 0;
+}
+
+/**
+  * @brief  等待上一次提交的窗口地址在垂直消隐时生效
+  * @retval 无
+  */
+static void CANVAS_WaitReload(void)
+{
+  LCD_PROF_STALL_BEGIN();
+  while(LCD_GetBackend()->ReloadPending() != 0U)
+  {
+    LCD_GetBackend()->Idle();
+  }
+  LCD_PROF_STALL_END(1);
+}
+
+/**
+  * @brief  按滚动位置和平移量设置窗口的起始地址，在下一次垂直消隐时生效
+  * @retval 无
+  */
+static void CANVAS_Apply(void)
+{
+  if(ScrollDir == LCD_CANVAS_VERTICAL)
+  {
+    LCD_Window_Scroll(Layer, PanOffset, Start);
+  }
+  else
+  {
+    LCD_Window_Scroll(Layer, Start, PanOffset);
+  }
+  LCD_Window_Commit();
+}
@@ -0,0 +1,339 @@
+#include "lcd_chart.h"
+#include "lcd_display.h"
+#include "lcd_prof.h"
+
+static uint16_t CHART_ToPixel(const LCD_ChartTypeDef *pChart, int16_t Value);
+static void CHART_Column(LCD_ChartTypeDef *pChart);
+static void CHART_Flush(LCD_ChartTypeDef *pChart);
+static void CHART_Clear(const LCD_ChartTypeDef *pChart, uint32_t Column, uint32_t Count);
+
+/**
+  * @brief  初始化滚动曲线，清空绘图区
+  * @param  pChart: 曲线
+  * @param  pBuffer: 采样环形缓冲区
+  * @param  Size: 采样个数，必须为2的幂，至少能容纳一帧时间内的采样
+  * @param  LayerIndex: 前景层(层1)或者背景层(层0)
+  * @param  Xpos: 绘图区左上角X坐标
+  * @param  Ypos: 绘图区左上角Y坐标
+  * @param  Width: 绘图区宽度
+  * @param  Height: 绘图区高度
+  * @retval HAL状态
+  */
+HAL_StatusTypeDef LCD_Chart_Init(LCD_ChartTypeDef *pChart, int16_t *pBuffer, uint32_t Size, uint32_t LayerIndex,
+                                 uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height)
+{
+  uint32_t layer, color;
+
+  if((pChart == NULL) || (pBuffer == NULL) || (Size < 2U) || ((Size & (Size - 1U)) != 0U) ||
+     (Width <= LCD_CHART_GAP) || (Height < 2U))
+  {
+    return HAL_ERROR;
+  }
+
+  pChart->Ring.pBuffer  = pBuffer;
+  pChart->Ring.Size     = Size;
+  pChart->Ring.Head     = 0;
+  pChart->Ring.Tail     = 0;
+  pChart->Ring.Overruns = 0;
+
+  pChart->Layer            = LayerIndex;
+  pChart->X                = Xpos;
+  pChart->Y                = Ypos;
+  pChart->Width            = Width;
+  pChart->Height           = Height;
+  pChart->Min              = -32768;
+  pChart->Max              = 32767;
+  pChart->SamplesPerColumn = 1;
+  pChart->LineColor        = LCD_COLOR_GREEN;
+  pChart->BackColor        = LCD_COLOR_BLACK;
+
+  pChart->Count      = 0;
+  pChart->HasLast    = 0;
+  pChart->Cursor     = 0;
+  pChart->BatchCount = 0;
+
+  pChart->Stats.Samples    = 0;
+  pChart->Stats.Skipped    = 0;
+  pChart->Stats.Columns    = 0;
+  pChart->Stats.Updates    = 0;
+  pChart->Stats.MaxBacklog = 0;
+
+  layer = LCD_GetActiveLayer();
+  LCD_SelectLayer(LayerIndex);
+  color = LCD_GetTextColor();
+  CHART_Clear(pChart, 0, Width);
+  LCD_SetTextColor(color);
+  LCD_SelectLayer(layer);
+  return HAL_OK;
+}
+
+/**
+  * @brief  设置纵轴范围和每列抽取的采样数，只影响之后绘制的列
+  * @param  pChart: 曲线
+  * @param  Min: 绘图区底部对应的采样值
+  * @param  Max: 绘图区顶部对应的采样值
+  * @param  SamplesPerColumn: 每列的采样数，每列画出这些采样的最小值到最大值
+  * @retval 无
+  */
+void LCD_Chart_SetRange(LCD_ChartTypeDef *pChart, int16_t Min, int16_t Max, uint32_t SamplesPerColumn)
+{
+  if(Max > Min)
+  {
+    pChart->Min = Min;
+    pChart->Max = Max;
+  }
+  pChart->SamplesPerColumn = (SamplesPerColumn == 0U) ? 1U : SamplesPerColumn;
+}
+
+/**
+  * @brief  设置曲线颜色和背景颜色
+  * @param  pChart: 曲线
+  * @param  LineColor: 曲线颜色
+  * @param  BackColor: 背景颜色
+  * @retval 无
+  */
+void LCD_Chart_SetColors(LCD_ChartTypeDef *pChart, uint32_t LineColor, uint32_t BackColor)
+{
+  pChart->LineColor = LineColor;
+  pChart->BackColor = BackColor;
+}
+
+/**
+  * @brief  写入一个采样，可以在中断中调用
+  * @note   只能有一个生产者；缓冲区满时丢弃新采样并计数，不会等待
+  * @param  pChart: 曲线
+  * @param  Sample: 采样值
+  * @retval 1: 已写入 0: 缓冲区满
+  */
+uint32_t LCD_Chart_Push(LCD_ChartTypeDef *pChart, int16_t Sample)
+{
+  LCD_RingTypeDef *ring = &pChart->Ring;
+  uint32_t head = ring->Head;
+
+  if((head - ring->Tail) >= ring->Size)
+  {
+    ring->Overruns++;
+    return 0;
+  }
+
+  ring->pBuffer[head & (ring->Size - 1U)] = Sample;
+  /* 采样写完后才能让消费者看到新的Head */
+  __DMB();
+  ring->Head = head + 1U;
+  return 1;
+}
+
+/**
+  * @brief  取出缓冲区中的全部采样，只绘制新完成的列，每帧调用一次
+  * @note   积压超过一屏时按整列丢弃最旧的采样，使一次调用的绘制量不超过一屏
+  * @param  pChart: 曲线
+  * @retval 无
+  */
+void LCD_Chart_Update(LCD_ChartTypeDef *pChart)
+{
+  LCD_RingTypeDef *ring = &pChart->Ring;
+  uint32_t head = ring->Head;
+  uint32_t tail = ring->Tail;
+  uint32_t backlog, limit, skip;
+  uint32_t layer = LCD_GetActiveLayer();
+  uint32_t color;
+  int16_t  sample;
+
+  /* 先读Head再读采样 */
+  __DMB();
+
+  pChart->Stats.Updates++;
+  backlog = head - tail;
+  if(backlog > pChart->Stats.MaxBacklog)
+  {
+    pChart->Stats.MaxBacklog = backlog;
+  }
+
+  /* 超过一屏的部分画出来也会被覆盖，按整列跳过，光标同样前进，保持横轴与时间对应 */
+  limit = (uint32_t)pChart->Width * pChart->SamplesPerColumn;
+  if(backlog > limit)
+  {
+    skip = (backlog - limit + pChart->SamplesPerColumn - 1U) / pChart->SamplesPerColumn;
+    pChart->Cursor = (uint16_t)((pChart->Cursor + skip) % pChart->Width);
+    pChart->HasLast = 0;
+    skip *= pChart->SamplesPerColumn;
+    pChart->Stats.Skipped += skip;
+    tail += skip;
+  }
+  if(tail == head)
+  {
+    ring->Tail = tail;
+    return;
+  }
+
+  LCD_PROF_BEGIN(LCD_PROF_CHART);
+  pChart->Stats.Samples += head - tail;
+  LCD_SelectLayer(pChart->Layer);
+  color = LCD_GetTextColor();
+
+  while(tail != head)
+  {
+    sample = ring->pBuffer[tail & (ring->Size - 1U)];
+    tail++;
+
+    if(pChart->Count == 0U)
+    {
+      pChart->ColumnMin = sample;
+      pChart->ColumnMax = sample;
+    }
+    else if(sample < pChart->ColumnMin)
+    {
+      pChart->ColumnMin = sample;
+    }
+    else if(sample > pChart->ColumnMax)
+    {
+      pChart->ColumnMax = sample;
+    }
+
+    if(++pChart->Count >= pChart->SamplesPerColumn)
+    {
+      CHART_Column(pChart);
+      pChart->Last    = sample;
+      pChart->HasLast = 1;
+      pChart->Count   = 0;
+    }
+  }
+
+  /* 采样读完后才能把空间还给生产者 */
+  __DMB();
+  ring->Tail = tail;
+
+  CHART_Flush(pChart);
+  LCD_SetTextColor(color);
+  LCD_SelectLayer(layer);
+  LCD_PROF_END();
+}
+
+/**
+  * @brief  读取统计
+  * @param  pChart: 曲线
+  * @param  pStats: 保存统计的结构体
+  * @retval 无
+  */
+void LCD_Chart_GetStats(const LCD_ChartTypeDef *pChart, LCD_ChartStatsTypeDef *pStats)
+{
+  *pStats = pChart->Stats;
+}
+
+/**
+  * @brief  采样值转换为绘图区内的行
+  * @param  pChart: 曲线
+  * @param  Value: 采样值
+  * @retval 行，0为顶部
+  */
+static uint16_t CHART_ToPixel(const LCD_ChartTypeDef *pChart, int16_t Value)
+{
+  int32_t span = (int32_t)pChart->Max - pChart->Min;
+  int32_t v = Value;
+
+  if(v < pChart->Min)
+  {
+    v = pChart->Min;
+  }
+  else if(v > pChart->Max)
+  {
+    v = pChart->Max;
+  }
+  return (uint16_t)((pChart->Height - 1U) - (uint32_t)(((v - pChart->Min) * (int32_t)(pChart->Height - 1U) + span / 2) / span));
+}
+
+/**
+  * @brief  完成一列，保存到待绘制列表，列表满时先绘制
+  * @note   列的范围延伸到上一列的最后一个采样，使相邻两列连成一条线
+  * @param  pChart: 曲线
+  * @retval 无
+  */
+static void CHART_Column(LCD_ChartTypeDef *pChart)
+{
+  int16_t lo = pChart->ColumnMin;
+  int16_t hi = pChart->ColumnMax;
+
+  if(pChart->HasLast != 0U)
+  {
+    if(pChart->Last < lo)
+    {
+      lo = pChart->Last;
+    }
+    else if(pChart->Last > hi)
+    {
+      hi = pChart->Last;
+    }
+  }
+
+  if(pChart->BatchCount == LCD_CHART_BATCH)
+  {
+    CHART_Flush(pChart);
+  }
+  pChart->BatchTop[pChart->BatchCount]    = CHART_ToPixel(pChart, hi);
+  pChart->BatchBottom[pChart->BatchCount] = CHART_ToPixel(pChart, lo);
+  pChart->BatchCount++;
+}
+
+/**
+  * @brief  绘制待绘制列表：一次清空这些列和光标前面的间隔，再逐列画竖线
+  * @param  pChart: 曲线
+  * @retval 无
+  */
+static void CHART_Flush(LCD_ChartTypeDef *pChart)
+{
+  uint32_t i, column;
+  uint32_t count = pChart->BatchCount;
+
+  if(count == 0U)
+  {
+    return;
+  }
+
+  CHART_Clear(pChart, pChart->Cursor, count + LCD_CHART_GAP);
+
+  LCD_SetTextColor(pChart->LineColor);
+  column = pChart->Cursor;
+  for(i = 0; i < count; i++)
+  {
+    LCD_FillRect((uint16_t)(pChart->X + column), (uint16_t)(pChart->Y + pChart->BatchTop[i]),
+                 1, (uint16_t)(pChart->BatchBottom[i] - pChart->BatchTop[i] + 1U));
+    if(++column == pChart->Width)
+    {
+      column = 0;
+    }
+  }
+
+  pChart->Cursor           = (uint16_t)column;
+  pChart->Stats.Columns   += count;
+  pChart->BatchCount       = 0;
+}
+
+/**
+  * @brief  用背景颜色清空若干列，到右边时回到左边
+  * @param  pChart: 曲线
+  * @param  Column: 起始列
+  * @param  Count: 列数
+  * @retval 无
+  */
+static void CHART_Clear(const LCD_ChartTypeDef *pChart, uint32_t Column, uint32_t Count)
+{
+  uint32_t length;
+
+  if(Count > pChart->Width)
+  {
+    Count = pChart->Width;
+  }
+
+  LCD_SetTextColor(pChart->BackColor);
+  while(Count > 0U)
+  {
+    length = pChart->Width - Column;
+    if(length > Count)
+    {
+      length = Count;
+    }
+    LCD_FillRect((uint16_t)(pChart->X + Column), pChart->Y, (uint16_t)length, pChart->Height);
+    Count -= length;
+    Column = 0;
+  }
+}
@@ -0,0 +1,271 @@
+#include "lcd_dirty.h"
+
+static uint32_t DIRTY_Split(LCD_DirtyListTypeDef *pList, const LCD_RectTypeDef *pRect);
+
+/**
+  * @brief  计算矩形面积
+  * @param  pRect: 矩形
+  * @retval 像素个数
+  */
+uint32_t LCD_Rect_Area(const LCD_RectTypeDef *pRect)
+{
+  return (uint32_t)(pRect->X1 - pRect->X0) * (uint32_t)(pRect->Y1 - pRect->Y0);
+}
+
+/**
+  * @brief  计算两个矩形的交集
+  * @param  pA: 矩形A
+  * @param  pB: 矩形B
+  * @param  pOut: 输出交集，可以为NULL
+  * @retval 交集面积，0表示不相交
+  */
+uint32_t LCD_Rect_Intersect(const LCD_RectTypeDef *pA, const LCD_RectTypeDef *pB, LCD_RectTypeDef *pOut)
+{
+  LCD_RectTypeDef r;
+
+  r.X0 = (pA->X0 > pB->X0) ? pA->X0 : pB->X0;
+  r.Y0 = (pA->Y0 > pB->Y0) ? pA->Y0 : pB->Y0;
+  r.X1 = (pA->X1 < pB->X1) ? pA->X1 : pB->X1;
+  r.Y1 = (pA->Y1 < pB->Y1) ? pA->Y1 : pB->Y1;
+
+  if((r.X0 >= r.X1) || (r.Y0 >= r.Y1))
+  {
+    return 0;
+  }
+  if(pOut != 0)
+  {
+    *pOut = r;
+  }
+  return LCD_Rect_Area(&r);
+}
+
+/**
+  * @brief  计算包含两个矩形的最小矩形
+  * @param  pA: 矩形A
+  * @param  pB: 矩形B
+  * @param  pOut: 输出矩形
+  * @retval 无
+  */
+void LCD_Rect_Union(const LCD_RectTypeDef *pA, const LCD_RectTypeDef *pB, LCD_RectTypeDef *pOut)
+{
+  LCD_RectTypeDef r;
+
+  r.X0 = (pA->X0 < pB->X0) ? pA->X0 : pB->X0;
+  r.Y0 = (pA->Y0 < pB->Y0) ? pA->Y0 : pB->Y0;
+  r.X1 = (pA->X1 > pB->X1) ? pA->X1 : pB->X1;
+  r.Y1 = (pA->Y1 > pB->Y1) ? pA->Y1 : pB->Y1;
+  *pOut = r;
+}
+
+/**
+  * @brief  清空脏矩形列表
+  * @param  pList: 列表
+  * @retval 无
+  */
+void LCD_Dirty_Clear(LCD_DirtyListTypeDef *pList)
+{
+  pList->Count = 0;
+}
+
+/**
+  * @brief  添加一个脏区域
+  * @param  pList: 列表
+  * @param  Xpos: X坐标
+  * @param  Ypos: Y坐标
+  * @param  Width: 宽度
+  * @param  Height: 高度
+  * @retval 无
+  */
+void LCD_Dirty_Add(LCD_DirtyListTypeDef *pList, uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height)
+{
+  LCD_RectTypeDef rect;
+
+  rect.X0 = Xpos;
+  rect.Y0 = Ypos;
+  rect.X1 = Xpos + Width;
+  rect.Y1 = Ypos + Height;
+  LCD_Dirty_AddRect(pList, &rect);
+}
+
+/**
+  * @brief  添加一个脏矩形，与列表中的矩形合并后浪费面积不超过LCD_DIRTY_MERGE_SLACK时合并；
+  *         与列表中的矩形相交时切去重叠部分，剩下的部分放不下才与相交的矩形合并；
+  *         列表已满时与浪费面积最小的矩形合并。因此列表中的矩形互不重叠
+  * @param  pList: 列表
+  * @param  pRect: 矩形
+  * @retval 无
+  */
+void LCD_Dirty_AddRect(LCD_DirtyListTypeDef *pList, const LCD_RectTypeDef *pRect)
+{
+  LCD_RectTypeDef rect = *pRect;
+  LCD_RectTypeDef merged;
+  uint32_t best;
+  uint32_t best_waste;
+  uint32_t hit;
+  uint32_t hit_waste;
+  uint32_t overlap;
+  uint32_t waste;
+  uint32_t area;
+  uint32_t i;
+
+  if((rect.X0 >= rect.X1) || (rect.Y0 >= rect.Y1))
+  {
+    return;
+  }
+
+  for(;;)
+  {
+    best = hit = pList->Count;
+    best_waste = hit_waste = 0xFFFFFFFF;
+    area = LCD_Rect_Area(&rect);
+
+    for(i = 0; i < pList->Count; i++)
+    {
+      overlap = LCD_Rect_Intersect(&pList->Rect[i], &rect, 0);
+      if(overlap == area)
+      {
+        /* 已经包含在列表中 */
+        return;
+      }
+
+      /* 合并后多覆盖的面积 = 并集面积 - (A + B - 交集) */
+      LCD_Rect_Union(&pList->Rect[i], &rect, &merged);
+      waste = LCD_Rect_Area(&merged) + overlap - LCD_Rect_Area(&pList->Rect[i]) - area;
+      if(waste < best_waste)
+      {
+        best_waste = waste;
+        best = i;
+      }
+      if((overlap != 0U) && (waste < hit_waste))
+      {
+        hit_waste = waste;
+        hit = i;
+      }
+    }
+
+    if((best == pList->Count) ||
+       ((best_waste > LCD_DIRTY_MERGE_SLACK) && (hit == pList->Count) && (pList->Count < LCD_DIRTY_MAX_RECTS)))
+    {
+      pList->Rect[pList->Count++] = rect;
+      return;
+    }
+
+    /* 与列表中的矩形相交但合并浪费太多：切去重叠部分，放不下时与相交的矩形合并 */
+    if((best_waste > LCD_DIRTY_MERGE_SLACK) && (hit != pList->Count))
+    {
+      if(DIRTY_Split(pList, &rect) == 0U)
+      {
+        return;
+      }
+      best = hit;
+    }
+
+    /* 合并后从列表中移除，合并结果可能继续与其它矩形合并 */
+    LCD_Rect_Union(&pList->Rect[best], &rect, &rect);
+    pList->Rect[best] = pList->Rect[--pList->Count];
+  }
+}
+
+/**
+  * @brief  从矩形中切去列表中所有矩形覆盖的部分，剩下的互不重叠的部分全部加入列表
+  * @param  pList: 列表
+  * @param  pRect: 矩形
+  * @retval 0表示已加入，1表示剩下的部分超出列表的空位，列表不变
+  */
+static uint32_t DIRTY_Split(LCD_DirtyListTypeDef *pList, const LCD_RectTypeDef *pRect)
+{
+  LCD_RectTypeDef piece[2][LCD_DIRTY_MAX_RECTS];
+  LCD_RectTypeDef part[4];
+  LCD_RectTypeDef cut;
+  const LCD_RectTypeDef *p;
+  uint32_t space = LCD_DIRTY_MAX_RECTS - pList->Count;
+  uint32_t count = 1;
+  uint32_t next;
+  uint32_t cur = 0;
+  uint32_t i;
+  uint32_t j;
+  uint32_t k;
+
+  piece[0][0] = *pRect;
+  for(i = 0; i < pList->Count; i++)
+  {
+    next = 0;
+    for(k = 0; k < count; k++)
+    {
+      p = &piece[cur][k];
+      if(LCD_Rect_Intersect(p, &pList->Rect[i], &cut) == 0U)
+      {
+        if(next >= space)
+        {
+          return 1;
+        }
+        piece[cur ^ 1U][next++] = *p;
+        continue;
+      }
+
+      /* 重叠部分上下的整行和左右两侧，最多4块 */
+      part[0] = *p;
+      part[0].Y1 = cut.Y0;
+      part[1] = *p;
+      part[1].Y0 = cut.Y1;
+      part[2] = cut;
+      part[2].X0 = p->X0;
+      part[2].X1 = cut.X0;
+      part[3] = cut;
+      part[3].X0 = cut.X1;
+      part[3].X1 = p->X1;
+      for(j = 0; j < 4U; j++)
+      {
+        if((part[j].X0 < part[j].X1) && (part[j].Y0 < part[j].Y1))
+        {
+          if(next >= space)
+          {
+            return 1;
+          }
+          piece[cur ^ 1U][next++] = part[j];
+        }
+      }
+    }
+    count = next;
+    cur ^= 1U;
+  }
+
+  for(k = 0; k < count; k++)
+  {
+    pList->Rect[pList->Count++] = piece[cur][k];
+  }
+  return 0;
+}
+
+/**
+  * @brief  把一个列表中的所有矩形合并到另一个列表
+  * @param  pDst: 目标列表
+  * @param  pSrc: 源列表
+  * @retval 无
+  */
+void LCD_Dirty_Merge(LCD_DirtyListTypeDef *pDst, const LCD_DirtyListTypeDef *pSrc)
+{
+  uint32_t i;
+
+  for(i = 0; i < pSrc->Count; i++)
+  {
+    LCD_Dirty_AddRect(pDst, &pSrc->Rect[i]);
+  }
+}
+
+/**
+  * @brief  计算列表覆盖的像素个数，列表中的矩形互不重叠，总面积就是并集的面积
+  * @param  pList: 列表
+  * @retval 像素个数
+  */
+uint32_t LCD_Dirty_Area(const LCD_DirtyListTypeDef *pList)
+{
+  uint32_t area = 0;
+  uint32_t i;
+
+  for(i = 0; i < pList->Count; i++)
+  {
+    area += LCD_Rect_Area(&pList->Rect[i]);
+  }
+  return area;
+}
@@ -1,7 +1,70 @@
 #include "lcd_display.h"
+#include "lcd_dma2d.h"
+#include "lcd_dirty.h"
+#include "lcd_window.h"
+#include "lcd_backend.h"
+#include "lcd_prof.h"
+#include <string.h>
 /* Default LCD configuration with LCD Layer 1 */
 static uint32_t            ActiveLayer = 0;
 static LCD_DrawPropTypeDef DrawProp[MAX_LAYER_NUMBER];
+static uint32_t            FrameBuffer[MAX_LAYER_NUMBER]; /* 每一层当前绘制的显存地址 */
+static const LCD_BackendTypeDef *Backend = &LCD_BACKEND_DEFAULT;
+
+/**
+  * @brief  交换链，LTDC扫描前台缓冲区时在后台缓冲区绘制
+  */
+typedef struct
+{
+  uint32_t          BufferCount;                        /* 缓冲区个数，0表示未使用交换链 */
+  uint32_t          Address[LCD_SWAPCHAIN_MAX_BUFFERS]; /* 各缓冲区首地址 */
+  uint32_t          BackIndex;                          /* 正在绘制的缓冲区 */
+  volatile uint32_t FrontIndex;                         /* LTDC正在扫描的缓冲区 */
+  volatile uint32_t PendingIndex;                       /* 等待垂直消隐期间生效的缓冲区 */
+  LCD_DirtyListTypeDef History[LCD_SWAPCHAIN_MAX_BUFFERS - 1]; /* 之前各帧的脏区域，History[0]为上一帧 */
+}LCD_SwapChainTypeDef;
+
+#define SWAPCHAIN_NONE       ((uint32_t)0xFFFFFFFF)
+
+static LCD_SwapChainTypeDef  SwapChain[MAX_LAYER_NUMBER];
+static LCD_FrameStatsTypeDef FrameStats = {0, 0, 0xFFFFFFFF, 0, 0, 0};
+static uint32_t              FrameTotalTime = 0;
+static uint32_t              LastPresentTick = 0;
+
+static LCD_DirtyListTypeDef  Dirty[MAX_LAYER_NUMBER];       /* 每一层当前帧绘制过的区域 */
+static LCD_DirtyStatsTypeDef DirtyStats;
+
+/**
+  * @brief  像素读写函数表，每种像素格式一份，在LCD_LayerInit中选定
+  * @note   Pack/Unpack在ARGB8888与层的原生格式之间转换，Store/Load/StoreSpan只处理原生格式
+  */
+typedef struct
+{
+  uint32_t BytesPerPixel;                                          /* 每个像素的字节数 */
+  uint32_t (*Pack)(uint32_t Color);                                /* ARGB8888转原生格式 */
+  uint32_t (*Unpack)(uint32_t Pixel);                              /* 原生格式转ARGB8888 */
+  void     (*Store)(uint32_t Address, uint32_t Pixel);             /* 写一个像素 */
+  uint32_t (*Load)(uint32_t Address);                              /* 读一个像素 */
+  void     (*StoreSpan)(uint32_t Address, uint32_t Count, uint32_t Pixel); /* 写连续Count个像素 */
+}LCD_PixelOpsTypeDef;
+
+static const LCD_PixelOpsTypeDef *PixelOps[MAX_LAYER_NUMBER]; /* 每一层的像素读写函数 */
+static uint32_t                   Stride[MAX_LAYER_NUMBER];   /* 每一层一行的字节数 */
+
+static uint32_t                   SpanColor;  /* 当前图元的ARGB8888颜色，供DMA2D填充 */
+static uint32_t                   SpanPixel;  /* 当前图元的原生格式颜色，供CPU写入 */
+static uint8_t                    SpanSynced; /* 本图元中已等待过DMA2D，CPU可以直接写显存 */
+
+static uint32_t Palette[MAX_LAYER_NUMBER][256];                          /* L8/AL44层的调色板 */
+static uint32_t PaletteSize[MAX_LAYER_NUMBER];                           /* 调色板项数 */
+static uint32_t PaletteCache[MAX_LAYER_NUMBER][LCD_PALETTE_CACHE_SIZE];  /* 颜色到索引的缓存，高8位为索引 */
+static uint32_t PaletteCacheValid[MAX_LAYER_NUMBER];                     /* 缓存项有效位 */
+static uint32_t BlitCLUT[256];                                           /* L8/AL44源图像使用的调色板 */
+static uint32_t BlitCLUTFence;                                           /* 加载BlitCLUT的DMA2D命令 */
+
+/* 像素(x, y)在层显存中的地址 */
+#define LCD_PIXEL_ADDRESS(Layer, x, y) \
+  (FrameBuffer[(Layer)] + (uint32_t)(y) * Stride[(Layer)] + (uint32_t)(x) * PixelOps[(Layer)]->BytesPerPixel)
 
 extern LTDC_HandleTypeDef hltdc;
 extern DMA2D_HandleTypeDef hdma2d;
@@ -10,6 +73,39 @@ extern DMA2D_HandleTypeDef hdma2d;
 #define Dma2d_Handler hdma2d
 
 static void LL_FillBuffer(uint32_t LayerIndex, void *pDst, uint32_t xSize, uint32_t ySize, uint32_t OffLine, uint32_t ColorIndex);
+static void LL_CopyBuffer(uint32_t LayerIndex, uint32_t Src, uint32_t Dst, const LCD_RectTypeDef *pRect);
+static void LL_DrawPixel(uint16_t Xpos, uint16_t Ypos, uint32_t Pixel);
+static const LCD_PixelOpsTypeDef *LL_GetPixelOps(uint32_t PixelFormat);
+static void LL_SpanBegin(uint32_t Color);
+static void LL_SpanRect(int32_t x0, int32_t y0, int32_t x1, int32_t y1);
+static void LL_BlendA8(uint32_t Src, uint32_t SrcWidth, int32_t Xpos, int32_t Ypos, uint32_t Width, uint32_t Height, uint32_t Color);
+static void LL_DrawGlyph(int32_t Xpos, int32_t Ypos, const sFONT *pFont, const LCD_GlyphTypeDef *pGlyph, uint32_t Char);
+static void LL_BlitCPU(uint32_t Src, uint32_t SrcFormat, uint32_t SrcStride, uint32_t Dst, uint32_t Width, uint32_t Height);
+static void LL_FillPacked(uint32_t LayerIndex, uint32_t Address, uint32_t xSize, uint32_t ySize, uint32_t OffLine, uint32_t Pixel);
+static uint32_t LL_PaletteIndex(uint32_t LayerIndex, uint32_t Color, uint32_t Count);
+static void LL_CircleOutline(int32_t Left, int32_t Top, int32_t Right, int32_t Bottom, uint32_t Radius);
+static void LL_CircleFill(int32_t Left, int32_t Top, int32_t Right, int32_t Bottom, uint32_t Radius);
+static void LCD_MarkDirty(int32_t Xpos, int32_t Ypos, int32_t Width, int32_t Height);
+static void LL_ConfigLayer(uint32_t LayerIndex, uint32_t Reload);
+
+/**
+  * @brief  选择显示后端，必须在LCD_DMA2D_Init和LCD_LayerInit之前调用
+  * @param  pBackend: 后端，NULL恢复默认后端
+  * @retval 无
+  */
+void LCD_SetBackend(const LCD_BackendTypeDef *pBackend)
+{
+  Backend = (pBackend != NULL) ? pBackend : &LCD_BACKEND_DEFAULT;
+}
+
+/**
+  * @brief  获取当前的显示后端
+  * @retval 后端
+  */
+const LCD_BackendTypeDef *LCD_GetBackend(void)
+{
+  return Backend;
+}
 
 /**
   * @brief  获取LCD当前有效层X轴的大小
@@ -50,7 +146,7 @@ void LCD_SetYSize(uint32_t imageHeightPixels)
 }
 
 /**
-  * @brief  初始化LCD层 
+  * @brief  初始化LCD层，图像大小与屏幕相同
   * @param  LayerIndex:  前景层(层1)或者背景层(层0)
   * @param  FB_Address:  每一层显存的首地址
   * @param  PixelFormat: 层的像素格式
@@ -58,13 +154,32 @@ void LCD_SetYSize(uint32_t imageHeightPixels)
   */
 void LCD_LayerInit(uint16_t LayerIndex, uint32_t FB_Address,uint32_t PixelFormat)
 {     
+  LCD_LayerInitSize(LayerIndex, FB_Address, PixelFormat,
+                    (uint16_t)(Ltdc_Handler.Init.AccumulatedActiveW - Ltdc_Handler.Init.AccumulatedHBP),
+                    (uint16_t)(Ltdc_Handler.Init.AccumulatedActiveH - Ltdc_Handler.Init.AccumulatedVBP));
+}
+
+/**
+  * @brief  按指定的图像大小初始化LCD层，图像可以大于屏幕，窗口显示左上角与屏幕相同大小的部分
+  * @note   绘图函数按图像大小裁剪，LCD_GetXSize/LCD_GetYSize返回图像大小；行距等于图像宽度
+  * @param  LayerIndex:  前景层(层1)或者背景层(层0)
+  * @param  FB_Address:  图像首地址
+  * @param  PixelFormat: 层的像素格式
+  * @param  Width:       图像宽度
+  * @param  Height:      图像高度
+  * @retval 无
+  */
+void LCD_LayerInitSize(uint16_t LayerIndex, uint32_t FB_Address, uint32_t PixelFormat, uint16_t Width, uint16_t Height)
+{
   LTDC_LayerCfgTypeDef  layer_cfg;
+  uint32_t xsize = Ltdc_Handler.Init.AccumulatedActiveW - Ltdc_Handler.Init.AccumulatedHBP;
+  uint32_t ysize = Ltdc_Handler.Init.AccumulatedActiveH - Ltdc_Handler.Init.AccumulatedVBP;
 
   /* 层初始化 */
   layer_cfg.WindowX0 = 0;				//窗口起始位置X坐标
-  layer_cfg.WindowX1 = LCD_GetXSize();	//窗口结束位置X坐标
+  layer_cfg.WindowX1 = (Width < xsize) ? Width : xsize;	//窗口结束位置X坐标
   layer_cfg.WindowY0 = 0;				//窗口起始位置Y坐标
-  layer_cfg.WindowY1 = LCD_GetYSize();  //窗口结束位置Y坐标
+  layer_cfg.WindowY1 = (Height < ysize) ? Height : ysize;  //窗口结束位置Y坐标
   layer_cfg.PixelFormat = PixelFormat;	//像素格式
   layer_cfg.FBStartAdress = FB_Address; //层显存首地址
   layer_cfg.Alpha = 255;				//用于混合的透明度常量，范围（0―255）0为完全透明
@@ -74,15 +189,21 @@ void LCD_LayerInit(uint16_t LayerIndex, uint32_t FB_Address,uint32_t PixelFormat
   layer_cfg.Backcolor.Red = 0;			//层背景颜色红色分量
   layer_cfg.BlendingFactor1 = LTDC_BLENDING_FACTOR1_PAxCA;//层混合系数1
   layer_cfg.BlendingFactor2 = LTDC_BLENDING_FACTOR2_PAxCA;//层混合系数2
-  layer_cfg.ImageWidth = LCD_GetXSize();//设置图像宽度
-  layer_cfg.ImageHeight = LCD_GetYSize();//设置图像高度
+  layer_cfg.ImageWidth = Width;//设置图像宽度
+  layer_cfg.ImageHeight = Height;//设置图像高度
   
-  HAL_LTDC_ConfigLayer(&Ltdc_Handler, &layer_cfg, LayerIndex); //设置选中的层参数
+  LCD_Window_Release(LayerIndex);
+  Backend->ConfigLayer(&layer_cfg, LayerIndex, LCD_RELOAD_IMMEDIATE); //设置选中的层参数
+  FrameBuffer[LayerIndex] = FB_Address;
+  PixelOps[LayerIndex] = LL_GetPixelOps(PixelFormat);          //按像素格式选择读写函数
+  Stride[LayerIndex] = layer_cfg.ImageWidth * PixelOps[LayerIndex]->BytesPerPixel;
+  SwapChain[LayerIndex].BufferCount = 0;
+  LCD_Dirty_Clear(&Dirty[LayerIndex]);
 
   DrawProp[LayerIndex].BackColor = LCD_COLOR_WHITE;//设置层的字体颜色
-  // DrawProp[LayerIndex].pFont     = &LCD_DEFAULT_FONT;//设置层的字体类型
+  DrawProp[LayerIndex].pFont     = &LCD_DEFAULT_FONT;//设置层的字体类型
   DrawProp[LayerIndex].TextColor = LCD_COLOR_BLACK; //设置层的字体背景颜色  
-  __HAL_LTDC_RELOAD_CONFIG(&Ltdc_Handler);//重载层的配置参数
+  Backend->Reload(LCD_RELOAD_IMMEDIATE);//重载层的配置参数
 }
 /**
   * @brief  选择LCD层
@@ -102,15 +223,7 @@ void LCD_SelectLayer(uint32_t LayerIndex)
   */
 void LCD_SetLayerVisible(uint32_t LayerIndex, FunctionalState State)
 {
-  if(State == ENABLE)
-  {
-    __HAL_LTDC_LAYER_ENABLE(&Ltdc_Handler, LayerIndex);
-  }
-  else
-  {
-    __HAL_LTDC_LAYER_DISABLE(&Ltdc_Handler, LayerIndex);
-  }
-  __HAL_LTDC_RELOAD_CONFIG(&Ltdc_Handler);
+  Backend->EnableLayer(LayerIndex, State, LCD_RELOAD_IMMEDIATE);
 } 
 
 /**
@@ -121,7 +234,12 @@ void LCD_SetLayerVisible(uint32_t LayerIndex, FunctionalState State)
   */
 void LCD_SetTransparency(uint32_t LayerIndex, uint8_t Transparency)
 {    
-  HAL_LTDC_SetAlpha(&Ltdc_Handler, Transparency, LayerIndex);
+  Ltdc_Handler.LayerCfg[LayerIndex].Alpha = Transparency;
+  if(LCD_Window_IsActive(LayerIndex) != 0U)
+  {
+    LCD_Window_SetAlpha(LayerIndex, Transparency);
+  }
+  LL_ConfigLayer(LayerIndex, LCD_RELOAD_IMMEDIATE);
 }
 
 /**
@@ -132,393 +250,1554 @@ void LCD_SetTransparency(uint32_t LayerIndex, uint8_t Transparency)
   */
 void LCD_SetLayerAddress(uint32_t LayerIndex, uint32_t Address)
 {
-  HAL_LTDC_SetAddress(&Ltdc_Handler, Address, LayerIndex);
+  Ltdc_Handler.LayerCfg[LayerIndex].FBStartAdress = Address;
+  LL_ConfigLayer(LayerIndex, LCD_RELOAD_IMMEDIATE);
+  FrameBuffer[LayerIndex] = Address;
 }
 
 /**
-  * @brief  设置显示窗口
+  * @brief  按句柄中的层配置写入层寄存器；层作为窗口使用时交给窗口裁剪和滚动，
+  *         句柄中始终是整个图像的配置
   * @param  LayerIndex: 前景层(层1)或者背景层(层0)
-  * @param  Xpos: LCD 	X轴起始位置
-  * @param  Ypos: LCD 	Y轴起始位置
-  * @param  Width: LCD  窗口大小
-  * @param  Height: LCD 窗口大小  
-  * @retval None
+  * @param  Reload: LCD_RELOAD_NONE/LCD_RELOAD_IMMEDIATE/LCD_RELOAD_VBLANK
+  * @retval 无
   */
-void LCD_SetLayerWindow(uint16_t LayerIndex, uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height)
+static void LL_ConfigLayer(uint32_t LayerIndex, uint32_t Reload)
 {
-  /* 重新设置窗口大小 */
-  HAL_LTDC_SetWindowSize(&Ltdc_Handler, Width, Height, LayerIndex);
-  
-  /* 重新设置窗口的起始位置 */
-  HAL_LTDC_SetWindowPosition(&Ltdc_Handler, Xpos, Ypos, LayerIndex); 
+  if(LCD_Window_IsActive(LayerIndex) != 0U)
+  {
+    LCD_Window_SetAddress(LayerIndex, Ltdc_Handler.LayerCfg[LayerIndex].FBStartAdress);
+    LCD_Window_Update(LayerIndex, Reload);
+  }
+  else
+  {
+    Backend->ConfigLayer(&Ltdc_Handler.LayerCfg[LayerIndex], LayerIndex, Reload);
+  }
 }
 
 /**
-  * @brief  读LCD的像素值
-  * @param  Xpos: X 轴坐标位置
-  * @param  Ypos: Y 轴坐标位置
-  * @retval RGB像素值
+  * @brief  设置L8/AL44层的调色板并使能LTDC的CLUT
+  * @note   之后在该层绘图时颜色取调色板中最接近的一项；LTDC的CLUT应在层关闭或
+  *         垂直消隐期间修改，否则当前帧可能出现新旧颜色混杂
+  * @param  LayerIndex: 前景层(层1)或者背景层(层0)
+  * @param  pCLUT: 调色板，RGB888，最高字节忽略
+  * @param  Count: 项数，L8最多256，AL44最多16
+  * @retval HAL状态
   */
-uint32_t LCD_ReadPixel(uint16_t Xpos, uint16_t Ypos)
+HAL_StatusTypeDef LCD_SetPalette(uint32_t LayerIndex, const uint32_t *pCLUT, uint32_t Count)
 {
-  uint32_t ret = 0;
-  
-  if(Ltdc_Handler.LayerCfg[ActiveLayer].PixelFormat == LTDC_PIXEL_FORMAT_ARGB8888)
-  {
-    /* 从SDRAM显存中读取颜色数据 */
-    ret = *(__IO uint32_t*) (Ltdc_Handler.LayerCfg[ActiveLayer].FBStartAdress + (2*(Ypos*LCD_GetXSize() + Xpos)));
-  }
-  else if(Ltdc_Handler.LayerCfg[ActiveLayer].PixelFormat == LTDC_PIXEL_FORMAT_RGB888)
+  uint32_t format;
+  uint32_t i;
+
+  if(LayerIndex >= MAX_LAYER_NUMBER)
   {
-    /* 从SDRAM显存中读取颜色数据 */
-    ret  = (*(__IO uint8_t*) (Ltdc_Handler.LayerCfg[ActiveLayer].FBStartAdress + (3*(Ypos*LCD_GetXSize() + Xpos))+2) & 0x00FFFFFF);
-	ret |= (*(__IO uint8_t*) (Ltdc_Handler.LayerCfg[ActiveLayer].FBStartAdress + (3*(Ypos*LCD_GetXSize() + Xpos))+1) & 0x00FFFFFF);
-	ret |= (*(__IO uint8_t*) (Ltdc_Handler.LayerCfg[ActiveLayer].FBStartAdress + (3*(Ypos*LCD_GetXSize() + Xpos))) & 0x00FFFFFF);
+    return HAL_ERROR;
   }
-  else if((Ltdc_Handler.LayerCfg[ActiveLayer].PixelFormat == LTDC_PIXEL_FORMAT_RGB565) || \
-          (Ltdc_Handler.LayerCfg[ActiveLayer].PixelFormat == LTDC_PIXEL_FORMAT_ARGB4444) || \
-          (Ltdc_Handler.LayerCfg[ActiveLayer].PixelFormat == LTDC_PIXEL_FORMAT_AL88))  
+  format = Ltdc_Handler.LayerCfg[LayerIndex].PixelFormat;
+  if(((format != LTDC_PIXEL_FORMAT_L8) && (format != LTDC_PIXEL_FORMAT_AL44)) || (Count == 0U) ||
+     (Count > ((format == LTDC_PIXEL_FORMAT_AL44) ? 16U : 256U)))
   {
-    /* 从SDRAM显存中读取颜色数据 */
-    ret = *(__IO uint16_t*) (Ltdc_Handler.LayerCfg[ActiveLayer].FBStartAdress + (2*(Ypos*LCD_GetXSize() + Xpos)));    
+    return HAL_ERROR;
   }
-  else
+
+  for(i = 0; i < Count; i++)
   {
-    /* 从SDRAM显存中读取颜色数据 */
-    ret = *(__IO uint8_t*) (Ltdc_Handler.LayerCfg[ActiveLayer].FBStartAdress + (2*(Ypos*LCD_GetXSize() + Xpos)));    
+    Palette[LayerIndex][i] = pCLUT[i] & 0x00FFFFFF;
   }
-  
-  return ret;
+  PaletteSize[LayerIndex] = Count;
+  PaletteCacheValid[LayerIndex] = 0;
+
+  return Backend->ConfigCLUT(Palette[LayerIndex], Count, LayerIndex);
 }
 
 /**
-  * @brief  LCD当前层清屏
-  * @param  Color: 背景颜色
-  * @retval None
+  * @brief  设置L8/AL44源图像的调色板，LCD_BlitImage转换到其它格式时使用
+  * @note   调色板被复制并加入DMA2D命令队列加载到前景CLUT，之前提交的转换不受影响
+  * @param  pCLUT: 调色板，ARGB8888，L8源像素的透明度取高8位，AL44只用颜色
+  * @param  Count: 项数，1~256
+  * @retval 无
   */
-void LCD_Clear(uint32_t Color)
-{ 
-  /* 清屏 */ 
-  LL_FillBuffer(ActiveLayer, (uint32_t *)(Ltdc_Handler.LayerCfg[ActiveLayer].FBStartAdress), LCD_GetXSize(), LCD_GetYSize(), 0, Color);
+void LCD_SetBlitPalette(const uint32_t *pCLUT, uint32_t Count)
+{
+  uint32_t i;
+
+  if((Count == 0U) || (Count > 256U))
+  {
+    return;
+  }
+
+  /* 上一次加载完成前不能改写BlitCLUT */
+  LCD_DMA2D_Wait(BlitCLUTFence);
+  for(i = 0; i < Count; i++)
+  {
+    BlitCLUT[i] = pCLUT[i];
+  }
+  BlitCLUTFence = LCD_DMA2D_LoadCLUT(BlitCLUT, Count);
 }
-//=====================================================================================
+
 /**
-  * @brief  使能显示
-  * @retval 无
+  * @brief  获取层每个像素的字节数
+  * @param  LayerIndex: 前景层(层1)或者背景层(层0)
+  * @retval 字节数
   */
-void LCD_DisplayOn(void)
+static uint32_t LCD_GetBytesPerPixel(uint32_t LayerIndex)
 {
-  /* 开显示 */
-  __HAL_LTDC_ENABLE(&Ltdc_Handler);
-  HAL_GPIO_WritePin(LTDC_BL_GPIO_PIN_GPIO_Port, LTDC_BL_GPIO_PIN_Pin, GPIO_PIN_SET);  /* 开背光*/
+  return PixelOps[LayerIndex]->BytesPerPixel;
 }
 
 /**
-  * @brief  禁能显示
-  * @retval 无
+  * @brief  为层建立交换链，在SDRAM中连续分配2~3个显存
+  * @note   必须在LCD_LayerInit之后调用，缓冲区0作为前台缓冲区立即显示
+  * @param  LayerIndex: 前景层(层1)或者背景层(层0)
+  * @param  BaseAddress: 第一个缓冲区的首地址
+  * @param  BufferCount: 缓冲区个数，2为双缓冲，3为三缓冲
+  * @retval HAL状态
   */
-void LCD_DisplayOff(void)
+HAL_StatusTypeDef LCD_SwapChainInit(uint32_t LayerIndex, uint32_t BaseAddress, uint32_t BufferCount)
 {
-  /* 关显示 */
-  __HAL_LTDC_DISABLE(&Ltdc_Handler);
-  HAL_GPIO_WritePin(LTDC_BL_GPIO_PIN_GPIO_Port, LTDC_BL_GPIO_PIN_Pin, GPIO_PIN_RESET);/*关背光*/
+  LCD_SwapChainTypeDef *chain = &SwapChain[LayerIndex];
+  uint32_t size;
+  uint32_t i;
+
+  if((LayerIndex >= MAX_LAYER_NUMBER) || (BufferCount < 2U) || (BufferCount > LCD_SWAPCHAIN_MAX_BUFFERS))
+  {
+    return HAL_ERROR;
+  }
+
+  /* 每个缓冲区按32字节对齐，便于DMA2D突发传输 */
+  size = Ltdc_Handler.LayerCfg[LayerIndex].ImageWidth * Ltdc_Handler.LayerCfg[LayerIndex].ImageHeight *
+         LCD_GetBytesPerPixel(LayerIndex);
+  size = (size + 31U) & ~31U;
+  if((BaseAddress < LCD_SDRAM_START_ADDRESS) || ((BaseAddress + size * BufferCount) > LCD_SDRAM_END_ADDRESS))
+  {
+    return HAL_ERROR;
+  }
+
+  /* 等待旧缓冲区上的DMA2D命令完成 */
+  LCD_DMA2D_Flush();
+
+  for(i = 0; i < BufferCount; i++)
+  {
+    chain->Address[i] = BaseAddress + i * size;
+  }
+  chain->FrontIndex   = 0;
+  chain->BackIndex    = 1;
+  chain->PendingIndex = SWAPCHAIN_NONE;
+  chain->BufferCount  = BufferCount;
+
+  /* 各缓冲区内容未知，前几次翻转需要复制整屏 */
+  LCD_Dirty_Clear(&Dirty[LayerIndex]);
+  LCD_Dirty_Add(&Dirty[LayerIndex], 0, 0, Ltdc_Handler.LayerCfg[LayerIndex].ImageWidth, Ltdc_Handler.LayerCfg[LayerIndex].ImageHeight);
+  for(i = 0; i < (LCD_SWAPCHAIN_MAX_BUFFERS - 1U); i++)
+  {
+    chain->History[i] = Dirty[LayerIndex];
+  }
+
+  Ltdc_Handler.LayerCfg[LayerIndex].FBStartAdress = chain->Address[0];
+  LL_ConfigLayer(LayerIndex, LCD_RELOAD_IMMEDIATE);
+  FrameBuffer[LayerIndex] = chain->Address[chain->BackIndex];
+
+  LastPresentTick = HAL_GetTick();
+  return HAL_OK;
 }
 
 /**
-  * @brief  设置LCD当前层文字颜色
-  * @param  Color: 文字颜色
-  * @retval 无
+  * @brief  获取层当前绘制缓冲区的首地址
+  * @param  LayerIndex: 前景层(层1)或者背景层(层0)
+  * @retval 显存首地址
   */
-void LCD_SetTextColor(uint32_t Color)
+uint32_t LCD_GetDrawAddress(uint32_t LayerIndex)
 {
-  DrawProp[ActiveLayer].TextColor = Color;
+  return FrameBuffer[LayerIndex];
 }
 
 /**
-  * @brief  获取LCD当前层文字颜色
-  * @retval 文字颜色
+  * @brief  获取当前选中的层
+  * @retval 层索引
   */
-uint32_t LCD_GetTextColor(void)
+uint32_t LCD_GetActiveLayer(void)
 {
-  return DrawProp[ActiveLayer].TextColor;
+  return ActiveLayer;
 }
 
 /**
-  * @brief  设置LCD当前层的文字背景颜色
-  * @param  Color: 文字背景颜色
-  * @retval 无
+  * @brief  获取层一行像素占用的字节数
+  * @param  LayerIndex: 前景层(层1)或者背景层(层0)
+  * @retval 字节数
   */
-void LCD_SetBackColor(uint32_t Color)
+uint32_t LCD_GetStride(uint32_t LayerIndex)
 {
-  DrawProp[ActiveLayer].BackColor = Color;
+  return Stride[LayerIndex];
 }
 
 /**
-  * @brief  获取LCD当前层的文字背景颜色
-  * @retval 文字背景颜色
+  * @brief  获取层中像素(Xpos, Ypos)当前绘制缓冲区的地址
+  * @param  LayerIndex: 前景层(层1)或者背景层(层0)
+  * @param  Xpos: X坐标
+  * @param  Ypos: Y坐标
+  * @retval 地址
   */
-uint32_t LCD_GetBackColor(void)
+uint32_t LCD_GetPixelAddress(uint32_t LayerIndex, uint16_t Xpos, uint16_t Ypos)
 {
-  return DrawProp[ActiveLayer].BackColor;
+  return LCD_PIXEL_ADDRESS(LayerIndex, Xpos, Ypos);
 }
 
 /**
- * @brief  设置LCD文字的颜色和背景的颜色
- * @param  TextColor: 指定文字颜色
- * @param  BackColor: 指定背景颜色
- * @retval 无
- */
-void LCD_SetColors(uint32_t TextColor, uint32_t BackColor)
+  * @brief  等待已提交的翻转在垂直消隐期间生效
+  * @param  LayerIndex: 前景层(层1)或者背景层(层0)
+  * @retval 无
+  */
+void LCD_WaitVSync(uint32_t LayerIndex)
 {
-     LCD_SetTextColor (TextColor);
-     LCD_SetBackColor (BackColor);
+  if(SwapChain[LayerIndex].PendingIndex != SWAPCHAIN_NONE)
+  {
+    FrameStats.VSyncWaits++;
+    LCD_PROF_STALL_BEGIN();
+    while(SwapChain[LayerIndex].PendingIndex != SWAPCHAIN_NONE)
+    {
+      Backend->Idle();
+    }
+    LCD_PROF_STALL_END(1);
+  }
 }
+
 /**
-  * @brief  绘制水平线
-  * @param  Xpos: X轴起始坐标
-  * @param  Ypos: Y轴起始坐标
-  * @param  Length: 线的长度
+  * @brief  翻转当前层的交换链：后台缓冲区在下一次垂直消隐时成为前台缓冲区
+  * @note   双缓冲时必须等待翻转生效后才能绘制下一帧，三缓冲时可以立即继续绘制
   * @retval 无
   */
-void LCD_DrawHLine(uint16_t Xpos, uint16_t Ypos, uint16_t Length)
+void LCD_SwapBuffers(void)
 {
-  uint32_t  Xaddress = 0;
+  LCD_SwapChainTypeDef *chain = &SwapChain[ActiveLayer];
+  LCD_DirtyListTypeDef stale;
+  uint32_t full;
+  uint32_t copied;
+  uint32_t presented;
+  uint32_t next;
+  uint32_t primask;
+  uint32_t i;
 
-  if(Ltdc_Handler.LayerCfg[ActiveLayer].PixelFormat == LTDC_PIXEL_FORMAT_ARGB8888)
+  if(chain->BufferCount == 0U)
   {
-    Xaddress = (Ltdc_Handler.LayerCfg[ActiveLayer].FBStartAdress) + 4*(LCD_GetXSize()*Ypos + Xpos);
+    return;
   }
-  else if(Ltdc_Handler.LayerCfg[ActiveLayer].PixelFormat == LTDC_PIXEL_FORMAT_RGB888)
+  LCD_PROF_BEGIN(LCD_PROF_SWAP);
+
+  /* 后台缓冲区的DMA2D命令全部完成后才能显示 */
+  LCD_DMA2D_Flush();
+
+  /* 上一次翻转尚未生效 */
+  LCD_WaitVSync(ActiveLayer);
+
+  /* 先写入地址再记录等待生效的缓冲区，之前请求的重载不会提前提升这个缓冲区；
+   * 关中断使重载中断不会落在两者之间，否则等待的重载已经错过 */
+  presented = chain->BackIndex;
+  Ltdc_Handler.LayerCfg[ActiveLayer].FBStartAdress = chain->Address[presented];
+  primask = __get_PRIMASK();
+  __disable_irq();
+  LL_ConfigLayer(ActiveLayer, LCD_RELOAD_VBLANK);
+  chain->PendingIndex = presented;
+  __set_PRIMASK(primask);
+
+  /* 选择下一个后台缓冲区，不能是仍在扫描的前台缓冲区 */
+  next = (chain->BackIndex + 1U) % chain->BufferCount;
+  if(next == chain->FrontIndex)
   {
-    Xaddress = (Ltdc_Handler.LayerCfg[ActiveLayer].FBStartAdress) + 3*(LCD_GetXSize()*Ypos + Xpos);
+    LCD_WaitVSync(ActiveLayer);
   }
-  else if((Ltdc_Handler.LayerCfg[ActiveLayer].PixelFormat == LTDC_PIXEL_FORMAT_RGB565) || \
-          (Ltdc_Handler.LayerCfg[ActiveLayer].PixelFormat == LTDC_PIXEL_FORMAT_ARGB4444) || \
-          (Ltdc_Handler.LayerCfg[ActiveLayer].PixelFormat == LTDC_PIXEL_FORMAT_AL88))  
+  chain->BackIndex = next;
+  FrameBuffer[ActiveLayer] = chain->Address[next];
+
+  /* 新的后台缓冲区缺少最近BufferCount-1帧绘制的内容，只从刚提交的缓冲区复制这些区域 */
+  stale = Dirty[ActiveLayer];
+  for(i = 0; i < (chain->BufferCount - 2U); i++)
   {
-    Xaddress = (Ltdc_Handler.LayerCfg[ActiveLayer].FBStartAdress) + 2*(LCD_GetXSize()*Ypos + Xpos);   
+    LCD_Dirty_Merge(&stale, &chain->History[i]);
   }
-  else
+  for(i = 0; i < stale.Count; i++)
   {
-    Xaddress = (Ltdc_Handler.LayerCfg[ActiveLayer].FBStartAdress) + 2*(LCD_GetXSize()*Ypos + Xpos);   
-  } 
-  /* 填充数据 */
-  LL_FillBuffer(ActiveLayer, (uint32_t *)Xaddress, Length, 1, 0, DrawProp[ActiveLayer].TextColor);
+    LL_CopyBuffer(ActiveLayer, chain->Address[presented], chain->Address[next], &stale.Rect[i]);
+  }
+
+  for(i = LCD_SWAPCHAIN_MAX_BUFFERS - 2U; i > 0U; i--)
+  {
+    chain->History[i] = chain->History[i - 1U];
+  }
+  chain->History[0] = Dirty[ActiveLayer];
+
+  /* 统计与整屏复制相比节省的像素 */
+  full   = LCD_GetXSize() * LCD_GetYSize();
+  copied = LCD_Dirty_Area(&stale);
+  if(copied > full)
+  {
+    copied = full;
+  }
+  DirtyStats.Frames++;
+  DirtyStats.LastDirtyPixels  = LCD_Dirty_Area(&Dirty[ActiveLayer]);
+  DirtyStats.LastCopiedPixels = copied;
+  DirtyStats.LastSavedPixels  = full - copied;
+  DirtyStats.TotalSavedPixels += full - copied;
+
+  LCD_Dirty_Clear(&Dirty[ActiveLayer]);
+  LCD_PROF_END();
+  LCD_PROF_FRAME();
 }
 
 /**
-  * @brief  绘制垂直线
-  * @param  Xpos: X轴起始坐标
-  * @param  Ypos: Y轴起始坐标
-  * @param  Length: 线的长度
+  * @brief  获取层当前帧的脏区域
+  * @param  LayerIndex: 前景层(层1)或者背景层(层0)
+  * @retval 脏矩形列表
+  */
+const LCD_DirtyListTypeDef *LCD_GetDirtyList(uint32_t LayerIndex)
+{
+  return &Dirty[LayerIndex];
+}
+
+/**
+  * @brief  清除层当前帧的脏区域
+  * @param  LayerIndex: 前景层(层1)或者背景层(层0)
   * @retval 无
   */
-void LCD_DrawVLine(uint16_t Xpos, uint16_t Ypos, uint16_t Length)
+void LCD_ClearDirty(uint32_t LayerIndex)
 {
-  uint32_t  Xaddress = 0;
-  
-  if(Ltdc_Handler.LayerCfg[ActiveLayer].PixelFormat == LTDC_PIXEL_FORMAT_ARGB8888)
+  LCD_Dirty_Clear(&Dirty[LayerIndex]);
+}
+
+/**
+  * @brief  标记当前层的一个区域需要重绘，例如显存被外部修改时
+  * @param  Xpos: X坐标
+  * @param  Ypos: Y坐标
+  * @param  Width: 宽度
+  * @param  Height: 高度
+  * @retval 无
+  */
+void LCD_InvalidateRect(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height)
+{
+  LCD_MarkDirty(Xpos, Ypos, Width, Height);
+}
+
+/**
+  * @brief  读取脏区域统计
+  * @param  pStats: 输出统计数据
+  * @retval 无
+  */
+void LCD_GetDirtyStats(LCD_DirtyStatsTypeDef *pStats)
+{
+  *pStats = DirtyStats;
+}
+
+/**
+  * @brief  清除脏区域统计
+  * @retval 无
+  */
+void LCD_ResetDirtyStats(void)
+{
+  DirtyStats.Frames           = 0;
+  DirtyStats.LastDirtyPixels  = 0;
+  DirtyStats.LastCopiedPixels = 0;
+  DirtyStats.LastSavedPixels  = 0;
+  DirtyStats.TotalSavedPixels = 0;
+}
+
+/**
+  * @brief  记录当前层被绘制的区域，超出层的部分被裁掉
+  * @param  Xpos: X坐标
+  * @param  Ypos: Y坐标
+  * @param  Width: 宽度
+  * @param  Height: 高度
+  * @retval 无
+  */
+static void LCD_MarkDirty(int32_t Xpos, int32_t Ypos, int32_t Width, int32_t Height)
+{
+  int32_t x1 = Xpos + Width;
+  int32_t y1 = Ypos + Height;
+  int32_t xsize = (int32_t)LCD_GetXSize();
+  int32_t ysize = (int32_t)LCD_GetYSize();
+
+  if(Xpos < 0)
   {
-    Xaddress = (Ltdc_Handler.LayerCfg[ActiveLayer].FBStartAdress) + 4*(LCD_GetXSize()*Ypos + Xpos);
+    Xpos = 0;
   }
-  else if(Ltdc_Handler.LayerCfg[ActiveLayer].PixelFormat == LTDC_PIXEL_FORMAT_RGB888)
+  if(Ypos < 0)
   {
-    Xaddress = (Ltdc_Handler.LayerCfg[ActiveLayer].FBStartAdress) + 3*(LCD_GetXSize()*Ypos + Xpos);
+    Ypos = 0;
   }
-  else if((Ltdc_Handler.LayerCfg[ActiveLayer].PixelFormat == LTDC_PIXEL_FORMAT_RGB565) || \
-          (Ltdc_Handler.LayerCfg[ActiveLayer].PixelFormat == LTDC_PIXEL_FORMAT_ARGB4444) || \
-          (Ltdc_Handler.LayerCfg[ActiveLayer].PixelFormat == LTDC_PIXEL_FORMAT_AL88))  
+  if(x1 > xsize)
   {
-    Xaddress = (Ltdc_Handler.LayerCfg[ActiveLayer].FBStartAdress) + 2*(LCD_GetXSize()*Ypos + Xpos);   
+    x1 = xsize;
   }
-  else
+  if(y1 > ysize)
   {
-    Xaddress = (Ltdc_Handler.LayerCfg[ActiveLayer].FBStartAdress) + 2*(LCD_GetXSize()*Ypos + Xpos);   
-  } 
-  
-  /* 填充数据 */
-  LL_FillBuffer(ActiveLayer, (uint32_t *)Xaddress, 1, Length, (LCD_GetXSize() - 1), DrawProp[ActiveLayer].TextColor);
+    y1 = ysize;
+  }
+  if((Xpos < x1) && (Ypos < y1))
+  {
+    LCD_Dirty_Add(&Dirty[ActiveLayer], (uint16_t)Xpos, (uint16_t)Ypos, (uint16_t)(x1 - Xpos), (uint16_t)(y1 - Ypos));
+  }
 }
 
 /**
-  * @brief  指定两点画一条线
-  * @param  x1: 第一点X轴坐标
-  * @param  y1: 第一点Y轴坐标
-  * @param  x2: 第二点X轴坐标
-  * @param  y2: 第二点Y轴坐标
+  * @brief  读取帧时间统计
+  * @param  pStats: 输出统计数据
   * @retval 无
   */
-void LCD_DrawLine(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2)
+void LCD_GetFrameStats(LCD_FrameStatsTypeDef *pStats)
 {
-  int16_t deltax = 0, deltay = 0, x = 0, y = 0, xinc1 = 0, xinc2 = 0, 
-  yinc1 = 0, yinc2 = 0, den = 0, num = 0, num_add = 0, num_pixels = 0, 
-  curpixel = 0;
-  
-  deltax = ABS(x2 - x1);        /* 求x轴的绝对值 */
-  deltay = ABS(y2 - y1);        /* 求y轴的绝对值 */
-  x = x1;                       /* 第一个像素的x坐标起始值 */
-  y = y1;                       /* 第一个像素的y坐标起始值 */
-  
-  if (x2 >= x1)                 /* x坐标值为递增 */
+  *pStats = FrameStats;
+  pStats->AvgFrameTime = (FrameStats.Frames != 0U) ? (FrameTotalTime / FrameStats.Frames) : 0U;
+}
+
+/**
+  * @brief  清除帧时间统计
+  * @retval 无
+  */
+void LCD_ResetFrameStats(void)
+{
+  FrameStats.Frames        = 0;
+  FrameStats.LastFrameTime = 0;
+  FrameStats.MinFrameTime  = 0xFFFFFFFF;
+  FrameStats.MaxFrameTime  = 0;
+  FrameStats.AvgFrameTime  = 0;
+  FrameStats.VSyncWaits    = 0;
+  FrameTotalTime  = 0;
+  LastPresentTick = HAL_GetTick();
+}
+
+/**
+  * @brief  LTDC寄存器重载回调，在垂直消隐期间由LTDC_IRQHandler调用
+  * @param  hltdc: LTDC句柄
+  * @retval 无
+  */
+void HAL_LTDC_ReloadEventCallback(LTDC_HandleTypeDef *hltdc)
+{
+  uint32_t i;
+  uint32_t now;
+  uint32_t frame_time;
+  uint32_t presented = 0;
+
+  UNUSED(hltdc);
+
+  for(i = 0; i < MAX_LAYER_NUMBER; i++)
   {
-    xinc1 = 1;
-    xinc2 = 1;
+    if(SwapChain[i].PendingIndex != SWAPCHAIN_NONE)
+    {
+      SwapChain[i].FrontIndex   = SwapChain[i].PendingIndex;
+      SwapChain[i].PendingIndex = SWAPCHAIN_NONE;
+      presented = 1;
+    }
   }
-  else                          /* x坐标值为递减 */
+
+  if(presented != 0U)
   {
-    xinc1 = -1;
-    xinc2 = -1;
+    now = HAL_GetTick();
+    frame_time = now - LastPresentTick;
+    LastPresentTick = now;
+
+    FrameStats.Frames++;
+    FrameStats.LastFrameTime = frame_time;
+    FrameTotalTime += frame_time;
+    if(frame_time < FrameStats.MinFrameTime)
+    {
+      FrameStats.MinFrameTime = frame_time;
+    }
+    if(frame_time > FrameStats.MaxFrameTime)
+    {
+      FrameStats.MaxFrameTime = frame_time;
+    }
+  }
+}
+
+/**
+  * @brief  设置显示窗口
+  * @param  LayerIndex: 前景层(层1)或者背景层(层0)
+  * @param  Xpos: LCD 	X轴起始位置
+  * @param  Ypos: LCD 	Y轴起始位置
+  * @param  Width: LCD  窗口大小
+  * @param  Height: LCD 窗口大小  
+  * @retval None
+  */
+void LCD_SetLayerWindow(uint16_t LayerIndex, uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height)
+{
+  LTDC_LayerCfgTypeDef *cfg = &Ltdc_Handler.LayerCfg[LayerIndex];
+
+  /* 重新设置窗口大小，与HAL_LTDC_SetWindowSize相同，图像宽度随之改变 */
+  cfg->ImageWidth  = Width;
+  cfg->ImageHeight = Height;
+
+  /* 重新设置窗口的起始位置 */
+  cfg->WindowX0 = Xpos;
+  cfg->WindowX1 = Xpos + Width;
+  cfg->WindowY0 = Ypos;
+  cfg->WindowY1 = Ypos + Height;
+  Backend->ConfigLayer(cfg, LayerIndex, LCD_RELOAD_IMMEDIATE);
+}
+
+/**
+  * @brief  读LCD的像素值
+  * @param  Xpos: X 轴坐标位置
+  * @param  Ypos: Y 轴坐标位置
+  * @retval RGB像素值
+  */
+uint32_t LCD_ReadPixel(uint16_t Xpos, uint16_t Ypos)
+{
+  /* 等待DMA2D写完显存 */
+  LCD_DMA2D_Flush();
+
+  /* 从SDRAM显存中读取颜色数据 */
+  return PixelOps[ActiveLayer]->Load(LCD_PIXEL_ADDRESS(ActiveLayer, Xpos, Ypos));
+}
+
+/**
+  * @brief  LCD当前层清屏
+  * @param  Color: 背景颜色
+  * @retval None
+  */
+void LCD_Clear(uint32_t Color)
+{ 
+  LCD_PROF_BEGIN(LCD_PROF_CLEAR);
+  /* 清屏 */ 
+  LCD_MarkDirty(0, 0, LCD_GetXSize(), LCD_GetYSize());
+  LL_FillBuffer(ActiveLayer, (uint32_t *)(uintptr_t)FrameBuffer[ActiveLayer], LCD_GetXSize(), LCD_GetYSize(), 0, Color);
+  LCD_PROF_END();
+}
+//=====================================================================================
+/**
+  * @brief  使能显示
+  * @retval 无
+  */
+void LCD_DisplayOn(void)
+{
+  /* 开显示和背光 */
+  Backend->Display(ENABLE);
+}
+
+/**
+  * @brief  禁能显示
+  * @retval 无
+  */
+void LCD_DisplayOff(void)
+{
+  /* 关显示和背光 */
+  Backend->Display(DISABLE);
+}
+
+/**
+  * @brief  设置LCD当前层文字颜色
+  * @param  Color: 文字颜色
+  * @retval 无
+  */
+void LCD_SetTextColor(uint32_t Color)
+{
+  DrawProp[ActiveLayer].TextColor = Color;
+}
+
+/**
+  * @brief  获取LCD当前层文字颜色
+  * @retval 文字颜色
+  */
+uint32_t LCD_GetTextColor(void)
+{
+  return DrawProp[ActiveLayer].TextColor;
+}
+
+/**
+  * @brief  设置LCD当前层的文字背景颜色
+  * @param  Color: 文字背景颜色
+  * @retval 无
+  */
+void LCD_SetBackColor(uint32_t Color)
+{
+  DrawProp[ActiveLayer].BackColor = Color;
+}
+
+/**
+  * @brief  获取LCD当前层的文字背景颜色
+  * @retval 文字背景颜色
+  */
+uint32_t LCD_GetBackColor(void)
+{
+  return DrawProp[ActiveLayer].BackColor;
+}
+
+/**
+ * @brief  设置LCD文字的颜色和背景的颜色
+ * @param  TextColor: 指定文字颜色
+ * @param  BackColor: 指定背景颜色
+ * @retval 无
+ */
+void LCD_SetColors(uint32_t TextColor, uint32_t BackColor)
+{
+     LCD_SetTextColor (TextColor);
+     LCD_SetBackColor (BackColor);
+}
+/**
+  * @brief  绘制水平线
+  * @param  Xpos: X轴起始坐标
+  * @param  Ypos: Y轴起始坐标
+  * @param  Length: 线的长度
+  * @retval 无
+  */
+void LCD_DrawHLine(uint16_t Xpos, uint16_t Ypos, uint16_t Length)
+{
+  uint32_t  Xaddress = 0;
+
+  LCD_PROF_BEGIN(LCD_PROF_HLINE);
+  Xaddress = LCD_PIXEL_ADDRESS(ActiveLayer, Xpos, Ypos);
+  /* 填充数据 */
+  LCD_MarkDirty(Xpos, Ypos, Length, 1);
+  LL_FillBuffer(ActiveLayer, (uint32_t *)(uintptr_t)Xaddress, Length, 1, 0, DrawProp[ActiveLayer].TextColor);
+  LCD_PROF_END();
+}
+
+/**
+  * @brief  绘制垂直线
+  * @param  Xpos: X轴起始坐标
+  * @param  Ypos: Y轴起始坐标
+  * @param  Length: 线的长度
+  * @retval 无
+  */
+void LCD_DrawVLine(uint16_t Xpos, uint16_t Ypos, uint16_t Length)
+{
+  uint32_t  Xaddress = 0;
+  
+  LCD_PROF_BEGIN(LCD_PROF_VLINE);
+  Xaddress = LCD_PIXEL_ADDRESS(ActiveLayer, Xpos, Ypos);
+  
+  /* 填充数据 */
+  LCD_MarkDirty(Xpos, Ypos, 1, Length);
+  LL_FillBuffer(ActiveLayer, (uint32_t *)(uintptr_t)Xaddress, 1, Length, (LCD_GetXSize() - 1), DrawProp[ActiveLayer].TextColor);
+  LCD_PROF_END();
+}
+
+/**
+  * @brief  指定两点画一条线
+  * @param  x1: 第一点X轴坐标
+  * @param  y1: 第一点Y轴坐标
+  * @param  x2: 第二点X轴坐标
+  * @param  y2: 第二点Y轴坐标
+  * @retval 无
+  */
+void LCD_DrawLine(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2)
+{
+  int16_t deltax = 0, deltay = 0, x = 0, y = 0, xinc1 = 0, xinc2 = 0, 
+  yinc1 = 0, yinc2 = 0, den = 0, num = 0, num_add = 0, num_pixels = 0, 
+  curpixel = 0, start = 0;
+  
+  LCD_PROF_BEGIN(LCD_PROF_LINE);
+  deltax = ABS(x2 - x1);        /* 求x轴的绝对值 */
+  deltay = ABS(y2 - y1);        /* 求y轴的绝对值 */
+  x = x1;                       /* 第一个像素的x坐标起始值 */
+  y = y1;                       /* 第一个像素的y坐标起始值 */
+  
+  if (x2 >= x1)                 /* x坐标值为递增 */
+  {
+    xinc1 = 1;
+    xinc2 = 1;
+  }
+  else                          /* x坐标值为递减 */
+  {
+    xinc1 = -1;
+    xinc2 = -1;
   }
   
   if (y2 >= y1)                 /* y坐标值为递增 */
   {
-    yinc1 = 1;
-    yinc2 = 1;
+    yinc1 = 1;
+    yinc2 = 1;
+  }
+  else                          /* y坐标值为递减 */
+  {
+    yinc1 = -1;
+    yinc2 = -1;
+  }
+  
+  if (deltax >= deltay)         /* 每个 y 坐标值至少有一个x坐标值*/
+  {
+    xinc1 = 0;                  /* 当分子大于或等于分母时不要改变 x */
+    yinc2 = 0;                  /* 不要为每次迭代更改 y */
+    den = deltax;
+    num = deltax / 2;
+    num_add = deltay;
+    num_pixels = deltax;         /* x比y多的值 */
+  }
+  else                          /* 每个 x 坐标值至少有一个y坐标值 */
+  {
+    xinc2 = 0;                  /* 不要为每次迭代更改 x */
+    yinc1 = 0;                  /* 当分子大于或等于分母时不要改变 y */
+    den = deltay;
+    num = deltay / 2;
+    num_add = deltax;
+    num_pixels = deltay;         /* y比x多的值 */
+  }
+  
+  /* 记录线段的外接矩形 */
+  LCD_MarkDirty((x1 < x2) ? x1 : x2, (y1 < y2) ? y1 : y2, deltax + 1, deltay + 1);
+  LL_SpanBegin(DrawProp[ActiveLayer].TextColor);
+
+  /* 与逐点Bresenham走过的像素相同，但把同一行(或同一列)上连续的像素合并为一段输出 */
+  if (deltax >= deltay)
+  {
+    start = x;
+    for (curpixel = 0; curpixel <= num_pixels; curpixel++)
+    {
+      num += num_add;                          /* 在分数的基础上增加分子 */
+      if (num >= den)                         /* y将要改变，输出当前水平段 */
+      {
+        num -= den;
+        LL_SpanRect(start, y, x, y);
+        y += yinc1;
+        start = x + xinc2;
+      }
+      else if (curpixel == num_pixels)        /* 最后一段 */
+      {
+        LL_SpanRect(start, y, x, y);
+      }
+      x += xinc2;
+    }
+  }
+  else
+  {
+    start = y;
+    for (curpixel = 0; curpixel <= num_pixels; curpixel++)
+    {
+      num += num_add;                          /* 在分数的基础上增加分子 */
+      if (num >= den)                         /* x将要改变，输出当前垂直段 */
+      {
+        num -= den;
+        LL_SpanRect(x, start, x, y);
+        x += xinc1;
+        start = y + yinc2;
+      }
+      else if (curpixel == num_pixels)        /* 最后一段 */
+      {
+        LL_SpanRect(x, start, x, y);
+      }
+      y += yinc2;
+    }
+  }
+  LCD_PROF_END();
+}
+/**
+  * @brief  绘制一个点
+  * @param  Xpos:   X轴坐标
+  * @param  Ypos:   Y轴坐标
+  * @param  RGB_Code: 像素颜色值
+  * @retval 无
+  */
+void LCD_DrawPixel(uint16_t Xpos, uint16_t Ypos, uint32_t RGB_Code)
+{
+  LCD_PROF_BEGIN(LCD_PROF_PIXEL);
+  /* CPU写显存前等待DMA2D命令完成，保证绘制顺序 */
+  LCD_DMA2D_Flush();
+  LCD_MarkDirty(Xpos, Ypos, 1, 1);
+  LL_DrawPixel(Xpos, Ypos, PixelOps[ActiveLayer]->Pack(RGB_Code));
+  LCD_PROF_PIXELS(1);
+  LCD_PROF_END();
+}
+
+/**
+  * @brief  CPU把一行按透明度混合到当前层，用于DMA2D无法输出的像素格式
+  * @note   不等待DMA2D也不记录脏区域，由调用者负责；8位格式没有颜色可混合，透明度过半时直接写入
+  * @param  Xpos: 起始X坐标
+  * @param  Ypos: Y坐标
+  * @param  pAlpha: 每个像素的透明度(覆盖率)
+  * @param  Length: 像素个数
+  * @param  Color: ARGB8888颜色，其透明度与pAlpha相乘
+  * @retval 无
+  */
+void LCD_BlendSpan(uint16_t Xpos, uint16_t Ypos, const uint8_t *pAlpha, uint16_t Length, uint32_t Color)
+{
+  const LCD_PixelOpsTypeDef *ops = PixelOps[ActiveLayer];
+  uint32_t address = LCD_PIXEL_ADDRESS(ActiveLayer, Xpos, Ypos);
+  uint32_t a, dst, rb, g;
+
+  LCD_PROF_BEGIN(LCD_PROF_BLEND_SPAN);
+  LCD_PROF_PIXELS(Length);
+  while(Length--)
+  {
+    a = (*pAlpha++ * (Color >> 24) + 127) / 255;
+    if(a != 0)
+    {
+      if((a == 255) || (ops->BytesPerPixel == 1))
+      {
+        if(a >= 128)
+        {
+          ops->Store(address, ops->Pack(Color | 0xFF000000));
+        }
+      }
+      else
+      {
+        /* dst = dst + (src - dst) * a / 255，R/B两个通道一起计算；
+         * (t + 128 + ((t + 128) >> 8)) >> 8 是t / 255的四舍五入，直接右移8位会使结果整体偏暗 */
+        dst = ops->Unpack(ops->Load(address));
+        rb  = ((Color & 0xFF00FF) * a) + ((dst & 0xFF00FF) * (255 - a)) + 0x800080;
+        rb  = ((rb + ((rb >> 8) & 0xFF00FF)) >> 8) & 0xFF00FF;
+        g   = (((Color >> 8) & 0xFF) * a) + (((dst >> 8) & 0xFF) * (255 - a)) + 0x80;
+        g   = ((g + (g >> 8)) >> 8) << 8;
+        a   = a + ((dst >> 24) * (255 - a) + 127) / 255;
+        ops->Store(address, ops->Pack((a << 24) | rb | g));
+      }
+    }
+    address += ops->BytesPerPixel;
+  }
+  LCD_PROF_END();
+}
+
+/**
+  * @brief  写一个像素，不等待DMA2D也不记录脏区域
+  * @param  Xpos:   X轴坐标
+  * @param  Ypos:   Y轴坐标
+  * @param  Pixel:  层原生格式的像素值
+  * @retval 无
+  */
+static void LL_DrawPixel(uint16_t Xpos, uint16_t Ypos, uint32_t Pixel)
+{
+  PixelOps[ActiveLayer]->Store(LCD_PIXEL_ADDRESS(ActiveLayer, Xpos, Ypos), Pixel);
+}
+
+/**
+  * @brief  填充一个实心矩形
+  * @param  Xpos: X坐标值
+  * @param  Ypos: Y坐标值
+  * @param  Width:  矩形宽度 
+  * @param  Height: 矩形高度
+  * @retval 无
+  */
+void LCD_FillRect(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height)
+{
+  uint32_t  x_address = 0;
+  
+  LCD_PROF_BEGIN(LCD_PROF_FILL_RECT);
+  /* 设置文字颜色 */
+  LCD_SetTextColor(DrawProp[ActiveLayer].TextColor);
+  
+  /* 设置矩形开始地址 */
+  x_address = LCD_PIXEL_ADDRESS(ActiveLayer, Xpos, Ypos);
+  /* 填充矩形 */
+  LCD_MarkDirty(Xpos, Ypos, Width, Height);
+  LL_FillBuffer(ActiveLayer, (uint32_t *)(uintptr_t)x_address, Width, Height, (LCD_GetXSize() - Width), DrawProp[ActiveLayer].TextColor);
+  LCD_PROF_END();
+}
+/**
+  * @brief  绘制一个圆形
+  * @param  Xpos:   X轴坐标
+  * @param  Ypos:   Y轴坐标
+  * @param  Radius: 圆的半径
+  * @retval 无
+  */
+void LCD_DrawCircle(uint16_t Xpos, uint16_t Ypos, uint16_t Radius)
+{
+  LCD_PROF_BEGIN(LCD_PROF_CIRCLE);
+  LCD_MarkDirty((int32_t)Xpos - Radius, (int32_t)Ypos - Radius, 2 * Radius + 1, 2 * Radius + 1);
+  LL_SpanBegin(DrawProp[ActiveLayer].TextColor);
+  LL_CircleOutline(Xpos, Ypos, Xpos, Ypos, Radius);
+  LCD_PROF_END();
+}
+
+/**
+  * @brief  绘制一个实心圆
+  * @param  Xpos:   X轴坐标
+  * @param  Ypos:   Y轴坐标
+  * @param  Radius: 圆的半径
+  * @retval 无
+  */
+void LCD_FillCircle(uint16_t Xpos, uint16_t Ypos, uint16_t Radius)
+{
+  LCD_PROF_BEGIN(LCD_PROF_FILL_CIRCLE);
+  LCD_MarkDirty((int32_t)Xpos - Radius, (int32_t)Ypos - Radius, 2 * Radius + 1, 2 * Radius + 1);
+  LL_SpanBegin(DrawProp[ActiveLayer].TextColor);
+  LL_CircleFill(Xpos, Ypos, Xpos, Ypos, Radius);
+  LCD_PROF_END();
+}
+
+/**
+  * @brief  绘制一个圆角矩形
+  * @param  Xpos: X坐标值
+  * @param  Ypos: Y坐标值
+  * @param  Width:  矩形宽度
+  * @param  Height: 矩形高度
+  * @param  Radius: 圆角半径，超过宽高的一半时取宽高一半
+  * @retval 无
+  */
+void LCD_DrawRoundRect(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height, uint16_t Radius)
+{
+  int32_t left, top, right, bottom;
+
+  if((Width == 0) || (Height == 0))
+  {
+    return;
+  }
+  if(Radius > (Width - 1) / 2)
+  {
+    Radius = (Width - 1) / 2;
+  }
+  if(Radius > (Height - 1) / 2)
+  {
+    Radius = (Height - 1) / 2;
+  }
+
+  LCD_PROF_BEGIN(LCD_PROF_ROUND_RECT);
+  /* 四个圆角的圆心 */
+  left   = Xpos + Radius;
+  top    = Ypos + Radius;
+  right  = Xpos + Width - 1 - Radius;
+  bottom = Ypos + Height - 1 - Radius;
+
+  LCD_MarkDirty(Xpos, Ypos, Width, Height);
+  LL_SpanBegin(DrawProp[ActiveLayer].TextColor);
+  LL_SpanRect(left, Ypos, right, Ypos);                              /* 上边 */
+  LL_SpanRect(left, Ypos + Height - 1, right, Ypos + Height - 1);    /* 下边 */
+  LL_SpanRect(Xpos, top, Xpos, bottom);                              /* 左边 */
+  LL_SpanRect(Xpos + Width - 1, top, Xpos + Width - 1, bottom);      /* 右边 */
+  LL_CircleOutline(left, top, right, bottom, Radius);
+  LCD_PROF_END();
+}
+
+/**
+  * @brief  填充一个圆角矩形
+  * @param  Xpos: X坐标值
+  * @param  Ypos: Y坐标值
+  * @param  Width:  矩形宽度
+  * @param  Height: 矩形高度
+  * @param  Radius: 圆角半径，超过宽高的一半时取宽高一半
+  * @retval 无
+  */
+void LCD_FillRoundRect(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height, uint16_t Radius)
+{
+  int32_t left, top, right, bottom;
+
+  if((Width == 0) || (Height == 0))
+  {
+    return;
+  }
+  if(Radius > (Width - 1) / 2)
+  {
+    Radius = (Width - 1) / 2;
+  }
+  if(Radius > (Height - 1) / 2)
+  {
+    Radius = (Height - 1) / 2;
+  }
+
+  LCD_PROF_BEGIN(LCD_PROF_FILL_ROUND_RECT);
+  left   = Xpos + Radius;
+  top    = Ypos + Radius;
+  right  = Xpos + Width - 1 - Radius;
+  bottom = Ypos + Height - 1 - Radius;
+
+  LCD_MarkDirty(Xpos, Ypos, Width, Height);
+  LL_SpanBegin(DrawProp[ActiveLayer].TextColor);
+  LL_SpanRect(Xpos, top + 1, Xpos + Width - 1, bottom - 1);          /* 中间部分一次填充 */
+  LL_CircleFill(left, top, right, bottom, Radius);
+  LCD_PROF_END();
+}
+
+/**
+  * @brief  绘制折线，相邻两点之间用直线连接
+  * @param  Points: 顶点数组
+  * @param  PointCount: 顶点个数
+  * @retval 无
+  */
+void LCD_DrawPolyline(const Point *Points, uint16_t PointCount)
+{
+  uint16_t i;
+
+  LCD_PROF_BEGIN(LCD_PROF_POLYLINE);
+  for(i = 1; i < PointCount; i++)
+  {
+    LCD_DrawLine(Points[i - 1].X, Points[i - 1].Y, Points[i].X, Points[i].Y);
+  }
+  LCD_PROF_END();
+}
+
+/**
+  * @brief  绘制闭合多边形，最后一点与第一点相连
+  * @param  Points: 顶点数组
+  * @param  PointCount: 顶点个数
+  * @retval 无
+  */
+void LCD_DrawPolygon(const Point *Points, uint16_t PointCount)
+{
+  if(PointCount < 2)
+  {
+    return;
+  }
+  LCD_PROF_BEGIN(LCD_PROF_POLYGON);
+  LCD_DrawPolyline(Points, PointCount);
+  LCD_DrawLine(Points[PointCount - 1].X, Points[PointCount - 1].Y, Points[0].X, Points[0].Y);
+  LCD_PROF_END();
+}
+
+/**
+  * @brief  设置当前层的字体
+  * @param  fonts: 字体
+  * @retval 无
+  */
+void LCD_SetFont(sFONT *fonts)
+{
+  DrawProp[ActiveLayer].pFont = fonts;
+}
+
+/**
+  * @brief  获取当前层的字体
+  * @retval 字体
+  */
+sFONT *LCD_GetFont(void)
+{
+  return DrawProp[ActiveLayer].pFont;
+}
+
+/**
+  * @brief  显示一个字符
+  * @note   字符单元(前进宽度×行高)先用背景色填充，背景色透明度为0时保留原有内容；
+  *         字模从缓存中取出A8覆盖率，由DMA2D与文字颜色混合到显存
+  * @param  Xpos: 字符单元左上角X坐标
+  * @param  Ypos: 字符单元左上角Y坐标
+  * @param  Char: 字符编码(Unicode)
+  * @retval 无
+  */
+void LCD_DisplayChar(uint16_t Xpos, uint16_t Ypos, uint32_t Char)
+{
+  sFONT *font = DrawProp[ActiveLayer].pFont;
+  const LCD_GlyphTypeDef *glyph = LCD_Font_GetGlyph(font, Char);
+
+  if(glyph != NULL)
+  {
+    LL_DrawGlyph(Xpos, Ypos, font, glyph, Char);
+  }
+}
+
+/**
+  * @brief  显示UTF-8字符串，超出屏幕右边的字符不显示
+  * @note   相邻字符之间按字体的字距调整表移动笔位置
+  * @param  Xpos: X坐标，右对齐时为到屏幕右边的距离
+  * @param  Ypos: Y坐标
+  * @param  Text: 以0结尾的UTF-8字符串
+  * @param  Mode: 对齐模式 CENTER_MODE / RIGHT_MODE / LEFT_MODE
+  * @retval 无
+  */
+void LCD_DisplayStringAt(uint16_t Xpos, uint16_t Ypos, const uint8_t *Text, Text_AlignModeTypdef Mode)
+{
+  sFONT *font = DrawProp[ActiveLayer].pFont;
+  const LCD_GlyphTypeDef *glyph;
+  int32_t xsize = (int32_t)LCD_GetXSize();
+  uint32_t code, prev = 0;
+  int32_t x;
+
+  LCD_PROF_BEGIN(LCD_PROF_STRING);
+  switch(Mode)
+  {
+  case CENTER_MODE:
+    x = (int32_t)Xpos + (xsize - (int32_t)LCD_Font_GetStringWidth(font, Text)) / 2;
+    break;
+  case RIGHT_MODE:
+    x = xsize - (int32_t)LCD_Font_GetStringWidth(font, Text) - (int32_t)Xpos;
+    break;
+  default:
+    x = (int32_t)Xpos;
+    break;
+  }
+  if(x < 0)
+  {
+    x = 0;
+  }
+
+  while((code = LCD_Font_DecodeUTF8(&Text)) != 0U)
+  {
+    glyph = LCD_Font_GetGlyph(font, code);
+    if(glyph != NULL)
+    {
+      x += LCD_Font_GetKerning(font, prev, code);
+      if((x < 0) || ((x + glyph->Advance) > xsize))
+      {
+        break;
+      }
+      LL_DrawGlyph(x, Ypos, font, glyph, code);
+      x += glyph->Advance;
+      prev = code;
+    }
+  }
+  LCD_PROF_END();
+}
+
+/**
+  * @brief  在指定行左对齐显示字符串
+  * @param  Line: 行号，行高为当前字体的高度
+  * @param  ptr: 以0结尾的字符串
+  * @retval 无
+  */
+void LCD_DisplayStringAtLine(uint16_t Line, const uint8_t *ptr)
+{
+  LCD_DisplayStringAt(0, LINE(Line), ptr, LEFT_MODE);
+}
+
+/**
+  * @brief  把一幅图像复制到当前层，同时转换像素格式，超出层的部分被裁掉
+  * @note   整个矩形由一条DMA2D M2M_PFC命令完成，CPU开销与图像大小无关；
+  *         层格式DMA2D不能输出、源图像为AL88(DMA2D按CLUT索引解释)、或源地址/行跨度没有按像素对齐时由CPU逐行复制。
+  *         DMA2D异步读取源图像，在返回的栅栏完成前源缓冲区不能修改。
+  *         L8/AL44源图像与层格式相同时直接复制索引，否则按LCD_SetBlitPalette设置的调色板转换，
+  *         L8的透明度也取调色板，与DMA2D的ARGB8888 CLUT相同
+  * @param  pSrc: 源图像首地址(对应Xpos, Ypos处的像素)
+  * @param  SrcFormat: 源图像像素格式 LTDC_PIXEL_FORMAT_xxx
+  * @param  SrcStride: 源图像一行的字节数
+  * @param  Xpos, Ypos: 图像左上角在层中的坐标，可以为负
+  * @param  Width, Height: 图像大小
+  * @retval 栅栏值，可用于LCD_DMA2D_Wait
+  */
+uint32_t LCD_BlitImage(const void *pSrc, uint32_t SrcFormat, uint32_t SrcStride,
+                       int16_t Xpos, int16_t Ypos, uint16_t Width, uint16_t Height)
+{
+  LCD_DMA2D_CmdTypeDef cmd = {0};
+  uint32_t src = LCD_DMA2D_Address(pSrc);
+  uint32_t format = Ltdc_Handler.LayerCfg[ActiveLayer].PixelFormat;
+  uint32_t src_bpp;
+  int32_t  x0 = Xpos, y0 = Ypos;
+  int32_t  x1 = (int32_t)Xpos + Width, y1 = (int32_t)Ypos + Height;
+  int32_t  xsize = (int32_t)LCD_GetXSize();
+  int32_t  ysize = (int32_t)LCD_GetYSize();
+  uint32_t w, h, fence;
+
+  if(SrcFormat > LTDC_PIXEL_FORMAT_AL88)
+  {
+    return LCD_DMA2D_Fence();
+  }
+  src_bpp = LL_GetPixelOps(SrcFormat)->BytesPerPixel;
+
+  if(x0 < 0)
+  {
+    x0 = 0;
+  }
+  if(y0 < 0)
+  {
+    y0 = 0;
+  }
+  if(x1 > xsize)
+  {
+    x1 = xsize;
+  }
+  if(y1 > ysize)
+  {
+    y1 = ysize;
+  }
+  if((x0 >= x1) || (y0 >= y1))
+  {
+    return LCD_DMA2D_Fence();
+  }
+
+  w = (uint32_t)(x1 - x0);
+  h = (uint32_t)(y1 - y0);
+  src += (uint32_t)(y0 - Ypos) * SrcStride + (uint32_t)(x0 - Xpos) * src_bpp;
+  LCD_PROF_BEGIN(LCD_PROF_BLIT);
+  LCD_PROF_PIXELS(w * h);
+  LCD_MarkDirty(x0, y0, (int32_t)w, (int32_t)h);
+
+  /* DMA2D的行偏移以像素为单位，16/32位像素的地址必须按像素大小对齐；
+     DMA2D把AL88的低8位当作CLUT索引，而这里的AL88是灰度，由CPU转换 */
+  if((format <= LTDC_PIXEL_FORMAT_ARGB4444) && (SrcFormat != LTDC_PIXEL_FORMAT_AL88) && ((SrcStride % src_bpp) == 0U) &&
+     (((src_bpp == 3U) || ((src % src_bpp) == 0U))))
+  {
+    cmd.Mode         = DMA2D_M2M_PFC;
+    cmd.OutColorMode = format;
+    cmd.OutOffset    = (uint32_t)xsize - w;
+    cmd.DstAddress   = LCD_PIXEL_ADDRESS(ActiveLayer, x0, y0);
+    cmd.FgAddress    = src;
+    cmd.FgColorMode  = SrcFormat;
+    cmd.FgOffset     = SrcStride / src_bpp - w;
+    cmd.FgAlphaMode  = DMA2D_NO_MODIF_ALPHA;
+    cmd.FgAlpha      = 0xFF;
+    cmd.Width        = (uint16_t)w;
+    cmd.Height       = (uint16_t)h;
+    fence = LCD_DMA2D_Submit(&cmd);
+    LCD_PROF_END();
+    return fence;
+  }
+
+  /* 索引格式的素材装入同格式的层：存储器到存储器模式按像素大小原样复制 */
+  if((SrcFormat == format) && ((src_bpp == 1U) || ((src % src_bpp) == 0U)) && ((SrcStride % src_bpp) == 0U))
+  {
+    cmd.Mode         = DMA2D_M2M;
+    cmd.OutColorMode = DMA2D_OUTPUT_ARGB8888;
+    cmd.OutOffset    = (uint32_t)xsize - w;
+    cmd.DstAddress   = LCD_PIXEL_ADDRESS(ActiveLayer, x0, y0);
+    cmd.FgAddress    = src;
+    cmd.FgColorMode  = SrcFormat;
+    cmd.FgOffset     = SrcStride / src_bpp - w;
+    cmd.FgAlphaMode  = DMA2D_NO_MODIF_ALPHA;
+    cmd.FgAlpha      = 0xFF;
+    cmd.Width        = (uint16_t)w;
+    cmd.Height       = (uint16_t)h;
+    fence = LCD_DMA2D_Submit(&cmd);
+    LCD_PROF_END();
+    return fence;
+  }
+
+  /* 等待之前写这块区域的DMA2D命令完成 */
+  LCD_DMA2D_Flush();
+  LL_BlitCPU(src, SrcFormat, SrcStride, LCD_PIXEL_ADDRESS(ActiveLayer, x0, y0), w, h);
+  LCD_PROF_END();
+  return LCD_DMA2D_Fence();
+}
+
+/**
+  * @brief  CPU逐行复制图像到当前层
+  * @note   格式相同时整行memcpy，否则每个像素经ARGB8888转换一次
+  * @param  Src: 源图像首地址
+  * @param  SrcFormat: 源图像像素格式
+  * @param  SrcStride: 源图像一行的字节数
+  * @param  Dst: 目标地址
+  * @param  Width, Height: 复制的大小
+  * @retval 无
+  */
+static void LL_BlitCPU(uint32_t Src, uint32_t SrcFormat, uint32_t SrcStride, uint32_t Dst, uint32_t Width, uint32_t Height)
+{
+  const LCD_PixelOpsTypeDef *src_ops = LL_GetPixelOps(SrcFormat);
+  const LCD_PixelOpsTypeDef *dst_ops = PixelOps[ActiveLayer];
+  uint32_t format = Ltdc_Handler.LayerCfg[ActiveLayer].PixelFormat;
+  uint32_t s, d, n, color;
+
+  if(SrcFormat == format)
+  {
+    while(Height--)
+    {
+      memcpy((void *)(uintptr_t)Dst, (const void *)(uintptr_t)Src, Width * dst_ops->BytesPerPixel);
+      Src += SrcStride;
+      Dst += Stride[ActiveLayer];
+    }
+    return;
+  }
+
+  /* 索引格式的源图像按BlitCLUT转换，目标为索引格式时Pack查找最接近的调色板项 */
+  LCD_DMA2D_Wait(BlitCLUTFence);
+  while(Height--)
+  {
+    s = Src;
+    d = Dst;
+    for(n = Width; n != 0U; n--)
+    {
+      if(SrcFormat == LTDC_PIXEL_FORMAT_L8)
+      {
+        color = BlitCLUT[*(__IO uint8_t *)(uintptr_t)s];
+      }
+      else if(SrcFormat == LTDC_PIXEL_FORMAT_AL44)
+      {
+        color = (((*(__IO uint8_t *)(uintptr_t)s >> 4) * 0x11U) << 24) | (BlitCLUT[*(__IO uint8_t *)(uintptr_t)s & 0x0FU] & 0x00FFFFFF);
+      }
+      else
+      {
+        color = src_ops->Unpack(src_ops->Load(s));
+      }
+      dst_ops->Store(d, dst_ops->Pack(color));
+      s += src_ops->BytesPerPixel;
+      d += dst_ops->BytesPerPixel;
+    }
+    Src += SrcStride;
+    Dst += Stride[ActiveLayer];
+  }
+}
+
+/**
+  * @brief  在字符单元中绘制一个字模
+  * @param  Xpos, Ypos: 字符单元左上角坐标
+  * @param  pFont: 字体
+  * @param  pGlyph: 字模信息
+  * @param  Char: 字符编码，用于在缓存中查找A8字模
+  * @retval 无
+  */
+static void LL_DrawGlyph(int32_t Xpos, int32_t Ypos, const sFONT *pFont, const LCD_GlyphTypeDef *pGlyph, uint32_t Char)
+{
+  uint32_t address;
+
+  LCD_PROF_BEGIN(LCD_PROF_CHAR);
+  LCD_MarkDirty(Xpos, Ypos, pGlyph->Advance, pFont->Height);
+
+  if((DrawProp[ActiveLayer].BackColor >> 24) != 0U)
+  {
+    LL_SpanBegin(DrawProp[ActiveLayer].BackColor);
+    LL_SpanRect(Xpos, Ypos, Xpos + pGlyph->Advance - 1, Ypos + pFont->Height - 1);
+  }
+
+  address = LCD_Font_GetGlyphA8(pFont, Char);
+  if(address != 0U)
+  {
+    LL_BlendA8(address, pGlyph->Width, Xpos + pGlyph->XOffset, Ypos + pGlyph->YOffset,
+               pGlyph->Width, pGlyph->Height, DrawProp[ActiveLayer].TextColor);
+  }
+  LCD_PROF_END();
+}
+
+/**
+  * @brief  把A8覆盖率位图以指定颜色混合到当前层，超出层的部分被裁掉
+  * @note   DMA2D能输出的格式使用M2M_BLEND，其它格式由CPU逐行混合
+  * @param  Src: A8位图地址
+  * @param  SrcWidth: 位图每行的字节数
+  * @param  Xpos, Ypos: 位图左上角在层中的坐标，可以为负
+  * @param  Width, Height: 位图大小
+  * @param  Color: ARGB8888颜色
+  * @retval 无
+  */
+static void LL_BlendA8(uint32_t Src, uint32_t SrcWidth, int32_t Xpos, int32_t Ypos, uint32_t Width, uint32_t Height, uint32_t Color)
+{
+  LCD_DMA2D_CmdTypeDef cmd = {0};
+  int32_t  x0 = Xpos, y0 = Ypos;
+  int32_t  x1 = Xpos + (int32_t)Width, y1 = Ypos + (int32_t)Height;
+  int32_t  xsize = (int32_t)LCD_GetXSize();
+  int32_t  ysize = (int32_t)LCD_GetYSize();
+  uint32_t format = Ltdc_Handler.LayerCfg[ActiveLayer].PixelFormat;
+  uint32_t w, h;
+
+  if(x0 < 0)
+  {
+    x0 = 0;
+  }
+  if(y0 < 0)
+  {
+    y0 = 0;
   }
-  else                          /* y坐标值为递减 */
+  if(x1 > xsize)
   {
-    yinc1 = -1;
-    yinc2 = -1;
+    x1 = xsize;
   }
-  
-  if (deltax >= deltay)         /* 每个 y 坐标值至少有一个x坐标值*/
+  if(y1 > ysize)
   {
-    xinc1 = 0;                  /* 当分子大于或等于分母时不要改变 x */
-    yinc2 = 0;                  /* 不要为每次迭代更改 y */
-    den = deltax;
-    num = deltax / 2;
-    num_add = deltay;
-    num_pixels = deltax;         /* x比y多的值 */
+    y1 = ysize;
   }
-  else                          /* 每个 x 坐标值至少有一个y坐标值 */
+  if((x0 >= x1) || (y0 >= y1))
   {
-    xinc2 = 0;                  /* 不要为每次迭代更改 x */
-    yinc1 = 0;                  /* 当分子大于或等于分母时不要改变 y */
-    den = deltay;
-    num = deltay / 2;
-    num_add = deltax;
-    num_pixels = deltay;         /* y比x多的值 */
+    return;
   }
-  
-  for (curpixel = 0; curpixel <= num_pixels; curpixel++)
+
+  w = (uint32_t)(x1 - x0);
+  h = (uint32_t)(y1 - y0);
+  Src += (uint32_t)(y0 - Ypos) * SrcWidth + (uint32_t)(x0 - Xpos);
+
+  if(format <= LTDC_PIXEL_FORMAT_ARGB4444)
   {
-    LCD_DrawPixel(x, y, DrawProp[ActiveLayer].TextColor);   /* 绘制当前像素点 */
-    num += num_add;                            /* 在分数的基础上增加分子 */
-    if (num >= den)                           /* 检查分子大于或等于分母 */
-    {
-      num -= den;                             /* 计算新的分子值 */
-      x += xinc1;                             /* x值递增 */
-      y += yinc1;                             /* y值递增 */
-    }
-    x += xinc2;                               /* y值递增 */
-    y += yinc2;                               /* y值递增 */
+    /* 前景A8与颜色组合透明度，背景和输出都是显存 */
+    cmd.Mode         = DMA2D_M2M_BLEND;
+    cmd.OutColorMode = format;
+    cmd.OutOffset    = (uint32_t)xsize - w;
+    cmd.DstAddress   = LCD_PIXEL_ADDRESS(ActiveLayer, x0, y0);
+    cmd.FgAddress    = Src;
+    cmd.FgColorMode  = DMA2D_INPUT_A8;
+    cmd.FgOffset     = SrcWidth - w;
+    cmd.FgAlphaMode  = DMA2D_COMBINE_ALPHA;
+    cmd.FgAlpha      = Color;
+    cmd.BgAddress    = cmd.DstAddress;
+    cmd.BgColorMode  = format;
+    cmd.BgOffset     = cmd.OutOffset;
+    cmd.BgAlphaMode  = DMA2D_NO_MODIF_ALPHA;
+    cmd.BgAlpha      = 0xFF;
+    cmd.Width        = (uint16_t)w;
+    cmd.Height       = (uint16_t)h;
+    LCD_DMA2D_Submit(&cmd);
+    LCD_PROF_PIXELS(w * h);
+    return;
+  }
+
+  LCD_DMA2D_Flush();
+  while(h--)
+  {
+    LCD_BlendSpan((uint16_t)x0, (uint16_t)y0++, (const uint8_t *)(uintptr_t)Src, (uint16_t)w, Color);
+    Src += SrcWidth;
   }
 }
+
 /**
-  * @brief  绘制一个点
-  * @param  Xpos:   X轴坐标
-  * @param  Ypos:   Y轴坐标
-  * @param  RGB_Code: 像素颜色值
+  * @brief  开始绘制一个图元，并准备两种格式的颜色
+  * @note   同一图元内DMA2D与CPU写入的颜色相同，相互重叠时先后顺序不影响结果；
+  *         之前的DMA2D命令在第一次由CPU写显存前才等待，纯DMA2D的图元不会阻塞
+  * @param  Color: ARGB8888颜色
   * @retval 无
   */
-void LCD_DrawPixel(uint16_t Xpos, uint16_t Ypos, uint32_t RGB_Code)
+static void LL_SpanBegin(uint32_t Color)
+{
+  SpanSynced = 0;
+  SpanColor = Color;
+  SpanPixel = PixelOps[ActiveLayer]->Pack(Color);
+}
+
+/**
+  * @brief  填充一个矩形区域(包含两端坐标)，超出层的部分被裁掉
+  * @note   像素数达到LCD_SPAN_DMA2D_MIN时交给DMA2D，否则由CPU直接写
+  * @param  x0, y0: 一个角的坐标
+  * @param  x1, y1: 对角的坐标
+  * @retval 无
+  */
+static void LL_SpanRect(int32_t x0, int32_t y0, int32_t x1, int32_t y1)
 {
+  int32_t  xsize = (int32_t)LCD_GetXSize();
+  int32_t  ysize = (int32_t)LCD_GetYSize();
+  int32_t  t;
+  uint32_t width, height, address;
 
-  if(Ltdc_Handler.LayerCfg[ActiveLayer].PixelFormat == LTDC_PIXEL_FORMAT_ARGB8888)
+  if(x0 > x1)
   {
-    *(__IO uint32_t*) (Ltdc_Handler.LayerCfg[ActiveLayer].FBStartAdress + (4*(Ypos*LCD_GetXSize() + Xpos))) = RGB_Code;
+    t = x0; x0 = x1; x1 = t;
   }
-  else if(Ltdc_Handler.LayerCfg[ActiveLayer].PixelFormat == LTDC_PIXEL_FORMAT_RGB888)
+  if(y0 > y1)
   {
-    *(__IO uint8_t*) (Ltdc_Handler.LayerCfg[ActiveLayer].FBStartAdress + (3*(Ypos*LCD_GetXSize() + Xpos))+2) = 0xFF&(RGB_Code>>16);
-	*(__IO uint8_t*) (Ltdc_Handler.LayerCfg[ActiveLayer].FBStartAdress + (3*(Ypos*LCD_GetXSize() + Xpos))+1) = 0xFF&(RGB_Code>>8);
-	*(__IO uint8_t*) (Ltdc_Handler.LayerCfg[ActiveLayer].FBStartAdress + (3*(Ypos*LCD_GetXSize() + Xpos))) = 0xFF&RGB_Code;
+    t = y0; y0 = y1; y1 = t;
   }
-  else if((Ltdc_Handler.LayerCfg[ActiveLayer].PixelFormat == LTDC_PIXEL_FORMAT_RGB565) || \
-          (Ltdc_Handler.LayerCfg[ActiveLayer].PixelFormat == LTDC_PIXEL_FORMAT_ARGB4444) || \
-          (Ltdc_Handler.LayerCfg[ActiveLayer].PixelFormat == LTDC_PIXEL_FORMAT_AL88))  
+  if(x0 < 0)
   {
-    *(__IO uint16_t*) (Ltdc_Handler.LayerCfg[ActiveLayer].FBStartAdress + (2*(Ypos*LCD_GetXSize() + Xpos))) = (uint16_t)RGB_Code;   
+    x0 = 0;
   }
-  else
+  if(y0 < 0)
+  {
+    y0 = 0;
+  }
+  if(x1 >= xsize)
+  {
+    x1 = xsize - 1;
+  }
+  if(y1 >= ysize)
+  {
+    y1 = ysize - 1;
+  }
+  if((x0 > x1) || (y0 > y1))
   {
-    *(__IO uint16_t*) (Ltdc_Handler.LayerCfg[ActiveLayer].FBStartAdress + (2*(Ypos*LCD_GetXSize() + Xpos))) = (uint16_t)RGB_Code;   
+    return;
   }
 
+  width   = (uint32_t)(x1 - x0 + 1);
+  height  = (uint32_t)(y1 - y0 + 1);
+  address = LCD_PIXEL_ADDRESS(ActiveLayer, x0, y0);
+
+  /* DMA2D只能输出ARGB8888/RGB888/RGB565/ARGB1555/ARGB4444，其它格式按字打包填充 */
+  if((width * height) >= LCD_SPAN_DMA2D_MIN)
+  {
+    if(Ltdc_Handler.LayerCfg[ActiveLayer].PixelFormat <= LTDC_PIXEL_FORMAT_ARGB4444)
+    {
+      LL_FillBuffer(ActiveLayer, (uint32_t *)(uintptr_t)address, width, height, LCD_GetXSize() - width, SpanColor);
+    }
+    else
+    {
+      LL_FillPacked(ActiveLayer, address, width, height, LCD_GetXSize() - width, SpanPixel);
+    }
+    return;
+  }
+
+  if(SpanSynced == 0U)
+  {
+    LCD_DMA2D_Flush();
+    SpanSynced = 1;
+  }
+  LCD_PROF_PIXELS(width * height);
+  while(height--)
+  {
+    PixelOps[ActiveLayer]->StoreSpan(address, width, SpanPixel);
+    address += Stride[ActiveLayer];
+  }
 }
 
 /**
-  * @brief  填充一个实心矩形
-  * @param  Xpos: X坐标值
-  * @param  Ypos: Y坐标值
-  * @param  Width:  矩形宽度 
-  * @param  Height: 矩形高度
+  * @brief  中点画圆法绘制四段圆弧，上下圆心可以分开以绘制圆角矩形
+  * @note   同一y值上连续的点合并为水平段，对应的侧面八分圆合并为垂直段，
+  *         走过的像素与逐点绘制的LCD_DrawCircle相同
+  * @param  Left, Right: 左侧、右侧圆弧的圆心X坐标
+  * @param  Top, Bottom: 上方、下方圆弧的圆心Y坐标
+  * @param  Radius: 半径
   * @retval 无
   */
-void LCD_FillRect(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height)
+static void LL_CircleOutline(int32_t Left, int32_t Top, int32_t Right, int32_t Bottom, uint32_t Radius)
 {
-  uint32_t  x_address = 0;
-  
-  /* 设置文字颜色 */
-  LCD_SetTextColor(DrawProp[ActiveLayer].TextColor);
+  int32_t   decision;    /* 决策变量 */ 
+  uint32_t  current_x;   /* 当前x坐标值 */
+  uint32_t  current_y;   /* 当前y坐标值 */
+  int32_t   start;       /* 当前段的起始x坐标值 */
+  int32_t   cx, cy;
   
-  /* 设置矩形开始地址 */
-    if(Ltdc_Handler.LayerCfg[ActiveLayer].PixelFormat == LTDC_PIXEL_FORMAT_ARGB8888)
-  {
-    x_address = (Ltdc_Handler.LayerCfg[ActiveLayer].FBStartAdress) + 4*(LCD_GetXSize()*Ypos + Xpos);
-  }
-  else if(Ltdc_Handler.LayerCfg[ActiveLayer].PixelFormat == LTDC_PIXEL_FORMAT_RGB888)
-  {
-    x_address = (Ltdc_Handler.LayerCfg[ActiveLayer].FBStartAdress) + 3*(LCD_GetXSize()*Ypos + Xpos);
-  }
-  else if((Ltdc_Handler.LayerCfg[ActiveLayer].PixelFormat == LTDC_PIXEL_FORMAT_RGB565) || \
-          (Ltdc_Handler.LayerCfg[ActiveLayer].PixelFormat == LTDC_PIXEL_FORMAT_ARGB4444) || \
-          (Ltdc_Handler.LayerCfg[ActiveLayer].PixelFormat == LTDC_PIXEL_FORMAT_AL88))  
+  /* 半径为0时current_y会从0减到0xFFFFFFFF，单独处理 */
+  if (Radius == 0)
   {
-    x_address = (Ltdc_Handler.LayerCfg[ActiveLayer].FBStartAdress) + 2*(LCD_GetXSize()*Ypos + Xpos);   
+    LL_SpanRect(Left, Top, Right, Top);
+    LL_SpanRect(Left, Bottom, Right, Bottom);
+    return;
   }
-  else
+
+  decision = 3 - (Radius << 1);
+  current_x = 0;
+  current_y = Radius;
+  start = 0;
+
+  while (current_x <= current_y)
   {
-    x_address = (Ltdc_Handler.LayerCfg[ActiveLayer].FBStartAdress) + 2*(LCD_GetXSize()*Ypos + Xpos);
+    /* y将要改变或已是最后一步时输出本段 */
+    if ((decision >= 0) || (current_x == current_y))
+    {
+      cx = (int32_t)current_x;
+      cy = (int32_t)current_y;
+
+      LL_SpanRect(Right + start, Top - cy, Right + cx, Top - cy);
+      LL_SpanRect(Left - cx, Top - cy, Left - start, Top - cy);
+      LL_SpanRect(Right + start, Bottom + cy, Right + cx, Bottom + cy);
+      LL_SpanRect(Left - cx, Bottom + cy, Left - start, Bottom + cy);
+
+      LL_SpanRect(Right + cy, Top - cx, Right + cy, Top - start);
+      LL_SpanRect(Left - cy, Top - cx, Left - cy, Top - start);
+      LL_SpanRect(Right + cy, Bottom + start, Right + cy, Bottom + cx);
+      LL_SpanRect(Left - cy, Bottom + start, Left - cy, Bottom + cx);
+
+      start = cx + 1;
+    }
+
+    if (decision < 0)
+    { 
+      decision += (current_x << 2) + 6;
+    }
+    else
+    {
+      decision += ((current_x - current_y) << 2) + 10;
+      current_y--;
+    }
+    current_x++;
   } 
-  /* 填充矩形 */
-  LL_FillBuffer(ActiveLayer, (uint32_t *)x_address, Width, Height, (LCD_GetXSize() - Width), DrawProp[ActiveLayer].TextColor);
 }
+
 /**
-  * @brief  绘制一个圆形
-  * @param  Xpos:   X轴坐标
-  * @param  Ypos:   Y轴坐标
-  * @param  Radius: 圆的半径
+  * @brief  中点画圆法填充四分之一圆及其之间的区域，每一行只输出一次
+  * @param  Left, Right: 左侧、右侧圆弧的圆心X坐标
+  * @param  Top, Bottom: 上方、下方圆弧的圆心Y坐标
+  * @param  Radius: 半径
   * @retval 无
   */
-void LCD_DrawCircle(uint16_t Xpos, uint16_t Ypos, uint16_t Radius)
+static void LL_CircleFill(int32_t Left, int32_t Top, int32_t Right, int32_t Bottom, uint32_t Radius)
 {
   int32_t   decision;    /* 决策变量 */ 
   uint32_t  current_x;   /* 当前x坐标值 */
   uint32_t  current_y;   /* 当前y坐标值 */
+  int32_t   cx, cy;
   
+  if (Radius == 0)
+  {
+    LL_SpanRect(Left, Top, Right, Bottom);
+    return;
+  }
+
   decision = 3 - (Radius << 1);
   current_x = 0;
   current_y = Radius;
-  
+
   while (current_x <= current_y)
   {
-    LCD_DrawPixel((Xpos + current_x), (Ypos - current_y), DrawProp[ActiveLayer].TextColor);
-    
-    LCD_DrawPixel((Xpos - current_x), (Ypos - current_y), DrawProp[ActiveLayer].TextColor);
-    
-    LCD_DrawPixel((Xpos + current_y), (Ypos - current_x), DrawProp[ActiveLayer].TextColor);
-    
-    LCD_DrawPixel((Xpos - current_y), (Ypos - current_x), DrawProp[ActiveLayer].TextColor);
-    
-    LCD_DrawPixel((Xpos + current_x), (Ypos + current_y), DrawProp[ActiveLayer].TextColor);
-    
-    LCD_DrawPixel((Xpos - current_x), (Ypos + current_y), DrawProp[ActiveLayer].TextColor);
-    
-    LCD_DrawPixel((Xpos + current_y), (Ypos + current_x), DrawProp[ActiveLayer].TextColor);
-    
-    LCD_DrawPixel((Xpos - current_y), (Ypos + current_x), DrawProp[ActiveLayer].TextColor);
-    
+    cx = (int32_t)current_x;
+    cy = (int32_t)current_y;
+
+    /* 每一步x都不同，Top-x/Bottom+x两行各输出一次 */
+    LL_SpanRect(Left - cy, Top - cx, Right + cy, Top - cx);
+    if ((Bottom + cx) != (Top - cx))
+    {
+      LL_SpanRect(Left - cy, Bottom + cx, Right + cy, Bottom + cx);
+    }
+
+    /* y将要改变或已是最后一步时输出Top-y/Bottom+y两行 */
+    if (((decision >= 0) || (current_x == current_y)) && (current_x != current_y))
+    {
+      LL_SpanRect(Left - cx, Top - cy, Right + cx, Top - cy);
+      LL_SpanRect(Left - cx, Bottom + cy, Right + cx, Bottom + cy);
+    }
+
     if (decision < 0)
     { 
       decision += (current_x << 2) + 6;
@@ -543,79 +1822,354 @@ void LCD_DrawCircle(uint16_t Xpos, uint16_t Ypos, uint16_t Radius)
   */
 static void LL_FillBuffer(uint32_t LayerIndex, void *pDst, uint32_t xSize, uint32_t ySize, uint32_t OffLine, uint32_t ColorIndex) 
 {
+  uint32_t color_mode = DMA2D_OUTPUT_ARGB8888;
+
+  if(Ltdc_Handler.LayerCfg[LayerIndex].PixelFormat > LTDC_PIXEL_FORMAT_ARGB4444)
+  {
+    LL_FillPacked(LayerIndex, (uint32_t)(uintptr_t)pDst, xSize, ySize, OffLine, PixelOps[LayerIndex]->Pack(ColorIndex));
+    return;
+  }
 
-  Dma2d_Handler.Init.Mode         = DMA2D_R2M;
-  if(Ltdc_Handler.LayerCfg[ActiveLayer].PixelFormat == LTDC_PIXEL_FORMAT_RGB565)
+  if(Ltdc_Handler.LayerCfg[LayerIndex].PixelFormat == LTDC_PIXEL_FORMAT_RGB565)
   { 
-    Dma2d_Handler.Init.ColorMode    = DMA2D_RGB565;
+    color_mode = DMA2D_RGB565;
   }
-  else if(Ltdc_Handler.LayerCfg[ActiveLayer].PixelFormat == LTDC_PIXEL_FORMAT_ARGB8888)
+  else if(Ltdc_Handler.LayerCfg[LayerIndex].PixelFormat == LTDC_PIXEL_FORMAT_ARGB8888)
   { 
-    Dma2d_Handler.Init.ColorMode    = DMA2D_ARGB8888;
+    color_mode = DMA2D_ARGB8888;
   }
-  else if(Ltdc_Handler.LayerCfg[ActiveLayer].PixelFormat == LTDC_PIXEL_FORMAT_RGB888)
+  else if(Ltdc_Handler.LayerCfg[LayerIndex].PixelFormat == LTDC_PIXEL_FORMAT_RGB888)
   { 
-    Dma2d_Handler.Init.ColorMode    = DMA2D_RGB888;
+    color_mode = DMA2D_RGB888;
   }
-  else if(Ltdc_Handler.LayerCfg[ActiveLayer].PixelFormat == LTDC_PIXEL_FORMAT_ARGB1555)
+  else if(Ltdc_Handler.LayerCfg[LayerIndex].PixelFormat == LTDC_PIXEL_FORMAT_ARGB1555)
   { 
-    Dma2d_Handler.Init.ColorMode    = DMA2D_ARGB1555;
+    color_mode = DMA2D_ARGB1555;
   }
-  else if(Ltdc_Handler.LayerCfg[ActiveLayer].PixelFormat == LTDC_PIXEL_FORMAT_ARGB4444)
+  else if(Ltdc_Handler.LayerCfg[LayerIndex].PixelFormat == LTDC_PIXEL_FORMAT_ARGB4444)
   { 
-    Dma2d_Handler.Init.ColorMode    = DMA2D_ARGB4444;
+    color_mode = DMA2D_ARGB4444;
   }
-  Dma2d_Handler.Init.OutputOffset = OffLine;      
-  
-  Dma2d_Handler.Instance = DMA2D;
-  
-  /* DMA2D 初始化 */
-  if(HAL_DMA2D_Init(&Dma2d_Handler) == HAL_OK) 
+
+  /* 提交到DMA2D命令队列，由传输完成中断执行，不等待 */
+  LCD_DMA2D_Fill(LCD_DMA2D_Address(pDst), xSize, ySize, OffLine, color_mode, ColorIndex);
+  LCD_PROF_PIXELS(xSize * ySize);
+}
+
+/**
+  * @brief  填充DMA2D不能输出的L8/AL44/AL88格式
+  * @note   每行中按4字节对齐的部分当作ARGB8888由DMA2D填充，一个字包含4个或2个相同的像素；
+  *         行首、行尾不足一个字的像素由CPU写入
+  * @param  LayerIndex: 当前层
+  * @param  Address: 目标地址
+  * @param  xSize: 宽度
+  * @param  ySize: 高度
+  * @param  OffLine: 行偏移(像素)
+  * @param  Pixel: 层原生格式的像素值
+  * @retval 无
+  */
+static void LL_FillPacked(uint32_t LayerIndex, uint32_t Address, uint32_t xSize, uint32_t ySize, uint32_t OffLine, uint32_t Pixel)
+{
+  const LCD_PixelOpsTypeDef *ops = PixelOps[LayerIndex];
+  uint32_t bpp    = ops->BytesPerPixel;
+  uint32_t stride = (xSize + OffLine) * bpp;
+  uint32_t head, words, tail, word, y;
+
+  word  = (bpp == 1U) ? ((Pixel & 0xFFU) * 0x01010101U) : ((Pixel & 0xFFFFU) * 0x00010001U);
+  head  = ((4U - (Address & 3U)) & 3U) / bpp;
+  if((head > xSize) || ((stride & 3U) != 0U))
+  {
+    head = xSize;
+  }
+  words = ((xSize - head) * bpp) / 4U;
+  tail  = xSize - head - (words * 4U) / bpp;
+  LCD_PROF_PIXELS(xSize * ySize);
+
+  if((head != 0U) || (tail != 0U))
   {
-    if(HAL_DMA2D_ConfigLayer(&Dma2d_Handler, LayerIndex) == HAL_OK) 
+    /* CPU写的像素可能被之前的DMA2D命令覆盖 */
+    LCD_DMA2D_Flush();
+    for(y = 0; y < ySize; y++)
     {
-      if (HAL_DMA2D_Start(&Dma2d_Handler, ColorIndex, (uint32_t)pDst, xSize, ySize) == HAL_OK)
-      {
-        /* DMA轮询传输 */  
-        HAL_DMA2D_PollForTransfer(&Dma2d_Handler, 100);
-      }
+      ops->StoreSpan(Address + y * stride, head, Pixel);
+      ops->StoreSpan(Address + y * stride + head * bpp + words * 4U, tail, Pixel);
     }
-  } 
+  }
+
+  if(words != 0U)
+  {
+    LCD_DMA2D_Fill(Address + head * bpp, words, ySize, stride / 4U - words, DMA2D_OUTPUT_ARGB8888, word);
+  }
 }
 
 /**
-  * @brief  转换一行为ARGB8888像素格式
-  * @param  pSrc: 指向源缓冲区的指针
-  * @param  pDst: 输出颜色
-  * @param  xSize: 缓冲区宽度
-  * @param  ColorMode: 输入颜色模式   
+  * @brief  在同一层的两个缓冲区之间复制一个矩形区域
+  * @param  LayerIndex: 层索引
+  * @param  Src: 源缓冲区首地址
+  * @param  Dst: 目标缓冲区首地址
+  * @param  pRect: 复制的区域
   * @retval 无
   */
-static void LL_ConvertLineToARGB8888(void *pSrc, void *pDst, uint32_t xSize, uint32_t ColorMode)
-{    
-  /* 配置DMA2D模式,颜色模式和输出偏移 */
-  Dma2d_Handler.Init.Mode         = DMA2D_M2M_PFC;
-  Dma2d_Handler.Init.ColorMode    = DMA2D_ARGB8888;
-  Dma2d_Handler.Init.OutputOffset = 0;     
-  
-  /* Foreground Configuration */
-  Dma2d_Handler.LayerCfg[1].AlphaMode = DMA2D_NO_MODIF_ALPHA;
-  Dma2d_Handler.LayerCfg[1].InputAlpha = 0xFF;
-  Dma2d_Handler.LayerCfg[1].InputColorMode = ColorMode;
-  Dma2d_Handler.LayerCfg[1].InputOffset = 0;
-  
-  Dma2d_Handler.Instance = DMA2D; 
-  
-  /* DMA2D 初始化 */
-  if(HAL_DMA2D_Init(&Dma2d_Handler) == HAL_OK) 
+static void LL_CopyBuffer(uint32_t LayerIndex, uint32_t Src, uint32_t Dst, const LCD_RectTypeDef *pRect)
+{
+  LCD_DMA2D_CmdTypeDef cmd = {0};
+  uint32_t width  = Ltdc_Handler.LayerCfg[LayerIndex].ImageWidth;
+  uint32_t offset = pRect->Y0 * Stride[LayerIndex] + pRect->X0 * PixelOps[LayerIndex]->BytesPerPixel;
+
+  /* 存储器到存储器模式下前景层格式只决定像素大小，LTDC与DMA2D的格式编码一致 */
+  cmd.Mode         = DMA2D_M2M;
+  cmd.OutColorMode = DMA2D_OUTPUT_ARGB8888;
+  if(Ltdc_Handler.LayerCfg[LayerIndex].PixelFormat <= LTDC_PIXEL_FORMAT_ARGB4444)
+  {
+    cmd.OutColorMode = Ltdc_Handler.LayerCfg[LayerIndex].PixelFormat;
+  }
+  cmd.OutOffset    = width - (pRect->X1 - pRect->X0);
+  cmd.DstAddress   = Dst + offset;
+  cmd.FgAddress    = Src + offset;
+  cmd.FgColorMode  = Ltdc_Handler.LayerCfg[LayerIndex].PixelFormat;
+  cmd.FgOffset     = width - (pRect->X1 - pRect->X0);
+  cmd.FgAlphaMode  = DMA2D_NO_MODIF_ALPHA;
+  cmd.FgAlpha      = 0xFF;
+  cmd.Width        = pRect->X1 - pRect->X0;
+  cmd.Height       = pRect->Y1 - pRect->Y0;
+
+  LCD_DMA2D_Submit(&cmd);
+  LCD_PROF_PIXELS((uint32_t)cmd.Width * cmd.Height);
+}
+
+/* 按像素位宽生成写像素、读像素、写连续像素的函数 */
+#define LL_DEFINE_PIXEL_ACCESS(Bits)                                              \
+static void LL_Store##Bits(uint32_t Address, uint32_t Pixel)                      \
+{                                                                                 \
+  *(__IO uint##Bits##_t *)(uintptr_t)Address = (uint##Bits##_t)Pixel;                        \
+}                                                                                 \
+static uint32_t LL_Load##Bits(uint32_t Address)                                   \
+{                                                                                 \
+  return *(__IO uint##Bits##_t *)(uintptr_t)Address;                                         \
+}                                                                                 \
+static void LL_StoreSpan##Bits(uint32_t Address, uint32_t Count, uint32_t Pixel)  \
+{                                                                                 \
+  __IO uint##Bits##_t *p = (__IO uint##Bits##_t *)(uintptr_t)Address;                        \
+  while(Count--)                                                                  \
+  {                                                                               \
+    *p++ = (uint##Bits##_t)Pixel;                                                 \
+  }                                                                               \
+}
+
+LL_DEFINE_PIXEL_ACCESS(32)
+LL_DEFINE_PIXEL_ACCESS(16)
+
+/* 8位格式一个像素一个字节，连续像素用memset按字写入 */
+static void LL_Store8(uint32_t Address, uint32_t Pixel)
+{
+  *(__IO uint8_t *)(uintptr_t)Address = (uint8_t)Pixel;
+}
+
+static uint32_t LL_Load8(uint32_t Address)
+{
+  return *(__IO uint8_t *)(uintptr_t)Address;
+}
+
+static void LL_StoreSpan8(uint32_t Address, uint32_t Count, uint32_t Pixel)
+{
+  memset((void *)(uintptr_t)Address, (int)(Pixel & 0xFFU), Count);
+}
+
+/* RGB888在显存中按B、G、R顺序存放 */
+static void LL_Store24(uint32_t Address, uint32_t Pixel)
+{
+  *(__IO uint8_t *)(uintptr_t)(Address)     = 0xFF & Pixel;
+  *(__IO uint8_t *)(uintptr_t)(Address + 1) = 0xFF & (Pixel >> 8);
+  *(__IO uint8_t *)(uintptr_t)(Address + 2) = 0xFF & (Pixel >> 16);
+}
+
+static uint32_t LL_Load24(uint32_t Address)
+{
+  return ((uint32_t)*(__IO uint8_t *)(uintptr_t)(Address + 2) << 16) |
+         ((uint32_t)*(__IO uint8_t *)(uintptr_t)(Address + 1) << 8)  |
+          (uint32_t)*(__IO uint8_t *)(uintptr_t)(Address);
+}
+
+static void LL_StoreSpan24(uint32_t Address, uint32_t Count, uint32_t Pixel)
+{
+  while(Count--)
+  {
+    LL_Store24(Address, Pixel);
+    Address += 3;
+  }
+}
+
+/* ARGB8888颜色转换为各像素格式 */
+static uint32_t LL_PackARGB8888(uint32_t Color)
+{
+  return Color;
+}
+
+static uint32_t LL_PackRGB888(uint32_t Color)
+{
+  return Color & 0x00FFFFFF;
+}
+
+static uint32_t LL_PackRGB565(uint32_t Color)
+{
+  return ((Color >> 8) & 0xF800) | ((Color >> 5) & 0x07E0) | ((Color >> 3) & 0x001F);
+}
+
+static uint32_t LL_PackARGB1555(uint32_t Color)
+{
+  return ((Color >> 16) & 0x8000) | ((Color >> 9) & 0x7C00) | ((Color >> 6) & 0x03E0) | ((Color >> 3) & 0x001F);
+}
+
+static uint32_t LL_PackARGB4444(uint32_t Color)
+{
+  return ((Color >> 16) & 0xF000) | ((Color >> 12) & 0x0F00) | ((Color >> 8) & 0x00F0) | ((Color >> 4) & 0x000F);
+}
+
+/* AL88: 高8位为透明度，低8位为亮度 */
+static uint32_t LL_PackAL88(uint32_t Color)
+{
+  uint32_t luma = (77 * ((Color >> 16) & 0xFF) + 150 * ((Color >> 8) & 0xFF) + 29 * (Color & 0xFF)) >> 8;
+
+  return ((Color >> 16) & 0xFF00) | luma;
+}
+
+/* 索引格式查找调色板中最接近的颜色，没有设置调色板时颜色的低8位就是索引 */
+static uint32_t LL_PackL8(uint32_t Color)
+{
+  return LL_PaletteIndex(ActiveLayer, Color, PaletteSize[ActiveLayer]);
+}
+
+/* AL44: 高4位为透明度，低4位为调色板前16项的索引 */
+static uint32_t LL_PackAL44(uint32_t Color)
+{
+  uint32_t count = (PaletteSize[ActiveLayer] > 16U) ? 16U : PaletteSize[ActiveLayer];
+
+  return ((Color >> 24) & 0xF0) | (LL_PaletteIndex(ActiveLayer, Color, count) & 0x0F);
+}
+
+/* 其它8位格式的颜色已经是原始值，直接写入低8位 */
+static uint32_t LL_PackRaw(uint32_t Color)
+{
+  return Color;
+}
+
+/* 各像素格式转换为ARGB8888，低位用高位填充使白色仍为0xFF */
+static uint32_t LL_UnpackRGB888(uint32_t Pixel)
+{
+  return 0xFF000000 | Pixel;
+}
+
+static uint32_t LL_UnpackRGB565(uint32_t Pixel)
+{
+  uint32_t r = (Pixel >> 11) & 0x1F;
+  uint32_t g = (Pixel >> 5) & 0x3F;
+  uint32_t b = Pixel & 0x1F;
+
+  return 0xFF000000 | (((r << 3) | (r >> 2)) << 16) | (((g << 2) | (g >> 4)) << 8) | ((b << 3) | (b >> 2));
+}
+
+static uint32_t LL_UnpackARGB1555(uint32_t Pixel)
+{
+  uint32_t r = (Pixel >> 10) & 0x1F;
+  uint32_t g = (Pixel >> 5) & 0x1F;
+  uint32_t b = Pixel & 0x1F;
+
+  return ((Pixel & 0x8000) ? 0xFF000000 : 0) |
+         (((r << 3) | (r >> 2)) << 16) | (((g << 3) | (g >> 2)) << 8) | ((b << 3) | (b >> 2));
+}
+
+static uint32_t LL_UnpackARGB4444(uint32_t Pixel)
+{
+  return ((Pixel & 0xF000) * 0x11000) | ((Pixel & 0x0F00) * 0x1100) | ((Pixel & 0x00F0) * 0x110) | ((Pixel & 0x000F) * 0x11);
+}
+
+static uint32_t LL_UnpackAL88(uint32_t Pixel)
+{
+  uint32_t luma = Pixel & 0xFF;
+
+  return ((Pixel & 0xFF00) << 16) | (luma << 16) | (luma << 8) | luma;
+}
+
+static uint32_t LL_UnpackL8(uint32_t Pixel)
+{
+  return 0xFF000000 | Palette[ActiveLayer][Pixel & 0xFF];
+}
+
+static uint32_t LL_UnpackAL44(uint32_t Pixel)
+{
+  return (((Pixel >> 4) & 0x0F) * 0x11000000U) | (Palette[ActiveLayer][Pixel & 0x0F] & 0x00FFFFFF);
+}
+
+static const LCD_PixelOpsTypeDef PixelOpsARGB8888 = {4, LL_PackARGB8888, LL_PackRaw,        LL_Store32, LL_Load32, LL_StoreSpan32};
+static const LCD_PixelOpsTypeDef PixelOpsRGB888   = {3, LL_PackRGB888,   LL_UnpackRGB888,   LL_Store24, LL_Load24, LL_StoreSpan24};
+static const LCD_PixelOpsTypeDef PixelOpsRGB565   = {2, LL_PackRGB565,   LL_UnpackRGB565,   LL_Store16, LL_Load16, LL_StoreSpan16};
+static const LCD_PixelOpsTypeDef PixelOpsARGB1555 = {2, LL_PackARGB1555, LL_UnpackARGB1555, LL_Store16, LL_Load16, LL_StoreSpan16};
+static const LCD_PixelOpsTypeDef PixelOpsARGB4444 = {2, LL_PackARGB4444, LL_UnpackARGB4444, LL_Store16, LL_Load16, LL_StoreSpan16};
+static const LCD_PixelOpsTypeDef PixelOpsAL88     = {2, LL_PackAL88,     LL_UnpackAL88,     LL_Store16, LL_Load16, LL_StoreSpan16};
+static const LCD_PixelOpsTypeDef PixelOpsL8       = {1, LL_PackL8,       LL_UnpackL8,       LL_Store8,  LL_Load8,  LL_StoreSpan8};
+static const LCD_PixelOpsTypeDef PixelOpsAL44     = {1, LL_PackAL44,     LL_UnpackAL44,     LL_Store8,  LL_Load8,  LL_StoreSpan8};
+static const LCD_PixelOpsTypeDef PixelOps8        = {1, LL_PackRaw,      LL_PackRaw,        LL_Store8,  LL_Load8,  LL_StoreSpan8};
+
+/**
+  * @brief  根据像素格式选择像素读写函数
+  * @param  PixelFormat: LTDC像素格式
+  * @retval 函数表
+  */
+static const LCD_PixelOpsTypeDef *LL_GetPixelOps(uint32_t PixelFormat)
+{
+  switch(PixelFormat)
+  {
+    case LTDC_PIXEL_FORMAT_ARGB8888: return &PixelOpsARGB8888;
+    case LTDC_PIXEL_FORMAT_RGB888:   return &PixelOpsRGB888;
+    case LTDC_PIXEL_FORMAT_RGB565:   return &PixelOpsRGB565;
+    case LTDC_PIXEL_FORMAT_ARGB1555: return &PixelOpsARGB1555;
+    case LTDC_PIXEL_FORMAT_ARGB4444: return &PixelOpsARGB4444;
+    case LTDC_PIXEL_FORMAT_AL88:     return &PixelOpsAL88;
+    case LTDC_PIXEL_FORMAT_L8:       return &PixelOpsL8;
+    case LTDC_PIXEL_FORMAT_AL44:     return &PixelOpsAL44;
+    default:                         return &PixelOps8;
+  }
+}
+
+/**
+  * @brief  在调色板中查找与颜色最接近的一项，结果按颜色缓存
+  * @note   距离按人眼对绿色更敏感加权；调色板为空时颜色的低8位就是索引
+  * @param  LayerIndex: 层索引
+  * @param  Color: ARGB8888颜色，透明度不参与比较
+  * @param  Count: 参与查找的调色板项数
+  * @retval 索引
+  */
+static uint32_t LL_PaletteIndex(uint32_t LayerIndex, uint32_t Color, uint32_t Count)
+{
+  const uint32_t *palette = Palette[LayerIndex];
+  uint32_t rgb  = Color & 0x00FFFFFF;
+  uint32_t slot = (rgb ^ (rgb >> 7) ^ (rgb >> 15)) & (LCD_PALETTE_CACHE_SIZE - 1U);
+  uint32_t best = 0, best_dist = 0xFFFFFFFF, dist, i;
+  int32_t  dr, dg, db;
+
+  if(Count == 0U)
+  {
+    return Color & 0xFF;
+  }
+  if(((PaletteCacheValid[LayerIndex] >> slot) & 1U) && ((PaletteCache[LayerIndex][slot] & 0x00FFFFFF) == rgb))
+  {
+    return PaletteCache[LayerIndex][slot] >> 24;
+  }
+
+  for(i = 0; (i < Count) && (best_dist != 0U); i++)
   {
-    if(HAL_DMA2D_ConfigLayer(&Dma2d_Handler, 1) == HAL_OK) 
+    dr   = (int32_t)((palette[i] >> 16) & 0xFF) - (int32_t)((rgb >> 16) & 0xFF);
+    dg   = (int32_t)((palette[i] >> 8) & 0xFF) - (int32_t)((rgb >> 8) & 0xFF);
+    db   = (int32_t)(palette[i] & 0xFF) - (int32_t)(rgb & 0xFF);
+    dist = (uint32_t)(3 * dr * dr + 4 * dg * dg + 2 * db * db);
+    if(dist < best_dist)
     {
-      if (HAL_DMA2D_Start(&Dma2d_Handler, (uint32_t)pSrc, (uint32_t)pDst, xSize, 1) == HAL_OK)
-      {
-        /* DMA轮询传输*/  
-        HAL_DMA2D_PollForTransfer(&Dma2d_Handler, 10);
-      }
+      best_dist = dist;
+      best = i;
     }
-  } 
-}
\ No newline at end of file
+  }
+
+  PaletteCache[LayerIndex][slot] = (best << 24) | rgb;
+  PaletteCacheValid[LayerIndex] |= 1U << slot;
+  return best;
+}
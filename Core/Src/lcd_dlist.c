@@ -0,0 +1,611 @@
+#include "lcd_dlist.h"
+#include "lcd_dma2d.h"
+#include "lcd_prof.h"
+#include <string.h>
+
+extern LTDC_HandleTypeDef hltdc;
+
+#define Ltdc_Handler hltdc
+
+/* 命令编码：第一个字的低8位为操作码，坐标按(x | y << 16)打包 */
+#define DL_OP_COLORS       ((uint32_t)1)   /* 文字颜色, 背景颜色 */
+#define DL_OP_TEXTCOLOR    ((uint32_t)2)   /* 文字颜色 */
+#define DL_OP_FONT         ((uint32_t)3)   /* 字体指针 */
+#define DL_OP_CLEAR        ((uint32_t)4)   /* 颜色 */
+#define DL_OP_FILLRECT     ((uint32_t)5)   /* 左上角, 宽高 */
+#define DL_OP_LINE         ((uint32_t)6)   /* 起点, 终点 */
+#define DL_OP_CIRCLE       ((uint32_t)7)   /* 圆心, 半径 */
+#define DL_OP_FILLCIRCLE   ((uint32_t)8)   /* 圆心, 半径 */
+#define DL_OP_STRING       ((uint32_t)9)   /* 位置, 对齐模式, 字符串指针 */
+
+/* 指针占用的字数 */
+#define DL_PTR_WORDS       ((sizeof(void *) + 3U) / 4U)
+
+#define DL_XY(x, y)        ((uint32_t)(x) | ((uint32_t)(y) << 16))
+#define DL_LO(w)           ((uint16_t)((w) & 0xFFFF))
+#define DL_HI(w)           ((uint16_t)((w) >> 16))
+
+static uint32_t *DL_Alloc(LCD_DisplayListTypeDef *pList, uint32_t Op, uint32_t Words);
+static uint32_t *DL_LastCmd(LCD_DisplayListTypeDef *pList, uint32_t Op);
+static void DL_AddBounds(LCD_DisplayListTypeDef *pList, int32_t x0, int32_t y0, int32_t x1, int32_t y1);
+static HAL_StatusTypeDef DL_AddRect(LCD_DisplayListTypeDef *pList, uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height);
+
+/**
+  * @brief  初始化显示列表
+  * @param  pList: 显示列表
+  * @param  pBuffer: 命令缓冲区
+  * @param  Size: 缓冲区字节数
+  * @retval 无
+  */
+void LCD_DL_Init(LCD_DisplayListTypeDef *pList, uint32_t *pBuffer, uint32_t Size)
+{
+  pList->pBuffer = pBuffer;
+  pList->Size    = Size / 4U;
+  LCD_DL_Reset(pList);
+}
+
+/**
+  * @brief  清空显示列表中的命令和缓存
+  * @param  pList: 显示列表
+  * @retval 无
+  */
+void LCD_DL_Reset(LCD_DisplayListTypeDef *pList)
+{
+  pList->Used         = 0;
+  pList->Last         = 0xFFFFFFFF;
+  pList->TextColor    = 0;
+  pList->BackColor    = 0;
+  pList->pFont        = LCD_GetFont();
+  pList->ColorsValid  = 0;
+  pList->Overflow     = 0;
+  pList->Recorded     = 0;
+  pList->Merged       = 0;
+  pList->Bounds.X0    = 0xFFFF;
+  pList->Bounds.Y0    = 0xFFFF;
+  pList->Bounds.X1    = 0;
+  pList->Bounds.Y1    = 0;
+  pList->CacheAddress = 0;
+}
+
+/**
+  * @brief  记录设置文字和背景颜色，与当前记录的颜色相同时省去
+  * @param  pList: 显示列表
+  * @param  TextColor: 文字颜色
+  * @param  BackColor: 背景颜色
+  * @retval HAL状态，缓冲区已满时为HAL_ERROR
+  */
+HAL_StatusTypeDef LCD_DL_SetColors(LCD_DisplayListTypeDef *pList, uint32_t TextColor, uint32_t BackColor)
+{
+  uint32_t *cmd;
+
+  pList->Recorded++;
+  if((pList->ColorsValid != 0U) && (pList->TextColor == TextColor) && (pList->BackColor == BackColor))
+  {
+    pList->Merged++;
+    return HAL_OK;
+  }
+
+  /* 连续的颜色设置只保留最后一条 */
+  cmd = DL_LastCmd(pList, DL_OP_COLORS);
+  if(cmd == NULL)
+  {
+    cmd = DL_LastCmd(pList, DL_OP_TEXTCOLOR);
+    if(cmd != NULL)
+    {
+      pList->Used = pList->Last;
+      pList->Merged++;
+    }
+    cmd = DL_Alloc(pList, DL_OP_COLORS, 2);
+  }
+  else
+  {
+    pList->Merged++;
+  }
+  if(cmd == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  cmd[1] = TextColor;
+  cmd[2] = BackColor;
+  pList->TextColor   = TextColor;
+  pList->BackColor   = BackColor;
+  pList->ColorsValid = 1;
+  return HAL_OK;
+}
+
+/**
+  * @brief  记录设置文字颜色
+  * @param  pList: 显示列表
+  * @param  Color: 文字颜色
+  * @retval HAL状态
+  */
+HAL_StatusTypeDef LCD_DL_SetTextColor(LCD_DisplayListTypeDef *pList, uint32_t Color)
+{
+  uint32_t *cmd;
+
+  if(pList->ColorsValid != 0U)
+  {
+    return LCD_DL_SetColors(pList, Color, pList->BackColor);
+  }
+
+  pList->Recorded++;
+  cmd = DL_Alloc(pList, DL_OP_TEXTCOLOR, 1);
+  if(cmd == NULL)
+  {
+    return HAL_ERROR;
+  }
+  cmd[1] = Color;
+  return HAL_OK;
+}
+
+/**
+  * @brief  记录设置字体
+  * @param  pList: 显示列表
+  * @param  fonts: 字体，重放时必须仍然有效
+  * @retval HAL状态
+  */
+HAL_StatusTypeDef LCD_DL_SetFont(LCD_DisplayListTypeDef *pList, sFONT *fonts)
+{
+  uint32_t *cmd;
+
+  pList->Recorded++;
+  cmd = DL_Alloc(pList, DL_OP_FONT, DL_PTR_WORDS);
+  if(cmd == NULL)
+  {
+    return HAL_ERROR;
+  }
+  memcpy(&cmd[1], &fonts, sizeof(fonts));
+  pList->pFont = fonts;
+  return HAL_OK;
+}
+
+/**
+  * @brief  记录清屏，之前记录的绘图命令被覆盖，直接丢弃
+  * @param  pList: 显示列表
+  * @param  Color: 颜色
+  * @retval HAL状态
+  */
+HAL_StatusTypeDef LCD_DL_Clear(LCD_DisplayListTypeDef *pList, uint32_t Color)
+{
+  uint32_t *cmd;
+
+  pList->Recorded++;
+  cmd = DL_Alloc(pList, DL_OP_CLEAR, 1);
+  if(cmd == NULL)
+  {
+    return HAL_ERROR;
+  }
+  cmd[1] = Color;
+  DL_AddBounds(pList, 0, 0, (int32_t)LCD_GetXSize(), (int32_t)LCD_GetYSize());
+  return HAL_OK;
+}
+
+/**
+  * @brief  记录填充矩形，与上一条同色的矩形相邻时合并为一个
+  * @param  pList: 显示列表
+  * @param  Xpos, Ypos: 左上角坐标
+  * @param  Width, Height: 宽度和高度
+  * @retval HAL状态
+  */
+HAL_StatusTypeDef LCD_DL_FillRect(LCD_DisplayListTypeDef *pList, uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height)
+{
+  pList->Recorded++;
+  return DL_AddRect(pList, Xpos, Ypos, Width, Height);
+}
+
+/**
+  * @brief  记录水平线，按1像素高的矩形保存
+  * @param  pList: 显示列表
+  * @param  Xpos, Ypos: 起点
+  * @param  Length: 长度
+  * @retval HAL状态
+  */
+HAL_StatusTypeDef LCD_DL_DrawHLine(LCD_DisplayListTypeDef *pList, uint16_t Xpos, uint16_t Ypos, uint16_t Length)
+{
+  pList->Recorded++;
+  return DL_AddRect(pList, Xpos, Ypos, Length, 1);
+}
+
+/**
+  * @brief  记录垂直线，按1像素宽的矩形保存
+  * @param  pList: 显示列表
+  * @param  Xpos, Ypos: 起点
+  * @param  Length: 长度
+  * @retval HAL状态
+  */
+HAL_StatusTypeDef LCD_DL_DrawVLine(LCD_DisplayListTypeDef *pList, uint16_t Xpos, uint16_t Ypos, uint16_t Length)
+{
+  pList->Recorded++;
+  return DL_AddRect(pList, Xpos, Ypos, 1, Length);
+}
+
+/**
+  * @brief  记录直线
+  * @note   屏幕内的水平线、垂直线按矩形保存；45度斜线与上一条首尾相接且方向相同时合并，
+  *         其它斜率的Bresenham舍入与起点有关，合并后像素会变化，不合并
+  * @param  pList: 显示列表
+  * @param  x1, y1: 起点
+  * @param  x2, y2: 终点
+  * @retval HAL状态
+  */
+HAL_StatusTypeDef LCD_DL_DrawLine(LCD_DisplayListTypeDef *pList, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2)
+{
+  uint32_t *cmd;
+  int32_t  dx = (int32_t)x2 - x1, dy = (int32_t)y2 - y1;
+  int32_t  px, py, pdx, pdy;
+
+  pList->Recorded++;
+
+  if(((dx == 0) || (dy == 0)) && (x1 < LCD_GetXSize()) && (x2 < LCD_GetXSize()) &&
+     (y1 < LCD_GetYSize()) && (y2 < LCD_GetYSize()))
+  {
+    return DL_AddRect(pList, (x1 < x2) ? x1 : x2, (y1 < y2) ? y1 : y2, (uint16_t)(ABS(dx) + 1), (uint16_t)(ABS(dy) + 1));
+  }
+
+  DL_AddBounds(pList, (x1 < x2) ? x1 : x2, (y1 < y2) ? y1 : y2, ((x1 > x2) ? x1 : x2) + 1, ((y1 > y2) ? y1 : y2) + 1);
+
+  cmd = DL_LastCmd(pList, DL_OP_LINE);
+  if((cmd != NULL) && (ABS(dx) == ABS(dy)))
+  {
+    px  = DL_LO(cmd[2]);
+    py  = DL_HI(cmd[2]);
+    pdx = px - DL_LO(cmd[1]);
+    pdy = py - DL_HI(cmd[1]);
+    if((px == x1) && (py == y1) && (ABS(pdx) == ABS(pdy)) && ((pdx > 0) == (dx > 0)) && ((pdy > 0) == (dy > 0)))
+    {
+      cmd[2] = DL_XY(x2, y2);
+      pList->Merged++;
+      return HAL_OK;
+    }
+  }
+
+  cmd = DL_Alloc(pList, DL_OP_LINE, 2);
+  if(cmd == NULL)
+  {
+    return HAL_ERROR;
+  }
+  cmd[1] = DL_XY(x1, y1);
+  cmd[2] = DL_XY(x2, y2);
+  return HAL_OK;
+}
+
+/**
+  * @brief  记录圆
+  * @param  pList: 显示列表
+  * @param  Xpos, Ypos: 圆心
+  * @param  Radius: 半径
+  * @retval HAL状态
+  */
+HAL_StatusTypeDef LCD_DL_DrawCircle(LCD_DisplayListTypeDef *pList, uint16_t Xpos, uint16_t Ypos, uint16_t Radius)
+{
+  uint32_t *cmd;
+
+  pList->Recorded++;
+  cmd = DL_Alloc(pList, DL_OP_CIRCLE, 2);
+  if(cmd == NULL)
+  {
+    return HAL_ERROR;
+  }
+  cmd[1] = DL_XY(Xpos, Ypos);
+  cmd[2] = Radius;
+  DL_AddBounds(pList, (int32_t)Xpos - Radius, (int32_t)Ypos - Radius, (int32_t)Xpos + Radius + 1, (int32_t)Ypos + Radius + 1);
+  return HAL_OK;
+}
+
+/**
+  * @brief  记录实心圆
+  * @param  pList: 显示列表
+  * @param  Xpos, Ypos: 圆心
+  * @param  Radius: 半径
+  * @retval HAL状态
+  */
+HAL_StatusTypeDef LCD_DL_FillCircle(LCD_DisplayListTypeDef *pList, uint16_t Xpos, uint16_t Ypos, uint16_t Radius)
+{
+  uint32_t *cmd;
+
+  pList->Recorded++;
+  cmd = DL_Alloc(pList, DL_OP_FILLCIRCLE, 2);
+  if(cmd == NULL)
+  {
+    return HAL_ERROR;
+  }
+  cmd[1] = DL_XY(Xpos, Ypos);
+  cmd[2] = Radius;
+  DL_AddBounds(pList, (int32_t)Xpos - Radius, (int32_t)Ypos - Radius, (int32_t)Xpos + Radius + 1, (int32_t)Ypos + Radius + 1);
+  return HAL_OK;
+}
+
+/**
+  * @brief  记录显示字符串
+  * @param  pList: 显示列表
+  * @param  Xpos, Ypos: 位置，含义与LCD_DisplayStringAt相同
+  * @param  Text: 以0结尾的字符串，只保存指针，重放时必须仍然有效
+  * @param  Mode: 对齐模式
+  * @retval HAL状态
+  */
+HAL_StatusTypeDef LCD_DL_DisplayStringAt(LCD_DisplayListTypeDef *pList, uint16_t Xpos, uint16_t Ypos, const uint8_t *Text, Text_AlignModeTypdef Mode)
+{
+  uint32_t *cmd;
+
+  pList->Recorded++;
+  cmd = DL_Alloc(pList, DL_OP_STRING, 2U + DL_PTR_WORDS);
+  if(cmd == NULL)
+  {
+    return HAL_ERROR;
+  }
+  cmd[1] = DL_XY(Xpos, Ypos);
+  cmd[2] = (uint32_t)Mode;
+  memcpy(&cmd[3], &Text, sizeof(Text));
+
+  /* 对齐后的位置与字体有关，按整行计算范围 */
+  DL_AddBounds(pList, 0, Ypos, (int32_t)LCD_GetXSize(), (int32_t)Ypos + pList->pFont->Height);
+  return HAL_OK;
+}
+
+/**
+  * @brief  在当前层重放显示列表
+  * @note   有预光栅化缓存且层格式未变时，只用一条DMA2D命令复制缓存的图像
+  * @param  pList: 显示列表
+  * @retval 无
+  */
+void LCD_DL_Replay(const LCD_DisplayListTypeDef *pList)
+{
+  const uint32_t *cmd = pList->pBuffer;
+  const uint32_t *end = pList->pBuffer + pList->Used;
+  const uint8_t  *text;
+  sFONT          *font;
+  uint32_t       format = Ltdc_Handler.LayerCfg[LCD_GetActiveLayer()].PixelFormat;
+  uint32_t       width;
+
+  LCD_PROF_BEGIN(LCD_PROF_DLIST);
+  if((pList->CacheAddress != 0U) && (pList->CacheFormat == format))
+  {
+    width = pList->Bounds.X1 - pList->Bounds.X0;
+    LCD_BlitImage((const void *)(uintptr_t)pList->CacheAddress, format, width * (LCD_GetStride(LCD_GetActiveLayer()) / LCD_GetXSize()),
+                  (int16_t)pList->Bounds.X0, (int16_t)pList->Bounds.Y0,
+                  (uint16_t)width, pList->Bounds.Y1 - pList->Bounds.Y0);
+    LCD_PROF_END();
+    return;
+  }
+
+  while(cmd < end)
+  {
+    switch(cmd[0] & 0xFF)
+    {
+    case DL_OP_COLORS:
+      LCD_SetColors(cmd[1], cmd[2]);
+      cmd += 3;
+      break;
+    case DL_OP_TEXTCOLOR:
+      LCD_SetTextColor(cmd[1]);
+      cmd += 2;
+      break;
+    case DL_OP_FONT:
+      memcpy(&font, &cmd[1], sizeof(font));
+      LCD_SetFont(font);
+      cmd += 1U + DL_PTR_WORDS;
+      break;
+    case DL_OP_CLEAR:
+      LCD_Clear(cmd[1]);
+      cmd += 2;
+      break;
+    case DL_OP_FILLRECT:
+      LCD_FillRect(DL_LO(cmd[1]), DL_HI(cmd[1]), DL_LO(cmd[2]), DL_HI(cmd[2]));
+      cmd += 3;
+      break;
+    case DL_OP_LINE:
+      LCD_DrawLine(DL_LO(cmd[1]), DL_HI(cmd[1]), DL_LO(cmd[2]), DL_HI(cmd[2]));
+      cmd += 3;
+      break;
+    case DL_OP_CIRCLE:
+      LCD_DrawCircle(DL_LO(cmd[1]), DL_HI(cmd[1]), (uint16_t)cmd[2]);
+      cmd += 3;
+      break;
+    case DL_OP_FILLCIRCLE:
+      LCD_FillCircle(DL_LO(cmd[1]), DL_HI(cmd[1]), (uint16_t)cmd[2]);
+      cmd += 3;
+      break;
+    case DL_OP_STRING:
+      memcpy(&text, &cmd[3], sizeof(text));
+      LCD_DisplayStringAt(DL_LO(cmd[1]), DL_HI(cmd[1]), text, (Text_AlignModeTypdef)cmd[2]);
+      cmd += 3U + DL_PTR_WORDS;
+      break;
+    default:
+      /* 命令损坏，停止重放 */
+      LCD_PROF_END();
+      return;
+    }
+  }
+  LCD_PROF_END();
+}
+
+/**
+  * @brief  预光栅化：在当前层重放一次，再把外接矩形内的像素复制到缓存
+  * @note   之后的重放只复制这块图像，外接矩形内没有被命令覆盖的像素也按缓存时的内容恢复，
+  *         适合整屏或有背景填充的静态界面
+  * @param  pList: 显示列表
+  * @param  Address: 缓存地址，大小为外接矩形的像素数乘以层的每像素字节数
+  * @retval HAL状态
+  */
+HAL_StatusTypeDef LCD_DL_Cache(LCD_DisplayListTypeDef *pList, uint32_t Address)
+{
+  LCD_DMA2D_CmdTypeDef cmd = {0};
+  uint32_t layer  = LCD_GetActiveLayer();
+  uint32_t format = Ltdc_Handler.LayerCfg[layer].PixelFormat;
+  uint32_t width, height;
+
+  pList->CacheAddress = 0;
+  if((pList->Overflow != 0U) || (pList->Bounds.X0 >= pList->Bounds.X1) || (pList->Bounds.Y0 >= pList->Bounds.Y1))
+  {
+    return HAL_ERROR;
+  }
+
+  LCD_DL_Replay(pList);
+
+  width  = pList->Bounds.X1 - pList->Bounds.X0;
+  height = pList->Bounds.Y1 - pList->Bounds.Y0;
+
+  /* 存储器到存储器模式按像素大小原样复制，任何层格式都可以 */
+  cmd.Mode         = DMA2D_M2M;
+  cmd.OutColorMode = DMA2D_OUTPUT_ARGB8888;
+  if(format <= LTDC_PIXEL_FORMAT_ARGB4444)
+  {
+    cmd.OutColorMode = format;
+  }
+  cmd.OutOffset    = 0;
+  cmd.DstAddress   = Address;
+  cmd.FgAddress    = LCD_GetPixelAddress(layer, pList->Bounds.X0, pList->Bounds.Y0);
+  cmd.FgColorMode  = format;
+  cmd.FgOffset     = LCD_GetXSize() - width;
+  cmd.FgAlphaMode  = DMA2D_NO_MODIF_ALPHA;
+  cmd.FgAlpha      = 0xFF;
+  cmd.Width        = (uint16_t)width;
+  cmd.Height       = (uint16_t)height;
+  LCD_DMA2D_Wait(LCD_DMA2D_Submit(&cmd));
+
+  pList->CacheAddress = Address;
+  pList->CacheFormat  = format;
+  return HAL_OK;
+}
+
+/**
+  * @brief  丢弃预光栅化缓存，之后按命令重放
+  * @param  pList: 显示列表
+  * @retval 无
+  */
+void LCD_DL_DropCache(LCD_DisplayListTypeDef *pList)
+{
+  pList->CacheAddress = 0;
+}
+
+/**
+  * @brief  在缓冲区末尾分配一条命令
+  * @param  pList: 显示列表
+  * @param  Op: 操作码
+  * @param  Words: 参数字数
+  * @retval 命令首地址，缓冲区已满时返回NULL
+  */
+static uint32_t *DL_Alloc(LCD_DisplayListTypeDef *pList, uint32_t Op, uint32_t Words)
+{
+  uint32_t *cmd;
+
+  /* 命令改变后缓存失效 */
+  pList->CacheAddress = 0;
+
+  if((pList->Overflow != 0U) || ((pList->Used + 1U + Words) > pList->Size))
+  {
+    pList->Overflow = 1;
+    return NULL;
+  }
+
+  cmd = &pList->pBuffer[pList->Used];
+  cmd[0] = Op;
+  pList->Last = pList->Used;
+  pList->Used += 1U + Words;
+  return cmd;
+}
+
+/**
+  * @brief  最后一条命令的操作码为Op时返回它，用于合并
+  * @param  pList: 显示列表
+  * @param  Op: 操作码
+  * @retval 命令首地址或NULL
+  */
+static uint32_t *DL_LastCmd(LCD_DisplayListTypeDef *pList, uint32_t Op)
+{
+  if((pList->Last >= pList->Used) || ((pList->pBuffer[pList->Last] & 0xFF) != Op))
+  {
+    return NULL;
+  }
+  pList->CacheAddress = 0;
+  return &pList->pBuffer[pList->Last];
+}
+
+/**
+  * @brief  扩大显示列表的外接矩形，超出层的部分被裁掉
+  * @param  pList: 显示列表
+  * @param  x0, y0: 左上角
+  * @param  x1, y1: 右下角(不包含)
+  * @retval 无
+  */
+static void DL_AddBounds(LCD_DisplayListTypeDef *pList, int32_t x0, int32_t y0, int32_t x1, int32_t y1)
+{
+  int32_t xsize = (int32_t)LCD_GetXSize();
+  int32_t ysize = (int32_t)LCD_GetYSize();
+
+  x0 = (x0 < 0) ? 0 : x0;
+  y0 = (y0 < 0) ? 0 : y0;
+  x1 = (x1 > xsize) ? xsize : x1;
+  y1 = (y1 > ysize) ? ysize : y1;
+  if((x0 >= x1) || (y0 >= y1))
+  {
+    return;
+  }
+
+  pList->Bounds.X0 = (pList->Bounds.X0 < x0) ? pList->Bounds.X0 : (uint16_t)x0;
+  pList->Bounds.Y0 = (pList->Bounds.Y0 < y0) ? pList->Bounds.Y0 : (uint16_t)y0;
+  pList->Bounds.X1 = (pList->Bounds.X1 > x1) ? pList->Bounds.X1 : (uint16_t)x1;
+  pList->Bounds.Y1 = (pList->Bounds.Y1 > y1) ? pList->Bounds.Y1 : (uint16_t)y1;
+}
+
+/**
+  * @brief  记录一个填充矩形，与上一个矩形左右或上下相接且对齐、或被其包含时合并
+  * @param  pList: 显示列表
+  * @param  Xpos, Ypos: 左上角坐标
+  * @param  Width, Height: 宽度和高度
+  * @retval HAL状态
+  */
+static HAL_StatusTypeDef DL_AddRect(LCD_DisplayListTypeDef *pList, uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height)
+{
+  uint32_t *cmd;
+  uint32_t px, py, pw, ph;
+
+  if((Width == 0U) || (Height == 0U))
+  {
+    pList->Merged++;
+    return HAL_OK;
+  }
+  DL_AddBounds(pList, Xpos, Ypos, (int32_t)Xpos + Width, (int32_t)Ypos + Height);
+
+  cmd = DL_LastCmd(pList, DL_OP_FILLRECT);
+  if(cmd != NULL)
+  {
+    px = DL_LO(cmd[1]);
+    py = DL_HI(cmd[1]);
+    pw = DL_LO(cmd[2]);
+    ph = DL_HI(cmd[2]);
+
+    /* 被上一个矩形包含 */
+    if((Xpos >= px) && (Ypos >= py) && ((Xpos + Width) <= (px + pw)) && ((Ypos + Height) <= (py + ph)))
+    {
+      pList->Merged++;
+      return HAL_OK;
+    }
+    /* 同一行高，左右相接或重叠 */
+    if((Ypos == py) && (Height == ph) && (Xpos <= (px + pw)) && ((Xpos + Width) >= px))
+    {
+      cmd[1] = DL_XY((Xpos < px) ? Xpos : px, py);
+      cmd[2] = DL_XY((((Xpos + Width) > (px + pw)) ? (Xpos + Width) : (px + pw)) - ((Xpos < px) ? Xpos : px), ph);
+      pList->Merged++;
+      return HAL_OK;
+    }
+    /* 同一列宽，上下相接或重叠 */
+    if((Xpos == px) && (Width == pw) && (Ypos <= (py + ph)) && ((Ypos + Height) >= py))
+    {
+      cmd[1] = DL_XY(px, (Ypos < py) ? Ypos : py);
+      cmd[2] = DL_XY(pw, (((Ypos + Height) > (py + ph)) ? (Ypos + Height) : (py + ph)) - ((Ypos < py) ? Ypos : py));
+      pList->Merged++;
+      return HAL_OK;
+    }
+  }
+
+  cmd = DL_Alloc(pList, DL_OP_FILLRECT, 2);
+  if(cmd == NULL)
+  {
+    return HAL_ERROR;
+  }
+  cmd[1] = DL_XY(Xpos, Ypos);
+  cmd[2] = DL_XY(Width, Height);
+  return HAL_OK;
+}
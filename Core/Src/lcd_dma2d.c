@@ -0,0 +1,309 @@
+#include "lcd_dma2d.h"
+#include "lcd_backend.h"
+#include "lcd_prof.h"
+#include "memsys.h"
+#if !defined(__arm__)
+#include <stdio.h>
+#include <stdlib.h>
+#endif
+
+#define QUEUE_MASK    (LCD_DMA2D_QUEUE_SIZE - 1U)
+
+static LCD_DMA2D_CmdTypeDef   Queue[LCD_DMA2D_QUEUE_SIZE];
+static volatile uint32_t      QueueHead = 0;    /* 已提交命令计数，只由提交者修改 */
+static volatile uint32_t      QueueTail = 0;    /* 已完成命令计数，只在中断中修改 */
+static volatile uint8_t       QueueRunning = 0; /* DMA2D 正在执行队首命令 */
+static LCD_DMA2D_StatsTypeDef Stats;
+
+/* DMA2D各输入格式每像素的位数，输出格式取前5项 */
+static const uint8_t InputBits[] = {32, 24, 16, 16, 16, 8, 8, 16, 4, 8, 4};
+
+static void LCD_DMA2D_Kick(void);
+static uint32_t LCD_DMA2D_Extent(uint32_t Width, uint32_t Height, uint32_t Offset, uint32_t ColorMode);
+static void LCD_DMA2D_Coherent(const LCD_DMA2D_CmdTypeDef *pCmd);
+
+/**
+  * @brief  初始化DMA2D命令队列，必须在MX_DMA2D_Init之后调用
+  * @retval 无
+  */
+void LCD_DMA2D_Init(void)
+{
+  QueueHead = 0;
+  QueueTail = 0;
+  QueueRunning = 0;
+  LCD_DMA2D_ResetStats();
+
+  LCD_GetBackend()->Dma2dInit();
+}
+
+/**
+  * @brief  提交一条DMA2D命令，立即返回
+  * @note   队列满时等待最早的一条命令完成
+  * @param  pCmd: 指向命令的指针，内容被复制到队列中
+  * @retval 该命令的栅栏值，可用于LCD_DMA2D_Wait
+  */
+uint32_t LCD_DMA2D_Submit(const LCD_DMA2D_CmdTypeDef *pCmd)
+{
+  uint32_t primask;
+  uint32_t depth;
+  uint32_t fence;
+
+  /* 空命令不提交 */
+  if((pCmd->Width == 0U) || (pCmd->Height == 0U))
+  {
+    return QueueHead;
+  }
+
+  /* 队列已满，等待最早的命令完成 */
+  if((QueueHead - QueueTail) >= LCD_DMA2D_QUEUE_SIZE)
+  {
+    Stats.FullStalls++;
+    LCD_DMA2D_Wait(QueueHead - LCD_DMA2D_QUEUE_SIZE + 1U);
+  }
+
+  Queue[QueueHead & QUEUE_MASK] = *pCmd;
+  LCD_DMA2D_Coherent(pCmd);
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  fence = ++QueueHead;
+  depth = fence - QueueTail;
+  if(depth > Stats.MaxDepth)
+  {
+    Stats.MaxDepth = depth;
+  }
+  Stats.Submitted++;
+  LCD_DMA2D_Kick();
+  __set_PRIMASK(primask);
+
+  return fence;
+}
+
+/**
+  * @brief  提交一条寄存器到存储器(R2M)的填充命令
+  * @param  DstAddress: 目标地址
+  * @param  Width: 填充宽度
+  * @param  Height: 填充高度
+  * @param  OffLine: 行偏移
+  * @param  ColorMode: 输出颜色格式
+  * @param  Color: ARGB8888格式的颜色
+  * @retval 栅栏值
+  */
+uint32_t LCD_DMA2D_Fill(uint32_t DstAddress, uint32_t Width, uint32_t Height, uint32_t OffLine, uint32_t ColorMode, uint32_t Color)
+{
+  LCD_DMA2D_CmdTypeDef cmd = {0};
+
+  cmd.Mode         = DMA2D_R2M;
+  cmd.OutColorMode = ColorMode;
+  cmd.OutOffset    = OffLine;
+  cmd.DstAddress   = DstAddress;
+  cmd.FgAddress    = Color;
+  cmd.Width        = (uint16_t)Width;
+  cmd.Height       = (uint16_t)Height;
+
+  return LCD_DMA2D_Submit(&cmd);
+}
+
+/**
+  * @brief  提交一条加载前景层CLUT的命令，之后的L8/AL44前景转换使用该CLUT
+  * @note   CLUT由DMA2D异步读取，在返回的栅栏完成前不能修改
+  * @param  pCLUT: ARGB8888格式的CLUT
+  * @param  Count: 项数，1~256
+  * @retval 栅栏值
+  */
+uint32_t LCD_DMA2D_LoadCLUT(const uint32_t *pCLUT, uint32_t Count)
+{
+  LCD_DMA2D_CmdTypeDef cmd = {0};
+
+  cmd.Mode        = LCD_DMA2D_CLUT_LOAD;
+  cmd.FgAddress   = LCD_DMA2D_Address(pCLUT);
+  cmd.FgColorMode = DMA2D_CCM_ARGB8888;
+  cmd.Width       = (uint16_t)Count;
+  cmd.Height      = 1;
+
+  return LCD_DMA2D_Submit(&cmd);
+}
+
+/**
+  * @brief  把缓冲区指针转换为DMA2D命令使用的32位地址
+  * @note   目标板上指针本来就是32位；主机仿真时只有非PIE的静态数据和映射的SDRAM位于4GB以下，
+  *         堆或栈上的缓冲区地址会被截断，这里直接终止，不让DMA2D读写别处的内存
+  * @param  pBuffer: 缓冲区
+  * @retval 地址
+  */
+uint32_t LCD_DMA2D_Address(const volatile void *pBuffer)
+{
+#if !defined(__arm__)
+  if((uintptr_t)(uint32_t)(uintptr_t)pBuffer != (uintptr_t)pBuffer)
+  {
+    printf("DMA2D buffer %p is above 4GB\n", (const void *)pBuffer);
+    abort();
+  }
+#endif
+  return (uint32_t)(uintptr_t)pBuffer;
+}
+
+/**
+  * @brief  获取最后一条已提交命令的栅栏值
+  * @retval 栅栏值
+  */
+uint32_t LCD_DMA2D_Fence(void)
+{
+  return QueueHead;
+}
+
+/**
+  * @brief  查询栅栏之前的命令是否已全部完成
+  * @param  Fence: 栅栏值
+  * @retval 1: 已完成 0: 未完成
+  */
+uint32_t LCD_DMA2D_IsDone(uint32_t Fence)
+{
+  return ((int32_t)(QueueTail - Fence) >= 0) ? 1U : 0U;
+}
+
+/**
+  * @brief  等待栅栏之前的命令全部完成
+  * @param  Fence: 栅栏值
+  * @retval 无
+  */
+void LCD_DMA2D_Wait(uint32_t Fence)
+{
+  if(LCD_DMA2D_IsDone(Fence) != 0U)
+  {
+    return;
+  }
+
+  LCD_PROF_STALL_BEGIN();
+  while(LCD_DMA2D_IsDone(Fence) == 0U)
+  {
+    /* 中断被屏蔽或在中断中调用时，主动处理DMA2D中断标志，避免死等 */
+    if((__get_PRIMASK() != 0U) || (__get_IPSR() != 0U))
+    {
+      LCD_GetBackend()->Dma2dPoll();
+    }
+    else
+    {
+      LCD_GetBackend()->Idle();
+    }
+  }
+  LCD_PROF_STALL_END(0);
+}
+
+/**
+  * @brief  等待所有已提交的命令完成
+  * @retval 无
+  */
+void LCD_DMA2D_Flush(void)
+{
+  LCD_DMA2D_Wait(QueueHead);
+}
+
+/**
+  * @brief  读取队列统计
+  * @param  pStats: 输出统计数据
+  * @retval 无
+  */
+void LCD_DMA2D_GetStats(LCD_DMA2D_StatsTypeDef *pStats)
+{
+  *pStats = Stats;
+  pStats->Completed = QueueTail;
+}
+
+/**
+  * @brief  清除队列统计
+  * @retval 无
+  */
+void LCD_DMA2D_ResetStats(void)
+{
+  Stats.Submitted  = 0;
+  Stats.Completed  = 0;
+  Stats.Errors     = 0;
+  Stats.FullStalls = 0;
+  Stats.MaxDepth   = 0;
+}
+
+/**
+  * @brief  DMA2D空闲时启动队首命令，调用者需保证中断已屏蔽或处于DMA2D中断中
+  * @retval 无
+  */
+static void LCD_DMA2D_Kick(void)
+{
+  while((QueueRunning == 0U) && (QueueTail != QueueHead))
+  {
+    LCD_PROF_DMA2D_START();
+    if(LCD_GetBackend()->Dma2dStart(&Queue[QueueTail & QUEUE_MASK]) == HAL_OK)
+    {
+      QueueRunning = 1;
+    }
+    else
+    {
+      /* 启动失败，丢弃该命令并继续 */
+      Stats.Errors++;
+      QueueTail++;
+    }
+  }
+}
+
+/**
+  * @brief  当前命令完成，启动下一条命令，由后端在DMA2D中断中调用
+  * @param  Error: 0: 正常完成 1: 传输或配置错误，丢弃该命令
+  * @retval 无
+  */
+void LCD_DMA2D_Complete(uint32_t Error)
+{
+  LCD_PROF_DMA2D_DONE();
+  if(Error != 0U)
+  {
+    Stats.Errors++;
+  }
+  QueueTail++;
+  QueueRunning = 0;
+  LCD_DMA2D_Kick();
+}
+
+/**
+  * @brief  计算一个DMA2D层访问的字节范围
+  * @param  Width, Height: 区域大小
+  * @param  Offset: 行偏移(像素)
+  * @param  ColorMode: 颜色格式，DMA2D_INPUT_xxx或DMA2D_OUTPUT_xxx
+  * @retval 第一个像素到最后一个像素的字节数
+  */
+static uint32_t LCD_DMA2D_Extent(uint32_t Width, uint32_t Height, uint32_t Offset, uint32_t ColorMode)
+{
+  uint32_t bits = (ColorMode < sizeof(InputBits)) ? InputBits[ColorMode] : 32U;
+
+  return ((((Height - 1U) * (Width + Offset)) + Width) * bits + 7U) / 8U;
+}
+
+/**
+  * @brief  提交命令前维护D-Cache：CPU写入写回缓存SRAM的源数据先写回，
+  *         目标在写回缓存中的先写回并丢弃，DMA2D完成后等待栅栏的一方再按需丢弃
+  * @note   写通和不经过缓存的区域只需等待写缓冲排空
+  * @param  pCmd: 命令
+  * @retval 无
+  */
+static void LCD_DMA2D_Coherent(const LCD_DMA2D_CmdTypeDef *pCmd)
+{
+  uint32_t width  = pCmd->Width;
+  uint32_t height = pCmd->Height;
+
+  if(pCmd->Mode == LCD_DMA2D_CLUT_LOAD)
+  {
+    MEM_CleanDCache(pCmd->FgAddress, width * 4U);
+  }
+  else
+  {
+    if(pCmd->Mode != DMA2D_R2M)
+    {
+      MEM_CleanDCache(pCmd->FgAddress, LCD_DMA2D_Extent(width, height, pCmd->FgOffset, pCmd->FgColorMode));
+    }
+    if(pCmd->Mode == DMA2D_M2M_BLEND)
+    {
+      MEM_CleanDCache(pCmd->BgAddress, LCD_DMA2D_Extent(width, height, pCmd->BgOffset, pCmd->BgColorMode));
+    }
+    MEM_CleanInvalidateDCache(pCmd->DstAddress,
+                              LCD_DMA2D_Extent(width, height, pCmd->OutOffset, pCmd->OutColorMode));
+  }
+  __DSB();
+}
@@ -0,0 +1,496 @@
+#include "lcd_font.h"
+#include "lcd_dma2d.h"
+
+#define CACHE_MASK          (LCD_FONT_CACHE_BUCKETS - 1U)
+#define CACHE_NIL           ((uint16_t)0xFFFF)
+#define CACHE_HASH(f, c)    ((((c) * 31U) + (uint32_t)((uintptr_t)(f) >> 2)) & CACHE_MASK)
+#define CACHE_ADDRESS(i)    (LCD_FONT_CACHE_ADDRESS + (uint32_t)(i) * LCD_FONT_CACHE_SLOT)
+#define CACHE_LARGE_ADDRESS (LCD_FONT_CACHE_ADDRESS + LCD_FONT_CACHE_SLOTS * LCD_FONT_CACHE_SLOT)
+
+/**
+  * @brief  缓存块，按字体和字符编码散列查找，另以双向链表按使用先后排列
+  */
+typedef struct
+{
+  const sFONT *Font;      /* NULL表示空闲 */
+  uint32_t     Char;
+  uint32_t     Fence;     /* 最后一条读取该块的DMA2D命令 */
+  uint16_t     Size;      /* 字模字节数 */
+  uint16_t     Chain;     /* 同一散列桶中的下一块 */
+  uint16_t     Prev;      /* 较新的一块 */
+  uint16_t     Next;      /* 较旧的一块 */
+}LCD_FontCacheEntryTypeDef;
+
+static LCD_FontCacheEntryTypeDef CacheEntry[LCD_FONT_CACHE_SLOTS];
+static uint16_t                  CacheBucket[LCD_FONT_CACHE_BUCKETS];
+static uint16_t                  CacheHead = CACHE_NIL;   /* 最近使用的块，为CACHE_NIL时尚未初始化 */
+static uint16_t                  CacheTail = CACHE_NIL;   /* 最久未使用的块，下一个被替换 */
+static uint32_t                  LargeFence[2];           /* 临时区两半各自最后一条读取它的DMA2D命令 */
+static uint32_t                  LargeNext = 0;
+static uint32_t                  *pLastFence = NULL;      /* 上次返回的字模的栅栏，下次调用时绘制命令已提交 */
+static LCD_FontCacheStatsTypeDef CacheStats;
+
+static const LCD_GlyphTypeDef *FONT_Find(const sFONT *pFont, uint32_t Char);
+static void FONT_CacheReset(void);
+static void FONT_CacheTouch(uint16_t Index);
+static void FONT_CacheUnlink(uint16_t Index);
+
+/**
+  * @brief  查找字符的字模信息
+  * @param  pFont: 字体
+  * @param  Char: 字符编码，字体中没有的字符用'?'代替
+  * @retval 字模信息，字体中既没有该字符也没有'?'时返回NULL
+  */
+const LCD_GlyphTypeDef *LCD_Font_GetGlyph(const sFONT *pFont, uint32_t Char)
+{
+  const LCD_GlyphTypeDef *glyph = FONT_Find(pFont, Char);
+
+  if(glyph == NULL)
+  {
+    glyph = FONT_Find(pFont, '?');
+  }
+  return glyph;
+}
+
+/**
+  * @brief  获取字符的A8字模地址，未缓存时从字体点阵展开到SDRAM
+  * @note   返回的字模每行Width个字节，可直接作为DMA2D的A8前景；地址在下次调用前有效，
+  *         之后该块可能被替换，替换前等待最后读取它的DMA2D命令完成
+  * @param  pFont: 字体
+  * @param  Char: 字符编码
+  * @retval 字模地址，空白字符或字模大于临时区的一半时返回0
+  */
+uint32_t LCD_Font_GetGlyphA8(const sFONT *pFont, uint32_t Char)
+{
+  const LCD_GlyphTypeDef *glyph;
+  LCD_FontCacheEntryTypeDef *entry;
+  uint16_t *bucket;
+  uint32_t size, address;
+  uint16_t index;
+
+  /* 上次返回的字模已经交给DMA2D，记下读取它的最后一条命令 */
+  if(pLastFence != NULL)
+  {
+    *pLastFence = LCD_DMA2D_Fence();
+    pLastFence  = NULL;
+  }
+  if(CacheHead == CACHE_NIL)
+  {
+    FONT_CacheReset();
+  }
+
+  bucket = &CacheBucket[CACHE_HASH(pFont, Char)];
+  for(index = *bucket; index != CACHE_NIL; index = CacheEntry[index].Chain)
+  {
+    entry = &CacheEntry[index];
+    if((entry->Font == pFont) && (entry->Char == Char))
+    {
+      CacheStats.Hits++;
+      FONT_CacheTouch(index);
+      pLastFence = &entry->Fence;
+      return CACHE_ADDRESS(index);
+    }
+  }
+
+  glyph = LCD_Font_GetGlyph(pFont, Char);
+  if((glyph == NULL) || (glyph->Width == 0U) || (glyph->Height == 0U))
+  {
+    return 0;
+  }
+  CacheStats.Misses++;
+
+  /* 大字模不进缓存，在临时区的两半中交替展开 */
+  size = (uint32_t)glyph->Width * glyph->Height;
+  if(size > LCD_FONT_CACHE_SLOT)
+  {
+    if(size > (LCD_FONT_CACHE_LARGE / 2U))
+    {
+      return 0;
+    }
+    CacheStats.Large++;
+    LargeNext ^= 1U;
+    LCD_DMA2D_Wait(LargeFence[LargeNext]);
+    address = CACHE_LARGE_ADDRESS + LargeNext * (LCD_FONT_CACHE_LARGE / 2U);
+    LCD_Font_Decode(pFont, glyph, (uint8_t *)(uintptr_t)address);
+    pLastFence = &LargeFence[LargeNext];
+    return address;
+  }
+
+  /* 替换最久未使用的块 */
+  index = CacheTail;
+  entry = &CacheEntry[index];
+  if(entry->Font != NULL)
+  {
+    FONT_CacheUnlink(index);
+    CacheStats.Evictions++;
+    CacheStats.BytesUsed -= entry->Size;
+    LCD_DMA2D_Wait(entry->Fence);
+  }
+  LCD_Font_Decode(pFont, glyph, (uint8_t *)(uintptr_t)CACHE_ADDRESS(index));
+
+  entry->Font  = pFont;
+  entry->Char  = Char;
+  entry->Size  = (uint16_t)size;
+  entry->Chain = *bucket;
+  *bucket = index;
+  CacheStats.BytesUsed += size;
+  FONT_CacheTouch(index);
+  pLastFence = &entry->Fence;
+
+  return CACHE_ADDRESS(index);
+}
+
+/**
+  * @brief  查找两个相邻字符之间的字距调整
+  * @param  pFont: 字体
+  * @param  Left: 左边字符的编码，0表示行首
+  * @param  Right: 右边字符的编码
+  * @retval 加到笔位置上的像素数
+  */
+int32_t LCD_Font_GetKerning(const sFONT *pFont, uint32_t Left, uint32_t Right)
+{
+  const LCD_KernTypeDef *kern = pFont->Kerning;
+  uint32_t key = (Left << 16) | Right;
+  uint32_t lo = 0;
+  uint32_t hi = pFont->KernCount;
+  uint32_t mid, pair;
+
+  if((kern == NULL) || (Left == 0U) || (Left > 0xFFFFU) || (Right > 0xFFFFU))
+  {
+    return 0;
+  }
+  while(lo < hi)
+  {
+    mid  = (lo + hi) / 2U;
+    pair = ((uint32_t)kern[mid].Left << 16) | kern[mid].Right;
+    if(pair == key)
+    {
+      return kern[mid].Adjust;
+    }
+    if(pair < key)
+    {
+      lo = mid + 1U;
+    }
+    else
+    {
+      hi = mid;
+    }
+  }
+  return 0;
+}
+
+/**
+  * @brief  从UTF-8字符串中取出一个字符
+  * @note   非法、过长或被截断的编码序列返回U+FFFD，并从下一个字节继续
+  * @param  pText: 字符串指针，返回时指向下一个字符；遇到结尾的0时不移动
+  * @retval 字符编码，0表示字符串结束
+  */
+uint32_t LCD_Font_DecodeUTF8(const uint8_t **pText)
+{
+  const uint8_t *p = *pText;
+  uint32_t code = p[0];
+  uint32_t count, min, i;
+
+  if(code < 0x80U)
+  {
+    if(code != 0U)
+    {
+      *pText = p + 1;
+    }
+    return code;
+  }
+
+  if((code & 0xE0U) == 0xC0U)
+  {
+    count = 1;
+    min   = 0x80;
+    code &= 0x1FU;
+  }
+  else if((code & 0xF0U) == 0xE0U)
+  {
+    count = 2;
+    min   = 0x800;
+    code &= 0x0FU;
+  }
+  else if((code & 0xF8U) == 0xF0U)
+  {
+    count = 3;
+    min   = 0x10000;
+    code &= 0x07U;
+  }
+  else
+  {
+    *pText = p + 1;
+    return 0xFFFD;
+  }
+
+  for(i = 1; i <= count; i++)
+  {
+    if((p[i] & 0xC0U) != 0x80U)
+    {
+      *pText = p + i;
+      return 0xFFFD;
+    }
+    code = (code << 6) | (p[i] & 0x3FU);
+  }
+  *pText = p + count + 1U;
+
+  if((code < min) || (code > 0x10FFFFU) || ((code >= 0xD800U) && (code <= 0xDFFFU)))
+  {
+    return 0xFFFD;
+  }
+  return code;
+}
+
+/**
+  * @brief  把一个字模展开为A8格式，A4的每个4位值乘17扩展到0~255
+  * @note   LCD_FONT_RLE格式按行扫描顺序对每个像素与正上方像素的差(A4模16，A8模256，
+  *         第一行与0相比)编码，每个记号一个字节：
+  *         0x00~0x7F: 随后T+1个像素的差为0，即与上一行相同
+  *         0x80~0xFF: 随后(T&0x7F)+1个差值直接给出，A4每字节两个、高4位在前，A8每字节一个
+  *         汉字笔画多为横竖线，竖画和横画内部的行与上一行相同，大部分差值为0
+  * @param  pFont: 字体
+  * @param  pGlyph: 字模信息
+  * @param  pDst: 输出，Width×Height字节
+  * @retval 无
+  */
+void LCD_Font_Decode(const sFONT *pFont, const LCD_GlyphTypeDef *pGlyph, uint8_t *pDst)
+{
+  const uint8_t *src = pFont->table + pGlyph->Offset;
+  uint32_t width = pGlyph->Width;
+  uint32_t size = width * pGlyph->Height;
+  uint32_t stride, token, delta, above, count, i, k, x, y;
+
+  if(pFont->Encoding == LCD_FONT_RLE)
+  {
+    i = 0;
+    while(i < size)
+    {
+      token = *src++;
+      count = (token & 0x7FU) + 1U;
+      if(count > (size - i))
+      {
+        count = size - i;
+      }
+
+      if(token < 0x80U)
+      {
+        for(k = 0; k < count; k++, i++)
+        {
+          pDst[i] = (i < width) ? 0U : pDst[i - width];
+        }
+      }
+      else if(pFont->Bpp == 4U)
+      {
+        for(k = 0; k < count; k++, i++)
+        {
+          above = (i < width) ? 0U : (uint32_t)(pDst[i - width] >> 4);
+          delta = (k & 1U) ? (src[k >> 1] & 0x0FU) : (src[k >> 1] >> 4);
+          pDst[i] = (uint8_t)(((above + delta) & 0x0FU) * 17U);
+        }
+        src += (count + 1U) / 2U;
+      }
+      else
+      {
+        for(k = 0; k < count; k++, i++)
+        {
+          above = (i < width) ? 0U : pDst[i - width];
+          pDst[i] = (uint8_t)(above + src[k]);
+        }
+        src += count;
+      }
+    }
+  }
+  else if(pFont->Bpp == 4U)
+  {
+    stride = (width + 1U) / 2U;
+    for(y = 0; y < pGlyph->Height; y++)
+    {
+      for(x = 0; x < width; x++)
+      {
+        *pDst++ = ((x & 1U) ? (src[x >> 1] & 0x0F) : (src[x >> 1] >> 4)) * 17U;
+      }
+      src += stride;
+    }
+  }
+  else
+  {
+    for(i = 0; i < size; i++)
+    {
+      pDst[i] = src[i];
+    }
+  }
+}
+
+/**
+  * @brief  计算UTF-8字符串的像素宽度，包括字距调整
+  * @param  pFont: 字体
+  * @param  Text: 以0结尾的字符串
+  * @retval 宽度
+  */
+uint32_t LCD_Font_GetStringWidth(const sFONT *pFont, const uint8_t *Text)
+{
+  const LCD_GlyphTypeDef *glyph;
+  int32_t width = 0;
+  uint32_t code, prev = 0;
+
+  while((code = LCD_Font_DecodeUTF8(&Text)) != 0U)
+  {
+    glyph = LCD_Font_GetGlyph(pFont, code);
+    if(glyph != NULL)
+    {
+      width += LCD_Font_GetKerning(pFont, prev, code) + glyph->Advance;
+      prev = code;
+    }
+  }
+  return (width > 0) ? (uint32_t)width : 0U;
+}
+
+/**
+  * @brief  清空字模缓存
+  * @note   先等待DMA2D完成，避免正在读取的字模被覆盖
+  * @retval 无
+  */
+void LCD_Font_CacheFlush(void)
+{
+  LCD_DMA2D_Flush();
+  FONT_CacheReset();
+}
+
+/**
+  * @brief  读取字模缓存统计
+  * @param  pStats: 输出统计数据
+  * @retval 无
+  */
+void LCD_Font_GetCacheStats(LCD_FontCacheStatsTypeDef *pStats)
+{
+  uint32_t total = CacheStats.Hits + CacheStats.Misses;
+
+  *pStats = CacheStats;
+  pStats->HitRate = (total != 0U) ? (uint32_t)(((uint64_t)CacheStats.Hits * 1000U) / total) : 0U;
+}
+
+/**
+  * @brief  清除字模缓存统计，不影响已缓存的字模
+  * @retval 无
+  */
+void LCD_Font_ResetCacheStats(void)
+{
+  CacheStats.Hits      = 0;
+  CacheStats.Misses    = 0;
+  CacheStats.Evictions = 0;
+  CacheStats.Large     = 0;
+}
+
+/**
+  * @brief  在字体中查找字符，不代替缺少的字符
+  * @param  pFont: 字体
+  * @param  Char: 字符编码
+  * @retval 字模信息，没有时返回NULL
+  */
+static const LCD_GlyphTypeDef *FONT_Find(const sFONT *pFont, uint32_t Char)
+{
+  uint32_t lo = 0;
+  uint32_t hi = pFont->GlyphCount;
+  uint32_t mid;
+
+  if(pFont->Codes == NULL)
+  {
+    if((Char < pFont->FirstChar) || (Char >= (uint32_t)(pFont->FirstChar + pFont->GlyphCount)))
+    {
+      return NULL;
+    }
+    return &pFont->Glyphs[Char - pFont->FirstChar];
+  }
+
+  /* 稀疏字体按编码二分查找 */
+  while(lo < hi)
+  {
+    mid = (lo + hi) / 2U;
+    if(pFont->Codes[mid] < Char)
+    {
+      lo = mid + 1U;
+    }
+    else
+    {
+      hi = mid;
+    }
+  }
+  if((lo < pFont->GlyphCount) && (pFont->Codes[lo] == Char))
+  {
+    return &pFont->Glyphs[lo];
+  }
+  return NULL;
+}
+
+/**
+  * @brief  清空散列表，所有块按编号串成LRU链表
+  * @retval 无
+  */
+static void FONT_CacheReset(void)
+{
+  uint32_t i;
+
+  for(i = 0; i < LCD_FONT_CACHE_BUCKETS; i++)
+  {
+    CacheBucket[i] = CACHE_NIL;
+  }
+  for(i = 0; i < LCD_FONT_CACHE_SLOTS; i++)
+  {
+    CacheEntry[i].Font  = NULL;
+    CacheEntry[i].Fence = 0;
+    CacheEntry[i].Prev  = (i == 0U) ? CACHE_NIL : (uint16_t)(i - 1U);
+    CacheEntry[i].Next  = (i == (LCD_FONT_CACHE_SLOTS - 1U)) ? CACHE_NIL : (uint16_t)(i + 1U);
+  }
+  CacheHead  = 0;
+  CacheTail  = (uint16_t)(LCD_FONT_CACHE_SLOTS - 1U);
+  pLastFence = NULL;
+  CacheStats.BytesUsed = 0;
+}
+
+/**
+  * @brief  把块移到LRU链表头部
+  * @param  Index: 块编号
+  * @retval 无
+  */
+static void FONT_CacheTouch(uint16_t Index)
+{
+  LCD_FontCacheEntryTypeDef *entry = &CacheEntry[Index];
+
+  if(Index == CacheHead)
+  {
+    return;
+  }
+
+  CacheEntry[entry->Prev].Next = entry->Next;
+  if(entry->Next != CACHE_NIL)
+  {
+    CacheEntry[entry->Next].Prev = entry->Prev;
+  }
+  else
+  {
+    CacheTail = entry->Prev;
+  }
+
+  entry->Prev = CACHE_NIL;
+  entry->Next = CacheHead;
+  CacheEntry[CacheHead].Prev = Index;
+  CacheHead = Index;
+}
+
+/**
+  * @brief  把块从所在的散列桶中摘下
+  * @param  Index: 块编号
+  * @retval 无
+  */
+static void FONT_CacheUnlink(uint16_t Index)
+{
+  LCD_FontCacheEntryTypeDef *entry = &CacheEntry[Index];
+  uint16_t *link = &CacheBucket[CACHE_HASH(entry->Font, entry->Char)];
+
+  while(*link != Index)
+  {
+    link = &CacheEntry[*link].Chain;
+  }
+  *link = entry->Chain;
+}
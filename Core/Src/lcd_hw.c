@@ -0,0 +1,479 @@
+#include "lcd_backend.h"
+#include "dma2d.h"
+#include "jpeg.h"
+#include "lcd_jpeg.h"
+
+extern LTDC_HandleTypeDef hltdc;
+extern DMA2D_HandleTypeDef hdma2d;
+
+#define Ltdc_Handler hltdc
+#define Dma2d_Handler hdma2d
+
+static HAL_StatusTypeDef HW_ConfigLayer(LTDC_LayerCfgTypeDef *pLayerCfg, uint32_t LayerIndex, uint32_t Reload);
+static void HW_EnableLayer(uint32_t LayerIndex, FunctionalState State, uint32_t Reload);
+static HAL_StatusTypeDef HW_ConfigCLUT(uint32_t *pCLUT, uint32_t Count, uint32_t LayerIndex);
+static void HW_ColorKey(uint32_t LayerIndex, FunctionalState State, uint32_t RGBValue);
+static void HW_Reload(uint32_t Reload);
+static uint32_t HW_ReloadPending(void);
+static void HW_Display(FunctionalState State);
+static uint32_t HW_GetLine(void);
+static void HW_LineEvent(uint32_t Line);
+static void HW_Idle(void);
+static void HW_Dma2dInit(void);
+static HAL_StatusTypeDef HW_Dma2dStart(const LCD_DMA2D_CmdTypeDef *pCmd);
+static void HW_Dma2dPoll(void);
+static void HW_XferCplt(DMA2D_HandleTypeDef *hdma2d);
+static void HW_XferError(DMA2D_HandleTypeDef *hdma2d);
+static void HW_JpegInit(void);
+static HAL_StatusTypeDef HW_JpegStart(uint8_t *pIn, uint32_t InLength, uint8_t *pOut, uint32_t OutLength);
+static void HW_JpegInput(uint8_t *pIn, uint32_t Length);
+static void HW_JpegOutput(uint8_t *pOut, uint32_t Length);
+static void HW_JpegPause(uint32_t Direction);
+static void HW_JpegResume(uint32_t Direction);
+static void HW_JpegAbort(void);
+
+/**
+  * @brief  LTDC/DMA2D硬件后端
+  */
+const LCD_BackendTypeDef LCD_HardwareBackend =
+{
+  "hardware",
+  HW_ConfigLayer,
+  HW_EnableLayer,
+  HW_ConfigCLUT,
+  HW_ColorKey,
+  HW_Reload,
+  HW_ReloadPending,
+  HW_Display,
+  HW_GetLine,
+  HW_LineEvent,
+  HW_Idle,
+  HW_Dma2dInit,
+  HW_Dma2dStart,
+  HW_Dma2dPoll,
+};
+
+/**
+  * @brief  JPEG硬件编解码器，以中断方式搬运FIFO
+  */
+const LCD_JPEG_CodecTypeDef LCD_JPEG_HardwareCodec =
+{
+  "hardware",
+  HW_JpegInit,
+  HW_JpegStart,
+  HW_JpegInput,
+  HW_JpegOutput,
+  HW_JpegPause,
+  HW_JpegResume,
+  HW_JpegAbort,
+  HW_Idle,
+};
+
+/**
+  * @brief  写入层参数
+  * @param  pLayerCfg: 层参数
+  * @param  LayerIndex: 前景层(层1)或者背景层(层0)
+  * @param  Reload: LCD_RELOAD_NONE/LCD_RELOAD_IMMEDIATE/LCD_RELOAD_VBLANK
+  * @retval HAL状态
+  */
+static HAL_StatusTypeDef HW_ConfigLayer(LTDC_LayerCfgTypeDef *pLayerCfg, uint32_t LayerIndex, uint32_t Reload)
+{
+  HAL_StatusTypeDef status;
+
+  if(Reload == LCD_RELOAD_IMMEDIATE)
+  {
+    return HAL_LTDC_ConfigLayer(&Ltdc_Handler, pLayerCfg, LayerIndex);
+  }
+
+  status = HAL_LTDC_ConfigLayer_NoReload(&Ltdc_Handler, pLayerCfg, LayerIndex);
+  if((status == HAL_OK) && (Reload == LCD_RELOAD_VBLANK))
+  {
+    status = HAL_LTDC_Reload(&Ltdc_Handler, LTDC_RELOAD_VERTICAL_BLANKING);
+  }
+  return status;
+}
+
+/**
+  * @brief  打开或关闭层
+  * @param  LayerIndex: 前景层(层1)或者背景层(层0)
+  * @param  State: 禁能或者使能
+  * @param  Reload: LCD_RELOAD_NONE/LCD_RELOAD_IMMEDIATE/LCD_RELOAD_VBLANK
+  * @retval 无
+  */
+static void HW_EnableLayer(uint32_t LayerIndex, FunctionalState State, uint32_t Reload)
+{
+  if(State == ENABLE)
+  {
+    __HAL_LTDC_LAYER_ENABLE(&Ltdc_Handler, LayerIndex);
+  }
+  else
+  {
+    __HAL_LTDC_LAYER_DISABLE(&Ltdc_Handler, LayerIndex);
+  }
+  HW_Reload(Reload);
+}
+
+/**
+  * @brief  加载层的CLUT并使能
+  * @param  pCLUT: CLUT，RGB888
+  * @param  Count: 项数
+  * @param  LayerIndex: 前景层(层1)或者背景层(层0)
+  * @retval HAL状态
+  */
+static HAL_StatusTypeDef HW_ConfigCLUT(uint32_t *pCLUT, uint32_t Count, uint32_t LayerIndex)
+{
+  if(HAL_LTDC_ConfigCLUT(&Ltdc_Handler, pCLUT, Count, LayerIndex) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+  return HAL_LTDC_EnableCLUT(&Ltdc_Handler, LayerIndex);
+}
+
+/**
+  * @brief  设置层的色键，在下一次重载时生效
+  * @param  LayerIndex: 前景层(层1)或者背景层(层0)
+  * @param  State: 禁能或者使能
+  * @param  RGBValue: RGB888色键
+  * @retval 无
+  */
+static void HW_ColorKey(uint32_t LayerIndex, FunctionalState State, uint32_t RGBValue)
+{
+  if(State == ENABLE)
+  {
+    HAL_LTDC_ConfigColorKeying_NoReload(&Ltdc_Handler, RGBValue, LayerIndex);
+    HAL_LTDC_EnableColorKeying_NoReload(&Ltdc_Handler, LayerIndex);
+  }
+  else
+  {
+    HAL_LTDC_DisableColorKeying_NoReload(&Ltdc_Handler, LayerIndex);
+  }
+}
+
+/**
+  * @brief  使写入的层参数生效
+  * @note   立即重载不产生中断，垂直消隐重载生效后调用HAL_LTDC_ReloadEventCallback
+  * @param  Reload: LCD_RELOAD_NONE/LCD_RELOAD_IMMEDIATE/LCD_RELOAD_VBLANK
+  * @retval 无
+  */
+static void HW_Reload(uint32_t Reload)
+{
+  if(Reload == LCD_RELOAD_IMMEDIATE)
+  {
+    __HAL_LTDC_RELOAD_CONFIG(&Ltdc_Handler);
+  }
+  else if(Reload == LCD_RELOAD_VBLANK)
+  {
+    HAL_LTDC_Reload(&Ltdc_Handler, LTDC_RELOAD_VERTICAL_BLANKING);
+  }
+}
+
+/**
+  * @brief  查询垂直消隐重载是否尚未生效
+  * @retval 1: 尚未生效 0: 已生效
+  */
+static uint32_t HW_ReloadPending(void)
+{
+  return ((Ltdc_Handler.Instance->SRCR & LTDC_SRCR_VBR) != 0U) ? 1U : 0U;
+}
+
+/**
+  * @brief  开关显示和背光
+  * @param  State: 禁能或者使能
+  * @retval 无
+  */
+static void HW_Display(FunctionalState State)
+{
+  if(State == ENABLE)
+  {
+    __HAL_LTDC_ENABLE(&Ltdc_Handler);
+    HAL_GPIO_WritePin(LTDC_BL_GPIO_PIN_GPIO_Port, LTDC_BL_GPIO_PIN_Pin, GPIO_PIN_SET);  /* 开背光*/
+  }
+  else
+  {
+    __HAL_LTDC_DISABLE(&Ltdc_Handler);
+    HAL_GPIO_WritePin(LTDC_BL_GPIO_PIN_GPIO_Port, LTDC_BL_GPIO_PIN_Pin, GPIO_PIN_RESET);/*关背光*/
+  }
+}
+
+/**
+  * @brief  读取LTDC当前扫描的行
+  * @retval 行计数值
+  */
+static uint32_t HW_GetLine(void)
+{
+  return Ltdc_Handler.Instance->CPSR & LTDC_CPSR_CYPOS;
+}
+
+/**
+  * @brief  设置行中断，到达后调用HAL_LTDC_LineEventCallback
+  * @param  Line: 行计数值
+  * @retval 无
+  */
+static void HW_LineEvent(uint32_t Line)
+{
+  HAL_LTDC_ProgramLineEvent(&Ltdc_Handler, Line);
+}
+
+/**
+  * @brief  忙等待，硬件上由中断推进，无需处理
+  * @retval 无
+  */
+static void HW_Idle(void)
+{
+}
+
+/**
+  * @brief  设置DMA2D句柄的回调，必须在MX_DMA2D_Init之后调用
+  * @retval 无
+  */
+static void HW_Dma2dInit(void)
+{
+  Dma2d_Handler.XferCpltCallback  = HW_XferCplt;
+  Dma2d_Handler.XferErrorCallback = HW_XferError;
+}
+
+/**
+  * @brief  配置DMA2D并以中断方式启动一条命令
+  * @param  pCmd: 命令
+  * @retval HAL状态
+  */
+static HAL_StatusTypeDef HW_Dma2dStart(const LCD_DMA2D_CmdTypeDef *pCmd)
+{
+  DMA2D_CLUTCfgTypeDef clut;
+
+  /* CLUT加载不使用输出配置，完成后进入HAL_DMA2D_CLUTLoadingCpltCallback */
+  if(pCmd->Mode == LCD_DMA2D_CLUT_LOAD)
+  {
+    clut.pCLUT         = (uint32_t *)pCmd->FgAddress;
+    clut.CLUTColorMode = pCmd->FgColorMode;
+    clut.Size          = pCmd->Width - 1U;
+    DMA2D_ConfigCLUT(DMA2D_FOREGROUND_LAYER, clut.CLUTColorMode, clut.Size);
+    return HAL_DMA2D_CLUTStartLoad_IT(&Dma2d_Handler, &clut, DMA2D_FOREGROUND_LAYER);
+  }
+
+  /* 只写入与上一条命令不同的寄存器，代替HAL_DMA2D_Init/HAL_DMA2D_ConfigLayer */
+  DMA2D_ConfigOutput(pCmd->Mode, pCmd->OutColorMode, pCmd->OutOffset);
+
+  /* 寄存器到存储器模式不使用前景层和背景层 */
+  if(pCmd->Mode == DMA2D_R2M)
+  {
+    return HAL_DMA2D_Start_IT(&Dma2d_Handler, pCmd->FgAddress, pCmd->DstAddress, pCmd->Width, pCmd->Height);
+  }
+
+  /* 前景层配置 */
+  DMA2D_ConfigInput(DMA2D_FOREGROUND_LAYER, pCmd->FgColorMode, pCmd->FgOffset, pCmd->FgAlphaMode, pCmd->FgAlpha);
+
+  if(pCmd->Mode == DMA2D_M2M_BLEND)
+  {
+    /* 背景层配置 */
+    DMA2D_ConfigInput(DMA2D_BACKGROUND_LAYER, pCmd->BgColorMode, pCmd->BgOffset, pCmd->BgAlphaMode, pCmd->BgAlpha);
+    return HAL_DMA2D_BlendingStart_IT(&Dma2d_Handler, pCmd->FgAddress, pCmd->BgAddress, pCmd->DstAddress, pCmd->Width, pCmd->Height);
+  }
+
+  return HAL_DMA2D_Start_IT(&Dma2d_Handler, pCmd->FgAddress, pCmd->DstAddress, pCmd->Width, pCmd->Height);
+}
+
+/**
+  * @brief  中断被屏蔽时处理DMA2D中断标志
+  * @retval 无
+  */
+static void HW_Dma2dPoll(void)
+{
+  HAL_DMA2D_IRQHandler(&Dma2d_Handler);
+}
+
+/**
+  * @brief  DMA2D传输完成回调
+  * @param  hdma2d: DMA2D句柄
+  * @retval 无
+  */
+static void HW_XferCplt(DMA2D_HandleTypeDef *hdma2d)
+{
+  UNUSED(hdma2d);
+
+  LCD_DMA2D_Complete(0);
+}
+
+/**
+  * @brief  CLUT加载完成回调，与传输完成相同
+  * @param  hdma2d: DMA2D句柄
+  * @retval 无
+  */
+void HAL_DMA2D_CLUTLoadingCpltCallback(DMA2D_HandleTypeDef *hdma2d)
+{
+  HW_XferCplt(hdma2d);
+}
+
+/**
+  * @brief  DMA2D传输错误回调，丢弃当前命令后继续执行
+  * @param  hdma2d: DMA2D句柄
+  * @retval 无
+  */
+static void HW_XferError(DMA2D_HandleTypeDef *hdma2d)
+{
+  UNUSED(hdma2d);
+
+  LCD_DMA2D_Complete(1);
+}
+
+/**
+  * @brief  JPEG编解码器由MX_JPEG_Init初始化，这里无需处理
+  * @retval 无
+  */
+static void HW_JpegInit(void)
+{
+}
+
+/**
+  * @brief  以中断方式开始解码
+  * @param  pIn, InLength: 第一块输入
+  * @param  pOut, OutLength: 第一块输出缓冲区
+  * @retval HAL状态
+  */
+static HAL_StatusTypeDef HW_JpegStart(uint8_t *pIn, uint32_t InLength, uint8_t *pOut, uint32_t OutLength)
+{
+  return HAL_JPEG_Decode_IT(&hjpeg, pIn, InLength, pOut, OutLength);
+}
+
+/**
+  * @brief  设置下一块输入
+  * @param  pIn: 输入数据
+  * @param  Length: 字节数，0表示没有更多数据
+  * @retval 无
+  */
+static void HW_JpegInput(uint8_t *pIn, uint32_t Length)
+{
+  HAL_JPEG_ConfigInputBuffer(&hjpeg, pIn, Length);
+}
+
+/**
+  * @brief  设置下一块输出缓冲区
+  * @param  pOut: 输出缓冲区
+  * @param  Length: 字节数
+  * @retval 无
+  */
+static void HW_JpegOutput(uint8_t *pOut, uint32_t Length)
+{
+  HAL_JPEG_ConfigOutputBuffer(&hjpeg, pOut, Length);
+}
+
+/**
+  * @brief  暂停输入或输出FIFO的搬运
+  * @param  Direction: LCD_JPEG_INPUT/LCD_JPEG_OUTPUT
+  * @retval 无
+  */
+static void HW_JpegPause(uint32_t Direction)
+{
+  HAL_JPEG_Pause(&hjpeg, Direction);
+}
+
+/**
+  * @brief  恢复输入或输出FIFO的搬运
+  * @param  Direction: LCD_JPEG_INPUT/LCD_JPEG_OUTPUT
+  * @retval 无
+  */
+static void HW_JpegResume(uint32_t Direction)
+{
+  HAL_JPEG_Resume(&hjpeg, Direction);
+}
+
+/**
+  * @brief  中止解码
+  * @retval 无
+  */
+static void HW_JpegAbort(void)
+{
+  HAL_JPEG_Abort(&hjpeg);
+}
+
+/**
+  * @brief  文件头解析完成回调
+  * @param  hjpeg: JPEG句柄
+  * @param  pInfo: 图像信息
+  * @retval 无
+  */
+void HAL_JPEG_InfoReadyCallback(JPEG_HandleTypeDef *hjpeg, JPEG_ConfTypeDef *pInfo)
+{
+  LCD_JPEG_InfoTypeDef info;
+
+  UNUSED(hjpeg);
+
+  info.Width  = pInfo->ImageWidth;
+  info.Height = pInfo->ImageHeight;
+  if(pInfo->ColorSpace == JPEG_GRAYSCALE_COLORSPACE)
+  {
+    info.ColorSpace = LCD_JPEG_GRAYSCALE;
+  }
+  else if(pInfo->ColorSpace == JPEG_CMYK_COLORSPACE)
+  {
+    info.ColorSpace = LCD_JPEG_CMYK;
+  }
+  else
+  {
+    info.ColorSpace = LCD_JPEG_YCBCR;
+  }
+  if(pInfo->ChromaSubsampling == JPEG_420_SUBSAMPLING)
+  {
+    info.ChromaSubsampling = LCD_JPEG_420;
+  }
+  else if(pInfo->ChromaSubsampling == JPEG_422_SUBSAMPLING)
+  {
+    info.ChromaSubsampling = LCD_JPEG_422;
+  }
+  else
+  {
+    info.ChromaSubsampling = LCD_JPEG_444;
+  }
+  LCD_JPEG_InfoReady(&info);
+}
+
+/**
+  * @brief  输入缓冲区读完回调
+  * @param  hjpeg: JPEG句柄
+  * @param  NbDecodedData: 读取的字节数
+  * @retval 无
+  */
+void HAL_JPEG_GetDataCallback(JPEG_HandleTypeDef *hjpeg, uint32_t NbDecodedData)
+{
+  UNUSED(hjpeg);
+
+  LCD_JPEG_GetData(NbDecodedData);
+}
+
+/**
+  * @brief  输出缓冲区写满回调
+  * @param  hjpeg: JPEG句柄
+  * @param  pDataOut: 输出数据
+  * @param  OutDataLength: 字节数
+  * @retval 无
+  */
+void HAL_JPEG_DataReadyCallback(JPEG_HandleTypeDef *hjpeg, uint8_t *pDataOut, uint32_t OutDataLength)
+{
+  UNUSED(hjpeg);
+
+  LCD_JPEG_DataReady(pDataOut, OutDataLength);
+}
+
+/**
+  * @brief  解码完成回调
+  * @param  hjpeg: JPEG句柄
+  * @retval 无
+  */
+void HAL_JPEG_DecodeCpltCallback(JPEG_HandleTypeDef *hjpeg)
+{
+  UNUSED(hjpeg);
+
+  LCD_JPEG_DecodeDone(0);
+}
+
+/**
+  * @brief  解码错误回调
+  * @param  hjpeg: JPEG句柄
+  * @retval 无
+  */
+void HAL_JPEG_ErrorCallback(JPEG_HandleTypeDef *hjpeg)
+{
+  UNUSED(hjpeg);
+
+  LCD_JPEG_DecodeDone(1);
+}
@@ -0,0 +1,683 @@
+#include "lcd_jpeg.h"
+#include "lcd_display.h"
+#include "lcd_dma2d.h"
+#include "lcd_prof.h"
+#include <string.h>
+
+/* 行带宽度比LCD_JPEG_MAX_WIDTH多一个MCU，左边裁剪时行带从MCU边界开始 */
+#define JPEG_STRIP_COLS      (LCD_JPEG_MAX_WIDTH + 16U)
+#define JPEG_STRIP_SIZE      (JPEG_STRIP_COLS * 16U * 4U)
+#define JPEG_MCU_MAX_BYTES   384U
+
+/**
+  * @brief  输入或输出缓冲区，Full由生产者置位、消费者清零
+  */
+typedef struct
+{
+  uint8_t           *pData;
+  volatile uint32_t Length;
+  volatile uint32_t Full;
+}JPEG_BufferTypeDef;
+
+/**
+  * @brief  内存中的JPEG文件
+  */
+typedef struct
+{
+  const uint8_t *pData;
+  uint32_t      Size;
+  uint32_t      Offset;
+}JPEG_MemoryTypeDef;
+
+static const LCD_JPEG_CodecTypeDef *Codec = &LCD_JPEG_CODEC_DEFAULT;
+
+static uint8_t InData[2][LCD_JPEG_IN_CHUNK] __attribute__((aligned(4)));
+static uint8_t OutData[2][LCD_JPEG_OUT_CHUNK] __attribute__((aligned(4)));
+static JPEG_BufferTypeDef In[2];
+static JPEG_BufferTypeDef Out[2];
+static volatile uint32_t  InRead;       /* 解码器正在读取的输入缓冲区，只在中断中修改 */
+static volatile uint32_t  OutWrite;     /* 解码器正在写入的输出缓冲区，只在中断中修改 */
+static uint32_t           InWrite;      /* 下一块要填充的输入缓冲区 */
+static uint32_t           OutRead;      /* 下一块要转换的输出缓冲区 */
+static volatile uint32_t  InPaused;
+static volatile uint32_t  OutPaused;
+static volatile uint32_t  InfoValid;
+static volatile uint32_t  Done;
+static volatile uint32_t  Failed;
+static uint32_t           Eof;          /* 文件已读完 */
+
+static LCD_JPEG_InfoTypeDef Info;
+static uint32_t McuWidth, McuHeight, McuBytes;
+static uint32_t McusPerRow, McuTotal, McuIndex;
+static uint8_t  Partial[JPEG_MCU_MAX_BYTES] __attribute__((aligned(4)));  /* 跨越两块输出缓冲区的MCU */
+static uint32_t PartialLength;
+
+/* 当前图像在层中的位置和可见部分(图像坐标) */
+static int32_t  DrawX, DrawY;
+static int32_t  ColStart, ColEnd, RowStart, RowEnd;
+static int32_t  StripBase;             /* 行带第0列对应的图像列，按MCU对齐 */
+static uint32_t Strip;                 /* 当前转换的行带 */
+static uint32_t StripFence[2];         /* 读取对应行带的DMA2D命令 */
+
+/* YCbCr转RGB查找表，G分量为16位定点 */
+static int16_t CrR[256];
+static int16_t CbB[256];
+static int32_t CrG[256];
+static int32_t CbG[256];
+
+static LCD_JPEG_StatsTypeDef Stats;
+
+static uint32_t JPEG_Fill(LCD_JPEG_ReadTypeDef Read, void *pArg, JPEG_BufferTypeDef *pBuffer);
+static HAL_StatusTypeDef JPEG_Setup(void);
+static void JPEG_Process(const uint8_t *pData, uint32_t Length);
+static void JPEG_ProcessMCU(const uint8_t *pMcu);
+static uint32_t JPEG_ReadMemory(void *pArg, uint8_t *pBuffer, uint32_t Size);
+
+/**
+  * @brief  限制到0~255
+  * @param  Value: 值
+  * @retval 结果
+  */
+static inline uint32_t JPEG_Clamp(int32_t Value)
+{
+  if(Value < 0)
+  {
+    return 0;
+  }
+  if(Value > 255)
+  {
+    return 255;
+  }
+  return (uint32_t)Value;
+}
+
+/**
+  * @brief  初始化颜色转换表和解码器，在LCD_DMA2D_Init之后调用
+  * @retval 无
+  */
+void LCD_JPEG_Init(void)
+{
+  int32_t i, c;
+
+  /* JFIF：R = Y + 1.402Cr，G = Y - 0.34414Cb - 0.71414Cr，B = Y + 1.772Cb */
+  for(i = 0; i < 256; i++)
+  {
+    c = i - 128;
+    CrR[i] = (int16_t)((91881 * c + 32768) >> 16);
+    CbB[i] = (int16_t)((116130 * c + 32768) >> 16);
+    CrG[i] = -46802 * c;
+    CbG[i] = -22554 * c + 32768;
+  }
+
+  In[0].pData  = InData[0];
+  In[1].pData  = InData[1];
+  Out[0].pData = OutData[0];
+  Out[1].pData = OutData[1];
+  StripFence[0] = StripFence[1] = LCD_DMA2D_Fence();
+
+  Codec->Init();
+}
+
+/**
+  * @brief  切换解码器，在LCD_JPEG_Init之前调用
+  * @param  pCodec: 解码器
+  * @retval 无
+  */
+void LCD_JPEG_SetCodec(const LCD_JPEG_CodecTypeDef *pCodec)
+{
+  Codec = pCodec;
+}
+
+/**
+  * @brief  流式解码一幅JPEG图像并显示到当前层，超出层的部分被裁掉
+  * @note   文件按LCD_JPEG_IN_CHUNK分块读入，解码器按MCU输出，每解完一行MCU就由CPU转换成
+  *         ARGB8888行带，再由DMA2D转换为层的像素格式写入显存，整幅图像不会在内存中展开。
+  *         读取、颜色转换与解码器的工作交替进行；图像下边超出层后提前结束解码
+  * @param  Xpos, Ypos: 图像左上角在层中的坐标，可以为负
+  * @param  Read: 读取文件数据的函数
+  * @param  pArg: 传给Read的参数
+  * @param  pInfo: 输出图像信息，可以为NULL
+  * @retval HAL_OK: 成功 HAL_ERROR: 文件为空或解码错误 HAL_TIMEOUT: 解码器无响应
+  */
+HAL_StatusTypeDef LCD_JPEG_Draw(int16_t Xpos, int16_t Ypos, LCD_JPEG_ReadTypeDef Read, void *pArg,
+                                LCD_JPEG_InfoTypeDef *pInfo)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+  uint32_t tick, done, progress;
+
+  LCD_PROF_BEGIN(LCD_PROF_JPEG);
+
+  DrawX = Xpos;
+  DrawY = Ypos;
+  InRead = OutWrite = 0;
+  InWrite = OutRead = 0;
+  InPaused = OutPaused = 0;
+  InfoValid = Done = Failed = 0;
+  Eof = 0;
+  McuTotal = McuIndex = 0;
+  PartialLength = 0;
+  In[0].Full = In[1].Full = 0;
+  Out[0].Full = Out[1].Full = 0;
+
+  /* 先准备两块输入，解码器读完第一块时第二块已经就绪 */
+  if(JPEG_Fill(Read, pArg, &In[0]) == 0U)
+  {
+    LCD_PROF_END();
+    return HAL_ERROR;
+  }
+  JPEG_Fill(Read, pArg, &In[1]);
+
+  if(Codec->Start(In[0].pData, In[0].Length, Out[0].pData, LCD_JPEG_OUT_CHUNK) != HAL_OK)
+  {
+    Stats.Errors++;
+    LCD_PROF_END();
+    return HAL_ERROR;
+  }
+
+  tick = HAL_GetTick();
+  while(1)
+  {
+    progress = 0;
+    /* 先读取结束标志，保证最后一块输出不会被漏掉 */
+    done = Done;
+
+    /* 补充解码器已经读完的输入缓冲区 */
+    if((Eof == 0U) && (In[InWrite].Full == 0U))
+    {
+      JPEG_Fill(Read, pArg, &In[InWrite]);
+      InWrite ^= 1U;
+      if((InPaused != 0U) && (In[InRead].Full != 0U))
+      {
+        InPaused = 0;
+        Codec->Input(In[InRead].pData, In[InRead].Length);
+        Codec->Resume(LCD_JPEG_INPUT);
+      }
+      progress = 1;
+    }
+
+    /* 转换解码器交出的输出块，然后把缓冲区还给解码器 */
+    if(Out[OutRead].Full != 0U)
+    {
+      if((McuTotal == 0U) && (JPEG_Setup() != HAL_OK))
+      {
+        Codec->Abort();
+        status = HAL_ERROR;
+        break;
+      }
+      JPEG_Process(Out[OutRead].pData, Out[OutRead].Length);
+      Out[OutRead].Full = 0;
+      if(OutPaused != 0U)
+      {
+        OutPaused = 0;
+        Codec->Output(Out[OutRead].pData, LCD_JPEG_OUT_CHUNK);
+        Codec->Resume(LCD_JPEG_OUTPUT);
+      }
+      OutRead ^= 1U;
+      progress = 1;
+
+      /* 剩下的MCU行都在层的下边以外 */
+      if((McuIndex < McuTotal) && ((int32_t)((McuIndex / McusPerRow) * McuHeight) >= RowEnd))
+      {
+        Stats.McusSkipped += McuTotal - McuIndex;
+        Codec->Abort();
+        break;
+      }
+    }
+    else if(done != 0U)
+    {
+      if(Failed != 0U)
+      {
+        status = HAL_ERROR;
+      }
+      break;
+    }
+
+    if(progress != 0U)
+    {
+      tick = HAL_GetTick();
+    }
+    else if((HAL_GetTick() - tick) > LCD_JPEG_TIMEOUT)
+    {
+      Codec->Abort();
+      status = HAL_TIMEOUT;
+      break;
+    }
+    Codec->Idle();
+  }
+
+  if(status == HAL_OK)
+  {
+    Stats.Images++;
+  }
+  else
+  {
+    Stats.Errors++;
+  }
+  if((pInfo != NULL) && (InfoValid != 0U))
+  {
+    *pInfo = Info;
+  }
+  LCD_PROF_END();
+  return status;
+}
+
+/**
+  * @brief  显示内存(Flash或SDRAM)中的JPEG文件
+  * @param  Xpos, Ypos: 图像左上角在层中的坐标，可以为负
+  * @param  pData: 文件数据
+  * @param  Size: 文件大小
+  * @param  pInfo: 输出图像信息，可以为NULL
+  * @retval 同LCD_JPEG_Draw
+  */
+HAL_StatusTypeDef LCD_JPEG_DrawMemory(int16_t Xpos, int16_t Ypos, const uint8_t *pData, uint32_t Size,
+                                      LCD_JPEG_InfoTypeDef *pInfo)
+{
+  JPEG_MemoryTypeDef memory;
+
+  memory.pData  = pData;
+  memory.Size   = Size;
+  memory.Offset = 0;
+  return LCD_JPEG_Draw(Xpos, Ypos, JPEG_ReadMemory, &memory, pInfo);
+}
+
+/**
+  * @brief  把一个MCU转换为ARGB8888
+  * @note   MCU内各8x8块的顺序与JPEG编解码器的输出相同：先是全部Y块(从左到右、从上到下)，
+  *         然后是Cb块和Cr块；CMYK为C、M、Y、K四块，按Adobe的反相存储
+  * @param  pInfo: 图像信息，决定MCU的大小和排列
+  * @param  pMcu: MCU数据
+  * @param  pDst: 输出的左上角
+  * @param  Stride: 输出一行的像素数
+  * @param  Width, Height: 转换的大小，不超过MCU的大小
+  * @retval 无
+  */
+void LCD_JPEG_ConvertMCU(const LCD_JPEG_InfoTypeDef *pInfo, const uint8_t *pMcu, uint32_t *pDst,
+                         uint32_t Stride, uint32_t Width, uint32_t Height)
+{
+  const uint8_t *py, *pcb, *pcr;
+  uint32_t hshift = 0, vshift = 0, blocks = 1;
+  uint32_t x, y, i, c, k, yv;
+
+  if(pInfo->ColorSpace == LCD_JPEG_GRAYSCALE)
+  {
+    for(y = 0; y < Height; y++)
+    {
+      for(x = 0; x < Width; x++)
+      {
+        yv = pMcu[y * 8U + x];
+        pDst[x] = 0xFF000000U | (yv << 16) | (yv << 8) | yv;
+      }
+      pDst += Stride;
+    }
+    return;
+  }
+
+  if(pInfo->ColorSpace == LCD_JPEG_CMYK)
+  {
+    for(y = 0; y < Height; y++)
+    {
+      for(x = 0; x < Width; x++)
+      {
+        i = y * 8U + x;
+        k = pMcu[192U + i];
+        pDst[x] = 0xFF000000U | (((pMcu[i] * k) / 255U) << 16) |
+                  (((pMcu[64U + i] * k) / 255U) << 8) | ((pMcu[128U + i] * k) / 255U);
+      }
+      pDst += Stride;
+    }
+    return;
+  }
+
+  if(pInfo->ChromaSubsampling == LCD_JPEG_420)
+  {
+    hshift = 1;
+    vshift = 1;
+    blocks = 4;
+  }
+  else if(pInfo->ChromaSubsampling == LCD_JPEG_422)
+  {
+    hshift = 1;
+    blocks = 2;
+  }
+  pcb = pMcu + blocks * 64U;
+  pcr = pcb + 64U;
+
+  for(y = 0; y < Height; y++)
+  {
+    /* 4:2:0时上下两排Y块，4:2:2/4:2:0时左右两个Y块 */
+    py = pMcu + ((y >> 3) << hshift) * 64U + (y & 7U) * 8U;
+    c  = (y >> vshift) * 8U;
+    for(x = 0; x < Width; x++)
+    {
+      yv = py[(x >> 3) * 64U + (x & 7U)];
+      i  = c + (x >> hshift);
+      pDst[x] = 0xFF000000U |
+                (JPEG_Clamp((int32_t)yv + CrR[pcr[i]]) << 16) |
+                (JPEG_Clamp((int32_t)yv + ((CbG[pcb[i]] + CrG[pcr[i]]) >> 16)) << 8) |
+                JPEG_Clamp((int32_t)yv + CbB[pcb[i]]);
+    }
+    pDst += Stride;
+  }
+}
+
+/**
+  * @brief  读取解码统计
+  * @param  pStats: 输出统计
+  * @retval 无
+  */
+void LCD_JPEG_GetStats(LCD_JPEG_StatsTypeDef *pStats)
+{
+  *pStats = Stats;
+}
+
+/**
+  * @brief  清除解码统计
+  * @retval 无
+  */
+void LCD_JPEG_ResetStats(void)
+{
+  memset(&Stats, 0, sizeof(Stats));
+}
+
+/**
+  * @brief  解码器解析完文件头，在中断中调用
+  * @param  pInfo: 图像信息
+  * @retval 无
+  */
+void LCD_JPEG_InfoReady(const LCD_JPEG_InfoTypeDef *pInfo)
+{
+  Info = *pInfo;
+  InfoValid = 1;
+}
+
+/**
+  * @brief  解码器读完当前输入缓冲区，在中断中调用
+  * @note   另一块输入已就绪时直接交给解码器，否则暂停输入，由LCD_JPEG_Draw填充后恢复
+  * @param  Consumed: 读取的字节数
+  * @retval 无
+  */
+void LCD_JPEG_GetData(uint32_t Consumed)
+{
+  Stats.InputBytes += Consumed;
+  In[InRead].Full = 0;
+  InRead ^= 1U;
+  if(In[InRead].Full != 0U)
+  {
+    Codec->Input(In[InRead].pData, In[InRead].Length);
+  }
+  else
+  {
+    InPaused = 1;
+    Stats.InputStalls++;
+    Codec->Pause(LCD_JPEG_INPUT);
+  }
+}
+
+/**
+  * @brief  解码器写满当前输出缓冲区或解码结束，在中断中调用
+  * @note   另一块输出已转换完时直接交给解码器，否则暂停输出，由LCD_JPEG_Draw转换后恢复
+  * @param  pData: 输出数据
+  * @param  Length: 字节数
+  * @retval 无
+  */
+void LCD_JPEG_DataReady(uint8_t *pData, uint32_t Length)
+{
+  UNUSED(pData);
+
+  Stats.OutputChunks++;
+  Out[OutWrite].Length = Length;
+  Out[OutWrite].Full   = 1;
+  OutWrite ^= 1U;
+  if(Out[OutWrite].Full == 0U)
+  {
+    Codec->Output(Out[OutWrite].pData, LCD_JPEG_OUT_CHUNK);
+  }
+  else
+  {
+    OutPaused = 1;
+    Stats.OutputStalls++;
+    Codec->Pause(LCD_JPEG_OUTPUT);
+  }
+}
+
+/**
+  * @brief  解码结束，在中断中调用
+  * @param  Error: 0: 成功 1: 解码错误
+  * @retval 无
+  */
+void LCD_JPEG_DecodeDone(uint32_t Error)
+{
+  if(Error != 0U)
+  {
+    Failed = 1;
+  }
+  Done = 1;
+}
+
+/**
+  * @brief  读取一块输入，文件结束时长度为0
+  * @note   除最后一块外每块都读满；最后一块补0到4的倍数，解码器按字写入数据。
+  *         文件结束后再给出一块长度为0的输入，解码器据此停止读取
+  * @param  Read: 读取文件数据的函数
+  * @param  pArg: 传给Read的参数
+  * @param  pBuffer: 输入缓冲区
+  * @retval 读取的字节数
+  */
+static uint32_t JPEG_Fill(LCD_JPEG_ReadTypeDef Read, void *pArg, JPEG_BufferTypeDef *pBuffer)
+{
+  uint32_t length = 0;
+  uint32_t n;
+
+  while(length < LCD_JPEG_IN_CHUNK)
+  {
+    n = Read(pArg, pBuffer->pData + length, LCD_JPEG_IN_CHUNK - length);
+    if(n == 0U)
+    {
+      break;
+    }
+    length += n;
+  }
+  while((length & 3U) != 0U)
+  {
+    pBuffer->pData[length++] = 0;
+  }
+
+  if(length != 0U)
+  {
+    Stats.InputChunks++;
+  }
+  else
+  {
+    Eof = 1;
+  }
+  pBuffer->Length = length;
+  pBuffer->Full   = 1;
+  return length;
+}
+
+/**
+  * @brief  根据图像信息计算MCU大小和可见范围，在转换第一块输出前调用
+  * @retval HAL_OK: 成功 HAL_ERROR: 不支持的格式
+  */
+static HAL_StatusTypeDef JPEG_Setup(void)
+{
+  int32_t xsize = (int32_t)LCD_GetXSize();
+  int32_t ysize = (int32_t)LCD_GetYSize();
+
+  if((InfoValid == 0U) || (Info.Width == 0U) || (Info.Height == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  McuWidth  = 8;
+  McuHeight = 8;
+  if(Info.ColorSpace == LCD_JPEG_GRAYSCALE)
+  {
+    McuBytes = 64;
+  }
+  else if(Info.ColorSpace == LCD_JPEG_CMYK)
+  {
+    McuBytes = 256;
+  }
+  else if(Info.ChromaSubsampling == LCD_JPEG_420)
+  {
+    McuWidth  = 16;
+    McuHeight = 16;
+    McuBytes  = 384;
+  }
+  else if(Info.ChromaSubsampling == LCD_JPEG_422)
+  {
+    McuWidth = 16;
+    McuBytes = 256;
+  }
+  else
+  {
+    McuBytes = 192;
+  }
+  McusPerRow = (Info.Width + McuWidth - 1U) / McuWidth;
+  McuTotal   = McusPerRow * ((Info.Height + McuHeight - 1U) / McuHeight);
+
+  ColStart = (DrawX < 0) ? -DrawX : 0;
+  ColEnd   = xsize - DrawX;
+  if(ColEnd > (int32_t)Info.Width)
+  {
+    ColEnd = (int32_t)Info.Width;
+  }
+  if(ColEnd - ColStart > (int32_t)LCD_JPEG_MAX_WIDTH)
+  {
+    ColEnd = ColStart + (int32_t)LCD_JPEG_MAX_WIDTH;
+  }
+  RowStart = (DrawY < 0) ? -DrawY : 0;
+  RowEnd   = ysize - DrawY;
+  if(RowEnd > (int32_t)Info.Height)
+  {
+    RowEnd = (int32_t)Info.Height;
+  }
+  if(ColStart >= ColEnd)
+  {
+    /* 左右都不可见，所有MCU都跳过 */
+    RowEnd = 0;
+  }
+  StripBase = ColStart & ~(int32_t)(McuWidth - 1U);
+  return HAL_OK;
+}
+
+/**
+  * @brief  转换一块输出中的MCU，跨越两块输出的MCU先拼接到Partial
+  * @param  pData: 输出数据
+  * @param  Length: 字节数
+  * @retval 无
+  */
+static void JPEG_Process(const uint8_t *pData, uint32_t Length)
+{
+  uint32_t n;
+
+  if(PartialLength != 0U)
+  {
+    n = McuBytes - PartialLength;
+    if(n > Length)
+    {
+      n = Length;
+    }
+    memcpy(Partial + PartialLength, pData, n);
+    PartialLength += n;
+    pData  += n;
+    Length -= n;
+    if(PartialLength < McuBytes)
+    {
+      return;
+    }
+    JPEG_ProcessMCU(Partial);
+    PartialLength = 0;
+  }
+
+  while(Length >= McuBytes)
+  {
+    JPEG_ProcessMCU(pData);
+    pData  += McuBytes;
+    Length -= McuBytes;
+  }
+
+  if(Length != 0U)
+  {
+    memcpy(Partial, pData, Length);
+    PartialLength = Length;
+  }
+}
+
+/**
+  * @brief  转换一个MCU到当前行带，一行MCU结束时提交给DMA2D
+  * @param  pMcu: MCU数据
+  * @retval 无
+  */
+static void JPEG_ProcessMCU(const uint8_t *pMcu)
+{
+  uint32_t *strip = (uint32_t *)(uintptr_t)(LCD_JPEG_STRIP_ADDRESS + Strip * JPEG_STRIP_SIZE);
+  int32_t  x0, y0, ys, ye;
+  uint32_t column;
+
+  if(McuIndex >= McuTotal)
+  {
+    return;
+  }
+  column = McuIndex % McusPerRow;
+  x0 = (int32_t)(column * McuWidth);
+  y0 = (int32_t)((McuIndex / McusPerRow) * McuHeight);
+  McuIndex++;
+
+  ys = (y0 > RowStart) ? y0 : RowStart;
+  ye = (y0 + (int32_t)McuHeight < RowEnd) ? (y0 + (int32_t)McuHeight) : RowEnd;
+  if(ys >= ye)
+  {
+    Stats.McusSkipped++;
+    return;
+  }
+
+  /* 行首：等待DMA2D读完上一次使用这条行带的命令 */
+  if(column == 0U)
+  {
+    LCD_DMA2D_Wait(StripFence[Strip]);
+  }
+
+  if((x0 < ColEnd) && (x0 + (int32_t)McuWidth > ColStart))
+  {
+    LCD_JPEG_ConvertMCU(&Info, pMcu, strip + (x0 - StripBase), JPEG_STRIP_COLS,
+                        ((ColEnd - x0) < (int32_t)McuWidth) ? (uint32_t)(ColEnd - x0) : McuWidth,
+                        (uint32_t)(ye - y0));
+    Stats.Mcus++;
+  }
+  else
+  {
+    Stats.McusSkipped++;
+  }
+
+  if(column == McusPerRow - 1U)
+  {
+    StripFence[Strip] = LCD_BlitImage(strip + (ys - y0) * (int32_t)JPEG_STRIP_COLS + (ColStart - StripBase),
+                                      LTDC_PIXEL_FORMAT_ARGB8888, JPEG_STRIP_COLS * 4U,
+                                      (int16_t)(DrawX + ColStart), (int16_t)(DrawY + ys),
+                                      (uint16_t)(ColEnd - ColStart), (uint16_t)(ye - ys));
+    Strip ^= 1U;
+    Stats.Strips++;
+  }
+}
+
+/**
+  * @brief  从内存读取文件数据
+  * @param  pArg: JPEG_MemoryTypeDef
+  * @param  pBuffer: 输出缓冲区
+  * @param  Size: 最多读取的字节数
+  * @retval 读取的字节数
+  */
+static uint32_t JPEG_ReadMemory(void *pArg, uint8_t *pBuffer, uint32_t Size)
+{
+  JPEG_MemoryTypeDef *memory = (JPEG_MemoryTypeDef *)pArg;
+
+  if(Size > memory->Size - memory->Offset)
+  {
+    Size = memory->Size - memory->Offset;
+  }
+  memcpy(pBuffer, memory->pData + memory->Offset, Size);
+  memory->Offset += Size;
+  return Size;
+}
@@ -0,0 +1,248 @@
+#include "lcd_prof.h"
+
+#if LCD_PROFILE
+
+#include <stdio.h>
+#include <string.h>
+#if !defined(__arm__)
+#include <time.h>
+#endif
+
+static const char *const Names[LCD_PROF_COUNT] =
+{
+  "Clear", "DrawPixel", "DrawHLine", "DrawVLine", "DrawLine", "FillRect", "DrawCircle", "FillCircle",
+  "DrawRoundRect", "FillRoundRect", "DrawPolyline", "DrawPolygon", "DisplayChar", "DisplayString",
+  "BlendSpan", "BlitImage", "SwapBuffers", "DrawLineAA", "DrawArcAA", "FillCircleAA", "FillPolygonAA",
+  "Sprite_Render", "DL_Replay", "Tile", "Scan", "Window_Commit", "Canvas", "Chart_Update",
+  "JPEG_Draw"
+};
+
+static LCD_ProfFrameTypeDef Current;        /* 正在统计的帧 */
+static LCD_ProfFrameTypeDef Last;           /* 最近完成的一帧 */
+static uint32_t             Depth;          /* 当前嵌套深度 */
+static LCD_ProfIdTypeDef    Outer;          /* 最外层的函数 */
+static uint32_t             OuterStart;     /* 最外层函数开始的时间 */
+static uint32_t             StallDepth;
+static uint32_t             StallStart;
+static uint32_t             Dma2dStart;     /* 当前DMA2D命令开始的时间 */
+static uint32_t             FrameStart;
+
+/**
+  * @brief  初始化计时器：目标板上打开DWT周期计数器，主机上使用单调时钟
+  * @retval 无
+  */
+void LCD_Prof_Init(void)
+{
+#if defined(__arm__)
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->LAR = 0xC5ACCE55U;
+  DWT->CYCCNT = 0;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+
+  memset(&Current, 0, sizeof(Current));
+  memset(&Last, 0, sizeof(Last));
+  Depth      = 0;
+  StallDepth = 0;
+  FrameStart = LCD_Prof_Now();
+}
+
+/**
+  * @brief  读取当前时间
+  * @retval 目标板上为CPU周期，主机上为纳秒，32位回绕
+  */
+uint32_t LCD_Prof_Now(void)
+{
+#if defined(__arm__)
+  return DWT->CYCCNT;
+#else
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint32_t)((uint64_t)ts.tv_sec * 1000000000U + (uint64_t)ts.tv_nsec);
+#endif
+}
+
+/**
+  * @brief  每微秒的计数值，用于换算
+  * @retval 计数值
+  */
+uint32_t LCD_Prof_TicksPerUs(void)
+{
+#if defined(__arm__)
+  return SystemCoreClock / 1000000U;
+#else
+  return 1000U;
+#endif
+}
+
+/**
+  * @brief  进入一个绘图函数
+  * @note   在中断中调用时忽略，行中断等在中断中完成的绘制不计数；
+  *         每一层都计调用次数，耗时和像素只计入最外层的函数
+  * @param  Id: 函数编号
+  * @retval 无
+  */
+void LCD_Prof_Begin(LCD_ProfIdTypeDef Id)
+{
+  if(__get_IPSR() != 0U)
+  {
+    return;
+  }
+  Current.Counter[Id].Calls++;
+  if(Depth++ == 0U)
+  {
+    Outer      = Id;
+    OuterStart = LCD_Prof_Now();
+  }
+}
+
+/**
+  * @brief  离开一个绘图函数，必须与LCD_Prof_Begin成对调用
+  * @retval 无
+  */
+void LCD_Prof_End(void)
+{
+  if(__get_IPSR() != 0U)
+  {
+    return;
+  }
+  if(--Depth == 0U)
+  {
+    Current.Counter[Outer].Ticks += LCD_Prof_Now() - OuterStart;
+  }
+}
+
+/**
+  * @brief  记录写入的像素，计入最外层的函数
+  * @param  Count: 像素个数
+  * @retval 无
+  */
+void LCD_Prof_Pixels(uint32_t Count)
+{
+  if((Depth != 0U) && (__get_IPSR() == 0U))
+  {
+    Current.Counter[Outer].Pixels += Count;
+  }
+}
+
+/**
+  * @brief  DMA2D开始执行一条命令，在中断屏蔽或DMA2D中断中调用
+  * @retval 无
+  */
+void LCD_Prof_Dma2dStart(void)
+{
+  Dma2dStart = LCD_Prof_Now();
+}
+
+/**
+  * @brief  DMA2D完成一条命令，在DMA2D中断中调用
+  * @retval 无
+  */
+void LCD_Prof_Dma2dDone(void)
+{
+  Current.Dma2dBusy += LCD_Prof_Now() - Dma2dStart;
+}
+
+/**
+  * @brief  CPU开始等待
+  * @retval 无
+  */
+void LCD_Prof_StallBegin(void)
+{
+  if(__get_IPSR() != 0U)
+  {
+    return;
+  }
+  if(StallDepth++ == 0U)
+  {
+    StallStart = LCD_Prof_Now();
+  }
+}
+
+/**
+  * @brief  CPU结束等待，嵌套的等待只计入最外层
+  * @param  VSync: 0: 等待DMA2D 1: 等待垂直消隐或层重载
+  * @retval 无
+  */
+void LCD_Prof_StallEnd(uint32_t VSync)
+{
+  uint32_t ticks;
+
+  if(__get_IPSR() != 0U)
+  {
+    return;
+  }
+  if(--StallDepth == 0U)
+  {
+    ticks = LCD_Prof_Now() - StallStart;
+    if(VSync != 0U)
+    {
+      Current.VSyncStall += ticks;
+    }
+    else
+    {
+      Current.Dma2dStall += ticks;
+    }
+  }
+}
+
+/**
+  * @brief  结束一帧的统计，每LCD_PROF_REPORT_PERIOD帧输出一次
+  * @note   由LCD_SwapBuffers调用，不使用交换链的程序在每帧结束时调用；
+  *         输出报告的时间不计入下一帧
+  * @retval 无
+  */
+void LCD_Prof_FrameEnd(void)
+{
+  uint32_t now = LCD_Prof_Now();
+  uint32_t frame = Current.Frame;
+
+  Current.FrameTicks = now - FrameStart;
+  Last = Current;
+  memset(&Current, 0, sizeof(Current));
+  Current.Frame = frame + 1U;
+
+  if((LCD_PROF_REPORT_PERIOD != 0U) && (((frame + 1U) % LCD_PROF_REPORT_PERIOD) == 0U))
+  {
+    LCD_Prof_Report(&Last);
+  }
+  FrameStart = LCD_Prof_Now();
+}
+
+/**
+  * @brief  读取最近完成的一帧的统计
+  * @param  pFrame: 输出统计
+  * @retval 无
+  */
+void LCD_Prof_GetLastFrame(LCD_ProfFrameTypeDef *pFrame)
+{
+  *pFrame = Last;
+}
+
+/**
+  * @brief  通过printf(USART1)输出一帧的统计，时间换算为微秒
+  * @param  pFrame: 帧统计
+  * @retval 无
+  */
+void LCD_Prof_Report(const LCD_ProfFrameTypeDef *pFrame)
+{
+  uint32_t tpu = LCD_Prof_TicksPerUs();
+  uint32_t i;
+
+  printf("lcd frame %lu: %lu us, dma2d busy %lu us, stall dma2d %lu us, vsync %lu us\r\n",
+         (unsigned long)pFrame->Frame, (unsigned long)(pFrame->FrameTicks / tpu),
+         (unsigned long)(pFrame->Dma2dBusy / tpu), (unsigned long)(pFrame->Dma2dStall / tpu),
+         (unsigned long)(pFrame->VSyncStall / tpu));
+  for(i = 0; i < LCD_PROF_COUNT; i++)
+  {
+    if(pFrame->Counter[i].Calls != 0U)
+    {
+      printf("  %-14s %6lu calls %9lu px %8lu us\r\n", Names[i],
+             (unsigned long)pFrame->Counter[i].Calls, (unsigned long)pFrame->Counter[i].Pixels,
+             (unsigned long)(pFrame->Counter[i].Ticks / tpu));
+    }
+  }
+}
+
+#endif /* LCD_PROFILE */
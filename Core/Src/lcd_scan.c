@@ -0,0 +1,377 @@
+#include "lcd_scan.h"
+#include "lcd_display.h"
+#include "lcd_backend.h"
+#include "lcd_prof.h"
+#include <string.h>
+
+extern LTDC_HandleTypeDef hltdc;
+
+#define Ltdc_Handler hltdc
+
+/**
+  * @brief  等待扫描线经过的条带
+  */
+typedef struct
+{
+  uint16_t            Y0, Y1;      /* 更新的行范围[Y0, Y1) */
+  uint16_t            Cost;        /* 估计的更新耗时(行) */
+  uint8_t             Deferred;    /* 已统计过推迟 */
+  uint32_t            Submit;      /* 提交时的行时钟 */
+  LCD_ScanDrawTypeDef pDraw;       /* 绘制回调，为NULL时从Src复制 */
+  void                *pArg;
+  const uint8_t       *pSrc;       /* 复制源，对应(X, Y0)像素 */
+  uint32_t            SrcStride;   /* 复制源行宽(字节) */
+  uint16_t            X, Width;    /* 更新的列范围 */
+}SCAN_BandTypeDef;
+
+static LCD_ScanTimingTypeDef Timing;
+static SCAN_BandTypeDef      Queue[LCD_SCAN_QUEUE_SIZE];
+static volatile uint32_t     QueueCount;
+static uint32_t              Layer;
+static uint32_t              LastLine;
+static uint32_t              Clock;        /* 单调递增的行时钟 */
+static LCD_ScanStatsTypeDef  Stats;
+
+static uint32_t SCAN_Row(void);
+static void SCAN_Dispatch(void);
+static void SCAN_Copy(const SCAN_BandTypeDef *pBand);
+static HAL_StatusTypeDef SCAN_Submit(const SCAN_BandTypeDef *pBand, uint32_t Height, uint32_t Rows);
+
+/**
+  * @brief  按LTDC的时序初始化扫描线调度，只适用于单缓冲的层
+  * @param  LayerIndex: 要更新的层
+  * @retval HAL状态
+  */
+HAL_StatusTypeDef LCD_Scan_Init(uint32_t LayerIndex)
+{
+  LCD_ScanTimingTypeDef timing;
+
+  /* AccumulatedVBP之后的一行开始有效显示，TotalHeigh为总行数减1 */
+  timing.ActiveStart   = (uint16_t)(Ltdc_Handler.Init.AccumulatedVBP + 1U);
+  timing.ActiveHeight  = (uint16_t)(Ltdc_Handler.Init.AccumulatedActiveH - Ltdc_Handler.Init.AccumulatedVBP);
+  timing.TotalLines    = (uint16_t)(Ltdc_Handler.Init.TotalHeigh + 1U);
+  timing.PixelsPerLine = LCD_SCAN_PIXELS_PER_LINE;
+  timing.GetLine       = LCD_GetBackend()->GetLine;
+  timing.SetLineEvent  = LCD_GetBackend()->LineEvent;
+
+  if(Ltdc_Handler.LayerCfg[LayerIndex].ImageHeight > timing.ActiveHeight)
+  {
+    return HAL_ERROR;
+  }
+
+  LCD_Scan_Config(LayerIndex, &timing);
+  return HAL_OK;
+}
+
+/**
+  * @brief  使用指定的扫描时序，主机测试时传入模拟的扫描线时钟
+  * @param  LayerIndex: 要更新的层
+  * @param  pTiming: 扫描时序
+  * @retval 无
+  */
+void LCD_Scan_Config(uint32_t LayerIndex, const LCD_ScanTimingTypeDef *pTiming)
+{
+  Timing     = *pTiming;
+  Layer      = LayerIndex;
+  QueueCount = 0;
+  Clock      = 0;
+  LastLine   = Timing.GetLine();
+  LCD_Scan_ResetStats();
+}
+
+/**
+  * @brief  请求更新一个区域，扫描线经过该区域后在行中断中调用绘制回调
+  * @note   区域按LCD_SCAN_BAND_ROWS拆成条带，回调对每个条带调用一次；
+  *         更新行范围重叠的请求按提交顺序执行
+  * @param  Ypos: 起始行
+  * @param  Height: 行数
+  * @param  Width: 每行更新的像素数，用于估计耗时
+  * @param  pDraw: 绘制回调
+  * @param  pArg: 回调参数
+  * @retval HAL状态，队列放不下时为HAL_BUSY
+  */
+HAL_StatusTypeDef LCD_Scan_Update(uint16_t Ypos, uint16_t Height, uint16_t Width, LCD_ScanDrawTypeDef pDraw, void *pArg)
+{
+  SCAN_BandTypeDef band = {0};
+
+  band.Y0    = Ypos;
+  band.Width = Width;
+  band.pDraw = pDraw;
+  band.pArg  = pArg;
+  return SCAN_Submit(&band, Height, LCD_SCAN_BAND_ROWS);
+}
+
+/**
+  * @brief  请求把一幅与层格式相同的图像复制到显存，扫描线经过后由CPU在行中断中复制
+  * @param  pSrc: 图像数据，更新完成(LCD_Scan_Pending为0)前必须保持不变
+  * @param  SrcStride: 图像行宽(字节)
+  * @param  Xpos, Ypos: 目标左上角
+  * @param  Width, Height: 宽度和高度
+  * @retval HAL状态
+  */
+HAL_StatusTypeDef LCD_Scan_Copy(const void *pSrc, uint32_t SrcStride, uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height)
+{
+  SCAN_BandTypeDef band = {0};
+
+  if(((uint32_t)Xpos + Width > Ltdc_Handler.LayerCfg[Layer].ImageWidth) ||
+     ((uint32_t)Ypos + Height > Ltdc_Handler.LayerCfg[Layer].ImageHeight))
+  {
+    return HAL_ERROR;
+  }
+
+  band.Y0        = Ypos;
+  band.X         = Xpos;
+  band.Width     = Width;
+  band.pSrc      = (const uint8_t *)pSrc;
+  band.SrcStride = SrcStride;
+  return SCAN_Submit(&band, Height, LCD_SCAN_BAND_ROWS);
+}
+
+/**
+  * @brief  获取尚未更新的条带数
+  * @retval 条带数
+  */
+uint32_t LCD_Scan_Pending(void)
+{
+  return QueueCount;
+}
+
+/**
+  * @brief  行中断处理：更新扫描线已经经过且来得及在下一帧扫到之前完成的条带
+  * @retval 无
+  */
+void LCD_Scan_LineEvent(void)
+{
+  Stats.Events++;
+  SCAN_Dispatch();
+}
+
+/**
+  * @brief  读取扫描线调度统计
+  * @param  pStats: 输出统计数据
+  * @retval 无
+  */
+void LCD_Scan_GetStats(LCD_ScanStatsTypeDef *pStats)
+{
+  *pStats = Stats;
+}
+
+/**
+  * @brief  清除扫描线调度统计
+  * @retval 无
+  */
+void LCD_Scan_ResetStats(void)
+{
+  LCD_ScanStatsTypeDef empty = {0};
+
+  Stats = empty;
+}
+
+/**
+  * @brief  LTDC行中断回调
+  * @param  hltdc: LTDC句柄
+  * @retval 无
+  */
+void HAL_LTDC_LineEventCallback(LTDC_HandleTypeDef *hltdc)
+{
+  UNUSED(hltdc);
+
+  if(Timing.TotalLines != 0U)
+  {
+    LCD_Scan_LineEvent();
+  }
+}
+
+/**
+  * @brief  读取扫描线位置并推进行时钟
+  * @retval 相对于第一行有效显示的行号，不小于ActiveHeight时处于消隐期
+  */
+static uint32_t SCAN_Row(void)
+{
+  uint32_t line = Timing.GetLine();
+
+  Clock   += (line + Timing.TotalLines - LastLine) % Timing.TotalLines;
+  LastLine = line;
+  return (line + Timing.TotalLines - Timing.ActiveStart) % Timing.TotalLines;
+}
+
+/**
+  * @brief  更新所有可以更新的条带，再把行中断设到下一个条带的下边
+  * @note   条带[Y0, Y1)在扫描线位于Y1之后开始更新，并且必须在扫描线下一帧回到Y0之前完成
+  * @retval 无
+  */
+static void SCAN_Dispatch(void)
+{
+  SCAN_BandTypeDef *band;
+  uint32_t row, end, i, j, next, target, latency;
+  uint8_t  blocked, progress;
+
+  do
+  {
+    progress = 0;
+    row = SCAN_Row();
+
+    for(i = 0; (i < QueueCount) && (progress == 0U); i++)
+    {
+      band = &Queue[i];
+
+      /* 与之前的请求行范围重叠时保持顺序 */
+      blocked = 0;
+      for(j = 0; j < i; j++)
+      {
+        if((Queue[j].Y0 < band->Y1) && (band->Y0 < Queue[j].Y1))
+        {
+          blocked = 1;
+          break;
+        }
+      }
+      if((blocked != 0U) || (row < band->Y1))
+      {
+        continue;
+      }
+
+      if((row + band->Cost) > ((uint32_t)band->Y0 + Timing.TotalLines))
+      {
+        if(band->Deferred == 0U)
+        {
+          band->Deferred = 1;
+          Stats.Deferred++;
+        }
+        continue;
+      }
+
+      latency = Clock - band->Submit;
+      if(latency > Stats.MaxLatency)
+      {
+        Stats.MaxLatency = latency;
+      }
+
+      if(band->pDraw != NULL)
+      {
+        band->pDraw(band->pArg, band->Y0, band->Y1);
+      }
+      else
+      {
+        SCAN_Copy(band);
+      }
+
+      /* 扫描线越过帧尾又到达了条带，说明更新耗时超出估计 */
+      end = SCAN_Row();
+      if((end < row) && (end >= band->Y0))
+      {
+        Stats.Tears++;
+      }
+      Stats.Dispatched++;
+
+      QueueCount--;
+      for(j = i; j < QueueCount; j++)
+      {
+        Queue[j] = Queue[j + 1U];
+      }
+      progress = 1;
+    }
+  }while(progress != 0U);
+
+  if(QueueCount == 0U)
+  {
+    return;
+  }
+
+  /* 扫描线已经过的条带只能等到下一帧 */
+  next = 0xFFFFFFFF;
+  for(i = 0; i < QueueCount; i++)
+  {
+    target = (row < Queue[i].Y1) ? Queue[i].Y1 : ((uint32_t)Queue[i].Y1 + Timing.TotalLines);
+    if(target < next)
+    {
+      next = target;
+    }
+  }
+  Timing.SetLineEvent((Timing.ActiveStart + next) % Timing.TotalLines);
+}
+
+/**
+  * @brief  把一个条带的图像复制到层的显存
+  * @param  pBand: 条带
+  * @retval 无
+  */
+static void SCAN_Copy(const SCAN_BandTypeDef *pBand)
+{
+  uint32_t stride = LCD_GetStride(Layer);
+  uint32_t bpp    = stride / Ltdc_Handler.LayerCfg[Layer].ImageWidth;
+  uint8_t  *dst   = (uint8_t *)(uintptr_t)Ltdc_Handler.LayerCfg[Layer].FBStartAdress + pBand->Y0 * stride + pBand->X * bpp;
+  const uint8_t *src = pBand->pSrc;
+  uint32_t y;
+
+  for(y = pBand->Y0; y < pBand->Y1; y++)
+  {
+    memcpy(dst, src, pBand->Width * bpp);
+    dst += stride;
+    src += pBand->SrcStride;
+  }
+  LCD_PROF_PIXELS((uint32_t)pBand->Width * (pBand->Y1 - pBand->Y0));
+}
+
+/**
+  * @brief  把区域拆成条带放入队列，下一行的行中断中开始更新
+  * @param  pBand: 第一个条带的模板，Y0为区域起始行
+  * @param  Height: 区域行数
+  * @param  Rows: 每个条带的最大行数
+  * @retval HAL状态
+  */
+static HAL_StatusTypeDef SCAN_Submit(const SCAN_BandTypeDef *pBand, uint32_t Height, uint32_t Rows)
+{
+  SCAN_BandTypeDef *band;
+  uint32_t primask, count, y, cost;
+
+  if((Timing.TotalLines == 0U) || (Height == 0U) || (pBand->Width == 0U) ||
+     ((uint32_t)pBand->Y0 + Height > Timing.ActiveHeight))
+  {
+    return HAL_ERROR;
+  }
+
+  /* 条带的更新时间加上条带本身的行数不能超过一帧 */
+  while((Rows > 1U) &&
+        (((Rows * pBand->Width + Timing.PixelsPerLine - 1U) / Timing.PixelsPerLine + Rows) > Timing.TotalLines))
+  {
+    Rows >>= 1;
+  }
+  cost = (Rows * pBand->Width + Timing.PixelsPerLine - 1U) / Timing.PixelsPerLine;
+  if((cost + Rows) > Timing.TotalLines)
+  {
+    return HAL_ERROR;
+  }
+  count = (Height + Rows - 1U) / Rows;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  if((QueueCount + count) > LCD_SCAN_QUEUE_SIZE)
+  {
+    __set_PRIMASK(primask);
+    return HAL_BUSY;
+  }
+
+  LCD_PROF_BEGIN(LCD_PROF_SCAN);
+  SCAN_Row();
+  for(y = 0; y < Height; y += Rows)
+  {
+    band  = &Queue[QueueCount++];
+    *band = *pBand;
+    band->Y0     = (uint16_t)(pBand->Y0 + y);
+    band->Y1     = (uint16_t)(pBand->Y0 + ((y + Rows < Height) ? (y + Rows) : Height));
+    band->Cost   = (uint16_t)(((band->Y1 - band->Y0) * pBand->Width + Timing.PixelsPerLine - 1U) / Timing.PixelsPerLine);
+    band->Submit = Clock;
+    if(band->pSrc != NULL)
+    {
+      band->pSrc = pBand->pSrc + y * pBand->SrcStride;
+    }
+  }
+  Stats.Submitted += count;
+
+  /* 只设置下一行的行中断，由行中断调度；关中断时不运行回调和复制 */
+  Timing.SetLineEvent((Timing.GetLine() + 1U) % Timing.TotalLines);
+  LCD_PROF_END();
+  __set_PRIMASK(primask);
+  return HAL_OK;
+}
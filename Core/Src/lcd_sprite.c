@@ -0,0 +1,457 @@
+#include "lcd_sprite.h"
+#include "lcd_display.h"
+#include "lcd_dma2d.h"
+#include "lcd_prof.h"
+
+extern LTDC_HandleTypeDef hltdc;
+
+#define Ltdc_Handler hltdc
+
+/**
+  * @brief  精灵，图像存放在SDRAM中，按Z值从小到大叠加在背景上
+  */
+typedef struct
+{
+  uint8_t         Used;       /* 已创建 */
+  uint8_t         Visible;    /* 是否显示 */
+  uint8_t         Changed;    /* 上次合成后位置、图像或属性改变过 */
+  uint8_t         Z;          /* 叠加顺序，越大越靠上 */
+  uint8_t         Alpha;      /* 整体透明度，与图像自带的透明度相乘 */
+  uint32_t        Address;    /* 图像首地址 */
+  uint32_t        ColorMode;  /* 图像像素格式 DMA2D_INPUT_xxx */
+  uint16_t        Width;      /* 图像宽度 */
+  uint16_t        Height;     /* 图像高度 */
+  int16_t         X;          /* 左上角在层中的坐标，可以为负 */
+  int16_t         Y;
+  LCD_RectTypeDef Drawn;      /* 上次合成时在屏幕上的区域，空矩形表示未显示 */
+}LCD_SpriteTypeDef;
+
+static LCD_SpriteTypeDef      Sprite[LCD_SPRITE_MAX];
+static uint8_t                Order[LCD_SPRITE_MAX];  /* 按Z值排序的精灵编号 */
+static uint32_t               Layer;                  /* 精灵所在的层 */
+static uint32_t               BackAddress;            /* 与层同格式、同大小的背景图像 */
+static LCD_DirtyListTypeDef   Damage;                 /* 下次合成需要重绘的区域 */
+static LCD_SpriteStatsTypeDef Stats;
+
+/* DMA2D各输入格式每像素的位数 */
+static const uint8_t InputBits[] = {32, 24, 16, 16, 16, 8, 8, 16, 4, 8, 4};
+
+static void SPRITE_GetBounds(const LCD_SpriteTypeDef *pSprite, LCD_RectTypeDef *pRect);
+static uint32_t SPRITE_Sort(void);
+static uint32_t SPRITE_Copy(const LCD_RectTypeDef *pRect);
+static uint32_t SPRITE_Blend(const LCD_SpriteTypeDef *pSprite, const LCD_RectTypeDef *pRect);
+
+/**
+  * @brief  初始化精灵管理，清除所有精灵并在下次合成时重绘整个背景
+  * @note   层格式必须是DMA2D能输出的格式(ARGB8888/RGB888/RGB565/ARGB1555/ARGB4444)
+  * @param  LayerIndex: 精灵所在的层
+  * @param  Background: 背景图像首地址，与层同格式、同大小，合成期间不能修改
+  * @retval HAL状态
+  */
+HAL_StatusTypeDef LCD_Sprite_Init(uint32_t LayerIndex, uint32_t Background)
+{
+  uint32_t i;
+
+  if((LayerIndex >= MAX_LAYER_NUMBER) ||
+     (Ltdc_Handler.LayerCfg[LayerIndex].PixelFormat > LTDC_PIXEL_FORMAT_ARGB4444))
+  {
+    return HAL_ERROR;
+  }
+
+  for(i = 0; i < LCD_SPRITE_MAX; i++)
+  {
+    Sprite[i].Used = 0;
+  }
+  Layer       = LayerIndex;
+  BackAddress = Background;
+  LCD_Dirty_Clear(&Damage);
+  LCD_Dirty_Add(&Damage, 0, 0, Ltdc_Handler.LayerCfg[Layer].ImageWidth, Ltdc_Handler.LayerCfg[Layer].ImageHeight);
+  return HAL_OK;
+}
+
+/**
+  * @brief  创建一个精灵，创建后不显示
+  * @param  Address: 图像首地址，通常位于SDRAM
+  * @param  ColorMode: 图像像素格式 DMA2D_INPUT_xxx，带透明度的格式按像素混合
+  * @param  Width, Height: 图像大小
+  * @retval 精灵编号，没有空闲位置时返回-1
+  */
+int32_t LCD_Sprite_Create(uint32_t Address, uint32_t ColorMode, uint16_t Width, uint16_t Height)
+{
+  LCD_SpriteTypeDef *sprite;
+  uint32_t i;
+
+  if(ColorMode >= sizeof(InputBits))
+  {
+    return -1;
+  }
+
+  for(i = 0; i < LCD_SPRITE_MAX; i++)
+  {
+    sprite = &Sprite[i];
+    if(sprite->Used == 0U)
+    {
+      sprite->Used      = 1;
+      sprite->Visible   = 0;
+      sprite->Changed   = 0;
+      sprite->Z         = 0;
+      sprite->Alpha     = 0xFF;
+      sprite->Address   = Address;
+      sprite->ColorMode = ColorMode;
+      sprite->Width     = Width;
+      sprite->Height    = Height;
+      sprite->X         = 0;
+      sprite->Y         = 0;
+      sprite->Drawn.X0  = 0;
+      sprite->Drawn.Y0  = 0;
+      sprite->Drawn.X1  = 0;
+      sprite->Drawn.Y1  = 0;
+      return (int32_t)i;
+    }
+  }
+  return -1;
+}
+
+/**
+  * @brief  删除精灵，下次合成时恢复它覆盖的背景
+  * @param  Id: 精灵编号
+  * @retval 无
+  */
+void LCD_Sprite_Destroy(int32_t Id)
+{
+  if((Id < 0) || (Id >= (int32_t)LCD_SPRITE_MAX) || (Sprite[Id].Used == 0U))
+  {
+    return;
+  }
+  LCD_Dirty_AddRect(&Damage, &Sprite[Id].Drawn);
+  Sprite[Id].Used = 0;
+}
+
+/**
+  * @brief  更换精灵图像，用于动画，新图像的大小和格式必须与原图像相同
+  * @param  Id: 精灵编号
+  * @param  Address: 图像首地址
+  * @retval 无
+  */
+void LCD_Sprite_SetImage(int32_t Id, uint32_t Address)
+{
+  if((Id < 0) || (Id >= (int32_t)LCD_SPRITE_MAX) || (Sprite[Id].Address == Address))
+  {
+    return;
+  }
+  Sprite[Id].Address = Address;
+  Sprite[Id].Changed = 1;
+}
+
+/**
+  * @brief  移动精灵
+  * @param  Id: 精灵编号
+  * @param  Xpos, Ypos: 左上角坐标，可以为负
+  * @retval 无
+  */
+void LCD_Sprite_SetPosition(int32_t Id, int16_t Xpos, int16_t Ypos)
+{
+  if((Id < 0) || (Id >= (int32_t)LCD_SPRITE_MAX) || ((Sprite[Id].X == Xpos) && (Sprite[Id].Y == Ypos)))
+  {
+    return;
+  }
+  Sprite[Id].X = Xpos;
+  Sprite[Id].Y = Ypos;
+  Sprite[Id].Changed = 1;
+}
+
+/**
+  * @brief  设置精灵的叠加顺序，Z值相同时编号小的在下面
+  * @param  Id: 精灵编号
+  * @param  Z: Z值，越大越靠上
+  * @retval 无
+  */
+void LCD_Sprite_SetZOrder(int32_t Id, uint8_t Z)
+{
+  if((Id < 0) || (Id >= (int32_t)LCD_SPRITE_MAX) || (Sprite[Id].Z == Z))
+  {
+    return;
+  }
+  Sprite[Id].Z = Z;
+  Sprite[Id].Changed = 1;
+}
+
+/**
+  * @brief  设置精灵的整体透明度
+  * @param  Id: 精灵编号
+  * @param  Alpha: 透明度，0为完全透明
+  * @retval 无
+  */
+void LCD_Sprite_SetAlpha(int32_t Id, uint8_t Alpha)
+{
+  if((Id < 0) || (Id >= (int32_t)LCD_SPRITE_MAX) || (Sprite[Id].Alpha == Alpha))
+  {
+    return;
+  }
+  Sprite[Id].Alpha = Alpha;
+  Sprite[Id].Changed = 1;
+}
+
+/**
+  * @brief  显示或隐藏精灵
+  * @param  Id: 精灵编号
+  * @param  State: ENABLE显示，DISABLE隐藏
+  * @retval 无
+  */
+void LCD_Sprite_SetVisible(int32_t Id, FunctionalState State)
+{
+  uint8_t visible = (State == ENABLE) ? 1U : 0U;
+
+  if((Id < 0) || (Id >= (int32_t)LCD_SPRITE_MAX) || (Sprite[Id].Visible == visible))
+  {
+    return;
+  }
+  Sprite[Id].Visible = visible;
+  Sprite[Id].Changed = 1;
+}
+
+/**
+  * @brief  背景图像的一块区域被修改，下次合成时重绘
+  * @param  Xpos, Ypos: 左上角坐标
+  * @param  Width, Height: 区域大小
+  * @retval 无
+  */
+void LCD_Sprite_Invalidate(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height)
+{
+  LCD_Dirty_Add(&Damage, Xpos, Ypos, Width, Height);
+}
+
+/**
+  * @brief  合成一帧：只重绘改变过的精灵新旧区域的并集
+  * @note   每个区域先用DMA2D从背景复制，再按Z顺序把与之相交的精灵逐个混合上去，
+  *         命令全部进入DMA2D队列后立即返回；重绘的区域记入层的脏区域，
+  *         随后调用LCD_SwapBuffers即可显示
+  * @retval 无
+  */
+void LCD_Sprite_Render(void)
+{
+  LCD_SpriteTypeDef *sprite;
+  LCD_RectTypeDef bounds, *rect;
+  uint32_t xsize = Ltdc_Handler.LayerCfg[Layer].ImageWidth;
+  uint32_t ysize = Ltdc_Handler.LayerCfg[Layer].ImageHeight;
+  uint32_t count, bytes = 0, full, blends = 0;
+  uint32_t active, i, j;
+
+  LCD_PROF_BEGIN(LCD_PROF_SPRITE);
+  /* 改变过的精灵，旧区域露出背景，新区域需要重新混合 */
+  for(i = 0; i < LCD_SPRITE_MAX; i++)
+  {
+    sprite = &Sprite[i];
+    if((sprite->Used == 0U) || (sprite->Changed == 0U))
+    {
+      continue;
+    }
+    LCD_Dirty_AddRect(&Damage, &sprite->Drawn);
+    SPRITE_GetBounds(sprite, &bounds);
+    LCD_Dirty_AddRect(&Damage, &bounds);
+    sprite->Drawn   = bounds;
+    sprite->Changed = 0;
+  }
+
+  count = SPRITE_Sort();
+
+  /* 整屏重绘的数据量，用于比较 */
+  full = xsize * ysize * ((InputBits[Ltdc_Handler.LayerCfg[Layer].PixelFormat] * 2U) / 8U);
+  for(j = 0; j < count; j++)
+  {
+    sprite = &Sprite[Order[j]];
+    full += LCD_Rect_Area(&sprite->Drawn) *
+            (InputBits[sprite->ColorMode] + InputBits[Ltdc_Handler.LayerCfg[Layer].PixelFormat] * 2U) / 8U;
+  }
+
+  active = LCD_GetActiveLayer();
+  LCD_SelectLayer(Layer);
+  for(i = 0; i < Damage.Count; i++)
+  {
+    rect   = &Damage.Rect[i];
+    bytes += SPRITE_Copy(rect);
+    for(j = 0; j < count; j++)
+    {
+      sprite = &Sprite[Order[j]];
+      if(LCD_Rect_Intersect(&sprite->Drawn, rect, &bounds) != 0U)
+      {
+        bytes += SPRITE_Blend(sprite, &bounds);
+        blends++;
+      }
+    }
+    LCD_InvalidateRect(rect->X0, rect->Y0, rect->X1 - rect->X0, rect->Y1 - rect->Y0);
+  }
+  LCD_SelectLayer(active);
+
+  Stats.Frames++;
+  Stats.LastRects     = Damage.Count;
+  Stats.LastBlends    = blends;
+  Stats.LastBytes     = bytes;
+  Stats.LastFullBytes = full;
+  Stats.TotalBytes   += bytes;
+  LCD_Dirty_Clear(&Damage);
+  LCD_PROF_END();
+}
+
+/**
+  * @brief  读取合成统计
+  * @param  pStats: 输出统计数据
+  * @retval 无
+  */
+void LCD_Sprite_GetStats(LCD_SpriteStatsTypeDef *pStats)
+{
+  *pStats = Stats;
+}
+
+/**
+  * @brief  清除合成统计
+  * @retval 无
+  */
+void LCD_Sprite_ResetStats(void)
+{
+  Stats.Frames        = 0;
+  Stats.LastRects     = 0;
+  Stats.LastBlends    = 0;
+  Stats.LastBytes     = 0;
+  Stats.LastFullBytes = 0;
+  Stats.TotalBytes    = 0;
+}
+
+/**
+  * @brief  计算精灵在屏幕上的区域，隐藏或完全在屏幕外时为空矩形
+  * @param  pSprite: 精灵
+  * @param  pRect: 输出区域
+  * @retval 无
+  */
+static void SPRITE_GetBounds(const LCD_SpriteTypeDef *pSprite, LCD_RectTypeDef *pRect)
+{
+  int32_t x0 = pSprite->X, y0 = pSprite->Y;
+  int32_t x1 = x0 + pSprite->Width, y1 = y0 + pSprite->Height;
+  int32_t xsize = (int32_t)Ltdc_Handler.LayerCfg[Layer].ImageWidth;
+  int32_t ysize = (int32_t)Ltdc_Handler.LayerCfg[Layer].ImageHeight;
+
+  pRect->X0 = 0;
+  pRect->Y0 = 0;
+  pRect->X1 = 0;
+  pRect->Y1 = 0;
+
+  if(x0 < 0)
+  {
+    x0 = 0;
+  }
+  if(y0 < 0)
+  {
+    y0 = 0;
+  }
+  if(x1 > xsize)
+  {
+    x1 = xsize;
+  }
+  if(y1 > ysize)
+  {
+    y1 = ysize;
+  }
+  if((pSprite->Visible == 0U) || (pSprite->Alpha == 0U) || (x0 >= x1) || (y0 >= y1))
+  {
+    return;
+  }
+
+  pRect->X0 = (uint16_t)x0;
+  pRect->Y0 = (uint16_t)y0;
+  pRect->X1 = (uint16_t)x1;
+  pRect->Y1 = (uint16_t)y1;
+}
+
+/**
+  * @brief  把屏幕上可见的精灵按Z值从小到大排入Order，Z值相同时保持编号顺序
+  * @retval 可见精灵个数
+  */
+static uint32_t SPRITE_Sort(void)
+{
+  uint32_t count = 0;
+  uint32_t i, j;
+
+  for(i = 0; i < LCD_SPRITE_MAX; i++)
+  {
+    if((Sprite[i].Used == 0U) || (LCD_Rect_Area(&Sprite[i].Drawn) == 0U))
+    {
+      continue;
+    }
+    /* 插入排序，精灵个数很少 */
+    for(j = count; (j > 0U) && (Sprite[Order[j - 1U]].Z > Sprite[i].Z); j--)
+    {
+      Order[j] = Order[j - 1U];
+    }
+    Order[j] = (uint8_t)i;
+    count++;
+  }
+  return count;
+}
+
+/**
+  * @brief  从背景复制一个矩形到层的绘制缓冲区
+  * @param  pRect: 区域
+  * @retval 搬运的字节数
+  */
+static uint32_t SPRITE_Copy(const LCD_RectTypeDef *pRect)
+{
+  LCD_DMA2D_CmdTypeDef cmd = {0};
+  uint32_t format = Ltdc_Handler.LayerCfg[Layer].PixelFormat;
+  uint32_t width  = pRect->X1 - pRect->X0;
+  uint32_t height = pRect->Y1 - pRect->Y0;
+  uint32_t offset = LCD_GetPixelAddress(Layer, pRect->X0, pRect->Y0) - LCD_GetDrawAddress(Layer);
+
+  cmd.Mode         = DMA2D_M2M;
+  cmd.OutColorMode = format;
+  cmd.OutOffset    = Ltdc_Handler.LayerCfg[Layer].ImageWidth - width;
+  cmd.DstAddress   = LCD_GetDrawAddress(Layer) + offset;
+  cmd.FgAddress    = BackAddress + offset;
+  cmd.FgColorMode  = format;
+  cmd.FgOffset     = cmd.OutOffset;
+  cmd.FgAlphaMode  = DMA2D_NO_MODIF_ALPHA;
+  cmd.FgAlpha      = 0xFF;
+  cmd.Width        = (uint16_t)width;
+  cmd.Height       = (uint16_t)height;
+  LCD_DMA2D_Submit(&cmd);
+  LCD_PROF_PIXELS(width * height);
+
+  return width * height * ((InputBits[format] * 2U) / 8U);
+}
+
+/**
+  * @brief  把精灵与一个矩形相交的部分混合到层的绘制缓冲区
+  * @param  pSprite: 精灵
+  * @param  pRect: 区域，必须在精灵范围内
+  * @retval 搬运的字节数
+  */
+static uint32_t SPRITE_Blend(const LCD_SpriteTypeDef *pSprite, const LCD_RectTypeDef *pRect)
+{
+  LCD_DMA2D_CmdTypeDef cmd = {0};
+  uint32_t format = Ltdc_Handler.LayerCfg[Layer].PixelFormat;
+  uint32_t width  = pRect->X1 - pRect->X0;
+  uint32_t height = pRect->Y1 - pRect->Y0;
+  uint32_t sx     = (uint32_t)((int32_t)pRect->X0 - pSprite->X);
+  uint32_t sy     = (uint32_t)((int32_t)pRect->Y0 - pSprite->Y);
+
+  /* 前景为精灵图像，透明度与整体透明度相乘；背景和输出都是显存 */
+  cmd.Mode         = DMA2D_M2M_BLEND;
+  cmd.OutColorMode = format;
+  cmd.OutOffset    = Ltdc_Handler.LayerCfg[Layer].ImageWidth - width;
+  cmd.DstAddress   = LCD_GetPixelAddress(Layer, pRect->X0, pRect->Y0);
+  cmd.FgAddress    = pSprite->Address + ((sy * pSprite->Width + sx) * InputBits[pSprite->ColorMode]) / 8U;
+  cmd.FgColorMode  = pSprite->ColorMode;
+  cmd.FgOffset     = pSprite->Width - width;
+  cmd.FgAlphaMode  = DMA2D_COMBINE_ALPHA;
+  cmd.FgAlpha      = pSprite->Alpha;
+  cmd.BgAddress    = cmd.DstAddress;
+  cmd.BgColorMode  = format;
+  cmd.BgOffset     = cmd.OutOffset;
+  cmd.BgAlphaMode  = DMA2D_NO_MODIF_ALPHA;
+  cmd.BgAlpha      = 0xFF;
+  cmd.Width        = (uint16_t)width;
+  cmd.Height       = (uint16_t)height;
+  LCD_DMA2D_Submit(&cmd);
+  LCD_PROF_PIXELS(width * height);
+
+  return width * height * ((InputBits[pSprite->ColorMode] + InputBits[format] * 2U) / 8U);
+}
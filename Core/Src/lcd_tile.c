@@ -0,0 +1,624 @@
+#include "lcd_tile.h"
+#include "lcd_display.h"
+#include "lcd_dma2d.h"
+#include "lcd_prof.h"
+#include "memsys.h"
+
+extern LTDC_HandleTypeDef hltdc;
+
+#define Ltdc_Handler hltdc
+
+#define TILE_COLS      ((LCD_TILE_MAX_XSIZE + LCD_TILE_WIDTH - 1U) / LCD_TILE_WIDTH)
+#define TILE_ROWS      ((LCD_TILE_MAX_YSIZE + LCD_TILE_HEIGHT - 1U) / LCD_TILE_HEIGHT)
+#define TILE_NONE      ((uint16_t)0xFFFF)
+
+/* 图元类型 */
+#define TILE_RECT      ((uint8_t)0)
+#define TILE_CIRCLE    ((uint8_t)1)
+#define TILE_IMAGE     ((uint8_t)2)
+#define TILE_STRING    ((uint8_t)3)
+
+/**
+  * @brief  记录的图元
+  */
+typedef struct
+{
+  uint8_t     Type;
+  uint8_t     Opaque;    /* 外接矩形内全部是不透明像素 */
+  int16_t     X, Y;      /* 矩形、图像的左上角，圆心，字符串起点 */
+  int16_t     X0, Y0;    /* 裁剪到层内的外接矩形 */
+  int16_t     X1, Y1;    /* 右下角(不包含) */
+  uint32_t    Color;     /* ARGB8888颜色，图像为整体透明度 */
+  uint32_t    Param;     /* 圆的半径，图像的行宽(像素) */
+  const void  *pData;    /* 图像数据或字符串 */
+  const sFONT *pFont;
+}TILE_PrimTypeDef;
+
+static TILE_PrimTypeDef Prims[LCD_TILE_MAX_PRIMS];
+static uint32_t PrimCount;
+
+/* 每个图块一条按记录顺序排列的图元链表 */
+static uint16_t BinHead[TILE_COLS * TILE_ROWS];
+static uint16_t BinTail[TILE_COLS * TILE_ROWS];
+static uint16_t BinNext[LCD_TILE_MAX_BINS];
+static uint16_t BinPrim[LCD_TILE_MAX_BINS];
+static uint32_t BinCount;
+
+/* 两个图块缓冲区轮流使用，CPU绘制一块时DMA2D写回另一块；位于DTCM，不经过D-Cache。
+   放到写回缓存的SRAM时读回后丢弃缓存中的旧数据，按缓存行对齐，首尾行不与其他变量共用 */
+static uint32_t TileBuffer[2][LCD_TILE_WIDTH * LCD_TILE_HEIGHT] MEM_DTCM_BSS __attribute__((aligned(32)));
+static uint32_t TileFence[2];
+static uint32_t TileIndex;
+
+static uint32_t Layer;
+static uint32_t Format;
+static uint32_t BytesPerPixel;
+static int32_t  XSize, YSize;
+static uint8_t  Active;
+
+static LCD_TileStatsTypeDef Stats;
+
+static void TILE_Reset(void);
+static void TILE_Render(void);
+static void TILE_Add(const TILE_PrimTypeDef *pPrim, uint32_t Direct);
+static void TILE_Raster(const TILE_PrimTypeDef *pPrim, uint32_t *pTile, int32_t tx, int32_t ty, int32_t tw, int32_t th);
+static uint32_t TILE_Blend(uint32_t Dst, uint32_t Color, uint32_t Alpha);
+static void TILE_Span(uint32_t *pTile, int32_t tx, int32_t ty, const int32_t *pClip, int32_t Y, int32_t Left, int32_t Right, uint32_t Color);
+
+/**
+  * @brief  开始一帧分块绘制，之后的LCD_Tile_xxx调用只记录图元并按图块分箱
+  * @param  LayerIndex: 目标层，像素格式必须是DMA2D可以输出的格式(ARGB8888 ~ ARGB4444)
+  * @retval HAL状态
+  */
+HAL_StatusTypeDef LCD_Tile_Begin(uint32_t LayerIndex)
+{
+  uint32_t format = Ltdc_Handler.LayerCfg[LayerIndex].PixelFormat;
+
+  if((format > LTDC_PIXEL_FORMAT_ARGB4444) ||
+     (Ltdc_Handler.LayerCfg[LayerIndex].ImageWidth > LCD_TILE_MAX_XSIZE) ||
+     (Ltdc_Handler.LayerCfg[LayerIndex].ImageHeight > LCD_TILE_MAX_YSIZE))
+  {
+    return HAL_ERROR;
+  }
+
+  Layer         = LayerIndex;
+  Format        = format;
+  BytesPerPixel = (format == LTDC_PIXEL_FORMAT_ARGB8888) ? 4U : ((format == LTDC_PIXEL_FORMAT_RGB888) ? 3U : 2U);
+  XSize         = (int32_t)Ltdc_Handler.LayerCfg[LayerIndex].ImageWidth;
+  YSize         = (int32_t)Ltdc_Handler.LayerCfg[LayerIndex].ImageHeight;
+  Active        = 1;
+  TILE_Reset();
+  return HAL_OK;
+}
+
+/**
+  * @brief  结束一帧：逐个图块在内部RAM中绘制，再用一条DMA2D命令写回显存
+  * @note   没有图元的图块不读也不写显存；写回是异步的，由DMA2D命令队列保证顺序
+  * @retval 无
+  */
+void LCD_Tile_End(void)
+{
+  if(Active == 0U)
+  {
+    return;
+  }
+  TILE_Render();
+  Active = 0;
+  Stats.Frames++;
+}
+
+/**
+  * @brief  用颜色填充整个层
+  * @param  Color: ARGB8888颜色
+  * @retval 无
+  */
+void LCD_Tile_Clear(uint32_t Color)
+{
+  LCD_Tile_FillRect(0, 0, (uint16_t)XSize, (uint16_t)YSize, Color);
+}
+
+/**
+  * @brief  填充矩形，颜色不是完全不透明时与下面的像素混合
+  * @param  Xpos, Ypos: 左上角，可以为负
+  * @param  Width, Height: 宽度和高度
+  * @param  Color: ARGB8888颜色
+  * @retval 无
+  */
+void LCD_Tile_FillRect(int16_t Xpos, int16_t Ypos, uint16_t Width, uint16_t Height, uint32_t Color)
+{
+  TILE_PrimTypeDef prim = {0};
+
+  prim.Type   = TILE_RECT;
+  prim.Opaque = ((Color >> 24) == 0xFFU) ? 1U : 0U;
+  prim.X      = Xpos;
+  prim.Y      = Ypos;
+  prim.X0     = Xpos;
+  prim.Y0     = Ypos;
+  prim.X1     = (int16_t)(Xpos + Width);
+  prim.Y1     = (int16_t)(Ypos + Height);
+  prim.Color  = Color;
+  TILE_Add(&prim, (prim.Opaque != 0U) ? 1U : 2U);
+}
+
+/**
+  * @brief  填充圆，颜色不是完全不透明时与下面的像素混合
+  * @param  Xpos, Ypos: 圆心
+  * @param  Radius: 半径
+  * @param  Color: ARGB8888颜色
+  * @retval 无
+  */
+void LCD_Tile_FillCircle(int16_t Xpos, int16_t Ypos, uint16_t Radius, uint32_t Color)
+{
+  TILE_PrimTypeDef prim = {0};
+
+  prim.Type  = TILE_CIRCLE;
+  prim.X     = Xpos;
+  prim.Y     = Ypos;
+  prim.X0    = (int16_t)(Xpos - Radius);
+  prim.Y0    = (int16_t)(Ypos - Radius);
+  prim.X1    = (int16_t)(Xpos + Radius + 1);
+  prim.Y1    = (int16_t)(Ypos + Radius + 1);
+  prim.Color = Color;
+  prim.Param = Radius;
+  TILE_Add(&prim, ((Color >> 24) == 0xFFU) ? 1U : 2U);
+}
+
+/**
+  * @brief  按每像素透明度混合一幅ARGB8888图像
+  * @param  pSrc: 图像数据，绘制完成(LCD_Tile_End)前必须保持有效
+  * @param  SrcStride: 图像行宽(像素)
+  * @param  Xpos, Ypos: 左上角，可以为负
+  * @param  Width, Height: 宽度和高度
+  * @param  Alpha: 整体透明度，与每个像素的透明度相乘
+  * @retval 无
+  */
+void LCD_Tile_BlendImage(const uint32_t *pSrc, uint32_t SrcStride, int16_t Xpos, int16_t Ypos,
+                         uint16_t Width, uint16_t Height, uint8_t Alpha)
+{
+  TILE_PrimTypeDef prim = {0};
+
+  prim.Type  = TILE_IMAGE;
+  prim.X     = Xpos;
+  prim.Y     = Ypos;
+  prim.X0    = Xpos;
+  prim.Y0    = Ypos;
+  prim.X1    = (int16_t)(Xpos + Width);
+  prim.Y1    = (int16_t)(Ypos + Height);
+  prim.Color = Alpha;
+  prim.Param = SrcStride;
+  prim.pData = pSrc;
+  TILE_Add(&prim, 2);
+}
+
+/**
+  * @brief  显示字符串，背景透明
+  * @param  Xpos, Ypos: 第一个字符所在行的左上角
+  * @param  Text: 以0结尾的UTF-8字符串，绘制完成前必须保持有效
+  * @param  pFont: 字体
+  * @param  Color: ARGB8888颜色
+  * @retval 无
+  */
+void LCD_Tile_DisplayString(int16_t Xpos, int16_t Ypos, const uint8_t *Text, const sFONT *pFont, uint32_t Color)
+{
+  TILE_PrimTypeDef prim = {0};
+
+  prim.Type  = TILE_STRING;
+  prim.X     = Xpos;
+  prim.Y     = Ypos;
+  prim.X0    = Xpos;
+  prim.Y0    = Ypos;
+  prim.X1    = (int16_t)(Xpos + (int32_t)LCD_Font_GetStringWidth(pFont, Text) + pFont->Width);
+  prim.Y1    = (int16_t)(Ypos + pFont->Height);
+  prim.Color = Color;
+  prim.pData = Text;
+  prim.pFont = pFont;
+  TILE_Add(&prim, 2);
+}
+
+/**
+  * @brief  读取分块绘制统计
+  * @param  pStats: 输出统计数据
+  * @retval 无
+  */
+void LCD_Tile_GetStats(LCD_TileStatsTypeDef *pStats)
+{
+  *pStats = Stats;
+}
+
+/**
+  * @brief  清除分块绘制统计
+  * @retval 无
+  */
+void LCD_Tile_ResetStats(void)
+{
+  LCD_TileStatsTypeDef empty = {0};
+
+  Stats = empty;
+}
+
+/**
+  * @brief  清空图元和分箱表
+  * @retval 无
+  */
+static void TILE_Reset(void)
+{
+  uint32_t i;
+
+  PrimCount = 0;
+  BinCount  = 0;
+  for(i = 0; i < (TILE_COLS * TILE_ROWS); i++)
+  {
+    BinHead[i] = TILE_NONE;
+  }
+}
+
+/**
+  * @brief  记录一个图元并把它加入覆盖到的每个图块的链表
+  * @note   图元表或分箱表放不下时，先把已记录的图元绘制出来再继续，绘制顺序不变
+  * @param  pPrim: 图元，外接矩形尚未裁剪
+  * @param  Direct: 直接绘制时每像素读写显存的次数，用于估算
+  * @retval 无
+  */
+static void TILE_Add(const TILE_PrimTypeDef *pPrim, uint32_t Direct)
+{
+  TILE_PrimTypeDef *prim;
+  int32_t  x0, y0, x1, y1, c0, c1, r0, r1, c, r;
+  uint32_t tile;
+
+  if(Active == 0U)
+  {
+    return;
+  }
+
+  x0 = (pPrim->X0 < 0) ? 0 : pPrim->X0;
+  y0 = (pPrim->Y0 < 0) ? 0 : pPrim->Y0;
+  x1 = (pPrim->X1 > XSize) ? XSize : pPrim->X1;
+  y1 = (pPrim->Y1 > YSize) ? YSize : pPrim->Y1;
+  if((x0 >= x1) || (y0 >= y1) || ((pPrim->Type != TILE_IMAGE) && ((pPrim->Color >> 24) == 0U)))
+  {
+    return;
+  }
+
+  c0 = x0 / (int32_t)LCD_TILE_WIDTH;
+  c1 = (x1 - 1) / (int32_t)LCD_TILE_WIDTH;
+  r0 = y0 / (int32_t)LCD_TILE_HEIGHT;
+  r1 = (y1 - 1) / (int32_t)LCD_TILE_HEIGHT;
+
+  if((PrimCount == LCD_TILE_MAX_PRIMS) ||
+     ((BinCount + (uint32_t)((c1 - c0 + 1) * (r1 - r0 + 1))) > LCD_TILE_MAX_BINS))
+  {
+    TILE_Render();
+    TILE_Reset();
+    Stats.Flushes++;
+  }
+
+  prim     = &Prims[PrimCount];
+  *prim    = *pPrim;
+  prim->X0 = (int16_t)x0;
+  prim->Y0 = (int16_t)y0;
+  prim->X1 = (int16_t)x1;
+  prim->Y1 = (int16_t)y1;
+
+  for(r = r0; r <= r1; r++)
+  {
+    for(c = c0; c <= c1; c++)
+    {
+      tile = (uint32_t)r * TILE_COLS + (uint32_t)c;
+      BinPrim[BinCount] = (uint16_t)PrimCount;
+      BinNext[BinCount] = TILE_NONE;
+      if(BinHead[tile] == TILE_NONE)
+      {
+        BinHead[tile] = (uint16_t)BinCount;
+      }
+      else
+      {
+        BinNext[BinTail[tile]] = (uint16_t)BinCount;
+      }
+      BinTail[tile] = (uint16_t)BinCount;
+      BinCount++;
+    }
+  }
+
+  PrimCount++;
+  Stats.Primitives++;
+  Stats.DirectBytes += (uint32_t)((x1 - x0) * (y1 - y0)) * BytesPerPixel * Direct;
+}
+
+/**
+  * @brief  绘制所有有图元的图块并写回显存
+  * @retval 无
+  */
+static void TILE_Render(void)
+{
+  LCD_DMA2D_CmdTypeDef cmd = {0};
+  const TILE_PrimTypeDef *prim;
+  uint32_t *buffer;
+  uint32_t active, tile, fence;
+  uint16_t node, start;
+  int32_t  tx, ty, tw, th;
+
+  LCD_PROF_BEGIN(LCD_PROF_TILE);
+  active = LCD_GetActiveLayer();
+  LCD_SelectLayer(Layer);
+
+  for(tile = 0; tile < (TILE_COLS * TILE_ROWS); tile++)
+  {
+    if(BinHead[tile] == TILE_NONE)
+    {
+      continue;
+    }
+
+    tx = (int32_t)((tile % TILE_COLS) * LCD_TILE_WIDTH);
+    ty = (int32_t)((tile / TILE_COLS) * LCD_TILE_HEIGHT);
+    tw = ((XSize - tx) < (int32_t)LCD_TILE_WIDTH) ? (XSize - tx) : (int32_t)LCD_TILE_WIDTH;
+    th = ((YSize - ty) < (int32_t)LCD_TILE_HEIGHT) ? (YSize - ty) : (int32_t)LCD_TILE_HEIGHT;
+
+    /* 最后一个覆盖整个图块的不透明图元之前的内容都会被盖住，从它开始画 */
+    start = TILE_NONE;
+    for(node = BinHead[tile]; node != TILE_NONE; node = BinNext[node])
+    {
+      prim = &Prims[BinPrim[node]];
+      if((prim->Opaque != 0U) && (prim->X0 <= tx) && (prim->Y0 <= ty) &&
+         (prim->X1 >= (tx + tw)) && (prim->Y1 >= (ty + th)))
+      {
+        start = node;
+      }
+    }
+
+    buffer = TileBuffer[TileIndex];
+    LCD_DMA2D_Wait(TileFence[TileIndex]);
+
+    cmd.Mode        = DMA2D_M2M_PFC;
+    cmd.FgAlphaMode = DMA2D_NO_MODIF_ALPHA;
+    cmd.FgAlpha     = 0xFF;
+    cmd.Width       = (uint16_t)tw;
+    cmd.Height      = (uint16_t)th;
+
+    if(start == TILE_NONE)
+    {
+      /* 图块没有被完全覆盖，先读入显存中原有的像素 */
+      cmd.OutColorMode = DMA2D_OUTPUT_ARGB8888;
+      cmd.OutOffset    = LCD_TILE_WIDTH - (uint32_t)tw;
+      cmd.DstAddress   = LCD_DMA2D_Address(buffer);
+      cmd.FgAddress    = LCD_GetPixelAddress(Layer, (uint16_t)tx, (uint16_t)ty);
+      cmd.FgColorMode  = Format;
+      cmd.FgOffset     = (uint32_t)(XSize - tw);
+      LCD_DMA2D_Wait(LCD_DMA2D_Submit(&cmd));
+      MEM_InvalidateDCache(LCD_DMA2D_Address(buffer), ((uint32_t)(th - 1) * LCD_TILE_WIDTH + (uint32_t)tw) * 4U);
+      start = BinHead[tile];
+      Stats.TilesLoaded++;
+      Stats.BytesRead += (uint32_t)(tw * th) * BytesPerPixel;
+    }
+    else
+    {
+      Stats.TilesCovered++;
+    }
+
+    for(node = start; node != TILE_NONE; node = BinNext[node])
+    {
+      TILE_Raster(&Prims[BinPrim[node]], buffer, tx, ty, tw, th);
+    }
+
+    cmd.OutColorMode = Format;
+    cmd.OutOffset    = (uint32_t)(XSize - tw);
+    cmd.DstAddress   = LCD_GetPixelAddress(Layer, (uint16_t)tx, (uint16_t)ty);
+    cmd.FgAddress    = LCD_DMA2D_Address(buffer);
+    cmd.FgColorMode  = DMA2D_INPUT_ARGB8888;
+    cmd.FgOffset     = LCD_TILE_WIDTH - (uint32_t)tw;
+    fence = LCD_DMA2D_Submit(&cmd);
+    TileFence[TileIndex] = fence;
+    TileIndex ^= 1U;
+
+    LCD_InvalidateRect((uint16_t)tx, (uint16_t)ty, (uint16_t)tw, (uint16_t)th);
+    Stats.TilesWritten++;
+    Stats.PixelsWritten += (uint32_t)(tw * th);
+    Stats.BytesWritten  += (uint32_t)(tw * th) * BytesPerPixel;
+    LCD_PROF_PIXELS((uint32_t)(tw * th));
+  }
+
+  LCD_SelectLayer(active);
+  LCD_PROF_END();
+}
+
+/**
+  * @brief  在图块缓冲区中绘制图元与图块相交的部分
+  * @param  pPrim: 图元
+  * @param  pTile: 图块缓冲区，行宽LCD_TILE_WIDTH
+  * @param  tx, ty: 图块左上角在层中的坐标
+  * @param  tw, th: 图块宽高
+  * @retval 无
+  */
+static void TILE_Raster(const TILE_PrimTypeDef *pPrim, uint32_t *pTile, int32_t tx, int32_t ty, int32_t tw, int32_t th)
+{
+  const LCD_GlyphTypeDef *glyph;
+  const uint8_t  *text, *mask;
+  const uint32_t *src;
+  uint32_t *row;
+  uint32_t alpha, color, pixel, code, prev;
+  int32_t  x0, y0, x1, y1, x, y, gx, gy, gx0, gx1, gy0, gy1, pen;
+  int32_t  clip[4], decision;
+
+  x0 = (pPrim->X0 > tx) ? pPrim->X0 : tx;
+  y0 = (pPrim->Y0 > ty) ? pPrim->Y0 : ty;
+  x1 = (pPrim->X1 < (tx + tw)) ? pPrim->X1 : (tx + tw);
+  y1 = (pPrim->Y1 < (ty + th)) ? pPrim->Y1 : (ty + th);
+  if((x0 >= x1) || (y0 >= y1))
+  {
+    return;
+  }
+
+  color = pPrim->Color;
+  alpha = color >> 24;
+
+  switch(pPrim->Type)
+  {
+  case TILE_RECT:
+    for(y = y0; y < y1; y++)
+    {
+      row = &pTile[(y - ty) * (int32_t)LCD_TILE_WIDTH];
+      for(x = x0; x < x1; x++)
+      {
+        row[x - tx] = (alpha == 0xFFU) ? color : TILE_Blend(row[x - tx], color, alpha);
+      }
+    }
+    Stats.PixelsShaded += (uint32_t)((x1 - x0) * (y1 - y0));
+    break;
+
+  case TILE_CIRCLE:
+    /* 与LCD_FillCircle相同的中点画圆，每一行只输出一次，图块以外的行被裁掉 */
+    clip[0] = x0;
+    clip[1] = y0;
+    clip[2] = x1;
+    clip[3] = y1;
+    x  = 0;
+    y  = (int32_t)pPrim->Param;
+    decision = 3 - (y << 1);
+    while(x <= y)
+    {
+      TILE_Span(pTile, tx, ty, clip, pPrim->Y - x, pPrim->X - y, pPrim->X + y, color);
+      if(x != 0)
+      {
+        TILE_Span(pTile, tx, ty, clip, pPrim->Y + x, pPrim->X - y, pPrim->X + y, color);
+      }
+      if((decision >= 0) && (x != y))
+      {
+        TILE_Span(pTile, tx, ty, clip, pPrim->Y - y, pPrim->X - x, pPrim->X + x, color);
+        TILE_Span(pTile, tx, ty, clip, pPrim->Y + y, pPrim->X - x, pPrim->X + x, color);
+      }
+      if(decision < 0)
+      {
+        decision += (x << 2) + 6;
+      }
+      else
+      {
+        decision += ((x - y) << 2) + 10;
+        y--;
+      }
+      x++;
+    }
+    break;
+
+  case TILE_IMAGE:
+    for(y = y0; y < y1; y++)
+    {
+      src = (const uint32_t *)pPrim->pData + (uint32_t)(y - pPrim->Y) * pPrim->Param;
+      row = &pTile[(y - ty) * (int32_t)LCD_TILE_WIDTH];
+      for(x = x0; x < x1; x++)
+      {
+        pixel = src[x - pPrim->X];
+        alpha = ((pixel >> 24) * color + 127U) / 255U;
+        if(alpha != 0U)
+        {
+          row[x - tx] = TILE_Blend(row[x - tx], pixel, alpha);
+        }
+      }
+    }
+    Stats.PixelsShaded += (uint32_t)((x1 - x0) * (y1 - y0));
+    break;
+
+  case TILE_STRING:
+    pen  = pPrim->X;
+    prev = 0;
+    text = (const uint8_t *)pPrim->pData;
+    while((pen < x1) && ((code = LCD_Font_DecodeUTF8(&text)) != 0U))
+    {
+      glyph = LCD_Font_GetGlyph(pPrim->pFont, code);
+      if(glyph == NULL)
+      {
+        continue;
+      }
+      pen += LCD_Font_GetKerning(pPrim->pFont, prev, code);
+      prev = code;
+      gx  = pen + glyph->XOffset;
+      gy  = pPrim->Y + glyph->YOffset;
+      pen += glyph->Advance;
+
+      gx0 = (gx > x0) ? gx : x0;
+      gy0 = (gy > y0) ? gy : y0;
+      gx1 = ((gx + glyph->Width) < x1) ? (gx + glyph->Width) : x1;
+      gy1 = ((gy + glyph->Height) < y1) ? (gy + glyph->Height) : y1;
+      if((gx0 >= gx1) || (gy0 >= gy1))
+      {
+        continue;
+      }
+
+      mask = (const uint8_t *)(uintptr_t)LCD_Font_GetGlyphA8(pPrim->pFont, code);
+      if(mask == NULL)
+      {
+        continue;
+      }
+      for(y = gy0; y < gy1; y++)
+      {
+        row = &pTile[(y - ty) * (int32_t)LCD_TILE_WIDTH];
+        for(x = gx0; x < gx1; x++)
+        {
+          alpha = (mask[(y - gy) * glyph->Width + (x - gx)] * (color >> 24) + 127U) / 255U;
+          if(alpha != 0U)
+          {
+            row[x - tx] = TILE_Blend(row[x - tx], color, alpha);
+          }
+        }
+      }
+      Stats.PixelsShaded += (uint32_t)((gx1 - gx0) * (gy1 - gy0));
+    }
+    break;
+
+  default:
+    break;
+  }
+}
+
+/**
+  * @brief  把颜色按透明度混合到ARGB8888像素上，算法与LCD_BlendSpan相同
+  * @param  Dst: 原像素
+  * @param  Color: 颜色，只使用RGB
+  * @param  Alpha: 透明度
+  * @retval 混合后的像素
+  */
+static uint32_t TILE_Blend(uint32_t Dst, uint32_t Color, uint32_t Alpha)
+{
+  uint32_t rb, g, a;
+
+  if(Alpha == 0xFFU)
+  {
+    return Color | 0xFF000000U;
+  }
+  /* t / 255四舍五入，与LCD_BlendSpan逐位相同 */
+  rb = ((Color & 0xFF00FF) * Alpha) + ((Dst & 0xFF00FF) * (255U - Alpha)) + 0x800080U;
+  rb = ((rb + ((rb >> 8) & 0xFF00FF)) >> 8) & 0xFF00FF;
+  g  = (((Color >> 8) & 0xFFU) * Alpha) + (((Dst >> 8) & 0xFFU) * (255U - Alpha)) + 0x80U;
+  g  = ((g + (g >> 8)) >> 8) << 8;
+  a  = Alpha + ((Dst >> 24) * (255U - Alpha) + 127U) / 255U;
+  return (a << 24) | rb | g;
+}
+
+/**
+  * @brief  在图块缓冲区中填充一行(包含两端)，裁剪到图元与图块相交的矩形
+  * @param  pTile: 图块缓冲区，行宽LCD_TILE_WIDTH
+  * @param  tx, ty: 图块左上角在层中的坐标
+  * @param  pClip: 裁剪矩形{x0, y0, x1, y1}，右下角不包含
+  * @param  Y: 行的Y坐标
+  * @param  Left, Right: 行的两端
+  * @param  Color: ARGB8888颜色，不是完全不透明时混合
+  * @retval 无
+  */
+static void TILE_Span(uint32_t *pTile, int32_t tx, int32_t ty, const int32_t *pClip, int32_t Y, int32_t Left, int32_t Right, uint32_t Color)
+{
+  uint32_t *row;
+  uint32_t alpha = Color >> 24;
+  int32_t  x;
+
+  Left  = (Left > pClip[0]) ? Left : pClip[0];
+  Right = (Right < (pClip[2] - 1)) ? Right : (pClip[2] - 1);
+  if((Y < pClip[1]) || (Y >= pClip[3]) || (Left > Right))
+  {
+    return;
+  }
+
+  row = &pTile[(Y - ty) * (int32_t)LCD_TILE_WIDTH];
+  for(x = Left; x <= Right; x++)
+  {
+    row[x - tx] = (alpha == 0xFFU) ? Color : TILE_Blend(row[x - tx], Color, alpha);
+  }
+  Stats.PixelsShaded += (uint32_t)(Right - Left + 1);
+}
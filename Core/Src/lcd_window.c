@@ -0,0 +1,348 @@
+#include "lcd_window.h"
+#include "lcd_display.h"
+#include "lcd_backend.h"
+#include "lcd_prof.h"
+
+extern LTDC_HandleTypeDef hltdc;
+
+#define Ltdc_Handler hltdc
+
+/**
+  * @brief  窗口：层的图像(可大于屏幕)中的一块区域显示在屏幕上的一个位置
+  */
+typedef struct
+{
+  uint32_t Address;       /* 图像首地址 */
+  uint16_t Width;         /* 图像宽度，即行距(像素) */
+  uint16_t Height;        /* 图像高度 */
+  int16_t  X, Y;          /* 窗口在屏幕上的位置，可以部分在屏幕外 */
+  uint16_t ViewWidth;     /* 窗口宽度 */
+  uint16_t ViewHeight;    /* 窗口高度 */
+  uint16_t ScrollX;       /* 窗口左上角对应的图像坐标 */
+  uint16_t ScrollY;
+  uint8_t  Alpha;         /* 层透明度常量 */
+  uint8_t  Visible;
+  uint8_t  KeyEnable;     /* 色键使能 */
+  uint8_t  Changed;       /* 下次提交时需要重新设置层寄存器 */
+  uint32_t Key;           /* 色键，RGB888 */
+}WINDOW_TypeDef;
+
+static WINDOW_TypeDef Window[MAX_LAYER_NUMBER];
+static LCD_WindowStatsTypeDef Stats;
+
+static void WINDOW_Apply(uint32_t LayerIndex);
+
+/**
+  * @brief  把层作为窗口使用：初始化层的图像，窗口大小与屏幕相同、位于左上角
+  * @note   之后可以用LCD_SelectLayer选择该层，在整个图像上绘图；移动、滚动、渐隐窗口
+  *         只修改LTDC寄存器，不复制像素
+  * @param  LayerIndex: 前景层(层1)或者背景层(层0)
+  * @param  Address: 图像首地址
+  * @param  PixelFormat: 像素格式
+  * @param  Width, Height: 图像大小，可以大于屏幕
+  * @retval HAL状态
+  */
+HAL_StatusTypeDef LCD_Window_Create(uint32_t LayerIndex, uint32_t Address, uint32_t PixelFormat, uint16_t Width, uint16_t Height)
+{
+  WINDOW_TypeDef *win;
+  uint32_t xsize = Ltdc_Handler.Init.AccumulatedActiveW - Ltdc_Handler.Init.AccumulatedHBP;
+  uint32_t ysize = Ltdc_Handler.Init.AccumulatedActiveH - Ltdc_Handler.Init.AccumulatedVBP;
+
+  if((LayerIndex >= MAX_LAYER_NUMBER) || (Width == 0U) || (Height == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  LCD_LayerInitSize((uint16_t)LayerIndex, Address, PixelFormat, Width, Height);
+
+  win = &Window[LayerIndex];
+  win->Address    = Address;
+  win->Width      = Width;
+  win->Height     = Height;
+  win->X          = 0;
+  win->Y          = 0;
+  win->ViewWidth  = (uint16_t)((Width < xsize) ? Width : xsize);
+  win->ViewHeight = (uint16_t)((Height < ysize) ? Height : ysize);
+  win->ScrollX    = 0;
+  win->ScrollY    = 0;
+  win->Alpha      = 255;
+  win->Visible    = 1;
+  win->KeyEnable  = 0;
+  win->Key        = 0;
+  win->Changed    = 1;
+  return HAL_OK;
+}
+
+/**
+  * @brief  设置窗口在屏幕上的位置，移出屏幕的部分不显示
+  * @param  LayerIndex: 层
+  * @param  Xpos, Ypos: 窗口左上角的屏幕坐标，可以为负
+  * @retval 无
+  */
+void LCD_Window_SetPosition(uint32_t LayerIndex, int16_t Xpos, int16_t Ypos)
+{
+  if(LayerIndex >= MAX_LAYER_NUMBER)
+  {
+    return;
+  }
+
+  Window[LayerIndex].X       = Xpos;
+  Window[LayerIndex].Y       = Ypos;
+  Window[LayerIndex].Changed = 1;
+}
+
+/**
+  * @brief  设置窗口大小，超出图像的部分被裁掉
+  * @param  LayerIndex: 层
+  * @param  Width, Height: 窗口大小
+  * @retval 无
+  */
+void LCD_Window_SetSize(uint32_t LayerIndex, uint16_t Width, uint16_t Height)
+{
+  if(LayerIndex >= MAX_LAYER_NUMBER)
+  {
+    return;
+  }
+
+  Window[LayerIndex].ViewWidth  = Width;
+  Window[LayerIndex].ViewHeight = Height;
+  Window[LayerIndex].Changed    = 1;
+}
+
+/**
+  * @brief  设置窗口显示的图像区域，即硬件滚动
+  * @param  LayerIndex: 层
+  * @param  Xoffset, Yoffset: 窗口左上角对应的图像坐标
+  * @retval 无
+  */
+void LCD_Window_Scroll(uint32_t LayerIndex, uint16_t Xoffset, uint16_t Yoffset)
+{
+  if(LayerIndex >= MAX_LAYER_NUMBER)
+  {
+    return;
+  }
+
+  Window[LayerIndex].ScrollX = Xoffset;
+  Window[LayerIndex].ScrollY = Yoffset;
+  Window[LayerIndex].Changed = 1;
+}
+
+/**
+  * @brief  设置窗口透明度，与像素自身的透明度相乘后和下层混合
+  * @param  LayerIndex: 层
+  * @param  Alpha: 透明度，0为完全透明
+  * @retval 无
+  */
+void LCD_Window_SetAlpha(uint32_t LayerIndex, uint8_t Alpha)
+{
+  if(LayerIndex >= MAX_LAYER_NUMBER)
+  {
+    return;
+  }
+
+  Window[LayerIndex].Alpha   = Alpha;
+  Window[LayerIndex].Changed = 1;
+}
+
+/**
+  * @brief  设置色键，颜色等于色键的像素完全透明
+  * @param  LayerIndex: 层
+  * @param  RGBValue: 色键，RGB888
+  * @param  State: 使能或者禁能
+  * @retval 无
+  */
+void LCD_Window_SetColorKey(uint32_t LayerIndex, uint32_t RGBValue, FunctionalState State)
+{
+  if(LayerIndex >= MAX_LAYER_NUMBER)
+  {
+    return;
+  }
+
+  Window[LayerIndex].Key       = RGBValue & 0xFFFFFF;
+  Window[LayerIndex].KeyEnable = (State == ENABLE) ? 1U : 0U;
+  Window[LayerIndex].Changed   = 1;
+}
+
+/**
+  * @brief  显示或隐藏窗口
+  * @param  LayerIndex: 层
+  * @param  State: 使能或者禁能
+  * @retval 无
+  */
+void LCD_Window_SetVisible(uint32_t LayerIndex, FunctionalState State)
+{
+  if(LayerIndex >= MAX_LAYER_NUMBER)
+  {
+    return;
+  }
+
+  Window[LayerIndex].Visible = (State == ENABLE) ? 1U : 0U;
+  Window[LayerIndex].Changed = 1;
+}
+
+/**
+  * @brief  改变窗口显示的图像地址，例如交换链翻转后的前台缓冲区；图像大小和格式不变
+  * @param  LayerIndex: 层
+  * @param  Address: 图像首地址
+  * @retval 无
+  */
+void LCD_Window_SetAddress(uint32_t LayerIndex, uint32_t Address)
+{
+  if(LayerIndex >= MAX_LAYER_NUMBER)
+  {
+    return;
+  }
+
+  Window[LayerIndex].Address = Address;
+  Window[LayerIndex].Changed = 1;
+}
+
+/**
+  * @brief  提交所有窗口的修改，在下一次垂直消隐时一起生效，不会出现撕裂
+  * @note   上一次提交尚未生效时先等待，避免消隐期间寄存器只更新了一半
+  * @retval 无
+  */
+void LCD_Window_Commit(void)
+{
+  uint32_t i;
+  uint32_t changed = 0;
+
+  LCD_PROF_BEGIN(LCD_PROF_WINDOW);
+  if(LCD_GetBackend()->ReloadPending() != 0U)
+  {
+    Stats.ReloadWaits++;
+    LCD_PROF_STALL_BEGIN();
+    while(LCD_GetBackend()->ReloadPending() != 0U)
+    {
+      LCD_GetBackend()->Idle();
+    }
+    LCD_PROF_STALL_END(1);
+  }
+
+  for(i = 0; i < MAX_LAYER_NUMBER; i++)
+  {
+    if((Window[i].Width != 0U) && (Window[i].Changed != 0U))
+    {
+      WINDOW_Apply(i);
+      Window[i].Changed = 0;
+      changed = 1;
+    }
+  }
+
+  if(changed != 0U)
+  {
+    LCD_GetBackend()->Reload(LCD_RELOAD_VBLANK);
+  }
+  Stats.Commits++;
+  LCD_PROF_END();
+}
+
+/**
+  * @brief  查询层是否作为窗口使用
+  * @param  LayerIndex: 层
+  * @retval 1: 是  0: 否
+  */
+uint32_t LCD_Window_IsActive(uint32_t LayerIndex)
+{
+  return ((LayerIndex < MAX_LAYER_NUMBER) && (Window[LayerIndex].Width != 0U)) ? 1U : 0U;
+}
+
+/**
+  * @brief  立即写入一个窗口的修改，供LCD_SetTransparency等直接设置层寄存器的函数使用
+  * @note   该窗口尚未提交的其他修改同时生效
+  * @param  LayerIndex: 层
+  * @param  Reload: LCD_RELOAD_NONE/LCD_RELOAD_IMMEDIATE/LCD_RELOAD_VBLANK
+  * @retval 无
+  */
+void LCD_Window_Update(uint32_t LayerIndex, uint32_t Reload)
+{
+  if(LayerIndex >= MAX_LAYER_NUMBER)
+  {
+    return;
+  }
+
+  WINDOW_Apply(LayerIndex);
+  Window[LayerIndex].Changed = 0;
+  LCD_GetBackend()->Reload(Reload);
+}
+
+/**
+  * @brief  不再把层作为窗口使用，由LCD_LayerInitSize调用
+  * @param  LayerIndex: 层
+  * @retval 无
+  */
+void LCD_Window_Release(uint32_t LayerIndex)
+{
+  if(LayerIndex >= MAX_LAYER_NUMBER)
+  {
+    return;
+  }
+
+  Window[LayerIndex].Width   = 0;
+  Window[LayerIndex].Changed = 0;
+}
+
+/**
+  * @brief  读取窗口合成统计
+  * @param  pStats: 输出统计数据
+  * @retval 无
+  */
+void LCD_Window_GetStats(LCD_WindowStatsTypeDef *pStats)
+{
+  *pStats = Stats;
+}
+
+/**
+  * @brief  把窗口裁剪到屏幕和图像内，写入层的影子寄存器
+  * @note   写入层参数时后端会用显示参数覆盖句柄中的层配置，写完后恢复整个图像的配置，
+  *         绘图函数和LCD_SetLayerAddress等仍然按整个图像工作，窗口参数只保存在Window中
+  * @param  LayerIndex: 层
+  * @retval 无
+  */
+static void WINDOW_Apply(uint32_t LayerIndex)
+{
+  WINDOW_TypeDef *win = &Window[LayerIndex];
+  LTDC_LayerCfgTypeDef image = Ltdc_Handler.LayerCfg[LayerIndex];
+  LTDC_LayerCfgTypeDef cfg;
+  int32_t  xsize = (int32_t)(Ltdc_Handler.Init.AccumulatedActiveW - Ltdc_Handler.Init.AccumulatedHBP);
+  int32_t  ysize = (int32_t)(Ltdc_Handler.Init.AccumulatedActiveH - Ltdc_Handler.Init.AccumulatedVBP);
+  int32_t  x0, y0, x1, y1, sx, sy;
+  uint32_t bpp = LCD_GetStride(LayerIndex) / win->Width;
+
+  image.FBStartAdress = win->Address;
+  cfg = image;
+
+  /* 窗口在屏幕上的可见部分，同时不能超出图像 */
+  x0 = win->X;
+  y0 = win->Y;
+  x1 = x0 + (((win->ViewWidth + win->ScrollX) <= win->Width) ? win->ViewWidth : (win->Width - win->ScrollX));
+  y1 = y0 + (((win->ViewHeight + win->ScrollY) <= win->Height) ? win->ViewHeight : (win->Height - win->ScrollY));
+  sx = (int32_t)win->ScrollX + ((x0 < 0) ? -x0 : 0);
+  sy = (int32_t)win->ScrollY + ((y0 < 0) ? -y0 : 0);
+  x0 = (x0 < 0) ? 0 : x0;
+  y0 = (y0 < 0) ? 0 : y0;
+  x1 = (x1 > xsize) ? xsize : x1;
+  y1 = (y1 > ysize) ? ysize : y1;
+
+  if((win->Visible == 0U) || (win->ScrollX >= win->Width) || (win->ScrollY >= win->Height) ||
+     (x0 >= x1) || (y0 >= y1))
+  {
+    LCD_GetBackend()->EnableLayer(LayerIndex, DISABLE, LCD_RELOAD_NONE);
+    Stats.LayerUpdates++;
+    return;
+  }
+
+  cfg.WindowX0      = (uint32_t)x0;
+  cfg.WindowX1      = (uint32_t)x1;
+  cfg.WindowY0      = (uint32_t)y0;
+  cfg.WindowY1      = (uint32_t)y1;
+  cfg.FBStartAdress = win->Address + ((uint32_t)sy * win->Width + (uint32_t)sx) * bpp;
+  cfg.ImageWidth    = win->Width;
+  cfg.ImageHeight   = (uint32_t)(y1 - y0);
+  cfg.Alpha         = win->Alpha;
+  LCD_GetBackend()->ConfigLayer(&cfg, LayerIndex, LCD_RELOAD_NONE);
+  Ltdc_Handler.LayerCfg[LayerIndex] = image;
+
+  LCD_GetBackend()->ColorKey(LayerIndex, (win->KeyEnable != 0U) ? ENABLE : DISABLE, win->Key);
+  Stats.LayerUpdates++;
+}
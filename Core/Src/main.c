@@ -20,6 +20,7 @@
 /* Includes ------------------------------------------------------------------*/
 #include "main.h"
 #include "dma2d.h"
+#include "jpeg.h"
 #include "ltdc.h"
 #include "tim.h"
 #include "usart.h"
@@ -29,6 +30,14 @@
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
 #include "lcd_display.h"
+#include "lcd_dma2d.h"
+#include "lcd_chart.h"
+#include "lcd_prof.h"
+#include "lcd_jpeg.h"
+#include "memsys.h"
+#include "memheap.h"
+#include "dsp_bench.h"
+#include "sdram_bench.h"
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
@@ -48,7 +57,9 @@
 /* Private variables ---------------------------------------------------------*/
 
 /* USER CODE BEGIN PV */
-
+/* 传感器曲线，采样由SysTick中断写入 */
+static LCD_ChartTypeDef SensorChart;
+static int16_t SensorSamples[1024];
 /* USER CODE END PV */
 
 /* Private function prototypes -----------------------------------------------*/
@@ -74,10 +85,13 @@ void rock_lcd_test()
   /* 第一层清屏，显示全黑 */ 
   LCD_Clear(LCD_COLOR_BLACK); 
 
+  /* LCD 第二层初始化，显存紧跟在第一层之后 */
+  LCD_LayerInit(1, LCD_FB_START_ADDRESS + LCD_PIXEL_WIDTH * LCD_PIXEL_HEIGHT * 4, ARGB8888);
+
   /* 选择LCD第二层 */
   LCD_SelectLayer(1);
 
-  /* 第二层清屏，显示全黑 */ 
+  /* 第二层清屏，全透明，显示第一层 */ 
   LCD_Clear(LCD_COLOR_TRANSPARENT);
 
 
@@ -92,6 +106,30 @@ void rock_lcd_test()
 
   LCD_SetColors(LCD_COLOR_GREEN,LCD_COLOR_GREEN);
   LCD_DrawCircle(200,350,50);
+
+  /* 传感器曲线显示在第一层上方 */
+  LCD_Chart_Init(&SensorChart, SensorSamples, 1024, 0, 50, 20, 700, 200);
+  LCD_Chart_SetRange(&SensorChart, -2048, 2047, 1);
+}
+
+/**
+  * @brief  采集一个传感器采样，在中断中调用
+  * @note   没有接传感器时用三角波加噪声代替
+  * @param  无
+  * @retval 无
+  */
+void Sensor_SampleISR(void)
+{
+  static uint32_t phase = 0;
+  static uint32_t seed = 1;
+  int32_t sample;
+
+  phase = (phase + 16U) & 0xFFFU;
+  sample = (phase < 0x800U) ? (int32_t)phase - 0x400 : 0xC00 - (int32_t)phase;
+  seed = seed * 1664525U + 1013904223U;
+  sample += (int32_t)(seed >> 26) - 32;
+
+  LCD_Chart_Push(&SensorChart, (int16_t)sample);
 }
 /* USER CODE END 0 */
 
@@ -102,7 +140,7 @@ void rock_lcd_test()
 int main(void)
 {
   /* USER CODE BEGIN 1 */
-
+  MEM_Init();
   /* USER CODE END 1 */
 
   /* MCU Configuration--------------------------------------------------------*/
@@ -128,7 +166,20 @@ int main(void)
   MX_FMC_Init();
   MX_LTDC_Init();
   MX_DMA2D_Init();
+  MX_JPEG_Init();
   /* USER CODE BEGIN 2 */
+  LCD_DMA2D_Init();
+#if SDRAM_BENCH
+  /* 调整FMC时序会破坏SDRAM中的数据，必须在使用SDRAM之前 */
+  SDRAM_Bench_Tune();
+#endif
+  MEM_ClearSdramBss();
+  MEM_Heap_Init();
+#if DSP_BENCH
+  DSP_Bench_Run(NULL, 0);
+#endif
+  LCD_PROF_INIT();
+  LCD_JPEG_Init();
   rock_lcd_test();
   /* USER CODE END 2 */
 
@@ -139,6 +190,10 @@ int main(void)
     /* USER CODE END WHILE */
 
     /* USER CODE BEGIN 3 */
+    LCD_Chart_Update(&SensorChart);
+    LCD_PROF_FRAME();
+    MEM_Heap_FrameEnd();
+    HAL_Delay(16);
   }
   /* USER CODE END 3 */
 }
@@ -0,0 +1,655 @@
+#include "memheap.h"
+#include "memsys.h"
+#include <stdio.h>
+#include <string.h>
+
+#define HEAP_ALIGN_UP(x, a)   (((x) + ((a) - 1U)) & ~((a) - 1U))
+
+#if MEM_TLSF
+/* TLSF块：头部两个字为物理上前一块的偏移和数据区大小(最低位为空闲标志)，空闲块的数据区前两个字为空闲链表指针 */
+#define TLSF_NIL              ((uint32_t)0xFFFFFFFF)
+#define TLSF_HEADER           ((uint32_t)8)
+#define TLSF_MIN              ((uint32_t)8)
+#define TLSF_FREE             ((uint32_t)1)
+#define TLSF_PREV_PHYS        0
+#define TLSF_SIZE             1
+#define TLSF_NEXT_FREE        2
+#define TLSF_PREV_FREE        3
+#define TLSF_WORD(h, o, i)    (((uint32_t *)(void *)((h)->Base + (o)))[i])
+#define TLSF_BLOCK_SIZE(h, o) (TLSF_WORD(h, o, TLSF_SIZE) & ~TLSF_FREE)
+#define TLSF_IS_FREE(h, o)    ((TLSF_WORD(h, o, TLSF_SIZE) & TLSF_FREE) != 0U)
+#define TLSF_SMALL            ((uint32_t)1 << MEM_TLSF_FL_SHIFT)
+#endif
+
+MEM_ArenaTypeDef MEM_FrameArena;
+#if MEM_TLSF
+MEM_TlsfTypeDef  MEM_SdramHeap;
+#endif
+
+/* MEM_Heap_Init管理的SDRAM，不经过缓存，DMA2D/LTDC可以直接使用 */
+static uint8_t SdramHeap[MEM_SDRAM_HEAP_SIZE] MEM_SDRAM_BSS __attribute__((aligned(32)));
+
+static uint8_t *HEAP_AlignBase(void *pBase, uint32_t *pSize);
+static void HEAP_Used(MEM_HeapStatsTypeDef *pStats, uint32_t Used);
+static void HEAP_Print(const char *pName, const MEM_HeapStatsTypeDef *pStats);
+#if MEM_TLSF
+static void TLSF_Mapping(uint32_t Size, uint32_t *pFl, uint32_t *pSl);
+static void TLSF_Insert(MEM_TlsfTypeDef *pHeap, uint32_t Block);
+static void TLSF_Remove(MEM_TlsfTypeDef *pHeap, uint32_t Block);
+static uint32_t TLSF_Find(const MEM_TlsfTypeDef *pHeap, uint32_t Size);
+#endif
+
+/**
+  * @brief  初始化区域分配器
+  * @param  pArena: 区域分配器
+  * @param  pBase: 管理的内存
+  * @param  Size: 字节数
+  * @retval 无
+  */
+void MEM_Arena_Init(MEM_ArenaTypeDef *pArena, void *pBase, uint32_t Size)
+{
+  memset(pArena, 0, sizeof(*pArena));
+  pArena->Base       = HEAP_AlignBase(pBase, &Size);
+  pArena->Stats.Size = Size;
+}
+
+/**
+  * @brief  从区域中分配，只移动分配位置
+  * @param  pArena: 区域分配器
+  * @param  Size: 字节数
+  * @param  Align: 地址对齐，2的幂，0表示MEM_ALIGN；DMA2D缓冲区放在写回缓存的内存中时用MEM_CACHE_LINE
+  * @retval 地址，空间不足时为NULL
+  */
+void *MEM_Arena_Alloc(MEM_ArenaTypeDef *pArena, uint32_t Size, uint32_t Align)
+{
+  uintptr_t address;
+  uint32_t  offset;
+
+  if(Align == 0U)
+  {
+    Align = MEM_ALIGN;
+  }
+  address = (uintptr_t)(pArena->Base + pArena->Offset);
+  offset  = pArena->Offset + (uint32_t)(((address + Align - 1U) & ~(uintptr_t)(Align - 1U)) - address);
+  if(((Align & (Align - 1U)) != 0U) || (offset > pArena->Stats.Size) || (Size > (pArena->Stats.Size - offset)))
+  {
+    pArena->Stats.Failures++;
+    return NULL;
+  }
+
+  pArena->Offset = offset + Size;
+  pArena->Stats.Allocs++;
+  HEAP_Used(&pArena->Stats, pArena->Offset);
+  return pArena->Base + offset;
+}
+
+/**
+  * @brief  记录当前分配位置，之后用MEM_Arena_Release一次释放此后的所有分配
+  * @param  pArena: 区域分配器
+  * @retval 分配位置
+  */
+uint32_t MEM_Arena_Mark(const MEM_ArenaTypeDef *pArena)
+{
+  return pArena->Offset;
+}
+
+/**
+  * @brief  回到MEM_Arena_Mark记录的位置
+  * @param  pArena: 区域分配器
+  * @param  Mark: 分配位置
+  * @retval 无
+  */
+void MEM_Arena_Release(MEM_ArenaTypeDef *pArena, uint32_t Mark)
+{
+  if(Mark <= pArena->Offset)
+  {
+    pArena->Offset     = Mark;
+    pArena->Stats.Used = Mark;
+  }
+}
+
+/**
+  * @brief  释放区域中的所有分配，最大使用量保留
+  * @param  pArena: 区域分配器
+  * @retval 无
+  */
+void MEM_Arena_Reset(MEM_ArenaTypeDef *pArena)
+{
+  pArena->Offset     = 0;
+  pArena->Stats.Used = 0;
+  pArena->Stats.Frees++;
+}
+
+/**
+  * @brief  初始化固定块内存池，不需要遍历所有块
+  * @param  pPool: 内存池
+  * @param  pBase: 管理的内存
+  * @param  Size: 字节数
+  * @param  BlockSize: 块大小，按MEM_ALIGN向上取整
+  * @retval 块数
+  */
+uint32_t MEM_Pool_Init(MEM_PoolTypeDef *pPool, void *pBase, uint32_t Size, uint32_t BlockSize)
+{
+  memset(pPool, 0, sizeof(*pPool));
+  if(BlockSize < sizeof(void *))
+  {
+    BlockSize = sizeof(void *);
+  }
+  pPool->Base       = HEAP_AlignBase(pBase, &Size);
+  pPool->BlockSize  = HEAP_ALIGN_UP(BlockSize, MEM_ALIGN);
+  pPool->Count      = Size / pPool->BlockSize;
+  pPool->Stats.Size = pPool->Count * pPool->BlockSize;
+  return pPool->Count;
+}
+
+/**
+  * @brief  分配一块，优先使用最近释放的块
+  * @param  pPool: 内存池
+  * @retval 地址，没有空闲块时为NULL
+  */
+void *MEM_Pool_Alloc(MEM_PoolTypeDef *pPool)
+{
+  uint32_t primask;
+  uint8_t  *block = NULL;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  if(pPool->FreeList != NULL)
+  {
+    block = (uint8_t *)pPool->FreeList;
+    pPool->FreeList = *(void **)(void *)block;
+  }
+  else if(pPool->Fresh < pPool->Count)
+  {
+    block = pPool->Base + pPool->Fresh * pPool->BlockSize;
+    pPool->Fresh++;
+  }
+
+  if(block != NULL)
+  {
+    pPool->Stats.Allocs++;
+    HEAP_Used(&pPool->Stats, pPool->Stats.Used + pPool->BlockSize);
+  }
+  else
+  {
+    pPool->Stats.Failures++;
+  }
+  __set_PRIMASK(primask);
+
+  return block;
+}
+
+/**
+  * @brief  释放一块
+  * @note   不属于内存池或没有对齐到块的地址不释放，计入Failures；重复释放不能检出
+  * @param  pPool: 内存池
+  * @param  pBlock: MEM_Pool_Alloc返回的地址，NULL时不操作
+  * @retval 无
+  */
+void MEM_Pool_Free(MEM_PoolTypeDef *pPool, void *pBlock)
+{
+  uint32_t primask;
+  uintptr_t offset = (uintptr_t)pBlock - (uintptr_t)pPool->Base;
+
+  if(pBlock == NULL)
+  {
+    return;
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  if((offset >= ((uintptr_t)pPool->Fresh * pPool->BlockSize)) || ((offset % pPool->BlockSize) != 0U))
+  {
+    pPool->Stats.Failures++;
+  }
+  else
+  {
+    *(void **)pBlock = pPool->FreeList;
+    pPool->FreeList  = pBlock;
+    pPool->Stats.Used -= pPool->BlockSize;
+    pPool->Stats.Frees++;
+  }
+  __set_PRIMASK(primask);
+}
+
+#if MEM_TLSF
+/**
+  * @brief  初始化TLSF分配器，整个区域为一个空闲块，末尾为大小为0的哨兵块
+  * @param  pHeap: 分配器
+  * @param  pBase: 管理的内存
+  * @param  Size: 字节数，超过2^MEM_TLSF_FL_MAX的部分不使用
+  * @retval HAL_OK: 成功 HAL_ERROR: 区域太小
+  */
+HAL_StatusTypeDef MEM_TLSF_Init(MEM_TlsfTypeDef *pHeap, void *pBase, uint32_t Size)
+{
+  uint32_t payload;
+
+  memset(pHeap, 0, sizeof(*pHeap));
+  memset(pHeap->Head, 0xFF, sizeof(pHeap->Head));
+  pHeap->Base = HEAP_AlignBase(pBase, &Size);
+  if(Size < (2U * TLSF_HEADER + TLSF_MIN))
+  {
+    return HAL_ERROR;
+  }
+
+  payload = Size - 2U * TLSF_HEADER;
+  if(payload >= ((uint32_t)1 << MEM_TLSF_FL_MAX))
+  {
+    payload = ((uint32_t)1 << MEM_TLSF_FL_MAX) - MEM_ALIGN;
+  }
+  TLSF_WORD(pHeap, 0, TLSF_PREV_PHYS) = TLSF_NIL;
+  TLSF_WORD(pHeap, 0, TLSF_SIZE)      = payload | TLSF_FREE;
+  TLSF_WORD(pHeap, TLSF_HEADER + payload, TLSF_PREV_PHYS) = 0;
+  TLSF_WORD(pHeap, TLSF_HEADER + payload, TLSF_SIZE)      = 0;
+  TLSF_Insert(pHeap, 0);
+  pHeap->Stats.Size = payload;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  分配内存：按大小类找到第一个足够大的空闲块，多余的部分分出去放回空闲链表
+  * @note   查找时把大小向上取到大小类的上界，所以一次能分配的大小比最大的空闲块最多小1/16
+  * @param  pHeap: 分配器
+  * @param  Size: 字节数
+  * @retval 按MEM_ALIGN对齐的地址，空间不足时为NULL
+  */
+void *MEM_TLSF_Alloc(MEM_TlsfTypeDef *pHeap, uint32_t Size)
+{
+  uint32_t primask;
+  uint32_t block, size, rest;
+  void     *data = NULL;
+
+  size = (Size < TLSF_MIN) ? TLSF_MIN : HEAP_ALIGN_UP(Size, MEM_ALIGN);
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  block = ((Size <= pHeap->Stats.Size) && (size >= Size)) ? TLSF_Find(pHeap, size) : TLSF_NIL;
+  if(block != TLSF_NIL)
+  {
+    TLSF_Remove(pHeap, block);
+    rest = TLSF_BLOCK_SIZE(pHeap, block);
+    if(rest >= (size + TLSF_HEADER + TLSF_MIN))
+    {
+      /* 分出后面的部分 */
+      rest -= size + TLSF_HEADER;
+      TLSF_WORD(pHeap, block + TLSF_HEADER + size, TLSF_PREV_PHYS) = block;
+      TLSF_WORD(pHeap, block + TLSF_HEADER + size, TLSF_SIZE)      = rest | TLSF_FREE;
+      TLSF_WORD(pHeap, block + 2U * TLSF_HEADER + size + rest, TLSF_PREV_PHYS) = block + TLSF_HEADER + size;
+      TLSF_Insert(pHeap, block + TLSF_HEADER + size);
+    }
+    else
+    {
+      size = rest;
+    }
+    TLSF_WORD(pHeap, block, TLSF_SIZE) = size;
+    pHeap->Stats.Allocs++;
+    HEAP_Used(&pHeap->Stats, pHeap->Stats.Used + size);
+    data = pHeap->Base + block + TLSF_HEADER;
+  }
+  else
+  {
+    pHeap->Stats.Failures++;
+  }
+  __set_PRIMASK(primask);
+
+  return data;
+}
+
+/**
+  * @brief  释放内存，与物理上相邻的空闲块合并
+  * @note   不在区域内、没有对齐或已经空闲的地址不释放，计入Failures
+  * @param  pHeap: 分配器
+  * @param  pData: MEM_TLSF_Alloc返回的地址，NULL时不操作
+  * @retval 无
+  */
+void MEM_TLSF_Free(MEM_TlsfTypeDef *pHeap, void *pData)
+{
+  uint32_t primask;
+  uint32_t block, next, prev, size;
+  uintptr_t offset = (uintptr_t)pData - (uintptr_t)pHeap->Base;
+
+  if(pData == NULL)
+  {
+    return;
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  if((offset < TLSF_HEADER) || (offset > pHeap->Stats.Size) || ((offset % MEM_ALIGN) != 0U) ||
+     TLSF_IS_FREE(pHeap, (uint32_t)offset - TLSF_HEADER))
+  {
+    pHeap->Stats.Failures++;
+    __set_PRIMASK(primask);
+    return;
+  }
+
+  block = (uint32_t)offset - TLSF_HEADER;
+  size  = TLSF_BLOCK_SIZE(pHeap, block);
+  pHeap->Stats.Used -= size;
+  pHeap->Stats.Frees++;
+
+  next = block + TLSF_HEADER + size;
+  if(TLSF_IS_FREE(pHeap, next))
+  {
+    TLSF_Remove(pHeap, next);
+    size += TLSF_HEADER + TLSF_BLOCK_SIZE(pHeap, next);
+  }
+  prev = TLSF_WORD(pHeap, block, TLSF_PREV_PHYS);
+  if((prev != TLSF_NIL) && TLSF_IS_FREE(pHeap, prev))
+  {
+    TLSF_Remove(pHeap, prev);
+    size += TLSF_HEADER + TLSF_BLOCK_SIZE(pHeap, prev);
+    block = prev;
+  }
+  TLSF_WORD(pHeap, block, TLSF_SIZE) = size | TLSF_FREE;
+  TLSF_WORD(pHeap, block + TLSF_HEADER + size, TLSF_PREV_PHYS) = block;
+  TLSF_Insert(pHeap, block);
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  读取已分配块的实际大小，不小于申请的大小
+  * @param  pHeap: 分配器
+  * @param  pData: MEM_TLSF_Alloc返回的地址
+  * @retval 字节数
+  */
+uint32_t MEM_TLSF_BlockSize(const MEM_TlsfTypeDef *pHeap, const void *pData)
+{
+  return TLSF_BLOCK_SIZE(pHeap, (uint32_t)((const uint8_t *)pData - pHeap->Base) - TLSF_HEADER);
+}
+
+/**
+  * @brief  检查块链和空闲链表是否一致，遍历所有块，只用于调试和测试
+  * @param  pHeap: 分配器
+  * @param  pFree: 输出空闲字节数，可以为NULL
+  * @param  pLargest: 输出最大的空闲块，可以为NULL
+  * @retval HAL_OK: 一致 HAL_ERROR: 发现错误
+  */
+HAL_StatusTypeDef MEM_TLSF_Check(const MEM_TlsfTypeDef *pHeap, uint32_t *pFree, uint32_t *pLargest)
+{
+  uint32_t block = 0, prev = TLSF_NIL, size, used = 0, avail = 0, largest = 0, count = 0, blocks = 0, listed = 0;
+  uint32_t end = TLSF_HEADER + pHeap->Stats.Size;
+  uint32_t fl, sl, f, s, node, back;
+  uint8_t  last_free = 0;
+
+  /* 物理块链：前后链接一致，不存在相邻的空闲块 */
+  while(block < end)
+  {
+    size = TLSF_BLOCK_SIZE(pHeap, block);
+    if((TLSF_WORD(pHeap, block, TLSF_PREV_PHYS) != prev) || ((size % MEM_ALIGN) != 0U) || (size < TLSF_MIN) ||
+       ((block + TLSF_HEADER + size) > end))
+    {
+      return HAL_ERROR;
+    }
+    if(TLSF_IS_FREE(pHeap, block))
+    {
+      if(last_free != 0U)
+      {
+        return HAL_ERROR;
+      }
+      avail += size;
+      blocks++;
+      largest = (size > largest) ? size : largest;
+    }
+    else
+    {
+      used += size;
+    }
+    last_free = TLSF_IS_FREE(pHeap, block) ? 1U : 0U;
+    count++;
+    prev  = block;
+    block += TLSF_HEADER + size;
+  }
+  if((block != end) || (TLSF_WORD(pHeap, end, TLSF_PREV_PHYS) != prev) || (TLSF_WORD(pHeap, end, TLSF_SIZE) != 0U) ||
+     (used != pHeap->Stats.Used) || ((used + avail + TLSF_HEADER * (count - 1U)) != pHeap->Stats.Size))
+  {
+    return HAL_ERROR;
+  }
+
+  /* 空闲链表：每块都空闲、属于该大小类，位图与链表是否为空一致 */
+  for(fl = 0; fl < MEM_TLSF_FL_COUNT; fl++)
+  {
+    if((((pHeap->FlBitmap >> fl) & 1U) != 0U) != (pHeap->SlBitmap[fl] != 0U))
+    {
+      return HAL_ERROR;
+    }
+    for(sl = 0; sl < MEM_TLSF_SL_COUNT; sl++)
+    {
+      if((((pHeap->SlBitmap[fl] >> sl) & 1U) != 0U) != (pHeap->Head[fl][sl] != TLSF_NIL))
+      {
+        return HAL_ERROR;
+      }
+      back = TLSF_NIL;
+      for(node = pHeap->Head[fl][sl]; node != TLSF_NIL; node = TLSF_WORD(pHeap, node, TLSF_NEXT_FREE))
+      {
+        TLSF_Mapping(TLSF_BLOCK_SIZE(pHeap, node), &f, &s);
+        if(!TLSF_IS_FREE(pHeap, node) || (f != fl) || (s != sl) ||
+           (TLSF_WORD(pHeap, node, TLSF_PREV_FREE) != back) || (++listed > blocks))
+        {
+          return HAL_ERROR;
+        }
+        back = node;
+      }
+    }
+  }
+  if(listed != blocks)
+  {
+    return HAL_ERROR;
+  }
+
+  if(pFree != NULL)
+  {
+    *pFree = avail;
+  }
+  if(pLargest != NULL)
+  {
+    *pLargest = largest;
+  }
+  return HAL_OK;
+}
+#endif /* MEM_TLSF */
+
+/**
+  * @brief  在SDRAM中建立每帧的临时区域和TLSF分配器，在MEM_ClearSdramBss之后调用
+  * @retval HAL_OK: 成功 HAL_ERROR: MEM_FRAME_ARENA_SIZE不小于MEM_SDRAM_HEAP_SIZE
+  */
+HAL_StatusTypeDef MEM_Heap_Init(void)
+{
+#if MEM_TLSF
+  if(MEM_FRAME_ARENA_SIZE >= MEM_SDRAM_HEAP_SIZE)
+  {
+    return HAL_ERROR;
+  }
+  MEM_Arena_Init(&MEM_FrameArena, SdramHeap, MEM_FRAME_ARENA_SIZE);
+  return MEM_TLSF_Init(&MEM_SdramHeap, SdramHeap + MEM_FRAME_ARENA_SIZE, MEM_SDRAM_HEAP_SIZE - MEM_FRAME_ARENA_SIZE);
+#else
+  MEM_Arena_Init(&MEM_FrameArena, SdramHeap, MEM_SDRAM_HEAP_SIZE);
+  return HAL_OK;
+#endif
+}
+
+/**
+  * @brief  一帧结束，释放每帧临时区域中的所有分配
+  * @retval 无
+  */
+void MEM_Heap_FrameEnd(void)
+{
+  MEM_Arena_Reset(&MEM_FrameArena);
+}
+
+/**
+  * @brief  通过printf(USART1)输出SDRAM分配器的使用量和最大使用量
+  * @retval 无
+  */
+void MEM_Heap_Report(void)
+{
+  HEAP_Print("frame arena", &MEM_FrameArena.Stats);
+#if MEM_TLSF
+  HEAP_Print("sdram heap", &MEM_SdramHeap.Stats);
+#endif
+}
+
+/**
+  * @brief  把区域起始地址按MEM_ALIGN向上对齐，大小相应减小并按MEM_ALIGN向下取整
+  * @param  pBase: 起始地址
+  * @param  pSize: 输入输出字节数
+  * @retval 对齐后的起始地址
+  */
+static uint8_t *HEAP_AlignBase(void *pBase, uint32_t *pSize)
+{
+  uint32_t skip = (uint32_t)((MEM_ALIGN - ((uintptr_t)pBase & (MEM_ALIGN - 1U))) & (MEM_ALIGN - 1U));
+
+  *pSize = (*pSize > skip) ? ((*pSize - skip) & ~(MEM_ALIGN - 1U)) : 0U;
+  return (uint8_t *)pBase + skip;
+}
+
+/**
+  * @brief  更新使用量和最大使用量
+  * @param  pStats: 统计
+  * @param  Used: 新的使用量
+  * @retval 无
+  */
+static void HEAP_Used(MEM_HeapStatsTypeDef *pStats, uint32_t Used)
+{
+  pStats->Used = Used;
+  if(Used > pStats->HighWater)
+  {
+    pStats->HighWater = Used;
+  }
+}
+
+/**
+  * @brief  输出一个分配器的统计
+  * @param  pName: 名称
+  * @param  pStats: 统计
+  * @retval 无
+  */
+static void HEAP_Print(const char *pName, const MEM_HeapStatsTypeDef *pStats)
+{
+  printf("%-12s %8lu used %8lu peak %8lu size, %lu allocs %lu frees %lu failures\r\n", pName,
+         (unsigned long)pStats->Used, (unsigned long)pStats->HighWater, (unsigned long)pStats->Size,
+         (unsigned long)pStats->Allocs, (unsigned long)pStats->Frees, (unsigned long)pStats->Failures);
+}
+
+#if MEM_TLSF
+/**
+  * @brief  块大小对应的一级和二级索引：小于TLSF_SMALL的块按MEM_ALIGN线性分类，
+  *         更大的块按最高位所在的2的幂区间分类，区间内再按次高的MEM_TLSF_SL_LOG2位分类
+  * @param  Size: 块大小
+  * @param  pFl: 输出一级索引
+  * @param  pSl: 输出二级索引
+  * @retval 无
+  */
+static void TLSF_Mapping(uint32_t Size, uint32_t *pFl, uint32_t *pSl)
+{
+  uint32_t msb;
+
+  if(Size < TLSF_SMALL)
+  {
+    *pFl = 0;
+    *pSl = Size / (TLSF_SMALL / MEM_TLSF_SL_COUNT);
+  }
+  else
+  {
+    msb  = 31U - (uint32_t)__builtin_clz(Size);
+    *pSl = (Size >> (msb - MEM_TLSF_SL_LOG2)) ^ MEM_TLSF_SL_COUNT;
+    *pFl = msb - (MEM_TLSF_FL_SHIFT - 1U);
+  }
+}
+
+/**
+  * @brief  把空闲块放到所属大小类链表的开头
+  * @param  pHeap: 分配器
+  * @param  Block: 块偏移
+  * @retval 无
+  */
+static void TLSF_Insert(MEM_TlsfTypeDef *pHeap, uint32_t Block)
+{
+  uint32_t fl, sl, next;
+
+  TLSF_Mapping(TLSF_BLOCK_SIZE(pHeap, Block), &fl, &sl);
+  next = pHeap->Head[fl][sl];
+  TLSF_WORD(pHeap, Block, TLSF_NEXT_FREE) = next;
+  TLSF_WORD(pHeap, Block, TLSF_PREV_FREE) = TLSF_NIL;
+  if(next != TLSF_NIL)
+  {
+    TLSF_WORD(pHeap, next, TLSF_PREV_FREE) = Block;
+  }
+  pHeap->Head[fl][sl] = Block;
+  pHeap->FlBitmap    |= 1U << fl;
+  pHeap->SlBitmap[fl] |= 1U << sl;
+}
+
+/**
+  * @brief  从空闲链表中取出一块，链表变空时清除位图
+  * @param  pHeap: 分配器
+  * @param  Block: 块偏移
+  * @retval 无
+  */
+static void TLSF_Remove(MEM_TlsfTypeDef *pHeap, uint32_t Block)
+{
+  uint32_t fl, sl;
+  uint32_t next = TLSF_WORD(pHeap, Block, TLSF_NEXT_FREE);
+  uint32_t prev = TLSF_WORD(pHeap, Block, TLSF_PREV_FREE);
+
+  TLSF_Mapping(TLSF_BLOCK_SIZE(pHeap, Block), &fl, &sl);
+  if(next != TLSF_NIL)
+  {
+    TLSF_WORD(pHeap, next, TLSF_PREV_FREE) = prev;
+  }
+  if(prev != TLSF_NIL)
+  {
+    TLSF_WORD(pHeap, prev, TLSF_NEXT_FREE) = next;
+  }
+  else
+  {
+    pHeap->Head[fl][sl] = next;
+    if(next == TLSF_NIL)
+    {
+      pHeap->SlBitmap[fl] &= ~(1U << sl);
+      if(pHeap->SlBitmap[fl] == 0U)
+      {
+        pHeap->FlBitmap &= ~(1U << fl);
+      }
+    }
+  }
+}
+
+/**
+  * @brief  查找不小于Size的空闲块：先把Size向上取到大小类的上界，保证该类中任何一块都够大，
+  *         再用位图找到不小于该类的第一个非空链表
+  * @param  pHeap: 分配器
+  * @param  Size: 按MEM_ALIGN对齐的字节数
+  * @retval 块偏移，没有时为TLSF_NIL
+  */
+static uint32_t TLSF_Find(const MEM_TlsfTypeDef *pHeap, uint32_t Size)
+{
+  uint32_t fl, sl, map;
+
+  if(Size >= TLSF_SMALL)
+  {
+    Size += (1U << ((31U - (uint32_t)__builtin_clz(Size)) - MEM_TLSF_SL_LOG2)) - 1U;
+  }
+  TLSF_Mapping(Size, &fl, &sl);
+  if(fl >= MEM_TLSF_FL_COUNT)
+  {
+    return TLSF_NIL;
+  }
+
+  map = pHeap->SlBitmap[fl] & (~0U << sl);
+  if(map == 0U)
+  {
+    map = pHeap->FlBitmap & (~0U << (fl + 1U));
+    if(map == 0U)
+    {
+      return TLSF_NIL;
+    }
+    fl  = (uint32_t)__builtin_ctz(map);
+    map = pHeap->SlBitmap[fl];
+  }
+  sl = (uint32_t)__builtin_ctz(map);
+
+  return pHeap->Head[fl][sl];
+}
+#endif /* MEM_TLSF */
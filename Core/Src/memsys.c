@@ -0,0 +1,184 @@
+#include "memsys.h"
+#include <string.h>
+
+static uint8_t CacheEnabled = 0;   /* MEM_Init打开D-Cache后为1，之前维护缓存的函数直接返回 */
+
+static uint32_t MEM_LineRange(uint32_t Address, uint32_t Size, uint32_t *pStart, int32_t *pSize);
+
+/**
+  * @brief  配置MPU并打开I-Cache和D-Cache，在HAL_Init之前调用
+  * @note   区域0: 4GB禁止访问，关闭子区域0/1/2/5/7(代码和SRAM、外设、FMC/QSPI寄存器、内核外设)，
+  *                其余为没有接存储器的FMC/QSPI地址，防止CPU推测读取时总线挂起
+  *         区域1: SDRAM 32MB，不经过缓存的普通存储器，显存和DMA2D的目标都在这里
+  *         区域2: SDRAM末尾2MB，写通缓存，CPU展开字模/转换JPEG后DMA2D直接读取
+  *         内部SRAM和Flash保持默认的写回缓存属性，DMA2D读取SRAM中的数据时由LCD_DMA2D_Submit清理
+  * @retval 无
+  */
+void MEM_Init(void)
+{
+#if defined(__arm__)
+  MPU_Region_InitTypeDef region = {0};
+
+  HAL_MPU_Disable();
+
+  region.Enable           = MPU_REGION_ENABLE;
+  region.Number           = MPU_REGION_NUMBER0;
+  region.BaseAddress      = 0x00000000;
+  region.Size             = MPU_REGION_SIZE_4GB;
+  region.SubRegionDisable = 0xA7;
+  region.TypeExtField     = MPU_TEX_LEVEL0;
+  region.AccessPermission = MPU_REGION_NO_ACCESS;
+  region.DisableExec      = MPU_INSTRUCTION_ACCESS_DISABLE;
+  region.IsShareable      = MPU_ACCESS_SHAREABLE;
+  region.IsCacheable      = MPU_ACCESS_NOT_CACHEABLE;
+  region.IsBufferable     = MPU_ACCESS_NOT_BUFFERABLE;
+  HAL_MPU_ConfigRegion(&region);
+
+  /* TEX=1 C=0 B=0: 普通存储器，不经过缓存，允许写合并 */
+  region.Number           = MPU_REGION_NUMBER1;
+  region.BaseAddress      = MEM_SDRAM_ADDRESS;
+  region.Size             = MEM_SDRAM_REGION_SIZE;
+  region.SubRegionDisable = 0x00;
+  region.TypeExtField     = MPU_TEX_LEVEL1;
+  region.AccessPermission = MPU_REGION_FULL_ACCESS;
+  region.IsShareable      = MPU_ACCESS_NOT_SHAREABLE;
+  HAL_MPU_ConfigRegion(&region);
+
+  /* TEX=0 C=1 B=0: 写通，读分配；M7上可共享的区域不经过缓存，所以必须为不可共享 */
+  region.Number           = MPU_REGION_NUMBER2;
+  region.BaseAddress      = MEM_SDRAM_WT_ADDRESS;
+  region.Size             = MEM_SDRAM_WT_REGION_SIZE;
+  region.TypeExtField     = MPU_TEX_LEVEL0;
+  region.IsCacheable      = MPU_ACCESS_CACHEABLE;
+  HAL_MPU_ConfigRegion(&region);
+
+  HAL_MPU_Enable(MPU_PRIVILEGED_DEFAULT);
+
+  SCB_EnableICache();
+  SCB_EnableDCache();
+  CacheEnabled = 1;
+#endif
+}
+
+/**
+  * @brief  清零链接到SDRAM的.sdram_bss段，在MX_FMC_Init之后、使用其中的变量之前调用
+  * @note   启动代码运行时SDRAM还没有初始化，所以不能与.bss一起清零
+  * @retval 无
+  */
+void MEM_ClearSdramBss(void)
+{
+#if defined(__arm__)
+  extern uint32_t _ssdram_bss[], _esdram_bss[];
+
+  memset(_ssdram_bss, 0, (uint32_t)_esdram_bss - (uint32_t)_ssdram_bss);
+#endif
+}
+
+/**
+  * @brief  判断一段地址是否经过写回D-Cache，是则DMA访问前后需要维护缓存
+  * @param  Address: 起始地址
+  * @param  Size: 字节数
+  * @retval 1: 与写回缓存的SRAM有重叠 0: 没有，或D-Cache未打开
+  */
+uint32_t MEM_IsWriteBack(uint32_t Address, uint32_t Size)
+{
+  if((CacheEnabled == 0U) || (Size == 0U))
+  {
+    return 0;
+  }
+  return ((Address < MEM_SRAM_WB_END) && ((Address + Size) > MEM_SRAM_WB_START)) ? 1U : 0U;
+}
+
+/**
+  * @brief  把CPU写入的数据写回存储器，在DMA读取之前调用
+  * @note   只处理写回缓存的SRAM，其他地址直接返回，可以对任何DMA源地址调用
+  * @param  Address: 起始地址，不必按行对齐
+  * @param  Size: 字节数
+  * @retval 无
+  */
+void MEM_CleanDCache(uint32_t Address, uint32_t Size)
+{
+  uint32_t start;
+  int32_t  size;
+
+  if(MEM_LineRange(Address, Size, &start, &size) != 0U)
+  {
+#if defined(__arm__)
+    SCB_CleanDCache_by_Addr((uint32_t *)start, size);
+#endif
+  }
+}
+
+/**
+  * @brief  丢弃缓存中的旧数据，在DMA写入完成后、CPU读取之前调用
+  * @note   首尾不满一行的部分可能还有其他变量，先写回再丢弃，不会丢失它们的修改
+  * @param  Address: 起始地址，不必按行对齐
+  * @param  Size: 字节数
+  * @retval 无
+  */
+void MEM_InvalidateDCache(uint32_t Address, uint32_t Size)
+{
+  uint32_t start, end;
+  int32_t  size;
+
+  if(MEM_LineRange(Address, Size, &start, &size) == 0U)
+  {
+    return;
+  }
+#if defined(__arm__)
+  end = start + (uint32_t)size;
+  if(start != Address)
+  {
+    SCB_CleanInvalidateDCache_by_Addr((uint32_t *)start, (int32_t)MEM_CACHE_LINE);
+    start += MEM_CACHE_LINE;
+  }
+  if((end != (Address + Size)) && (end > start))
+  {
+    end -= MEM_CACHE_LINE;
+    SCB_CleanInvalidateDCache_by_Addr((uint32_t *)end, (int32_t)MEM_CACHE_LINE);
+  }
+  if(end > start)
+  {
+    SCB_InvalidateDCache_by_Addr((uint32_t *)start, (int32_t)(end - start));
+  }
+#else
+  (void)end;
+#endif
+}
+
+/**
+  * @brief  写回并丢弃缓存，在DMA写入SRAM之前调用，避免之后脏行被换出覆盖DMA写入的数据
+  * @param  Address: 起始地址，不必按行对齐
+  * @param  Size: 字节数
+  * @retval 无
+  */
+void MEM_CleanInvalidateDCache(uint32_t Address, uint32_t Size)
+{
+  uint32_t start;
+  int32_t  size;
+
+  if(MEM_LineRange(Address, Size, &start, &size) != 0U)
+  {
+#if defined(__arm__)
+    SCB_CleanInvalidateDCache_by_Addr((uint32_t *)start, size);
+#endif
+  }
+}
+
+/**
+  * @brief  把地址范围扩展到整行
+  * @param  Address, Size: 地址范围
+  * @param  pStart: 输出按行对齐的起始地址
+  * @param  pSize: 输出整行的字节数
+  * @retval 1: 需要维护缓存 0: 不需要
+  */
+static uint32_t MEM_LineRange(uint32_t Address, uint32_t Size, uint32_t *pStart, int32_t *pSize)
+{
+  if(MEM_IsWriteBack(Address, Size) == 0U)
+  {
+    return 0;
+  }
+  *pStart = Address & ~(MEM_CACHE_LINE - 1U);
+  *pSize  = (int32_t)(((Address + Size + MEM_CACHE_LINE - 1U) & ~(MEM_CACHE_LINE - 1U)) - *pStart);
+  return 1;
+}
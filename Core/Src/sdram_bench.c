@@ -0,0 +1,629 @@
+#include "sdram_bench.h"
+#include "memsys.h"
+
+#if SDRAM_BENCH
+
+#include <stdio.h>
+#include <string.h>
+#include "fmc.h"
+#include "ltdc.h"
+#include "lcd_dma2d.h"
+#include "sdram_tune.h"
+
+/* 测试从显存开始，调整和测试期间SDRAM中的数据全部丢失 */
+#define BENCH_BASE          MEM_SDRAM_ADDRESS
+#define BENCH_SDRAM_SIZE    ((uint32_t)32 * 1024 * 1024)
+#define BENCH_LINE          MEM_CACHE_LINE
+#define BENCH_CHUNK         ((uint32_t)16384)         /* DMA和DMA2D每条传输的字节数，也是读测试的目标缓冲区大小 */
+#define BENCH_MEASURE_SIZE  ((uint32_t)64 * 1024)     /* 调整时参考负载的顺序读写字节数 */
+#define BENCH_MEASURE_LINES ((uint32_t)1024)          /* 调整时参考负载的随机读取行数 */
+#define BENCH_LATENCY_RUNS  ((uint32_t)256)
+#define BENCH_DMA_TIMEOUT   ((uint32_t)100)
+
+typedef uint32_t (*BENCH_RunTypeDef)(uint32_t Test);
+typedef uint32_t (*BENCH_LatencyTypeDef)(void);
+
+/* 读测试的目标和写测试的源，以及随机访问的偏移，放在DTCM中不占用SDRAM带宽 */
+static uint32_t ChunkBuffer[BENCH_CHUNK / 4U] MEM_DTCM_BSS __attribute__((aligned(32)));
+static uint32_t RandomOffset[SDRAM_BENCH_RANDOM_COUNT] MEM_DTCM_BSS;
+
+static DMA_HandleTypeDef BenchDma;
+static uint32_t BenchReady = 0;
+static volatile uint32_t Sink;    /* 防止读取被优化掉 */
+
+static void BENCH_Init(void);
+static uint32_t BENCH_Random(uint32_t *pSeed);
+static uint32_t BENCH_Cpu(uint32_t Test);
+static uint32_t BENCH_Dma(uint32_t Test);
+static uint32_t BENCH_Dma2d(uint32_t Test);
+static uint32_t BENCH_CpuLatency(void);
+static uint32_t BENCH_DmaLatency(void);
+static uint32_t BENCH_Dma2dLatency(void);
+static uint32_t BENCH_CpuRead(uint32_t Address, uint32_t Size);
+static uint32_t BENCH_CpuWrite(uint32_t Address, uint32_t Size);
+static uint32_t BENCH_CpuRandom(uint32_t Test, uint32_t Count);
+static HAL_StatusTypeDef BENCH_DmaMove(uint32_t Dst, uint32_t Src, uint32_t Size);
+static uint32_t BENCH_Dma2dCopy(uint32_t Dst, uint32_t Src, uint32_t Width, uint32_t Height);
+static uint32_t BENCH_Verify(void);
+static uint32_t BENCH_Measure(void);
+static void BENCH_PrintRate(uint32_t Rate);
+
+static const struct
+{
+  const char          *Name;
+  BENCH_RunTypeDef     Run;
+  BENCH_LatencyTypeDef Latency;
+}Engines[SDRAM_BENCH_ENGINES] =
+{
+  {"CPU",   BENCH_Cpu,   BENCH_CpuLatency},
+  {"DMA",   BENCH_Dma,   BENCH_DmaLatency},
+  {"DMA2D", BENCH_Dma2d, BENCH_Dma2dLatency},
+};
+
+static const char *const TestNames[SDRAM_BENCH_TESTS] =
+{
+  "seq rd", "seq wr", "seq cp", "rnd rd", "rnd wr", "rnd cp"
+};
+
+static const SDRAM_TuneOpsTypeDef TuneOps =
+{
+  FMC_SDRAM_Reconfigure,
+  BENCH_Verify,
+  BENCH_Measure,
+};
+
+/**
+  * @brief  用CPU、DMA2和DMA2D顺序和随机读、写、复制SDRAM，测量带宽和延迟，通过printf(USART1)输出
+  * @note   CPU访问的SDRAM由MPU设为不经过缓存，反映的是FMC本身的带宽；DMA和DMA2D的延迟包括软件启动传输的时间。
+  *         在LCD_DMA2D_Init之后、使用SDRAM之前调用，会改写SDRAM开头SDRAM_BENCH_RANDOM_SIZE字节
+  * @param  pResult: 输出SDRAM_BENCH_ENGINES个结果，可以为NULL
+  * @retval 无
+  */
+void SDRAM_Bench_Run(SDRAM_BenchResultTypeDef *pResult)
+{
+  SDRAM_BenchResultTypeDef result[SDRAM_BENCH_ENGINES];
+  SDRAM_ConfigTypeDef config;
+  uint32_t mhz = SystemCoreClock / 1000000U;
+  uint32_t engine, test, bytes, cycles;
+
+  BENCH_Init();
+  FMC_SDRAM_GetConfig(&config);
+  for(engine = 0; engine < SDRAM_BENCH_ENGINES; engine++)
+  {
+    for(test = 0; test < SDRAM_BENCH_TESTS; test++)
+    {
+      bytes = (test < SDRAM_BENCH_RND_READ) ? SDRAM_BENCH_SIZE : (SDRAM_BENCH_RANDOM_COUNT * BENCH_LINE);
+      cycles = Engines[engine].Run(test);
+      result[engine].Bandwidth[test] = (cycles != 0U) ?
+        (uint32_t)(((uint64_t)bytes * mhz * 1000000U) / ((uint64_t)cycles * 1024U)) : 0U;
+    }
+    result[engine].Latency = (Engines[engine].Latency() * 1000U) / mhz;
+  }
+
+  printf("sdram bench @ %lu MHz, CAS %u, read burst %s, pipe %u, BL %u: seq %lu KB, random %lu x %lu B in %lu KB\r\n",
+         (unsigned long)mhz, (unsigned)config.CASLatency, (config.ReadBurst != 0U) ? "on" : "off",
+         (unsigned)config.ReadPipeDelay, (unsigned)config.BurstLength, (unsigned long)(SDRAM_BENCH_SIZE / 1024U),
+         (unsigned long)SDRAM_BENCH_RANDOM_COUNT, (unsigned long)BENCH_LINE,
+         (unsigned long)(SDRAM_BENCH_RANDOM_SIZE / 1024U));
+  printf("  %-6s", "MB/s");
+  for(test = 0; test < SDRAM_BENCH_TESTS; test++)
+  {
+    printf(" %8s", TestNames[test]);
+  }
+  printf(" %10s\r\n", "latency ns");
+  for(engine = 0; engine < SDRAM_BENCH_ENGINES; engine++)
+  {
+    printf("  %-6s", Engines[engine].Name);
+    for(test = 0; test < SDRAM_BENCH_TESTS; test++)
+    {
+      BENCH_PrintRate(result[engine].Bandwidth[test]);
+    }
+    printf(" %10lu\r\n", (unsigned long)result[engine].Latency);
+  }
+
+  if(pResult != NULL)
+  {
+    memcpy(pResult, result, sizeof(result));
+  }
+}
+
+/**
+  * @brief  测量原来的配置，搜索最快的稳定FMC时序和读取方式并应用，再测量一次；
+  *         找到的配置按fmc.c的写法输出，可以写回MX_FMC_Init和SDRAM_InitSequence
+  * @note   LTDC扫描显存会占用SDRAM带宽并影响校验，调整期间暂停
+  * @retval HAL_OK: 已应用找到的配置  HAL_ERROR: 原来的配置校验失败，保留原配置
+  */
+HAL_StatusTypeDef SDRAM_Bench_Tune(void)
+{
+  SDRAM_ConfigTypeDef baseline;
+  SDRAM_TuneResultTypeDef result;
+  HAL_StatusTypeDef status;
+  uint32_t ltdc = LTDC->GCR & LTDC_GCR_LTDCEN;
+
+  __HAL_LTDC_DISABLE(&hltdc);
+  BENCH_Init();
+  FMC_SDRAM_GetConfig(&baseline);
+  SDRAM_Bench_Run(NULL);
+
+  status = SDRAM_Tune(&TuneOps, &baseline, &result);
+  printf("sdram tune: %s, %lu configs applied, %lu failed, %lu candidates, reference load %lu -> %lu cycles\r\n",
+         (status == HAL_OK) ? "ok" : "baseline unstable", (unsigned long)result.Applied, (unsigned long)result.Failed,
+         (unsigned long)result.Candidates, (unsigned long)result.BaselineCycles, (unsigned long)result.BestCycles);
+  SDRAM_Tune_Print(&result.Best);
+  if(status == HAL_OK)
+  {
+    SDRAM_Bench_Run(NULL);
+  }
+
+  /* 测试提交的命令不计入绘图的统计 */
+  LCD_DMA2D_ResetStats();
+  if(ltdc != 0U)
+  {
+    __HAL_LTDC_ENABLE(&hltdc);
+  }
+  return status;
+}
+
+/**
+  * @brief  打开DWT周期计数器，初始化DMA2数据流0，生成随机访问的偏移
+  * @retval 无
+  */
+static void BENCH_Init(void)
+{
+  uint32_t seed = 1U;
+  uint32_t i;
+
+  if(BenchReady != 0U)
+  {
+    return;
+  }
+
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->LAR = 0xC5ACCE55U;
+  DWT->CYCCNT = 0;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+  /* 只有DMA2能做存储器到存储器传输；FIFO打开，两端都用4拍突发 */
+  __HAL_RCC_DMA2_CLK_ENABLE();
+  BenchDma.Instance = DMA2_Stream0;
+  BenchDma.Init.Channel = DMA_CHANNEL_0;
+  BenchDma.Init.Direction = DMA_MEMORY_TO_MEMORY;
+  BenchDma.Init.PeriphInc = DMA_PINC_ENABLE;
+  BenchDma.Init.MemInc = DMA_MINC_ENABLE;
+  BenchDma.Init.PeriphDataAlignment = DMA_PDATAALIGN_WORD;
+  BenchDma.Init.MemDataAlignment = DMA_MDATAALIGN_WORD;
+  BenchDma.Init.Mode = DMA_NORMAL;
+  BenchDma.Init.Priority = DMA_PRIORITY_VERY_HIGH;
+  BenchDma.Init.FIFOMode = DMA_FIFOMODE_ENABLE;
+  BenchDma.Init.FIFOThreshold = DMA_FIFO_THRESHOLD_FULL;
+  BenchDma.Init.MemBurst = DMA_MBURST_INC4;
+  BenchDma.Init.PeriphBurst = DMA_PBURST_INC4;
+  if(HAL_DMA_Init(&BenchDma) != HAL_OK)
+  {
+    Error_Handler();
+  }
+
+  for(i = 0; i < SDRAM_BENCH_RANDOM_COUNT; i++)
+  {
+    RandomOffset[i] = (BENCH_Random(&seed) % (SDRAM_BENCH_RANDOM_SIZE / BENCH_LINE)) * BENCH_LINE;
+  }
+  BenchReady = 1U;
+}
+
+/**
+  * @brief  线性同余随机数，高位比低位随机，取连续两次的高16位
+  * @param  pSeed: 随机数状态
+  * @retval 32位随机数
+  */
+static uint32_t BENCH_Random(uint32_t *pSeed)
+{
+  uint32_t high;
+
+  *pSeed = (*pSeed * 1664525U) + 1013904223U;
+  high = *pSeed >> 16;
+  *pSeed = (*pSeed * 1664525U) + 1013904223U;
+  return (high << 16) | (*pSeed >> 16);
+}
+
+/**
+  * @brief  CPU测试：顺序读写每次8个字，随机访问每次一个32字节的块
+  * @param  Test: 测试项
+  * @retval 周期数
+  */
+static uint32_t BENCH_Cpu(uint32_t Test)
+{
+  uint32_t start;
+
+  switch(Test)
+  {
+  case SDRAM_BENCH_SEQ_READ:
+    return BENCH_CpuRead(BENCH_BASE, SDRAM_BENCH_SIZE);
+  case SDRAM_BENCH_SEQ_WRITE:
+    return BENCH_CpuWrite(BENCH_BASE, SDRAM_BENCH_SIZE);
+  case SDRAM_BENCH_SEQ_COPY:
+    start = DWT->CYCCNT;
+    memcpy((void *)(BENCH_BASE + SDRAM_BENCH_SIZE), (const void *)BENCH_BASE, SDRAM_BENCH_SIZE);
+    __DSB();
+    return DWT->CYCCNT - start;
+  default:
+    return BENCH_CpuRandom(Test, SDRAM_BENCH_RANDOM_COUNT);
+  }
+}
+
+/**
+  * @brief  DMA2测试：读的目标和写的源为DTCM中的ChunkBuffer，顺序测试每条传输BENCH_CHUNK字节，随机测试每条一行
+  * @param  Test: 测试项
+  * @retval 周期数，传输出错时为0
+  */
+static uint32_t BENCH_Dma(uint32_t Test)
+{
+  uint32_t sequential = (Test <= SDRAM_BENCH_SEQ_COPY) ? 1U : 0U;
+  uint32_t count = (sequential != 0U) ? (SDRAM_BENCH_SIZE / BENCH_CHUNK) : SDRAM_BENCH_RANDOM_COUNT;
+  uint32_t size = (sequential != 0U) ? BENCH_CHUNK : BENCH_LINE;
+  uint32_t start = DWT->CYCCNT;
+  uint32_t i, sdram, other, buffer;
+  HAL_StatusTypeDef status = HAL_OK;
+
+  for(i = 0; (i < count) && (status == HAL_OK); i++)
+  {
+    sdram  = BENCH_BASE + ((sequential != 0U) ? (i * BENCH_CHUNK) : RandomOffset[i]);
+    other  = BENCH_BASE + ((sequential != 0U) ? (SDRAM_BENCH_SIZE + (i * BENCH_CHUNK)) : RandomOffset[count - 1U - i]);
+    buffer = (uint32_t)ChunkBuffer + ((i * size) % BENCH_CHUNK);
+
+    /* 顺序和随机测试的读、写、复制按相同的顺序编号 */
+    switch(Test % (SDRAM_BENCH_SEQ_COPY + 1U))
+    {
+    case SDRAM_BENCH_SEQ_READ:
+      status = BENCH_DmaMove(buffer, sdram, size);
+      break;
+    case SDRAM_BENCH_SEQ_WRITE:
+      status = BENCH_DmaMove(sdram, buffer, size);
+      break;
+    default:
+      status = BENCH_DmaMove(other, sdram, size);
+      break;
+    }
+  }
+  return (status == HAL_OK) ? (DWT->CYCCNT - start) : 0U;
+}
+
+/**
+  * @brief  DMA2D测试：ARGB8888格式的M2M复制和R2M填充，通过命令队列提交，计时到最后一条完成
+  * @param  Test: 测试项
+  * @retval 周期数
+  */
+static uint32_t BENCH_Dma2d(uint32_t Test)
+{
+  uint32_t start = DWT->CYCCNT;
+  uint32_t width = BENCH_CHUNK / 16U;   /* 每行BENCH_CHUNK/4字节 */
+  uint32_t line = BENCH_LINE / 4U;
+  uint32_t fence = 0;
+  uint32_t offset, i;
+
+  switch(Test)
+  {
+  case SDRAM_BENCH_SEQ_READ:
+    for(offset = 0; offset < SDRAM_BENCH_SIZE; offset += BENCH_CHUNK)
+    {
+      fence = BENCH_Dma2dCopy((uint32_t)ChunkBuffer, BENCH_BASE + offset, width, 4U);
+    }
+    break;
+  case SDRAM_BENCH_SEQ_WRITE:
+    fence = LCD_DMA2D_Fill(BENCH_BASE, width, SDRAM_BENCH_SIZE / (width * 4U), 0, DMA2D_OUTPUT_ARGB8888, 0x5AA55AA5U);
+    break;
+  case SDRAM_BENCH_SEQ_COPY:
+    fence = BENCH_Dma2dCopy(BENCH_BASE + SDRAM_BENCH_SIZE, BENCH_BASE, width, SDRAM_BENCH_SIZE / (width * 4U));
+    break;
+  case SDRAM_BENCH_RND_READ:
+    for(i = 0; i < SDRAM_BENCH_RANDOM_COUNT; i++)
+    {
+      fence = BENCH_Dma2dCopy((uint32_t)ChunkBuffer + ((i * BENCH_LINE) % BENCH_CHUNK), BENCH_BASE + RandomOffset[i], line, 1U);
+    }
+    break;
+  case SDRAM_BENCH_RND_WRITE:
+    for(i = 0; i < SDRAM_BENCH_RANDOM_COUNT; i++)
+    {
+      fence = LCD_DMA2D_Fill(BENCH_BASE + RandomOffset[i], line, 1U, 0, DMA2D_OUTPUT_ARGB8888, i);
+    }
+    break;
+  default:
+    for(i = 0; i < SDRAM_BENCH_RANDOM_COUNT; i++)
+    {
+      fence = BENCH_Dma2dCopy(BENCH_BASE + RandomOffset[SDRAM_BENCH_RANDOM_COUNT - 1U - i], BENCH_BASE + RandomOffset[i], line, 1U);
+    }
+    break;
+  }
+  LCD_DMA2D_Wait(fence);
+  return DWT->CYCCNT - start;
+}
+
+/**
+  * @brief  CPU读延迟：在SDRAM_BENCH_RANDOM_SIZE范围内建立随机的单环链表(Sattolo算法)，每个节点占一行，
+  *         沿链表读取，每次读取的地址取决于上一次读到的数据
+  * @retval 每次读取的周期数
+  */
+static uint32_t BENCH_CpuLatency(void)
+{
+  volatile uint32_t *node = (volatile uint32_t *)BENCH_BASE;
+  uint32_t count = SDRAM_BENCH_RANDOM_SIZE / BENCH_LINE;
+  uint32_t stride = BENCH_LINE / 4U;
+  uint32_t seed = 7U;
+  uint32_t i, j, next, start;
+
+  for(i = 0; i < count; i++)
+  {
+    node[i * stride] = i;
+  }
+  for(i = count - 1U; i > 0U; i--)
+  {
+    j = BENCH_Random(&seed) % i;
+    next = node[i * stride];
+    node[i * stride] = node[j * stride];
+    node[j * stride] = next;
+  }
+  for(i = 0; i < count; i++)
+  {
+    node[i * stride] = BENCH_BASE + (node[i * stride] * BENCH_LINE);
+  }
+  __DSB();
+
+  next = BENCH_BASE;
+  start = DWT->CYCCNT;
+  for(i = 0; i < SDRAM_BENCH_RANDOM_COUNT; i++)
+  {
+    next = *(volatile uint32_t *)next;
+  }
+  start = DWT->CYCCNT - start;
+  Sink = next;
+  return start / SDRAM_BENCH_RANDOM_COUNT;
+}
+
+/**
+  * @brief  DMA2读延迟：从随机地址读取一行到DTCM，从启动到传输完成
+  * @retval 每次传输的平均周期数
+  */
+static uint32_t BENCH_DmaLatency(void)
+{
+  uint32_t start = DWT->CYCCNT;
+  uint32_t i;
+
+  for(i = 0; i < BENCH_LATENCY_RUNS; i++)
+  {
+    if(BENCH_DmaMove((uint32_t)ChunkBuffer, BENCH_BASE + RandomOffset[i], BENCH_LINE) != HAL_OK)
+    {
+      return 0U;
+    }
+  }
+  return (DWT->CYCCNT - start) / BENCH_LATENCY_RUNS;
+}
+
+/**
+  * @brief  DMA2D读延迟：从随机地址复制一行到DTCM，从提交到完成
+  * @retval 每条命令的平均周期数
+  */
+static uint32_t BENCH_Dma2dLatency(void)
+{
+  uint32_t start = DWT->CYCCNT;
+  uint32_t i;
+
+  for(i = 0; i < BENCH_LATENCY_RUNS; i++)
+  {
+    LCD_DMA2D_Wait(BENCH_Dma2dCopy((uint32_t)ChunkBuffer, BENCH_BASE + RandomOffset[i], BENCH_LINE / 4U, 1U));
+  }
+  return (DWT->CYCCNT - start) / BENCH_LATENCY_RUNS;
+}
+
+/**
+  * @brief  CPU顺序读，每次循环读8个字
+  * @param  Address: 起始地址，按32字节对齐
+  * @param  Size: 字节数，32的倍数
+  * @retval 周期数
+  */
+static uint32_t BENCH_CpuRead(uint32_t Address, uint32_t Size)
+{
+  const volatile uint32_t *p = (const volatile uint32_t *)Address;
+  const volatile uint32_t *end = p + (Size / 4U);
+  uint32_t sum = 0;
+  uint32_t start = DWT->CYCCNT;
+
+  while(p < end)
+  {
+    sum += p[0] + p[1] + p[2] + p[3] + p[4] + p[5] + p[6] + p[7];
+    p += 8;
+  }
+  start = DWT->CYCCNT - start;
+  Sink = sum;
+  return start;
+}
+
+/**
+  * @brief  CPU顺序写，每次循环写8个字，等待写缓冲清空后停止计时
+  * @param  Address: 起始地址，按32字节对齐
+  * @param  Size: 字节数，32的倍数
+  * @retval 周期数
+  */
+static uint32_t BENCH_CpuWrite(uint32_t Address, uint32_t Size)
+{
+  volatile uint32_t *p = (volatile uint32_t *)Address;
+  volatile uint32_t *end = p + (Size / 4U);
+  uint32_t start = DWT->CYCCNT;
+
+  while(p < end)
+  {
+    p[0] = Size; p[1] = Size; p[2] = Size; p[3] = Size;
+    p[4] = Size; p[5] = Size; p[6] = Size; p[7] = Size;
+    p += 8;
+  }
+  __DSB();
+  return DWT->CYCCNT - start;
+}
+
+/**
+  * @brief  CPU随机访问，每次读、写或复制RandomOffset中的一个32字节块
+  * @param  Test: SDRAM_BENCH_RND_READ / SDRAM_BENCH_RND_WRITE / SDRAM_BENCH_RND_COPY
+  * @param  Count: 块数，不超过SDRAM_BENCH_RANDOM_COUNT
+  * @retval 周期数
+  */
+static uint32_t BENCH_CpuRandom(uint32_t Test, uint32_t Count)
+{
+  volatile uint32_t *p;
+  uint32_t sum = 0;
+  uint32_t start = DWT->CYCCNT;
+  uint32_t i;
+
+  for(i = 0; i < Count; i++)
+  {
+    p = (volatile uint32_t *)(BENCH_BASE + RandomOffset[i]);
+    if(Test == SDRAM_BENCH_RND_READ)
+    {
+      sum += p[0] + p[1] + p[2] + p[3] + p[4] + p[5] + p[6] + p[7];
+    }
+    else if(Test == SDRAM_BENCH_RND_WRITE)
+    {
+      p[0] = i; p[1] = i; p[2] = i; p[3] = i;
+      p[4] = i; p[5] = i; p[6] = i; p[7] = i;
+    }
+    else
+    {
+      memcpy((void *)(BENCH_BASE + RandomOffset[Count - 1U - i]), (const void *)p, BENCH_LINE);
+    }
+  }
+  __DSB();
+  start = DWT->CYCCNT - start;
+  Sink = sum;
+  return start;
+}
+
+/**
+  * @brief  用DMA2数据流0复制并等待完成
+  * @param  Dst: 目标地址，按16字节对齐
+  * @param  Src: 源地址，按16字节对齐
+  * @param  Size: 字节数，16的倍数，不超过65535个字
+  * @retval HAL状态
+  */
+static HAL_StatusTypeDef BENCH_DmaMove(uint32_t Dst, uint32_t Src, uint32_t Size)
+{
+  if(HAL_DMA_Start(&BenchDma, Src, Dst, Size / 4U) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+  return HAL_DMA_PollForTransfer(&BenchDma, HAL_DMA_FULL_TRANSFER, BENCH_DMA_TIMEOUT);
+}
+
+/**
+  * @brief  提交一条ARGB8888的DMA2D M2M复制命令
+  * @param  Dst: 目标地址
+  * @param  Src: 源地址
+  * @param  Width: 每行像素数
+  * @param  Height: 行数
+  * @retval 栅栏值
+  */
+static uint32_t BENCH_Dma2dCopy(uint32_t Dst, uint32_t Src, uint32_t Width, uint32_t Height)
+{
+  LCD_DMA2D_CmdTypeDef cmd = {0};
+
+  cmd.Mode         = DMA2D_M2M;
+  cmd.OutColorMode = DMA2D_OUTPUT_ARGB8888;
+  cmd.DstAddress   = Dst;
+  cmd.FgAddress    = Src;
+  cmd.FgColorMode  = DMA2D_INPUT_ARGB8888;
+  cmd.FgAlphaMode  = DMA2D_NO_MODIF_ALPHA;
+  cmd.FgAlpha      = 0xFF;
+  cmd.Width        = (uint16_t)Width;
+  cmd.Height       = (uint16_t)Height;
+
+  return LCD_DMA2D_Submit(&cmd);
+}
+
+/**
+  * @brief  调整时的读写测试：
+  *         1. 在2的幂个字的偏移处写入不同的值，地址线或行、列、Bank的时序出错时会互相覆盖；
+  *         2. CPU写入随机数据再读出，然后用DMA2突发复制到另一块再比较；
+  *         3. 按字节写入再按字读出，检查NBL0/NBL1字节选择
+  *         每次调用的数据和位置都不同
+  * @retval 出错的字数
+  */
+static uint32_t BENCH_Verify(void)
+{
+  static uint32_t calls = 0;
+  volatile uint32_t *sdram = (volatile uint32_t *)BENCH_BASE;
+  uint32_t words = SDRAM_BENCH_VERIFY_SIZE / 4U;
+  uint32_t base = BENCH_BASE + ((calls % 64U) * 2U * SDRAM_BENCH_VERIFY_SIZE);
+  volatile uint32_t *src = (volatile uint32_t *)base;
+  volatile uint32_t *dst = src + words;
+  volatile uint8_t *bytes = (volatile uint8_t *)base;
+  uint32_t seed = ++calls;
+  uint32_t errors = 0;
+  uint32_t i, k, value;
+
+  for(k = 0; (4U << k) < BENCH_SDRAM_SIZE; k++)
+  {
+    sdram[1U << k] = ~(k * 0x01010101U) ^ seed;
+  }
+  sdram[0] = seed;
+  __DSB();
+  for(k = 0; (4U << k) < BENCH_SDRAM_SIZE; k++)
+  {
+    errors += (sdram[1U << k] != (~(k * 0x01010101U) ^ seed)) ? 1U : 0U;
+  }
+  errors += (sdram[0] != seed) ? 1U : 0U;
+
+  for(i = 0; i < words; i++)
+  {
+    src[i] = BENCH_Random(&seed);
+  }
+  __DSB();
+  if(BENCH_DmaMove((uint32_t)dst, base, SDRAM_BENCH_VERIFY_SIZE) != HAL_OK)
+  {
+    errors += words;
+  }
+  seed = calls;
+  for(i = 0; i < words; i++)
+  {
+    value = BENCH_Random(&seed);
+    errors += (src[i] != value) ? 1U : 0U;
+    errors += (dst[i] != value) ? 1U : 0U;
+  }
+
+  for(i = 0; i < BENCH_CHUNK; i++)
+  {
+    bytes[i] = (uint8_t)((i * 7U) + calls);
+  }
+  __DSB();
+  for(i = 0; i < (BENCH_CHUNK / 4U); i++)
+  {
+    value = (uint32_t)(uint8_t)((i * 28U) + calls) | ((uint32_t)(uint8_t)((i * 28U) + 7U + calls) << 8) |
+            ((uint32_t)(uint8_t)((i * 28U) + 14U + calls) << 16) | ((uint32_t)(uint8_t)((i * 28U) + 21U + calls) << 24);
+    errors += (src[i] != value) ? 1U : 0U;
+  }
+  return errors;
+}
+
+/**
+  * @brief  调整时的参考负载：CPU顺序读写、DMA2复制和CPU随机读取
+  * @retval 周期数
+  */
+static uint32_t BENCH_Measure(void)
+{
+  uint32_t start, cycles;
+
+  cycles  = BENCH_CpuRead(BENCH_BASE, BENCH_MEASURE_SIZE);
+  cycles += BENCH_CpuWrite(BENCH_BASE, BENCH_MEASURE_SIZE);
+  start = DWT->CYCCNT;
+  (void)BENCH_DmaMove(BENCH_BASE + BENCH_MEASURE_SIZE, BENCH_BASE, BENCH_MEASURE_SIZE);
+  cycles += DWT->CYCCNT - start;
+  cycles += BENCH_CpuRandom(SDRAM_BENCH_RND_READ, BENCH_MEASURE_LINES);
+  return cycles;
+}
+
+/**
+  * @brief  以MB/s输出带宽，保留一位小数
+  * @param  Rate: KB/s
+  * @retval 无
+  */
+static void BENCH_PrintRate(uint32_t Rate)
+{
+  printf(" %6lu.%lu", (unsigned long)(Rate / 1024U), (unsigned long)(((Rate % 1024U) * 10U) / 1024U));
+}
+
+#endif /* SDRAM_BENCH */
@@ -0,0 +1,278 @@
+#include "sdram_tune.h"
+#include <stdio.h>
+#include <string.h>
+
+/* 逐个减小的时序参数：先减TRAS和TRC，TWR的约束才允许继续减小TRCD和TRP；
+ * TMRD和TXSR只在加载模式寄存器和退出自刷新时起作用，读写测试覆盖不到，保持原值 */
+static const uint8_t TuneOrder[] = {SDRAM_TRAS, SDRAM_TRC, SDRAM_TRCD, SDRAM_TRP, SDRAM_TWR};
+
+static const char *const TimingNames[SDRAM_TIMINGS] =
+{
+  "LoadToActiveDelay", "ExitSelfRefreshDelay", "SelfRefreshTime", "RowCycleDelay",
+  "WriteRecoveryTime", "RPDelay", "RCDDelay"
+};
+
+static uint32_t TUNE_Stable(const SDRAM_TuneOpsTypeDef *pOps, const SDRAM_ConfigTypeDef *pConfig,
+                            uint32_t Repeat, SDRAM_TuneResultTypeDef *pResult);
+static uint32_t TUNE_Measure(const SDRAM_TuneOpsTypeDef *pOps);
+static void TUNE_Descend(const SDRAM_TuneOpsTypeDef *pOps, SDRAM_ConfigTypeDef *pConfig, SDRAM_TuneResultTypeDef *pResult);
+static void TUNE_AddMargin(SDRAM_ConfigTypeDef *pConfig, const SDRAM_ConfigTypeDef *pBaseline);
+
+/**
+  * @brief  检查配置能否写入FMC
+  * @param  pConfig: 配置
+  * @retval 1: 合法  0: 超出范围或不满足FMC_SDTR的约束
+  */
+uint32_t SDRAM_Tune_IsLegal(const SDRAM_ConfigTypeDef *pConfig)
+{
+  const uint8_t *t = pConfig->Timing;
+  uint32_t i;
+
+  for(i = 0; i < SDRAM_TIMINGS; i++)
+  {
+    if((t[i] < SDRAM_TIMING_MIN) || (t[i] > SDRAM_TIMING_MAX))
+    {
+      return 0U;
+    }
+  }
+  if((pConfig->CASLatency < 1U) || (pConfig->CASLatency > 3U) || (pConfig->ReadPipeDelay > 2U) ||
+     (pConfig->BurstLength == 0U) || (pConfig->BurstLength > 8U) ||
+     ((pConfig->BurstLength & (pConfig->BurstLength - 1U)) != 0U))
+  {
+    return 0U;
+  }
+
+  /* RM0410 FMC_SDTR：TWR >= TRAS - TRCD，TWR >= TRC - TRCD - TRP */
+  if(((int32_t)t[SDRAM_TWR] < ((int32_t)t[SDRAM_TRAS] - (int32_t)t[SDRAM_TRCD])) ||
+     ((int32_t)t[SDRAM_TWR] < ((int32_t)t[SDRAM_TRC] - (int32_t)t[SDRAM_TRCD] - (int32_t)t[SDRAM_TRP])))
+  {
+    return 0U;
+  }
+  return 1U;
+}
+
+/**
+  * @brief  搜索最快的稳定配置，结束时应用找到的配置
+  * @note   对CAS延迟、突发读、读流水线延迟和突发长度的每种组合，从原来的时序开始逐个减小时序参数，
+  *         直到校验出错；再给每个减小过的参数加SDRAM_TUNE_MARGIN，长时间校验后测量参考负载。
+  *         假定每个参数越大越稳定；调整期间SDRAM中的数据全部丢失
+  * @param  pOps: 应用配置、校验和测量的操作
+  * @param  pBaseline: 原来的配置，必须稳定；没有更快的配置时保留
+  * @param  pResult: 输出结果
+  * @retval HAL_OK: 已应用pResult->Best  HAL_ERROR: 原来的配置不稳定或最终校验失败，已恢复原配置
+  */
+HAL_StatusTypeDef SDRAM_Tune(const SDRAM_TuneOpsTypeDef *pOps, const SDRAM_ConfigTypeDef *pBaseline,
+                             SDRAM_TuneResultTypeDef *pResult)
+{
+  SDRAM_ConfigTypeDef config;
+  uint32_t cas, pipe, burst, length, cycles;
+
+  memset(pResult, 0, sizeof(*pResult));
+  pResult->Best = *pBaseline;
+  if(TUNE_Stable(pOps, pBaseline, SDRAM_TUNE_REPEAT, pResult) == 0U)
+  {
+    (void)pOps->Apply(pBaseline);
+    return HAL_ERROR;
+  }
+  pResult->BaselineCycles = TUNE_Measure(pOps);
+  pResult->BestCycles = pResult->BaselineCycles;
+
+  /* 从保守的选项开始，周期数相同时保留先找到的配置 */
+  for(cas = 3U; cas >= 1U; cas--)
+  {
+    for(pipe = 2U; pipe <= 2U; pipe--)
+    {
+      for(burst = 0; burst <= 1U; burst++)
+      {
+        for(length = SDRAM_TUNE_MAX_BURST; length >= 1U; length >>= 1)
+        {
+          config = *pBaseline;
+          config.CASLatency    = (uint8_t)cas;
+          config.ReadPipeDelay = (uint8_t)pipe;
+          config.ReadBurst     = (uint8_t)burst;
+          config.BurstLength   = (uint8_t)length;
+          if(TUNE_Stable(pOps, &config, SDRAM_TUNE_REPEAT, pResult) == 0U)
+          {
+            continue;
+          }
+
+          TUNE_Descend(pOps, &config, pResult);
+          TUNE_AddMargin(&config, pBaseline);
+          if(TUNE_Stable(pOps, &config, SDRAM_TUNE_SOAK, pResult) == 0U)
+          {
+            continue;
+          }
+
+          pResult->Candidates++;
+          cycles = TUNE_Measure(pOps);
+          if(cycles < pResult->BestCycles)
+          {
+            pResult->Best = config;
+            pResult->BestCycles = cycles;
+          }
+        }
+      }
+    }
+  }
+
+  if(TUNE_Stable(pOps, &pResult->Best, 1U, pResult) == 0U)
+  {
+    pResult->Best = *pBaseline;
+    pResult->BestCycles = pResult->BaselineCycles;
+    (void)pOps->Apply(pBaseline);
+    return HAL_ERROR;
+  }
+  return HAL_OK;
+}
+
+/**
+  * @brief  按fmc.c中MX_FMC_Init和SDRAM_InitSequence的写法输出配置，可以直接替换原来的值
+  * @param  pConfig: 配置
+  * @retval 无
+  */
+void SDRAM_Tune_Print(const SDRAM_ConfigTypeDef *pConfig)
+{
+  uint32_t i;
+
+  printf("  hsdram2.Init.CASLatency = FMC_SDRAM_CAS_LATENCY_%u;\r\n", (unsigned)pConfig->CASLatency);
+  printf("  hsdram2.Init.ReadBurst = FMC_SDRAM_RBURST_%s;\r\n", (pConfig->ReadBurst != 0U) ? "ENABLE" : "DISABLE");
+  printf("  hsdram2.Init.ReadPipeDelay = FMC_SDRAM_RPIPE_DELAY_%u;\r\n", (unsigned)pConfig->ReadPipeDelay);
+  for(i = 0; i < SDRAM_TIMINGS; i++)
+  {
+    printf("  SdramTiming.%s = %u;\r\n", TimingNames[i], (unsigned)pConfig->Timing[i]);
+  }
+  printf("  /* SDRAM_InitSequence */ SDRAM_MODEREG_BURST_LENGTH_%u | SDRAM_MODEREG_CAS_LATENCY_%u\r\n",
+         (unsigned)pConfig->BurstLength, (unsigned)pConfig->CASLatency);
+}
+
+/**
+  * @brief  应用一个配置并连续校验
+  * @param  pOps: 操作
+  * @param  pConfig: 配置
+  * @param  Repeat: 校验次数
+  * @param  pResult: 累计应用和失败的次数
+  * @retval 1: 全部通过  0: 不合法、应用失败或校验出错
+  */
+static uint32_t TUNE_Stable(const SDRAM_TuneOpsTypeDef *pOps, const SDRAM_ConfigTypeDef *pConfig,
+                            uint32_t Repeat, SDRAM_TuneResultTypeDef *pResult)
+{
+  uint32_t i;
+
+  if(SDRAM_Tune_IsLegal(pConfig) == 0U)
+  {
+    return 0U;
+  }
+
+  pResult->Applied++;
+  if(pOps->Apply(pConfig) != HAL_OK)
+  {
+    pResult->Failed++;
+    return 0U;
+  }
+  for(i = 0; i < Repeat; i++)
+  {
+    if(pOps->Verify() != 0U)
+    {
+      pResult->Failed++;
+      return 0U;
+    }
+  }
+  return 1U;
+}
+
+/**
+  * @brief  测量已应用的配置
+  * @param  pOps: 操作
+  * @retval SDRAM_TUNE_RUNS次中最少的周期数
+  */
+static uint32_t TUNE_Measure(const SDRAM_TuneOpsTypeDef *pOps)
+{
+  uint32_t best = 0xFFFFFFFFU;
+  uint32_t run, cycles;
+
+  for(run = 0; run < SDRAM_TUNE_RUNS; run++)
+  {
+    cycles = pOps->Measure();
+    if(cycles < best)
+    {
+      best = cycles;
+    }
+  }
+  return best;
+}
+
+/**
+  * @brief  按TuneOrder逐个减小时序参数，每次减1，直到校验出错或违反FMC约束；
+  *         一个参数减小后其他参数的约束可能放宽，所以重复到没有参数能再减小
+  * @param  pOps: 操作
+  * @param  pConfig: 输入为稳定的起点，输出为减小后的配置
+  * @param  pResult: 累计应用和失败的次数
+  * @retval 无
+  */
+static void TUNE_Descend(const SDRAM_TuneOpsTypeDef *pOps, SDRAM_ConfigTypeDef *pConfig, SDRAM_TuneResultTypeDef *pResult)
+{
+  uint8_t floor[SDRAM_TIMINGS];     /* 已知不稳定的最大值，不再尝试 */
+  SDRAM_ConfigTypeDef trial;
+  uint32_t i, changed;
+  uint8_t index;
+
+  memset(floor, SDRAM_TIMING_MIN - 1U, sizeof(floor));
+  do
+  {
+    changed = 0;
+    for(i = 0; i < sizeof(TuneOrder); i++)
+    {
+      index = TuneOrder[i];
+      trial = *pConfig;
+      while(trial.Timing[index] > (floor[index] + 1U))
+      {
+        trial.Timing[index]--;
+        if(SDRAM_Tune_IsLegal(&trial) == 0U)
+        {
+          break;
+        }
+        if(TUNE_Stable(pOps, &trial, SDRAM_TUNE_REPEAT, pResult) == 0U)
+        {
+          floor[index] = trial.Timing[index];
+          break;
+        }
+        *pConfig = trial;
+        changed = 1U;
+      }
+    }
+  }while(changed != 0U);
+}
+
+/**
+  * @brief  给减小过的时序参数加上余量，不超过原来的值，并把TWR调整到满足FMC约束
+  * @param  pConfig: 配置
+  * @param  pBaseline: 原来的配置
+  * @retval 无
+  */
+static void TUNE_AddMargin(SDRAM_ConfigTypeDef *pConfig, const SDRAM_ConfigTypeDef *pBaseline)
+{
+  uint8_t *t = pConfig->Timing;
+  int32_t required;
+  uint32_t i, value;
+  uint8_t index;
+
+  for(i = 0; i < sizeof(TuneOrder); i++)
+  {
+    index = TuneOrder[i];
+    if(t[index] < pBaseline->Timing[index])
+    {
+      value = (uint32_t)t[index] + SDRAM_TUNE_MARGIN;
+      t[index] = (uint8_t)((value < pBaseline->Timing[index]) ? value : pBaseline->Timing[index]);
+    }
+  }
+
+  required = (int32_t)t[SDRAM_TRAS] - (int32_t)t[SDRAM_TRCD];
+  if(((int32_t)t[SDRAM_TRC] - (int32_t)t[SDRAM_TRCD] - (int32_t)t[SDRAM_TRP]) > required)
+  {
+    required = (int32_t)t[SDRAM_TRC] - (int32_t)t[SDRAM_TRCD] - (int32_t)t[SDRAM_TRP];
+  }
+  if((int32_t)t[SDRAM_TWR] < required)
+  {
+    t[SDRAM_TWR] = (uint8_t)required;
+  }
+}
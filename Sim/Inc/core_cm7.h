@@ -0,0 +1,46 @@
+/**
+  * @brief  主机仿真用的内核头文件，在包含路径中位于CMSIS之前
+  * @note   先包含CMSIS的core_cm7.h，再用能在x86上编译的实现代替LCD驱动用到的几条ARM指令，
+  *         其余内联函数不被调用就不会生成代码
+  */
+#ifndef __SIM_CORE_CM7_H
+#define __SIM_CORE_CM7_H
+
+#define __DMB            ARM___DMB
+#define __DSB            ARM___DSB
+#define __ISB            ARM___ISB
+#define __get_PRIMASK    ARM___get_PRIMASK
+#define __set_PRIMASK    ARM___set_PRIMASK
+#define __disable_irq    ARM___disable_irq
+#define __enable_irq     ARM___enable_irq
+#define __get_IPSR       ARM___get_IPSR
+
+/* CMSIS里寄存器地址与指针互转的内联函数只在目标板上执行，主机上的64位截断警告不关心 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpointer-to-int-cast"
+#pragma GCC diagnostic ignored "-Wint-to-pointer-cast"
+#include "../../Drivers/CMSIS/Include/core_cm7.h"
+#pragma GCC diagnostic pop
+
+#undef __DMB
+#undef __DSB
+#undef __ISB
+#undef __get_PRIMASK
+#undef __set_PRIMASK
+#undef __disable_irq
+#undef __enable_irq
+#undef __get_IPSR
+
+/* 仿真是单线程的，中断在忙等待时由后端同步产生，屏蔽中断只需要记录状态 */
+extern uint32_t SIM_PRIMASK;
+
+static inline void     __DMB(void)                  { __sync_synchronize(); }
+static inline void     __DSB(void)                  { __sync_synchronize(); }
+static inline void     __ISB(void)                  { }
+static inline uint32_t __get_PRIMASK(void)          { return SIM_PRIMASK; }
+static inline void     __set_PRIMASK(uint32_t Mask) { SIM_PRIMASK = Mask; }
+static inline void     __disable_irq(void)          { SIM_PRIMASK = 1U; }
+static inline void     __enable_irq(void)           { SIM_PRIMASK = 0U; }
+static inline uint32_t __get_IPSR(void)             { return 0U; }
+
+#endif /* __SIM_CORE_CM7_H */
@@ -0,0 +1,25 @@
+#ifndef __LCD_FONT_SOFT_H__
+#define __LCD_FONT_SOFT_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "lcd_font.h"
+
+/*
+ * 主机上生成大字库的工具。系统中没有中文TrueType字体时，用伪随机的横、竖、撇笔画合成与汉字
+ * 相近的A4字模，按Tools/ttf2font.py --rle相同的格式压缩，用于测量字模缓存和压缩的效果。
+ */
+
+uint32_t LCD_Font_Soft_Encode(const uint8_t *pPixels, uint32_t Width, uint32_t Height, uint32_t Bpp,
+                              uint8_t *pOut, uint32_t Size);
+void LCD_Font_Soft_Glyph(uint32_t Char, uint32_t Size, uint8_t *pPixels);
+HAL_StatusTypeDef LCD_Font_Soft_CJK(sFONT *pFont, uint32_t FirstCode, uint32_t Step, uint32_t Count,
+                                    uint32_t Size, uint32_t *pRawBytes);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __LCD_FONT_SOFT_H__ */
@@ -0,0 +1,39 @@
+#ifndef __LCD_JPEG_SOFT_H__
+#define __LCD_JPEG_SOFT_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "lcd_jpeg.h"
+
+/*
+ * 主机上代替JPEG编解码器的解码器。输入不是JPEG文件，而是10字节文件头("MCU0"、宽、高(16位小端)、
+ * 颜色空间、色度抽样)加上与编解码器输出相同排列的MCU数据；解码器把MCU数据按块原样搬到输出，
+ * 回调的时序与HAL中断方式相同，用于在主机上检验分块读取、暂停/恢复和颜色转换。
+ */
+
+/* 每次LCD_JPEG_SoftCodec.Idle最多搬运的字节数，越小与绘图代码交替得越频繁 */
+#ifndef LCD_JPEG_SOFT_STEP
+#define LCD_JPEG_SOFT_STEP        ((uint32_t)1024)
+#endif
+
+#define LCD_JPEG_SOFT_HEADER      ((uint32_t)10)
+
+/**
+  * @brief  生成测试图像的像素
+  * @param  X, Y: 像素坐标
+  * @retval RGB888颜色
+  */
+typedef uint32_t (*LCD_JPEG_SoftPixelTypeDef)(uint32_t X, uint32_t Y);
+
+extern const LCD_JPEG_CodecTypeDef LCD_JPEG_SoftCodec;
+
+uint32_t LCD_JPEG_Soft_Encode(const LCD_JPEG_InfoTypeDef *pInfo, LCD_JPEG_SoftPixelTypeDef Pixel,
+                              uint8_t *pOut, uint32_t Size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __LCD_JPEG_SOFT_H__ */
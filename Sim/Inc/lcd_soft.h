@@ -0,0 +1,79 @@
+#ifndef __LCD_SOFT_H__
+#define __LCD_SOFT_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "lcd_backend.h"
+
+/*
+ * 周期估计参数，按216MHz HCLK、16位108MHz SDRAM粗略估计，应按板上实测值修改。
+ * 每条DMA2D命令的周期 = 启动开销 + max(像素数 × 每像素周期, 读写字节数 × 每字节周期)，
+ * 每像素和每字节周期以1/16周期为单位。
+ */
+#ifndef LCD_SOFT_HCLK_MHZ
+#define LCD_SOFT_HCLK_MHZ             ((uint32_t)216)
+#endif
+#ifndef LCD_SOFT_FRAME_RATE
+#define LCD_SOFT_FRAME_RATE           ((uint32_t)60)
+#endif
+#ifndef LCD_SOFT_DMA2D_SETUP_CYCLES
+#define LCD_SOFT_DMA2D_SETUP_CYCLES   ((uint32_t)40)
+#endif
+#ifndef LCD_SOFT_CYCLES_PER_BYTE16
+#define LCD_SOFT_CYCLES_PER_BYTE16    ((uint32_t)16)
+#endif
+#ifndef LCD_SOFT_BLEND_CYCLES16
+#define LCD_SOFT_BLEND_CYCLES16       ((uint32_t)32)
+#endif
+#ifndef LCD_SOFT_PIXEL_CYCLES16
+#define LCD_SOFT_PIXEL_CYCLES16       ((uint32_t)16)
+#endif
+
+/* 统计中DMA2D命令的分类 */
+#define LCD_SOFT_R2M          ((uint32_t)0)
+#define LCD_SOFT_M2M          ((uint32_t)1)
+#define LCD_SOFT_M2M_PFC      ((uint32_t)2)
+#define LCD_SOFT_M2M_BLEND    ((uint32_t)3)
+#define LCD_SOFT_CLUT_LOAD    ((uint32_t)4)
+#define LCD_SOFT_MODES        ((uint32_t)5)
+
+/**
+  * @brief  软件后端统计，周期为估计值
+  */
+typedef struct
+{
+  uint32_t Commands[LCD_SOFT_MODES];   /* DMA2D命令数 */
+  uint64_t Pixels[LCD_SOFT_MODES];     /* 处理的像素数 */
+  uint64_t Bytes[LCD_SOFT_MODES];      /* 读写存储器的字节数 */
+  uint64_t Cycles[LCD_SOFT_MODES];     /* 估计的DMA2D周期 */
+  uint32_t Frames;                     /* LTDC扫描输出的帧数 */
+  uint32_t Reloads;                    /* 垂直消隐重载次数 */
+  uint64_t LtdcBytes;                  /* LTDC读取显存的字节数 */
+  uint64_t LtdcCycles;                 /* LTDC占用总线的估计周期 */
+}LCD_SoftStatsTypeDef;
+
+/**
+  * @brief  每帧扫描完成时的回调，用于检查驱动等待重载期间输出的画面
+  */
+typedef void (*LCD_SoftFrameHookTypeDef)(const uint32_t *pFrame);
+
+extern const LCD_BackendTypeDef LCD_SoftBackend;
+
+HAL_StatusTypeDef LCD_Soft_Init(uint16_t Width, uint16_t Height);
+void LCD_Soft_Advance(uint32_t Lines);
+void LCD_Soft_VSync(void);
+const uint32_t *LCD_Soft_GetFrame(void);
+void LCD_Soft_SetFrameHook(LCD_SoftFrameHookTypeDef pHook);
+uint32_t LCD_Soft_GetScanAddress(uint32_t LayerIndex);
+HAL_StatusTypeDef LCD_Soft_DumpPPM(const char *pPath);
+void LCD_Soft_GetStats(LCD_SoftStatsTypeDef *pStats);
+void LCD_Soft_ResetStats(void);
+void LCD_Soft_PrintStats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __LCD_SOFT_H__ */
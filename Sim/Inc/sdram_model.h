@@ -0,0 +1,38 @@
+#ifndef __SDRAM_MODEL_H__
+#define __SDRAM_MODEL_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "sdram_tune.h"
+
+/*
+ * 主机上代替FMC和SDRAM的时序模型，用于检验SDRAM_Tune的搜索：配置满足模型的最小时序时校验通过，
+ * 恰好等于最小值时按FlakeRate随机出错；参考负载的周期数按FMC的命令间隔粗略估算。
+ */
+
+/**
+  * @brief  模型参数
+  */
+typedef struct
+{
+  uint8_t  Minimum[SDRAM_TIMINGS];  /* 稳定工作的最小时序，不检查TMRD和TXSR */
+  uint8_t  MinCASLatency;           /* 可用的最小CAS延迟 */
+  uint8_t  MinReadDelay;            /* CASLatency + ReadPipeDelay的最小值，数据在FMC采样之前到达 */
+  uint8_t  MaxBurstLength;          /* 不与下一个命令冲突的最大突发长度 */
+  uint16_t FlakeRate;               /* 时序恰好等于最小值时每次校验出错的概率(1/65536) */
+}SDRAM_ModelTypeDef;
+
+extern const SDRAM_TuneOpsTypeDef SDRAM_ModelOps;
+
+void     SDRAM_Model_Init(const SDRAM_ModelTypeDef *pModel, const SDRAM_ConfigTypeDef *pConfig, uint32_t Seed);
+uint32_t SDRAM_Model_IsStable(const SDRAM_ConfigTypeDef *pConfig);
+uint32_t SDRAM_Model_Cycles(const SDRAM_ConfigTypeDef *pConfig);
+const SDRAM_ConfigTypeDef *SDRAM_Model_Current(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __SDRAM_MODEL_H__ */
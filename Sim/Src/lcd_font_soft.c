@@ -0,0 +1,275 @@
+#include "lcd_font_soft.h"
+#include <stdlib.h>
+#include <string.h>
+
+static uint32_t SOFT_FontRandom(uint32_t *pSeed);
+static void SOFT_FontStroke(uint8_t *pPixels, uint32_t Size, float ax, float ay, float bx, float by, float r);
+
+/**
+  * @brief  按LCD_FONT_RLE格式压缩一个字模，与Tools/ttf2font.py的rle()相同
+  * @param  pPixels: 逐像素的值，A4为0~15，A8为0~255
+  * @param  Width, Height: 字模大小
+  * @param  Bpp: 4或8
+  * @param  pOut: 输出缓冲区
+  * @param  Size: 输出缓冲区大小
+  * @retval 压缩后的字节数，缓冲区不够时返回0
+  */
+uint32_t LCD_Font_Soft_Encode(const uint8_t *pPixels, uint32_t Width, uint32_t Height, uint32_t Bpp,
+                              uint8_t *pOut, uint32_t Size)
+{
+  uint32_t total = Width * Height;
+  uint32_t mask = (1U << Bpp) - 1U;
+  uint32_t brk = (Bpp == 4U) ? 3U : 2U;
+  uint32_t length = 0;
+  uint32_t i = 0;
+  uint32_t n, j, k, zeros;
+  uint8_t  *res;
+
+  res = (uint8_t *)malloc(total + 1U);
+  if(res == NULL)
+  {
+    return 0;
+  }
+  for(k = 0; k < total; k++)
+  {
+    res[k] = (uint8_t)((pPixels[k] - ((k >= Width) ? pPixels[k - Width] : 0U)) & mask);
+  }
+
+  while(i < total)
+  {
+    for(n = 0; ((i + n) < total) && (res[i + n] == 0U) && (n < 128U); n++)
+    {
+    }
+    if((n >= brk) || ((i + n) == total))
+    {
+      if((length + 1U) > Size)
+      {
+        break;
+      }
+      pOut[length++] = (uint8_t)(n - 1U);
+      i += n;
+      continue;
+    }
+
+    /* 直接给出差值，直到后面连续brk个差值为0 */
+    for(j = i; (j < total) && ((j - i) < 128U); j++)
+    {
+      for(zeros = 0; (zeros < brk) && ((j + zeros) < total) && (res[j + zeros] == 0U); zeros++)
+      {
+      }
+      if((zeros == brk) || ((j + zeros) == total))
+      {
+        break;
+      }
+    }
+    n = j - i;
+    if((length + 1U + ((Bpp == 4U) ? (n + 1U) / 2U : n)) > Size)
+    {
+      break;
+    }
+    pOut[length++] = (uint8_t)(0x80U | (n - 1U));
+    for(k = 0; k < n; k++)
+    {
+      if(Bpp == 8U)
+      {
+        pOut[length++] = res[i + k];
+      }
+      else if((k & 1U) == 0U)
+      {
+        pOut[length++] = (uint8_t)(res[i + k] << 4);
+      }
+      else
+      {
+        pOut[length - 1U] |= res[i + k];
+      }
+    }
+    i = j;
+  }
+
+  free(res);
+  return (i == total) ? length : 0U;
+}
+
+/**
+  * @brief  生成一个类似汉字的A4字模：4~9笔横、竖和撇，笔画边缘按4×4超采样抗锯齿
+  * @param  Char: 字符编码，作为随机数种子
+  * @param  Size: 字模宽度和高度(像素)
+  * @param  pPixels: 输出Size×Size个0~15的值
+  * @retval 无
+  */
+void LCD_Font_Soft_Glyph(uint32_t Char, uint32_t Size, uint8_t *pPixels)
+{
+  uint32_t seed = (Char * 2654435761U) | 1U;
+  uint32_t strokes, s, type, a, b, c, span;
+  float r = (float)Size / 24.0f;
+
+  memset(pPixels, 0, Size * Size);
+  span = Size - 4U;
+  strokes = 4U + SOFT_FontRandom(&seed) % 6U;
+  for(s = 0; s < strokes; s++)
+  {
+    type = SOFT_FontRandom(&seed) % 10U;
+    a = 2U + SOFT_FontRandom(&seed) % span;                     /* 横画的行或竖画的列 */
+    b = 1U + SOFT_FontRandom(&seed) % (span / 2U);              /* 起点 */
+    c = b + span / 4U + SOFT_FontRandom(&seed) % (span / 2U);   /* 终点 */
+    if(c > (Size - 2U))
+    {
+      c = Size - 2U;
+    }
+
+    if(type < 6U)
+    {
+      SOFT_FontStroke(pPixels, Size, (float)b + 0.5f, (float)a + 0.5f, (float)c + 0.5f, (float)a + 0.5f, r);
+    }
+    else if(type < 9U)
+    {
+      SOFT_FontStroke(pPixels, Size, (float)a + 0.5f, (float)b + 0.5f, (float)a + 0.5f, (float)c + 0.5f, r);
+    }
+    else
+    {
+      SOFT_FontStroke(pPixels, Size, (float)a, (float)b, (float)(Size - 1U - c), (float)c, r);
+    }
+  }
+}
+
+/**
+  * @brief  生成一个稀疏的、按LCD_FONT_RLE压缩的A4字体
+  * @note   字符编码为FirstCode + i×Step，点阵和索引用malloc分配，不释放
+  * @param  pFont: 输出字体
+  * @param  FirstCode: 第一个字符的编码
+  * @param  Step: 相邻字符编码的间隔
+  * @param  Count: 字符个数
+  * @param  Size: 字模大小(像素)，行高为Size + 2
+  * @param  pRawBytes: 输出未压缩A4点阵的字节数，可以为NULL
+  * @retval HAL_OK: 成功 HAL_ERROR: 内存不足或编码超出16位
+  */
+HAL_StatusTypeDef LCD_Font_Soft_CJK(sFONT *pFont, uint32_t FirstCode, uint32_t Step, uint32_t Count,
+                                    uint32_t Size, uint32_t *pRawBytes)
+{
+  uint32_t bound = Size * Size / 2U + Size * Size / 128U + 2U;
+  LCD_GlyphTypeDef *glyphs;
+  uint16_t *codes;
+  uint8_t  *table, *pixels;
+  uint32_t i, length, offset = 0;
+
+  if(((FirstCode + (Count - 1U) * Step) > 0xFFFFU) || (Size > 255U))
+  {
+    return HAL_ERROR;
+  }
+  glyphs = (LCD_GlyphTypeDef *)malloc(Count * sizeof(LCD_GlyphTypeDef));
+  codes  = (uint16_t *)malloc(Count * sizeof(uint16_t));
+  table  = (uint8_t *)malloc(Count * bound);
+  pixels = (uint8_t *)malloc(Size * Size);
+  if((glyphs == NULL) || (codes == NULL) || (table == NULL) || (pixels == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  for(i = 0; i < Count; i++)
+  {
+    codes[i] = (uint16_t)(FirstCode + i * Step);
+    LCD_Font_Soft_Glyph(codes[i], Size, pixels);
+    length = LCD_Font_Soft_Encode(pixels, Size, Size, 4, table + offset, bound);
+    if(length == 0U)
+    {
+      return HAL_ERROR;
+    }
+    glyphs[i].Offset  = offset;
+    glyphs[i].Width   = (uint8_t)Size;
+    glyphs[i].Height  = (uint8_t)Size;
+    glyphs[i].XOffset = 1;
+    glyphs[i].YOffset = 1;
+    glyphs[i].Advance = (uint8_t)(Size + 2U);
+    offset += length;
+  }
+  free(pixels);
+
+  memset(pFont, 0, sizeof(*pFont));
+  pFont->table      = table;
+  pFont->Width      = (uint16_t)(Size + 2U);
+  pFont->Height     = (uint16_t)(Size + 2U);
+  pFont->Glyphs     = glyphs;
+  pFont->Ascent     = (uint16_t)(Size * 7U / 8U);
+  pFont->FirstChar  = codes[0];
+  pFont->GlyphCount = (uint16_t)Count;
+  pFont->Bpp        = 4;
+  pFont->Encoding   = LCD_FONT_RLE;
+  pFont->Codes      = codes;
+  if(pRawBytes != NULL)
+  {
+    *pRawBytes = Count * Size * ((Size + 1U) / 2U);
+  }
+  return HAL_OK;
+}
+
+/**
+  * @brief  xorshift32随机数
+  * @param  pSeed: 种子，不能为0
+  * @retval 随机数
+  */
+static uint32_t SOFT_FontRandom(uint32_t *pSeed)
+{
+  uint32_t x = *pSeed;
+
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  *pSeed = x;
+  return x;
+}
+
+/**
+  * @brief  画一笔：到线段(ax, ay)-(bx, by)的距离不超过r的区域，覆盖率取最大值
+  * @param  pPixels: Size×Size个0~15的值
+  * @param  Size: 字模大小
+  * @param  ax, ay, bx, by: 线段端点(像素)
+  * @param  r: 笔画半宽(像素)
+  * @retval 无
+  */
+static void SOFT_FontStroke(uint8_t *pPixels, uint32_t Size, float ax, float ay, float bx, float by, float r)
+{
+  float dx = bx - ax;
+  float dy = by - ay;
+  float len2 = dx * dx + dy * dy;
+  float px, py, t, ex, ey;
+  int32_t x, y, x0, y0, x1, y1, i, j;
+  uint32_t count, value;
+
+  x0 = (int32_t)(((ax < bx) ? ax : bx) - r - 1.0f);
+  y0 = (int32_t)(((ay < by) ? ay : by) - r - 1.0f);
+  x1 = (int32_t)(((ax > bx) ? ax : bx) + r + 1.0f);
+  y1 = (int32_t)(((ay > by) ? ay : by) + r + 1.0f);
+  x0 = (x0 < 0) ? 0 : x0;
+  y0 = (y0 < 0) ? 0 : y0;
+  x1 = (x1 >= (int32_t)Size) ? (int32_t)Size - 1 : x1;
+  y1 = (y1 >= (int32_t)Size) ? (int32_t)Size - 1 : y1;
+
+  for(y = y0; y <= y1; y++)
+  {
+    for(x = x0; x <= x1; x++)
+    {
+      count = 0;
+      for(j = 0; j < 4; j++)
+      {
+        for(i = 0; i < 4; i++)
+        {
+          px = (float)x + ((float)i + 0.5f) / 4.0f;
+          py = (float)y + ((float)j + 0.5f) / 4.0f;
+          t  = (len2 > 0.0f) ? (((px - ax) * dx + (py - ay) * dy) / len2) : 0.0f;
+          t  = (t < 0.0f) ? 0.0f : ((t > 1.0f) ? 1.0f : t);
+          ex = px - (ax + t * dx);
+          ey = py - (ay + t * dy);
+          if((ex * ex + ey * ey) <= (r * r))
+          {
+            count++;
+          }
+        }
+      }
+      value = (count * 15U + 8U) / 16U;
+      if(value > pPixels[y * (int32_t)Size + x])
+      {
+        pPixels[y * (int32_t)Size + x] = (uint8_t)value;
+      }
+    }
+  }
+}
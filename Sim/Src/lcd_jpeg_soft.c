@@ -0,0 +1,395 @@
+#include "lcd_jpeg_soft.h"
+#include "lcd_backend.h"
+#include <string.h>
+
+/**
+  * @brief  软件解码器状态，对应HAL_JPEG句柄中的输入输出计数
+  */
+typedef struct
+{
+  uint8_t  Running;
+  uint8_t  InPaused;
+  uint8_t  OutPaused;
+  uint8_t  InEnd;              /* 收到长度为0的输入 */
+  uint8_t  *pIn;
+  uint32_t InLength;
+  uint32_t InCount;
+  uint8_t  *pOut;
+  uint32_t OutLength;
+  uint32_t OutCount;
+  uint8_t  Header[LCD_JPEG_SOFT_HEADER];
+  uint32_t HeaderCount;
+  uint32_t Remaining;          /* 尚未输出的MCU数据字节数 */
+}SOFT_JpegTypeDef;
+
+static SOFT_JpegTypeDef Jpeg;
+
+static void SOFT_JpegInit(void);
+static HAL_StatusTypeDef SOFT_JpegStart(uint8_t *pIn, uint32_t InLength, uint8_t *pOut, uint32_t OutLength);
+static void SOFT_JpegInput(uint8_t *pIn, uint32_t Length);
+static void SOFT_JpegOutput(uint8_t *pOut, uint32_t Length);
+static void SOFT_JpegPause(uint32_t Direction);
+static void SOFT_JpegResume(uint32_t Direction);
+static void SOFT_JpegAbort(void);
+static void SOFT_JpegIdle(void);
+static uint32_t SOFT_JpegHeader(void);
+static uint32_t SOFT_JpegMcuBytes(const LCD_JPEG_InfoTypeDef *pInfo, uint32_t *pWidth, uint32_t *pHeight);
+
+/**
+  * @brief  软件JPEG解码器
+  */
+const LCD_JPEG_CodecTypeDef LCD_JPEG_SoftCodec =
+{
+  "soft",
+  SOFT_JpegInit,
+  SOFT_JpegStart,
+  SOFT_JpegInput,
+  SOFT_JpegOutput,
+  SOFT_JpegPause,
+  SOFT_JpegResume,
+  SOFT_JpegAbort,
+  SOFT_JpegIdle,
+};
+
+/**
+  * @brief  按编解码器的输出排列生成测试文件
+  * @note   色度取对应像素的平均值，图像右边和下边不满一个MCU的部分重复最后一列/行
+  * @param  pInfo: 图像大小、颜色空间和色度抽样，不支持CMYK
+  * @param  Pixel: 生成像素的函数
+  * @param  pOut: 输出缓冲区
+  * @param  Size: 输出缓冲区大小
+  * @retval 文件长度，缓冲区不够时为0
+  */
+uint32_t LCD_JPEG_Soft_Encode(const LCD_JPEG_InfoTypeDef *pInfo, LCD_JPEG_SoftPixelTypeDef Pixel,
+                              uint8_t *pOut, uint32_t Size)
+{
+  uint32_t mcu_w, mcu_h, mcu_bytes, mcus_x, mcus_y, length;
+  uint32_t mx, my, x, y, px, py, rgb, blocks, hs, vs;
+  int32_t  r, g, b, cb[64], cr[64], n[64];
+  uint8_t  *mcu;
+
+  mcu_bytes = SOFT_JpegMcuBytes(pInfo, &mcu_w, &mcu_h);
+  if((mcu_bytes == 0U) || (pInfo->ColorSpace == LCD_JPEG_CMYK))
+  {
+    return 0;
+  }
+  mcus_x = (pInfo->Width + mcu_w - 1U) / mcu_w;
+  mcus_y = (pInfo->Height + mcu_h - 1U) / mcu_h;
+  length = LCD_JPEG_SOFT_HEADER + mcus_x * mcus_y * mcu_bytes;
+  if(length > Size)
+  {
+    return 0;
+  }
+
+  pOut[0] = 'M';
+  pOut[1] = 'C';
+  pOut[2] = 'U';
+  pOut[3] = '0';
+  pOut[4] = (uint8_t)pInfo->Width;
+  pOut[5] = (uint8_t)(pInfo->Width >> 8);
+  pOut[6] = (uint8_t)pInfo->Height;
+  pOut[7] = (uint8_t)(pInfo->Height >> 8);
+  pOut[8] = (uint8_t)pInfo->ColorSpace;
+  pOut[9] = (uint8_t)pInfo->ChromaSubsampling;
+
+  blocks = (mcu_w / 8U) * (mcu_h / 8U);
+  hs = mcu_w / 8U;
+  vs = mcu_h / 8U;
+  mcu = pOut + LCD_JPEG_SOFT_HEADER;
+  for(my = 0; my < mcus_y; my++)
+  {
+    for(mx = 0; mx < mcus_x; mx++)
+    {
+      memset(cb, 0, sizeof(cb));
+      memset(cr, 0, sizeof(cr));
+      memset(n, 0, sizeof(n));
+      for(y = 0; y < mcu_h; y++)
+      {
+        for(x = 0; x < mcu_w; x++)
+        {
+          px  = mx * mcu_w + x;
+          py  = my * mcu_h + y;
+          rgb = Pixel((px < pInfo->Width) ? px : pInfo->Width - 1U, (py < pInfo->Height) ? py : pInfo->Height - 1U);
+          r = (int32_t)((rgb >> 16) & 0xFFU);
+          g = (int32_t)((rgb >> 8) & 0xFFU);
+          b = (int32_t)(rgb & 0xFFU);
+          /* Y块按从左到右、从上到下排列 */
+          mcu[((y / 8U) * hs + x / 8U) * 64U + (y % 8U) * 8U + x % 8U] =
+            (uint8_t)((19595 * r + 38470 * g + 7471 * b + 32768) >> 16);
+          cb[(y / vs) * 8U + x / hs] += (-11059 * r - 21709 * g + 32768 * b) >> 16;
+          cr[(y / vs) * 8U + x / hs] += (32768 * r - 27439 * g - 5329 * b) >> 16;
+          n[(y / vs) * 8U + x / hs]++;
+        }
+      }
+      if(pInfo->ColorSpace == LCD_JPEG_YCBCR)
+      {
+        for(x = 0; x < 64U; x++)
+        {
+          mcu[blocks * 64U + x]       = (uint8_t)(128 + cb[x] / n[x]);
+          mcu[blocks * 64U + 64U + x] = (uint8_t)(128 + cr[x] / n[x]);
+        }
+      }
+      mcu += mcu_bytes;
+    }
+  }
+  return length;
+}
+
+/**
+  * @brief  初始化
+  * @retval 无
+  */
+static void SOFT_JpegInit(void)
+{
+  memset(&Jpeg, 0, sizeof(Jpeg));
+}
+
+/**
+  * @brief  开始解码，数据在LCD_JPEG_SoftCodec.Idle中处理
+  * @param  pIn, InLength: 第一块输入
+  * @param  pOut, OutLength: 第一块输出缓冲区
+  * @retval HAL_OK: 成功 HAL_BUSY: 上一次解码尚未结束
+  */
+static HAL_StatusTypeDef SOFT_JpegStart(uint8_t *pIn, uint32_t InLength, uint8_t *pOut, uint32_t OutLength)
+{
+  if(Jpeg.Running != 0U)
+  {
+    return HAL_BUSY;
+  }
+  memset(&Jpeg, 0, sizeof(Jpeg));
+  Jpeg.Running   = 1;
+  Jpeg.pIn       = pIn;
+  Jpeg.InLength  = InLength;
+  Jpeg.pOut      = pOut;
+  Jpeg.OutLength = OutLength;
+  return HAL_OK;
+}
+
+/**
+  * @brief  设置下一块输入
+  * @param  pIn: 输入数据
+  * @param  Length: 字节数，0表示没有更多数据
+  * @retval 无
+  */
+static void SOFT_JpegInput(uint8_t *pIn, uint32_t Length)
+{
+  Jpeg.pIn      = pIn;
+  Jpeg.InLength = Length;
+  Jpeg.InCount  = 0;
+  Jpeg.InEnd    = (Length == 0U) ? 1U : 0U;
+}
+
+/**
+  * @brief  设置下一块输出缓冲区
+  * @param  pOut: 输出缓冲区
+  * @param  Length: 字节数
+  * @retval 无
+  */
+static void SOFT_JpegOutput(uint8_t *pOut, uint32_t Length)
+{
+  Jpeg.pOut      = pOut;
+  Jpeg.OutLength = Length;
+  Jpeg.OutCount  = 0;
+}
+
+/**
+  * @brief  暂停输入或输出
+  * @param  Direction: LCD_JPEG_INPUT/LCD_JPEG_OUTPUT
+  * @retval 无
+  */
+static void SOFT_JpegPause(uint32_t Direction)
+{
+  if((Direction & LCD_JPEG_INPUT) != 0U)
+  {
+    Jpeg.InPaused = 1;
+  }
+  if((Direction & LCD_JPEG_OUTPUT) != 0U)
+  {
+    Jpeg.OutPaused = 1;
+  }
+}
+
+/**
+  * @brief  恢复输入或输出
+  * @param  Direction: LCD_JPEG_INPUT/LCD_JPEG_OUTPUT
+  * @retval 无
+  */
+static void SOFT_JpegResume(uint32_t Direction)
+{
+  if((Direction & LCD_JPEG_INPUT) != 0U)
+  {
+    Jpeg.InPaused = 0;
+  }
+  if((Direction & LCD_JPEG_OUTPUT) != 0U)
+  {
+    Jpeg.OutPaused = 0;
+  }
+}
+
+/**
+  * @brief  中止解码
+  * @retval 无
+  */
+static void SOFT_JpegAbort(void)
+{
+  Jpeg.Running = 0;
+}
+
+/**
+  * @brief  搬运最多LCD_JPEG_SOFT_STEP字节，回调时序与HAL_JPEG中断处理相同：
+  *         输入读完调用GetData，输出写满调用DataReady，全部输出后交出剩余数据并结束
+  * @note   输入和输出都被暂停、或者输入已经用完时推进软件LTDC，使HAL_GetTick前进
+  * @retval 无
+  */
+static void SOFT_JpegIdle(void)
+{
+  uint32_t budget = LCD_JPEG_SOFT_STEP;
+  uint32_t n;
+
+  while((Jpeg.Running != 0U) && (budget != 0U))
+  {
+    /* 全部MCU已输出：交出不满的输出缓冲区后结束，输出暂停时等待恢复 */
+    if((Jpeg.HeaderCount == LCD_JPEG_SOFT_HEADER) && (Jpeg.Remaining == 0U))
+    {
+      if(Jpeg.OutPaused != 0U)
+      {
+        break;
+      }
+      Jpeg.Running = 0;
+      if(Jpeg.OutCount != 0U)
+      {
+        n = Jpeg.OutCount;
+        Jpeg.OutCount = 0;
+        LCD_JPEG_DataReady(Jpeg.pOut, n);
+      }
+      LCD_JPEG_DecodeDone(0);
+      return;
+    }
+
+    /* 当前输入读完，请求下一块 */
+    if((Jpeg.InCount == Jpeg.InLength) && (Jpeg.InPaused == 0U) && (Jpeg.InEnd == 0U))
+    {
+      n = Jpeg.InCount;
+      Jpeg.InCount  = 0;
+      Jpeg.InLength = 0;
+      LCD_JPEG_GetData(n);
+      continue;
+    }
+    if((Jpeg.InPaused != 0U) || (Jpeg.InCount == Jpeg.InLength))
+    {
+      break;
+    }
+
+    if(Jpeg.HeaderCount < LCD_JPEG_SOFT_HEADER)
+    {
+      Jpeg.Header[Jpeg.HeaderCount++] = Jpeg.pIn[Jpeg.InCount++];
+      budget--;
+      if((Jpeg.HeaderCount == LCD_JPEG_SOFT_HEADER) && (SOFT_JpegHeader() == 0U))
+      {
+        Jpeg.Running = 0;
+        LCD_JPEG_DecodeDone(1);
+        return;
+      }
+      continue;
+    }
+
+    if(Jpeg.OutPaused != 0U)
+    {
+      break;
+    }
+    n = Jpeg.InLength - Jpeg.InCount;
+    if(n > Jpeg.OutLength - Jpeg.OutCount)
+    {
+      n = Jpeg.OutLength - Jpeg.OutCount;
+    }
+    if(n > Jpeg.Remaining)
+    {
+      n = Jpeg.Remaining;
+    }
+    if(n > budget)
+    {
+      n = budget;
+    }
+    memcpy(Jpeg.pOut + Jpeg.OutCount, Jpeg.pIn + Jpeg.InCount, n);
+    Jpeg.InCount   += n;
+    Jpeg.OutCount  += n;
+    Jpeg.Remaining -= n;
+    budget         -= n;
+
+    if(Jpeg.OutCount == Jpeg.OutLength)
+    {
+      Jpeg.OutCount = 0;
+      LCD_JPEG_DataReady(Jpeg.pOut, Jpeg.OutLength);
+    }
+  }
+
+  if(budget == LCD_JPEG_SOFT_STEP)
+  {
+    LCD_GetBackend()->Idle();
+  }
+}
+
+/**
+  * @brief  解析文件头并通知图像信息
+  * @retval MCU数据字节数，格式错误时为0
+  */
+static uint32_t SOFT_JpegHeader(void)
+{
+  LCD_JPEG_InfoTypeDef info;
+  uint32_t mcu_w, mcu_h, mcu_bytes;
+
+  if(memcmp(Jpeg.Header, "MCU0", 4) != 0)
+  {
+    return 0;
+  }
+  info.Width             = (uint32_t)Jpeg.Header[4] | ((uint32_t)Jpeg.Header[5] << 8);
+  info.Height            = (uint32_t)Jpeg.Header[6] | ((uint32_t)Jpeg.Header[7] << 8);
+  info.ColorSpace        = Jpeg.Header[8];
+  info.ChromaSubsampling = Jpeg.Header[9];
+  mcu_bytes = SOFT_JpegMcuBytes(&info, &mcu_w, &mcu_h);
+  if((mcu_bytes == 0U) || (info.Width == 0U) || (info.Height == 0U))
+  {
+    return 0;
+  }
+
+  Jpeg.Remaining = ((info.Width + mcu_w - 1U) / mcu_w) * ((info.Height + mcu_h - 1U) / mcu_h) * mcu_bytes;
+  LCD_JPEG_InfoReady(&info);
+  return Jpeg.Remaining;
+}
+
+/**
+  * @brief  MCU的大小
+  * @param  pInfo: 图像信息
+  * @param  pWidth, pHeight: 输出MCU的宽度和高度
+  * @retval MCU字节数，不支持的格式为0
+  */
+static uint32_t SOFT_JpegMcuBytes(const LCD_JPEG_InfoTypeDef *pInfo, uint32_t *pWidth, uint32_t *pHeight)
+{
+  *pWidth  = 8;
+  *pHeight = 8;
+  switch(pInfo->ColorSpace)
+  {
+  case LCD_JPEG_GRAYSCALE:
+    return 64;
+  case LCD_JPEG_CMYK:
+    return 256;
+  case LCD_JPEG_YCBCR:
+    break;
+  default:
+    return 0;
+  }
+  switch(pInfo->ChromaSubsampling)
+  {
+  case LCD_JPEG_444:
+    return 192;
+  case LCD_JPEG_422:
+    *pWidth = 16;
+    return 256;
+  case LCD_JPEG_420:
+    *pWidth  = 16;
+    *pHeight = 16;
+    return 384;
+  default:
+    return 0;
+  }
+}
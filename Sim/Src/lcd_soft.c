@@ -0,0 +1,887 @@
+#include "lcd_soft.h"
+#include "lcd_display.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+
+/* 主机上没有ltdc.c，句柄在这里定义；dma2d.c只用于寄存器缓存的检查，DMA2D命令由本后端执行 */
+LTDC_HandleTypeDef  hltdc;
+uint32_t            SIM_PRIMASK;
+
+#define Ltdc_Handler hltdc
+
+/**
+  * @brief  一个LTDC层的寄存器状态
+  */
+typedef struct
+{
+  LTDC_LayerCfgTypeDef Cfg;
+  uint8_t              Enabled;
+  uint8_t              KeyEnable;
+  uint32_t             Key;
+  uint32_t             CLUT[256];   /* ARGB8888，Alpha固定为255 */
+}SOFT_LayerTypeDef;
+
+static SOFT_LayerTypeDef    Shadow[MAX_LAYER_NUMBER];  /* 写入的寄存器 */
+static SOFT_LayerTypeDef    Active[MAX_LAYER_NUMBER];  /* 重载后正在使用的寄存器 */
+static uint8_t              VBlankReload;
+static uint8_t              DisplayOn;
+static uint16_t             ScreenWidth, ScreenHeight;
+static uint32_t             ScanLine;                  /* 同LTDC_CPSR的CYPOS */
+static uint32_t             EventLine;
+static uint8_t              EventArmed;
+static uint64_t             LineClock;                 /* 开始仿真以来的行数，用于HAL_GetTick */
+static uint32_t             *Frame;                    /* 扫描输出的画面，ARGB8888 */
+static uint32_t             DmaCLUT[256];              /* DMA2D前景层CLUT */
+static uint8_t              Dma2dBusy;                 /* 已执行完、尚未通知队列的命令 */
+static uint8_t              Mapped;
+static LCD_SoftFrameHookTypeDef FrameHook;
+static LCD_SoftStatsTypeDef Stats;
+
+/* 各种输入格式每像素的位数，LTDC的层格式与DMA2D输入格式0~7相同 */
+static const uint8_t FormatBits[11] = {32, 24, 16, 16, 16, 8, 8, 16, 4, 8, 4};
+
+static HAL_StatusTypeDef SOFT_ConfigLayer(LTDC_LayerCfgTypeDef *pLayerCfg, uint32_t LayerIndex, uint32_t Reload);
+static void SOFT_EnableLayer(uint32_t LayerIndex, FunctionalState State, uint32_t Reload);
+static HAL_StatusTypeDef SOFT_ConfigCLUT(uint32_t *pCLUT, uint32_t Count, uint32_t LayerIndex);
+static void SOFT_ColorKey(uint32_t LayerIndex, FunctionalState State, uint32_t RGBValue);
+static void SOFT_Reload(uint32_t Reload);
+static uint32_t SOFT_ReloadPending(void);
+static void SOFT_Display(FunctionalState State);
+static uint32_t SOFT_GetLine(void);
+static void SOFT_LineEvent(uint32_t Line);
+static void SOFT_Idle(void);
+static void SOFT_Dma2dInit(void);
+static HAL_StatusTypeDef SOFT_Dma2dStart(const LCD_DMA2D_CmdTypeDef *pCmd);
+static void SOFT_Dma2dPoll(void);
+static uint32_t SOFT_Expand(uint32_t Value, uint32_t Bits);
+static uint32_t SOFT_Load(uint32_t Format, uint32_t Address, uint32_t Index, const uint32_t *pCLUT);
+static void SOFT_Store(uint32_t Format, uint32_t Address, uint32_t Color);
+static uint32_t SOFT_Input(uint32_t Format, uint32_t Address, uint32_t Index, uint32_t AlphaMode, uint32_t Alpha);
+static uint32_t SOFT_Blend(uint32_t Fg, uint32_t Bg);
+static void SOFT_Account(uint32_t Mode, uint32_t Pixels, uint32_t BitsPerPixel);
+static void SOFT_ScanRow(uint32_t Row);
+
+/**
+  * @brief  软件后端：LTDC和DMA2D在内存中模拟，用于在主机上运行和测量绘图代码
+  */
+const LCD_BackendTypeDef LCD_SoftBackend =
+{
+  "soft",
+  SOFT_ConfigLayer,
+  SOFT_EnableLayer,
+  SOFT_ConfigCLUT,
+  SOFT_ColorKey,
+  SOFT_Reload,
+  SOFT_ReloadPending,
+  SOFT_Display,
+  SOFT_GetLine,
+  SOFT_LineEvent,
+  SOFT_Idle,
+  SOFT_Dma2dInit,
+  SOFT_Dma2dStart,
+  SOFT_Dma2dPoll,
+};
+
+/**
+  * @brief  初始化软件后端：映射SDRAM地址范围，按ltdc.c的时序设置屏幕，并选择该后端
+  * @note   驱动以32位整数保存地址，程序必须以非PIE方式链接，静态变量和SDRAM都位于4GB以下
+  * @param  Width: 屏幕宽度
+  * @param  Height: 屏幕高度
+  * @retval HAL状态
+  */
+HAL_StatusTypeDef LCD_Soft_Init(uint16_t Width, uint16_t Height)
+{
+  void *sdram;
+
+  if(Mapped == 0U)
+  {
+    sdram = mmap((void *)(uintptr_t)LCD_SDRAM_START_ADDRESS, LCD_SDRAM_END_ADDRESS - LCD_SDRAM_START_ADDRESS,
+                 PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+    if(sdram != (void *)(uintptr_t)LCD_SDRAM_START_ADDRESS)
+    {
+      return HAL_ERROR;
+    }
+    Mapped = 1;
+  }
+
+  free(Frame);
+  Frame = calloc((size_t)Width * Height, sizeof(uint32_t));
+  if(Frame == NULL)
+  {
+    return HAL_ERROR;
+  }
+  ScreenWidth  = Width;
+  ScreenHeight = Height;
+
+  /* 与ltdc.c相同的前后肩 */
+  memset(&Ltdc_Handler, 0, sizeof(Ltdc_Handler));
+  Ltdc_Handler.Init.AccumulatedHBP     = 46;
+  Ltdc_Handler.Init.AccumulatedVBP     = 23;
+  Ltdc_Handler.Init.AccumulatedActiveW = 46U + Width;
+  Ltdc_Handler.Init.AccumulatedActiveH = 23U + Height;
+  Ltdc_Handler.Init.TotalWidth         = 46U + Width + 22U;
+  Ltdc_Handler.Init.TotalHeigh         = 23U + Height + 22U;
+
+  memset(Shadow, 0, sizeof(Shadow));
+  memset(Active, 0, sizeof(Active));
+  VBlankReload = 0;
+  DisplayOn    = 0;
+  ScanLine     = 0;
+  EventArmed   = 0;
+  LineClock    = 0;
+  Dma2dBusy    = 0;
+  SIM_PRIMASK  = 0;
+  LCD_Soft_ResetStats();
+
+  LCD_SetBackend(&LCD_SoftBackend);
+  return HAL_OK;
+}
+
+/**
+  * @brief  推进LTDC扫描若干行：扫描有效行，产生行中断，在垂直消隐开始时重载寄存器
+  * @param  Lines: 行数
+  * @retval 无
+  */
+void LCD_Soft_Advance(uint32_t Lines)
+{
+  uint32_t total = Ltdc_Handler.Init.TotalHeigh + 1U;
+  uint32_t first = Ltdc_Handler.Init.AccumulatedVBP + 1U;
+  uint32_t blank = Ltdc_Handler.Init.AccumulatedActiveH + 1U;
+
+  while(Lines-- > 0U)
+  {
+    if((ScanLine >= first) && (ScanLine < blank))
+    {
+      SOFT_ScanRow(ScanLine - first);
+    }
+    ScanLine = (ScanLine + 1U) % total;
+    LineClock++;
+
+    if(ScanLine == blank)
+    {
+      if(DisplayOn != 0U)
+      {
+        Stats.Frames++;
+        if(FrameHook != NULL)
+        {
+          FrameHook(Frame);
+        }
+      }
+      if(VBlankReload != 0U)
+      {
+        memcpy(Active, Shadow, sizeof(Active));
+        VBlankReload = 0;
+        Stats.Reloads++;
+        HAL_LTDC_ReloadEventCallback(&Ltdc_Handler);
+      }
+    }
+    if((EventArmed != 0U) && (ScanLine == EventLine))
+    {
+      EventArmed = 0;
+      HAL_LTDC_LineEventCallback(&Ltdc_Handler);
+    }
+  }
+}
+
+/**
+  * @brief  推进到下一次垂直消隐开始，此时上一帧已完整输出，等待中的重载已生效
+  * @retval 无
+  */
+void LCD_Soft_VSync(void)
+{
+  do
+  {
+    LCD_Soft_Advance(1);
+  }while(ScanLine != (Ltdc_Handler.Init.AccumulatedActiveH + 1U));
+}
+
+/**
+  * @brief  获取LTDC扫描输出的画面
+  * @retval ARGB8888画面，宽高为LCD_Soft_Init的参数
+  */
+const uint32_t *LCD_Soft_GetFrame(void)
+{
+  return Frame;
+}
+
+/**
+  * @brief  设置每帧扫描完成时的回调
+  * @param  pHook: 回调，NULL取消
+  * @retval 无
+  */
+void LCD_Soft_SetFrameHook(LCD_SoftFrameHookTypeDef pHook)
+{
+  FrameHook = pHook;
+}
+
+/**
+  * @brief  获取LTDC正在扫描的层显存地址，即最近一次重载生效的地址
+  * @param  LayerIndex: 前景层(层1)或者背景层(层0)
+  * @retval 显存首地址
+  */
+uint32_t LCD_Soft_GetScanAddress(uint32_t LayerIndex)
+{
+  return Active[LayerIndex].Cfg.FBStartAdress;
+}
+
+/**
+  * @brief  把扫描输出的画面保存为PPM文件
+  * @note   画面是最近一次扫描的结果，绘图后应先调用LCD_Soft_VSync
+  * @param  pPath: 文件名
+  * @retval HAL状态
+  */
+HAL_StatusTypeDef LCD_Soft_DumpPPM(const char *pPath)
+{
+  FILE *fp;
+  uint8_t rgb[3];
+  uint32_t i;
+
+  fp = fopen(pPath, "wb");
+  if(fp == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  fprintf(fp, "P6\n%u %u\n255\n", ScreenWidth, ScreenHeight);
+  for(i = 0; i < (uint32_t)ScreenWidth * ScreenHeight; i++)
+  {
+    rgb[0] = (uint8_t)(Frame[i] >> 16);
+    rgb[1] = (uint8_t)(Frame[i] >> 8);
+    rgb[2] = (uint8_t)Frame[i];
+    fwrite(rgb, 1, 3, fp);
+  }
+  return (fclose(fp) == 0) ? HAL_OK : HAL_ERROR;
+}
+
+/**
+  * @brief  读取统计
+  * @param  pStats: 输出统计数据
+  * @retval 无
+  */
+void LCD_Soft_GetStats(LCD_SoftStatsTypeDef *pStats)
+{
+  *pStats = Stats;
+}
+
+/**
+  * @brief  清除统计
+  * @retval 无
+  */
+void LCD_Soft_ResetStats(void)
+{
+  memset(&Stats, 0, sizeof(Stats));
+}
+
+/**
+  * @brief  打印DMA2D命令和LTDC扫描的数据量与估计耗时
+  * @retval 无
+  */
+void LCD_Soft_PrintStats(void)
+{
+  static const char *const names[LCD_SOFT_MODES] = {"R2M", "M2M", "M2M_PFC", "M2M_BLEND", "CLUT"};
+  uint64_t frame_cycles = (uint64_t)LCD_SOFT_HCLK_MHZ * 1000000U / LCD_SOFT_FRAME_RATE;
+  uint64_t cycles = 0;
+  uint32_t i;
+
+  printf("%-10s %8s %12s %12s %12s %9s\n", "DMA2D", "cmds", "pixels", "bytes", "cycles", "ms");
+  for(i = 0; i < LCD_SOFT_MODES; i++)
+  {
+    printf("%-10s %8u %12llu %12llu %12llu %9.3f\n", names[i], Stats.Commands[i],
+           (unsigned long long)Stats.Pixels[i], (unsigned long long)Stats.Bytes[i],
+           (unsigned long long)Stats.Cycles[i], (double)Stats.Cycles[i] / (LCD_SOFT_HCLK_MHZ * 1000.0));
+    cycles += Stats.Cycles[i];
+  }
+  printf("%-10s %8s %12s %12s %12llu %9.3f\n", "total", "", "", "",
+         (unsigned long long)cycles, (double)cycles / (LCD_SOFT_HCLK_MHZ * 1000.0));
+
+  if(Stats.Frames != 0U)
+  {
+    printf("LTDC: %u frames, %llu bytes/frame, %.1f%% of bus time at %u Hz, %u reloads\n", Stats.Frames,
+           (unsigned long long)(Stats.LtdcBytes / Stats.Frames),
+           100.0 * (double)Stats.LtdcCycles / ((double)frame_cycles * Stats.Frames), LCD_SOFT_FRAME_RATE, Stats.Reloads);
+  }
+}
+
+/**
+  * @brief  LTDC行中断回调，没有使用扫描线调度时为空
+  * @param  hltdc: LTDC句柄
+  * @retval 无
+  */
+__weak void HAL_LTDC_LineEventCallback(LTDC_HandleTypeDef *hltdc)
+{
+  UNUSED(hltdc);
+}
+
+/**
+  * @brief  LTDC寄存器重载回调
+  * @param  hltdc: LTDC句柄
+  * @retval 无
+  */
+__weak void HAL_LTDC_ReloadEventCallback(LTDC_HandleTypeDef *hltdc)
+{
+  UNUSED(hltdc);
+}
+
+/**
+  * @brief  仿真时间，按帧率和总行数由扫描的行数换算
+  * @retval 毫秒
+  */
+uint32_t HAL_GetTick(void)
+{
+  uint64_t lines_per_second = (uint64_t)LCD_SOFT_FRAME_RATE * (Ltdc_Handler.Init.TotalHeigh + 1U);
+
+  return (lines_per_second != 0U) ? (uint32_t)(LineClock * 1000U / lines_per_second) : 0U;
+}
+
+/**
+  * @brief  dma2d.c的MX_DMA2D_Init和MSP函数引用的HAL函数，仿真中不调用
+  */
+void HAL_NVIC_SetPriority(IRQn_Type IRQn, uint32_t PreemptPriority, uint32_t SubPriority)
+{
+  UNUSED(IRQn);
+  UNUSED(PreemptPriority);
+  UNUSED(SubPriority);
+}
+
+void HAL_NVIC_EnableIRQ(IRQn_Type IRQn)
+{
+  UNUSED(IRQn);
+}
+
+void HAL_NVIC_DisableIRQ(IRQn_Type IRQn)
+{
+  UNUSED(IRQn);
+}
+
+/**
+  * @brief  HAL初始化失败
+  * @retval 无
+  */
+void Error_Handler(void)
+{
+  printf("Error_Handler\n");
+  abort();
+}
+
+/**
+  * @brief  写入层参数，与HAL_LTDC_ConfigLayer相同同时打开该层
+  * @param  pLayerCfg: 层参数
+  * @param  LayerIndex: 前景层(层1)或者背景层(层0)
+  * @param  Reload: LCD_RELOAD_NONE/LCD_RELOAD_IMMEDIATE/LCD_RELOAD_VBLANK
+  * @retval HAL状态
+  */
+static HAL_StatusTypeDef SOFT_ConfigLayer(LTDC_LayerCfgTypeDef *pLayerCfg, uint32_t LayerIndex, uint32_t Reload)
+{
+  if(LayerIndex >= MAX_LAYER_NUMBER)
+  {
+    return HAL_ERROR;
+  }
+
+  Ltdc_Handler.LayerCfg[LayerIndex] = *pLayerCfg;
+  Shadow[LayerIndex].Cfg     = *pLayerCfg;
+  Shadow[LayerIndex].Enabled = 1;
+  SOFT_Reload(Reload);
+  return HAL_OK;
+}
+
+/**
+  * @brief  打开或关闭层
+  * @param  LayerIndex: 前景层(层1)或者背景层(层0)
+  * @param  State: 禁能或者使能
+  * @param  Reload: LCD_RELOAD_NONE/LCD_RELOAD_IMMEDIATE/LCD_RELOAD_VBLANK
+  * @retval 无
+  */
+static void SOFT_EnableLayer(uint32_t LayerIndex, FunctionalState State, uint32_t Reload)
+{
+  Shadow[LayerIndex].Enabled = (State == ENABLE) ? 1U : 0U;
+  SOFT_Reload(Reload);
+}
+
+/**
+  * @brief  加载层的CLUT，CLUT直接写入，使能位立即重载
+  * @param  pCLUT: CLUT，RGB888
+  * @param  Count: 项数
+  * @param  LayerIndex: 前景层(层1)或者背景层(层0)
+  * @retval HAL状态
+  */
+static HAL_StatusTypeDef SOFT_ConfigCLUT(uint32_t *pCLUT, uint32_t Count, uint32_t LayerIndex)
+{
+  uint32_t i;
+
+  if((LayerIndex >= MAX_LAYER_NUMBER) || (Count > 256U))
+  {
+    return HAL_ERROR;
+  }
+  for(i = 0; i < Count; i++)
+  {
+    Shadow[LayerIndex].CLUT[i] = 0xFF000000U | (pCLUT[i] & 0x00FFFFFFU);
+    Active[LayerIndex].CLUT[i] = Shadow[LayerIndex].CLUT[i];
+  }
+  SOFT_Reload(LCD_RELOAD_IMMEDIATE);
+  return HAL_OK;
+}
+
+/**
+  * @brief  设置层的色键，在下一次重载时生效
+  * @param  LayerIndex: 前景层(层1)或者背景层(层0)
+  * @param  State: 禁能或者使能
+  * @param  RGBValue: RGB888色键
+  * @retval 无
+  */
+static void SOFT_ColorKey(uint32_t LayerIndex, FunctionalState State, uint32_t RGBValue)
+{
+  Shadow[LayerIndex].KeyEnable = (State == ENABLE) ? 1U : 0U;
+  Shadow[LayerIndex].Key       = RGBValue & 0x00FFFFFFU;
+}
+
+/**
+  * @brief  使写入的层参数生效
+  * @param  Reload: LCD_RELOAD_NONE/LCD_RELOAD_IMMEDIATE/LCD_RELOAD_VBLANK
+  * @retval 无
+  */
+static void SOFT_Reload(uint32_t Reload)
+{
+  if(Reload == LCD_RELOAD_IMMEDIATE)
+  {
+    memcpy(Active, Shadow, sizeof(Active));
+  }
+  else if(Reload == LCD_RELOAD_VBLANK)
+  {
+    VBlankReload = 1;
+  }
+}
+
+/**
+  * @brief  查询垂直消隐重载是否尚未生效
+  * @retval 1: 尚未生效 0: 已生效
+  */
+static uint32_t SOFT_ReloadPending(void)
+{
+  return VBlankReload;
+}
+
+/**
+  * @brief  开关显示，关闭时输出黑色
+  * @param  State: 禁能或者使能
+  * @retval 无
+  */
+static void SOFT_Display(FunctionalState State)
+{
+  DisplayOn = (State == ENABLE) ? 1U : 0U;
+}
+
+/**
+  * @brief  读取当前扫描的行
+  * @retval 行计数值
+  */
+static uint32_t SOFT_GetLine(void)
+{
+  return ScanLine;
+}
+
+/**
+  * @brief  设置一次行中断
+  * @param  Line: 行计数值
+  * @retval 无
+  */
+static void SOFT_LineEvent(uint32_t Line)
+{
+  EventLine  = Line;
+  EventArmed = 1;
+}
+
+/**
+  * @brief  忙等待：先完成正在执行的DMA2D命令，否则推进到下一次垂直消隐
+  * @retval 无
+  */
+static void SOFT_Idle(void)
+{
+  if(Dma2dBusy != 0U)
+  {
+    SOFT_Dma2dPoll();
+  }
+  else
+  {
+    LCD_Soft_VSync();
+  }
+}
+
+/**
+  * @brief  初始化DMA2D
+  * @retval 无
+  */
+static void SOFT_Dma2dInit(void)
+{
+  Dma2dBusy = 0;
+}
+
+/**
+  * @brief  执行一条DMA2D命令，完成通知推迟到等待时发出，与硬件一样异步
+  * @param  pCmd: 命令
+  * @retval HAL状态
+  */
+static HAL_StatusTypeDef SOFT_Dma2dStart(const LCD_DMA2D_CmdTypeDef *pCmd)
+{
+  uint32_t x, y, i;
+  uint32_t obits = FormatBits[pCmd->OutColorMode];
+  uint32_t fbits = (pCmd->FgColorMode < 11U) ? FormatBits[pCmd->FgColorMode] : 0U;
+  uint32_t bbits = (pCmd->BgColorMode < 11U) ? FormatBits[pCmd->BgColorMode] : 0U;
+  uint32_t dst, fg, bg;
+
+  if(pCmd->Mode == LCD_DMA2D_CLUT_LOAD)
+  {
+    for(i = 0; (i < pCmd->Width) && (i < 256U); i++)
+    {
+      if(pCmd->FgColorMode == DMA2D_CCM_ARGB8888)
+      {
+        DmaCLUT[i] = SOFT_Load(DMA2D_INPUT_ARGB8888, pCmd->FgAddress, i, NULL);
+      }
+      else
+      {
+        DmaCLUT[i] = SOFT_Load(DMA2D_INPUT_RGB888, pCmd->FgAddress, i, NULL);
+      }
+    }
+    SOFT_Account(LCD_SOFT_CLUT_LOAD, pCmd->Width, (pCmd->FgColorMode == DMA2D_CCM_ARGB8888) ? 32U : 24U);
+    Dma2dBusy = 1;
+    return HAL_OK;
+  }
+
+  if((pCmd->OutColorMode > DMA2D_OUTPUT_ARGB4444) || (fbits == 0U) || (bbits == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  for(y = 0; y < pCmd->Height; y++)
+  {
+    dst = pCmd->DstAddress + (y * (pCmd->Width + pCmd->OutOffset) * obits) / 8U;
+    fg  = y * (pCmd->Width + pCmd->FgOffset);
+    bg  = y * (pCmd->Width + pCmd->BgOffset);
+
+    switch(pCmd->Mode)
+    {
+    case DMA2D_R2M:
+      for(x = 0; x < pCmd->Width; x++)
+      {
+        SOFT_Store(pCmd->OutColorMode, dst + x * obits / 8U, pCmd->FgAddress);
+      }
+      break;
+
+    case DMA2D_M2M:
+      /* 不转换格式，按前景层的像素大小复制 */
+      memmove((void *)(uintptr_t)(pCmd->DstAddress + (y * (pCmd->Width + pCmd->OutOffset) * fbits) / 8U),
+              (const void *)(uintptr_t)(pCmd->FgAddress + (fg * fbits) / 8U), (pCmd->Width * fbits) / 8U);
+      break;
+
+    case DMA2D_M2M_PFC:
+      for(x = 0; x < pCmd->Width; x++)
+      {
+        SOFT_Store(pCmd->OutColorMode, dst + x * obits / 8U,
+                   SOFT_Input(pCmd->FgColorMode, pCmd->FgAddress, fg + x, pCmd->FgAlphaMode, pCmd->FgAlpha));
+      }
+      break;
+
+    case DMA2D_M2M_BLEND:
+      for(x = 0; x < pCmd->Width; x++)
+      {
+        SOFT_Store(pCmd->OutColorMode, dst + x * obits / 8U,
+                   SOFT_Blend(SOFT_Input(pCmd->FgColorMode, pCmd->FgAddress, fg + x, pCmd->FgAlphaMode, pCmd->FgAlpha),
+                              SOFT_Input(pCmd->BgColorMode, pCmd->BgAddress, bg + x, pCmd->BgAlphaMode, pCmd->BgAlpha)));
+      }
+      break;
+
+    default:
+      return HAL_ERROR;
+    }
+  }
+
+  switch(pCmd->Mode)
+  {
+  case DMA2D_R2M:
+    SOFT_Account(LCD_SOFT_R2M, (uint32_t)pCmd->Width * pCmd->Height, obits);
+    break;
+  case DMA2D_M2M:
+    SOFT_Account(LCD_SOFT_M2M, (uint32_t)pCmd->Width * pCmd->Height, fbits * 2U);
+    break;
+  case DMA2D_M2M_PFC:
+    SOFT_Account(LCD_SOFT_M2M_PFC, (uint32_t)pCmd->Width * pCmd->Height, fbits + obits);
+    break;
+  default:
+    SOFT_Account(LCD_SOFT_M2M_BLEND, (uint32_t)pCmd->Width * pCmd->Height, fbits + bbits + obits);
+    break;
+  }
+
+  Dma2dBusy = 1;
+  return HAL_OK;
+}
+
+/**
+  * @brief  通知命令队列当前命令已完成
+  * @retval 无
+  */
+static void SOFT_Dma2dPoll(void)
+{
+  if(Dma2dBusy != 0U)
+  {
+    Dma2dBusy = 0;
+    LCD_DMA2D_Complete(0);
+  }
+}
+
+/**
+  * @brief  把Bits位的颜色分量扩展到8位，低位用高位填充
+  * @param  Value: 颜色分量
+  * @param  Bits: 位数
+  * @retval 8位颜色分量
+  */
+static uint32_t SOFT_Expand(uint32_t Value, uint32_t Bits)
+{
+  uint32_t v = Value << (8U - Bits);
+
+  return v | (v >> Bits);
+}
+
+/**
+  * @brief  读取一个像素并转换为ARGB8888
+  * @note   4位格式中偶数像素在低4位；A8/A4只返回透明度
+  * @param  Format: LTDC像素格式或DMA2D输入格式
+  * @param  Address: 图像首地址
+  * @param  Index: 像素序号
+  * @param  pCLUT: L8/AL44/AL88/L4使用的CLUT
+  * @retval ARGB8888颜色
+  */
+static uint32_t SOFT_Load(uint32_t Format, uint32_t Address, uint32_t Index, const uint32_t *pCLUT)
+{
+  const uint8_t *p = (const uint8_t *)(uintptr_t)Address;
+  uint32_t v;
+
+  switch(Format)
+  {
+  case DMA2D_INPUT_ARGB8888:
+    p += Index * 4U;
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+  case DMA2D_INPUT_RGB888:
+    p += Index * 3U;
+    return 0xFF000000U | (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16);
+  case DMA2D_INPUT_RGB565:
+    p += Index * 2U;
+    v = (uint32_t)p[0] | ((uint32_t)p[1] << 8);
+    return 0xFF000000U | (SOFT_Expand(v >> 11, 5) << 16) | (SOFT_Expand((v >> 5) & 0x3FU, 6) << 8) | SOFT_Expand(v & 0x1FU, 5);
+  case DMA2D_INPUT_ARGB1555:
+    p += Index * 2U;
+    v = (uint32_t)p[0] | ((uint32_t)p[1] << 8);
+    return (((v & 0x8000U) != 0U) ? 0xFF000000U : 0U) | (SOFT_Expand((v >> 10) & 0x1FU, 5) << 16) |
+           (SOFT_Expand((v >> 5) & 0x1FU, 5) << 8) | SOFT_Expand(v & 0x1FU, 5);
+  case DMA2D_INPUT_ARGB4444:
+    p += Index * 2U;
+    v = (uint32_t)p[0] | ((uint32_t)p[1] << 8);
+    return (SOFT_Expand(v >> 12, 4) << 24) | (SOFT_Expand((v >> 8) & 0xFU, 4) << 16) |
+           (SOFT_Expand((v >> 4) & 0xFU, 4) << 8) | SOFT_Expand(v & 0xFU, 4);
+  case DMA2D_INPUT_L8:
+    return pCLUT[p[Index]];
+  case DMA2D_INPUT_AL44:
+    v = p[Index];
+    return (SOFT_Expand(v >> 4, 4) << 24) | (pCLUT[v & 0xFU] & 0x00FFFFFFU);
+  case DMA2D_INPUT_AL88:
+    p += Index * 2U;
+    return ((uint32_t)p[1] << 24) | (pCLUT[p[0]] & 0x00FFFFFFU);
+  case DMA2D_INPUT_L4:
+    v = (p[Index / 2U] >> ((Index & 1U) * 4U)) & 0xFU;
+    return pCLUT[v];
+  case DMA2D_INPUT_A8:
+    return (uint32_t)p[Index] << 24;
+  default:
+    v = (p[Index / 2U] >> ((Index & 1U) * 4U)) & 0xFU;
+    return SOFT_Expand(v, 4) << 24;
+  }
+}
+
+/**
+  * @brief  把ARGB8888颜色按输出格式写入一个像素，低位截断
+  * @param  Format: DMA2D输出格式
+  * @param  Address: 像素地址
+  * @param  Color: ARGB8888颜色
+  * @retval 无
+  */
+static void SOFT_Store(uint32_t Format, uint32_t Address, uint32_t Color)
+{
+  uint8_t *p = (uint8_t *)(uintptr_t)Address;
+  uint32_t a = Color >> 24, r = (Color >> 16) & 0xFFU, g = (Color >> 8) & 0xFFU, b = Color & 0xFFU;
+  uint32_t v;
+
+  switch(Format)
+  {
+  case DMA2D_OUTPUT_ARGB8888:
+    p[0] = (uint8_t)b;
+    p[1] = (uint8_t)g;
+    p[2] = (uint8_t)r;
+    p[3] = (uint8_t)a;
+    return;
+  case DMA2D_OUTPUT_RGB888:
+    p[0] = (uint8_t)b;
+    p[1] = (uint8_t)g;
+    p[2] = (uint8_t)r;
+    return;
+  case DMA2D_OUTPUT_RGB565:
+    v = ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3);
+    break;
+  case DMA2D_OUTPUT_ARGB1555:
+    v = ((a >> 7) << 15) | ((r >> 3) << 10) | ((g >> 3) << 5) | (b >> 3);
+    break;
+  default:
+    v = ((a >> 4) << 12) | ((r >> 4) << 8) | ((g >> 4) << 4) | (b >> 4);
+    break;
+  }
+  p[0] = (uint8_t)v;
+  p[1] = (uint8_t)(v >> 8);
+}
+
+/**
+  * @brief  读取DMA2D输入层的一个像素并按透明度模式处理
+  * @note   A8/A4格式的颜色取Alpha的低24位，透明度常量取高8位；其它格式取低8位
+  * @param  Format: DMA2D输入格式
+  * @param  Address: 图像首地址
+  * @param  Index: 像素序号
+  * @param  AlphaMode: DMA2D_NO_MODIF_ALPHA/DMA2D_REPLACE_ALPHA/DMA2D_COMBINE_ALPHA
+  * @param  Alpha: 透明度常量
+  * @retval ARGB8888颜色
+  */
+static uint32_t SOFT_Input(uint32_t Format, uint32_t Address, uint32_t Index, uint32_t AlphaMode, uint32_t Alpha)
+{
+  uint32_t c = SOFT_Load(Format, Address, Index, DmaCLUT);
+  uint32_t a = c >> 24;
+  uint32_t constant = Alpha & 0xFFU;
+
+  if((Format == DMA2D_INPUT_A8) || (Format == DMA2D_INPUT_A4))
+  {
+    c = Alpha & 0x00FFFFFFU;
+    constant = Alpha >> 24;
+  }
+
+  if(AlphaMode == DMA2D_REPLACE_ALPHA)
+  {
+    a = constant;
+  }
+  else if(AlphaMode == DMA2D_COMBINE_ALPHA)
+  {
+    a = a * constant / 255U;
+  }
+  return (a << 24) | (c & 0x00FFFFFFU);
+}
+
+/**
+  * @brief  DMA2D混合：前景叠加在背景上，输出透明度为两者的合成
+  * @param  Fg: 前景ARGB8888
+  * @param  Bg: 背景ARGB8888
+  * @retval ARGB8888颜色
+  */
+static uint32_t SOFT_Blend(uint32_t Fg, uint32_t Bg)
+{
+  uint32_t fa = Fg >> 24, ba = Bg >> 24;
+  uint32_t mult = fa * ba / 255U;
+  uint32_t oa = fa + ba - mult;
+  uint32_t out = oa << 24;
+  uint32_t shift, fc, bc;
+
+  if(oa == 0U)
+  {
+    return 0;
+  }
+  for(shift = 0; shift < 24U; shift += 8U)
+  {
+    fc = (Fg >> shift) & 0xFFU;
+    bc = (Bg >> shift) & 0xFFU;
+    out |= ((fc * fa + bc * ba - bc * mult) / oa) << shift;
+  }
+  return out;
+}
+
+/**
+  * @brief  累计一条DMA2D命令的数据量和估计周期
+  * @param  Mode: LCD_SOFT_xxx
+  * @param  Pixels: 像素数
+  * @param  BitsPerPixel: 每像素读写的总位数
+  * @retval 无
+  */
+static void SOFT_Account(uint32_t Mode, uint32_t Pixels, uint32_t BitsPerPixel)
+{
+  uint64_t bytes = ((uint64_t)Pixels * BitsPerPixel + 7U) / 8U;
+  uint64_t pixel_cycles = (uint64_t)Pixels * ((Mode == LCD_SOFT_M2M_BLEND) ? LCD_SOFT_BLEND_CYCLES16 : LCD_SOFT_PIXEL_CYCLES16);
+  uint64_t bus_cycles = bytes * LCD_SOFT_CYCLES_PER_BYTE16;
+
+  Stats.Commands[Mode]++;
+  Stats.Pixels[Mode] += Pixels;
+  Stats.Bytes[Mode]  += bytes;
+  Stats.Cycles[Mode] += LCD_SOFT_DMA2D_SETUP_CYCLES + (((pixel_cycles > bus_cycles) ? pixel_cycles : bus_cycles) + 15U) / 16U;
+}
+
+/**
+  * @brief  按当前生效的寄存器扫描一行：背景色上依次混合层0和层1
+  * @note   窗口外输出层的默认颜色；混合系数按PAxCA或CA计算透明度，背景取1-透明度
+  * @param  Row: 有效显示区内的行
+  * @retval 无
+  */
+static void SOFT_ScanRow(uint32_t Row)
+{
+  uint32_t *out = &Frame[Row * ScreenWidth];
+  uint32_t background = 0xFF000000U | ((uint32_t)Ltdc_Handler.Init.Backcolor.Red << 16) |
+                        ((uint32_t)Ltdc_Handler.Init.Backcolor.Green << 8) | Ltdc_Handler.Init.Backcolor.Blue;
+  const SOFT_LayerTypeDef *layer;
+  const LTDC_LayerCfgTypeDef *cfg;
+  uint32_t i, x, c, a, shift, mixed, address, bits;
+  uint32_t fetched = 0;
+
+  if(DisplayOn == 0U)
+  {
+    memset(out, 0, ScreenWidth * sizeof(uint32_t));
+    return;
+  }
+
+  for(x = 0; x < ScreenWidth; x++)
+  {
+    out[x] = background;
+  }
+
+  for(i = 0; i < MAX_LAYER_NUMBER; i++)
+  {
+    layer = &Active[i];
+    cfg   = &layer->Cfg;
+    if((layer->Enabled == 0U) || (cfg->PixelFormat > LTDC_PIXEL_FORMAT_AL88))
+    {
+      continue;
+    }
+    bits    = FormatBits[cfg->PixelFormat];
+    address = cfg->FBStartAdress + (Row - cfg->WindowY0) * cfg->ImageWidth * bits / 8U;
+
+    for(x = 0; x < ScreenWidth; x++)
+    {
+      if((x >= cfg->WindowX0) && (x < cfg->WindowX1) && (Row >= cfg->WindowY0) && (Row < cfg->WindowY1) &&
+         ((Row - cfg->WindowY0) < cfg->ImageHeight))
+      {
+        c = SOFT_Load(cfg->PixelFormat, address, x - cfg->WindowX0, layer->CLUT);
+        if((layer->KeyEnable != 0U) && ((c & 0x00FFFFFFU) == layer->Key))
+        {
+          c = 0;
+        }
+        fetched += bits;
+      }
+      else
+      {
+        c = ((uint32_t)cfg->Alpha0 << 24) | ((uint32_t)cfg->Backcolor.Red << 16) |
+            ((uint32_t)cfg->Backcolor.Green << 8) | cfg->Backcolor.Blue;
+      }
+
+      a = (cfg->BlendingFactor1 == LTDC_BLENDING_FACTOR1_PAxCA) ? ((c >> 24) * cfg->Alpha / 255U) : cfg->Alpha;
+      mixed = 0xFF000000U;
+      for(shift = 0; shift < 24U; shift += 8U)
+      {
+        mixed |= (((((c >> shift) & 0xFFU) * a) + (((out[x] >> shift) & 0xFFU) * (255U - a))) / 255U) << shift;
+      }
+      out[x] = mixed;
+    }
+  }
+
+  Stats.LtdcBytes  += fetched / 8U;
+  Stats.LtdcCycles += (fetched / 8U) * LCD_SOFT_CYCLES_PER_BYTE16 / 16U;
+}
@@ -0,0 +1,165 @@
+#include "sdram_model.h"
+
+/* 参考负载：顺序读、顺序写、DMA复制各MODEL_SEQ_LINES行，随机读MODEL_RANDOM_LINES行 */
+#define MODEL_SEQ_LINES     ((uint32_t)2048)
+#define MODEL_RANDOM_LINES  ((uint32_t)1024)
+#define MODEL_ROW_LINES     ((uint32_t)32)      /* 每行(1KB)的缓存行数，顺序访问每MODEL_ROW_LINES行换一次行 */
+
+/* 时序模型检查的参数 */
+static const uint8_t Checked[] = {SDRAM_TRAS, SDRAM_TRC, SDRAM_TWR, SDRAM_TRP, SDRAM_TRCD};
+
+static SDRAM_ModelTypeDef  Model;
+static SDRAM_ConfigTypeDef Current;
+static uint32_t            ModelSeed;
+
+static HAL_StatusTypeDef MODEL_Apply(const SDRAM_ConfigTypeDef *pConfig);
+static uint32_t MODEL_Verify(void);
+static uint32_t MODEL_Measure(void);
+static uint32_t MODEL_Max(uint32_t A, uint32_t B);
+
+/**
+  * @brief  时序模型的操作
+  */
+const SDRAM_TuneOpsTypeDef SDRAM_ModelOps =
+{
+  MODEL_Apply,
+  MODEL_Verify,
+  MODEL_Measure,
+};
+
+/**
+  * @brief  设置模型参数和当前配置
+  * @param  pModel: 模型参数
+  * @param  pConfig: 当前配置，相当于MX_FMC_Init写入的值
+  * @param  Seed: 随机出错的种子
+  * @retval 无
+  */
+void SDRAM_Model_Init(const SDRAM_ModelTypeDef *pModel, const SDRAM_ConfigTypeDef *pConfig, uint32_t Seed)
+{
+  Model = *pModel;
+  Current = *pConfig;
+  ModelSeed = Seed;
+}
+
+/**
+  * @brief  配置在模型中是否稳定(不考虑随机出错)
+  * @param  pConfig: 配置
+  * @retval 1: 稳定  0: 校验会出错
+  */
+uint32_t SDRAM_Model_IsStable(const SDRAM_ConfigTypeDef *pConfig)
+{
+  const uint8_t *t = pConfig->Timing;
+  uint32_t i;
+
+  for(i = 0; i < sizeof(Checked); i++)
+  {
+    if(t[Checked[i]] < Model.Minimum[Checked[i]])
+    {
+      return 0U;
+    }
+  }
+  if((pConfig->CASLatency < Model.MinCASLatency) ||
+     ((pConfig->CASLatency + pConfig->ReadPipeDelay) < Model.MinReadDelay) ||
+     (pConfig->BurstLength > Model.MaxBurstLength))
+  {
+    return 0U;
+  }
+  return 1U;
+}
+
+/**
+  * @brief  估算参考负载的HCLK周期数，SDCLK为HCLK/2，16位总线每个字两拍
+  * @param  pConfig: 配置
+  * @retval 周期数
+  */
+uint32_t SDRAM_Model_Cycles(const SDRAM_ConfigTypeDef *pConfig)
+{
+  const uint8_t *t = pConfig->Timing;
+  uint32_t read, write, open, random;
+
+  /* 一行8个字：突发读只等一次CAS延迟，否则每个字单独读 */
+  if(pConfig->ReadBurst != 0U)
+  {
+    read = (2U * pConfig->CASLatency) + pConfig->ReadPipeDelay + 32U;
+  }
+  else
+  {
+    read = 8U * ((2U * pConfig->CASLatency) + pConfig->ReadPipeDelay + 4U);
+  }
+  write = 32U;
+
+  /* 换行：预充电后激活新行；写之后还要等写恢复时间 */
+  open = 2U * (t[SDRAM_TRP] + t[SDRAM_TRCD]);
+  random = MODEL_Max(open + read, 2U * MODEL_Max(t[SDRAM_TRC], t[SDRAM_TRAS] + t[SDRAM_TRP]));
+
+  return (MODEL_SEQ_LINES * (read + (open / MODEL_ROW_LINES))) +
+         (MODEL_SEQ_LINES * (write + ((open + (2U * t[SDRAM_TWR])) / MODEL_ROW_LINES))) +
+         (MODEL_SEQ_LINES * (read + write + ((2U * open + (2U * t[SDRAM_TWR])) / MODEL_ROW_LINES))) +
+         (MODEL_RANDOM_LINES * random);
+}
+
+/**
+  * @brief  最后一次应用的配置
+  * @retval 配置
+  */
+const SDRAM_ConfigTypeDef *SDRAM_Model_Current(void)
+{
+  return &Current;
+}
+
+/**
+  * @brief  记录配置，不合法的配置与FMC_SDRAM_Reconfigure一样返回错误
+  * @param  pConfig: 配置
+  * @retval HAL状态
+  */
+static HAL_StatusTypeDef MODEL_Apply(const SDRAM_ConfigTypeDef *pConfig)
+{
+  if(SDRAM_Tune_IsLegal(pConfig) == 0U)
+  {
+    return HAL_ERROR;
+  }
+  Current = *pConfig;
+  return HAL_OK;
+}
+
+/**
+  * @brief  不稳定的配置总是出错；恰好等于最小时序的参数按FlakeRate随机出错
+  * @retval 出错的字数
+  */
+static uint32_t MODEL_Verify(void)
+{
+  uint32_t errors = 0;
+  uint32_t i;
+
+  if(SDRAM_Model_IsStable(&Current) == 0U)
+  {
+    return 64U;
+  }
+  for(i = 0; i < sizeof(Checked); i++)
+  {
+    if(Current.Timing[Checked[i]] == Model.Minimum[Checked[i]])
+    {
+      ModelSeed = (ModelSeed * 1664525U) + 1013904223U;
+      errors += ((ModelSeed >> 16) < Model.FlakeRate) ? 1U : 0U;
+    }
+  }
+  return errors;
+}
+
+/**
+  * @brief  当前配置的参考负载周期数
+  * @retval 周期数
+  */
+static uint32_t MODEL_Measure(void)
+{
+  return SDRAM_Model_Cycles(&Current);
+}
+
+/**
+  * @brief  两数中较大的一个
+  * @retval 较大的数
+  */
+static uint32_t MODEL_Max(uint32_t A, uint32_t B)
+{
+  return (A > B) ? A : B;
+}
@@ -0,0 +1,3766 @@
+/**
+  * @brief  主机上的绘图基准：用软件后端运行几组典型场景，输出画面和DMA2D/LTDC的估计耗时
+  * @note   用法：lcd_sim [输出目录]，每个场景保存一个PPM文件
+  */
+#include "lcd_soft.h"
+#include "lcd_display.h"
+#include "lcd_dma2d.h"
+#include "lcd_prof.h"
+#include "lcd_scan.h"
+#include "lcd_chart.h"
+#include "lcd_sprite.h"
+#include "lcd_dlist.h"
+#include "lcd_aa.h"
+#include "lcd_tile.h"
+#include "lcd_window.h"
+#include "lcd_canvas.h"
+#include "lcd_jpeg_soft.h"
+#include "lcd_font_soft.h"
+#include "memheap.h"
+#include "sdram_model.h"
+#include "dma2d.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <math.h>
+
+#define SIM_WIDTH    ((uint16_t)800)
+#define SIM_HEIGHT   ((uint16_t)480)
+#define SIM_FRAMES   ((uint32_t)60)
+#define SIM_JPEG_MAX ((uint32_t)256 * 1024)
+#define SIM_RASTER_SHAPES ((uint32_t)3000)     /* 随机直线和圆的个数，每4个中有1个圆 */
+#define SIM_RASTER_ROUNDS ((uint32_t)10)       /* 每种像素格式重复绘制的轮数 */
+#define SIM_AA_SAMPLES  ((uint32_t)16)         /* 抗锯齿参考每个像素每边的采样数 */
+#define SIM_AA_ERROR    ((uint32_t)8)          /* 直线和多边形的覆盖率与参考的最大误差(1/255)，即参考的量化误差1/32 */
+#define SIM_AA_BIAS     ((uint32_t)2)          /* 边缘像素的平均误差上限(1/255)，检查覆盖率整体偏大或偏小 */
+#define SIM_CJK_COUNT   ((uint32_t)6763)       /* 与GB2312的汉字数相同 */
+#define SIM_CJK_SIZE    ((uint32_t)24)
+#define SIM_CJK_CORPUS  ((uint32_t)200000)     /* 语料字数 */
+#define SIM_CJK_LINE    ((uint32_t)30)         /* 每行字数 */
+#define SIM_HEAP_SIZE   ((uint32_t)8 * 1024 * 1024)
+#define SIM_HEAP_LIVE   ((uint32_t)2048)       /* TLSF测试中同时存在的分配数上限 */
+#define SIM_HEAP_OPS    ((uint32_t)2000000)
+#define SIM_TUNE_RUNS   ((uint32_t)20)         /* 时序模型随机出错的种子数 */
+#define SIM_JPEG_ERROR  ((uint32_t)2)          /* 解码后允许的最大亮度误差 */
+#define SIM_SCAN_ROUNDS ((uint32_t)40)         /* 扫描线调度的提交轮数 */
+#define SIM_QUEUE_SIZE  ((uint32_t)256)        /* DMA2D队列测试的缓冲区边长 */
+#define SIM_QUEUE_CMDS  ((uint32_t)20000)      /* DMA2D队列测试的命令数 */
+#define SIM_CACHE_CMDS  ((uint32_t)100000)     /* DMA2D寄存器缓存测试的命令数 */
+#define SIM_CHART_RING  ((uint32_t)4096)       /* 曲线的环形缓冲区大小 */
+#define SIM_CHART_RATE  ((uint32_t)250)        /* 目标速率：每帧的平均采样数(60帧/s时15kHz) */
+#define SIM_CHART_SPC   ((uint32_t)3)          /* 每列抽取的采样数 */
+#define SIM_SPRITES     ((uint32_t)4)          /* 精灵场景的精灵个数 */
+#define SIM_SPRITE_SIZE ((uint32_t)96)         /* 精灵图像的最大边长 */
+#define SIM_GRID_COLS   ((uint32_t)20)         /* 网格界面的列数 */
+#define SIM_GRID_ROWS   ((uint32_t)12)         /* 网格界面的行数 */
+#define SIM_BLIT_WIDTH  ((uint32_t)61)         /* 格式转换测试图像的宽度，奇数使行尾不按字对齐 */
+#define SIM_BLIT_HEIGHT ((uint32_t)37)         /* 格式转换测试图像的高度 */
+#define SIM_BLIT_MARGIN ((int32_t)3)           /* 图像四周检查没有被改写的像素宽度 */
+#define SIM_PALETTES    ((uint32_t)8)          /* 索引格式测试的随机调色板个数 */
+#define SIM_PACKED_RECTS ((uint32_t)400)       /* 每种索引格式和行宽填充的矩形数 */
+#define SIM_PACK_COLORS ((uint32_t)4000)       /* 查找调色板的随机颜色数，取自较小的颜色集合以命中缓存 */
+#define SIM_TILE_PRIMS  ((uint32_t)700)        /* 超过LCD_TILE_MAX_PRIMS，一帧中途绘制两次 */
+#define SIM_TILE_ERROR  ((uint32_t)2)          /* 文字A8混合与DMA2D的舍入不同，每个通道允许的误差(8位) */
+#define SIM_TILE_ERROR565 ((uint32_t)3)        /* RGB565层半透明图元叠加时每个分量允许的误差(最低位) */
+#define SIM_WIN_WIDTH   ((uint16_t)1000)       /* 窗口测试的图像大小，大于屏幕 */
+#define SIM_WIN_HEIGHT  ((uint16_t)600)
+#define SIM_WIN_CASES   ((uint32_t)150)        /* 随机的窗口位置、大小和滚动组合数 */
+#define SIM_CANVAS_OPS  ((uint32_t)300)        /* 每个滚动方向的随机滚动和平移次数 */
+#define SIM_CANVAS_SEG  ((uint16_t)50)         /* 绘制回调在另一个方向上每段颜色的长度 */
+#define SIM_CANVAS_STEP ((int32_t)13)          /* 连续滚动越过缓冲区末端时的步长 */
+
+/**
+  * @brief  分块读取内存中的测试文件，每次最多Chunk字节，检验不满一块的读取
+  */
+typedef struct
+{
+  const uint8_t *pData;
+  uint32_t      Size;
+  uint32_t      Offset;
+  uint32_t      Chunk;
+}SIM_FileTypeDef;
+
+/**
+  * @brief  文字黄金图像的一行：字体、颜色、位置和对齐方式
+  */
+typedef struct
+{
+  sFONT         *pFont;
+  uint32_t      TextColor;
+  uint32_t      BackColor;
+  uint16_t      X, Y;
+  Text_AlignModeTypdef Mode;
+  const char    *pText;
+}SIM_GoldenTextTypeDef;
+
+/**
+  * @brief  精灵场景中一个精灵的图像和状态，整屏重绘的参考按这些状态独立合成
+  */
+typedef struct
+{
+  int32_t  Id;
+  uint32_t ColorMode;       /* DMA2D_INPUT_xxx */
+  uint32_t BytesPerPixel;
+  uint16_t Width, Height;
+  int16_t  X, Y;
+  uint8_t  Z, Alpha, Visible;
+  uint32_t Address;         /* 当前图像 */
+}SIM_SpriteTypeDef;
+
+/**
+  * @brief  抗锯齿检查的一个图形，参考覆盖率由超采样得到
+  */
+typedef struct
+{
+  uint32_t Type;                        /* 0直线，1实心圆，2多边形 */
+  float    P[5];                        /* 直线为x1,y1,x2,y2,线宽；圆为x,y,半径 */
+  const LCD_AA_PointTypeDef *pPoints;   /* 多边形的顶点 */
+  uint16_t Count;
+}SIM_AAShapeTypeDef;
+
+/**
+  * @brief  扫描线调度的绘制回调参数：直接写层0显存
+  */
+typedef struct
+{
+  uint32_t Address;     /* 层0显存首地址 */
+  uint16_t X, Width;    /* 填充的列范围 */
+  uint32_t Color;       /* ARGB8888颜色 */
+  uint32_t Masked;      /* 在关中断时被调用的次数 */
+}SIM_ScanFillTypeDef;
+
+/**
+  * @brief  虚拟画布场景中LTDC每输出一帧的检查状态
+  */
+typedef struct
+{
+  const uint32_t *pConfig;   /* {滚动方向, 像素格式, 另一个方向上画布的长度} */
+  int32_t  Low, High;        /* 上次确认画面以来屏幕第一行(列)可能对应的虚拟坐标 */
+  uint32_t Pan[2];           /* 平移前后的画布坐标 */
+  uint8_t  Mixed;            /* 整屏重绘，允许一帧新旧混合的画面 */
+  uint32_t Frames;           /* 检查的帧数 */
+  uint32_t Errors;
+}SIM_CanvasCheckTypeDef;
+
+extern LTDC_HandleTypeDef hltdc;
+
+static uint8_t JpegFile[SIM_JPEG_MAX];
+static uint32_t QueueImage[3][SIM_QUEUE_SIZE * SIM_QUEUE_SIZE];   /* 源图像、异步结果、同步参考 */
+static uint32_t RasterRef[SIM_WIDTH * SIM_HEIGHT];                /* 逐点绘制或整屏重绘的参考画面 */
+static uint32_t SpriteBack[SIM_WIDTH * SIM_HEIGHT];               /* 精灵的背景图像 */
+static uint32_t BlitImage[(SIM_BLIT_HEIGHT * (SIM_BLIT_WIDTH * 4U + 12U) + 4U) / 4U];   /* 各种源格式共用的随机字节 */
+static uint32_t SpriteImage[SIM_SPRITES + 1U][SIM_SPRITE_SIZE * SIM_SPRITE_SIZE];   /* 最后一个是动画的第二帧 */
+
+static const char *OutDir = ".";
+static uint32_t   Failures;                  /* 各场景检查出错的总数，不为0时返回1 */
+static SIM_CanvasCheckTypeDef CanvasCheck;
+
+static void SIM_Report(const char *pName);
+static void SIM_Primitives(void);
+static void SIM_Raster(void);
+static void SIM_Overlay(void);
+static void SIM_Jpeg(void);
+static void SIM_Text(void);
+static void SIM_TextGolden(void);
+static uint32_t SIM_Checksum(const uint8_t *pData, uint32_t Size, uint32_t Hash);
+static void SIM_SwapChain(void);
+static void SIM_Dirty(void);
+static void SIM_Scan(void);
+static void SIM_Dma2dQueue(void);
+static void SIM_Dma2dCache(void);
+static void SIM_RasterBench(void);
+static void SIM_AntiAlias(void);
+static float SIM_AACoverage(const SIM_AAShapeTypeDef *pShape, int32_t X, int32_t Y);
+static int32_t SIM_Winding(const LCD_AA_PointTypeDef *pPoints, uint32_t Count, float X, float Y);
+static void SIM_Chart(void);
+static void SIM_Sprite(void);
+static void SIM_SpriteReference(const SIM_SpriteTypeDef *pSprites);
+static void SIM_DisplayList(void);
+static uint32_t SIM_Grid(LCD_DisplayListTypeDef *pList);
+static uint32_t SIM_ChartCheck(const LCD_ChartTypeDef *pChart);
+static void SIM_Heap(void);
+static void SIM_SdramTune(void);
+static uint32_t SIM_JpegPixel(uint32_t X, uint32_t Y);
+static uint32_t SIM_JpegRead(void *pArg, uint8_t *pBuffer, uint32_t Size);
+static uint32_t SIM_JpegCheck(const LCD_JPEG_InfoTypeDef *pInfo, int32_t Xpos, int32_t Ypos);
+static void SIM_ScanFill(void *pArg, uint16_t Y0, uint16_t Y1);
+static void SIM_QueueCommand(uint32_t Seed, uint32_t *pDst, LCD_DMA2D_CmdTypeDef *pCmd);
+static void SIM_RasterShape(uint32_t Index, int32_t *pShape);
+static void SIM_RefLine(int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint32_t Color);
+static void SIM_RefCircle(int32_t Xpos, int32_t Ypos, int32_t Radius, uint32_t Color);
+static void SIM_Blit(void);
+static uint32_t SIM_BlitUnpack(uint32_t Format, const uint8_t *pPixel, const uint32_t *pCLUT);
+static uint32_t SIM_BlitCheck(uint32_t Format, uint32_t Color, uint32_t Pixel, const uint32_t *pPalette);
+static uint32_t SIM_BlitDistance(uint32_t Color1, uint32_t Color2);
+static void SIM_Palette(void);
+static void SIM_Tile(void);
+static void SIM_TilePrims(uint32_t Count, uint32_t Seed, uint32_t Mask, uint32_t Tiled);
+static uint32_t SIM_TileCompare(uint32_t Format, uint32_t Width, uint32_t Height, uint32_t Tolerance);
+static void SIM_Window(void);
+static void SIM_Canvas(void);
+static uint32_t SIM_CanvasColor(uint32_t Format, int32_t Virtual, uint32_t Cross);
+static void SIM_CanvasDraw(void *pArg, int32_t Virtual, uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height);
+static uint32_t SIM_CanvasMatch(const uint32_t *pFrame, int32_t Position, uint32_t Pan, uint32_t Lines);
+static void SIM_CanvasFrame(const uint32_t *pFrame);
+static void SIM_Prof(void);
+static uint8_t *SIM_Corpus(const sFONT *pFont, uint32_t Count, uint32_t *pSize);
+static double SIM_Seconds(void);
+
+int main(int argc, char *argv[])
+{
+  if(argc > 1)
+  {
+    OutDir = argv[1];
+  }
+
+  if(LCD_Soft_Init(SIM_WIDTH, SIM_HEIGHT) != HAL_OK)
+  {
+    printf("cannot map SDRAM at 0x%08lX\n", (unsigned long)LCD_SDRAM_START_ADDRESS);
+    return 1;
+  }
+  LCD_PROF_INIT();
+  LCD_DMA2D_Init();
+  LCD_JPEG_Init();
+
+  SIM_Primitives();
+  SIM_Raster();
+  SIM_Overlay();
+  SIM_Jpeg();
+  SIM_Text();
+  SIM_TextGolden();
+  SIM_SwapChain();
+  SIM_Dirty();
+  SIM_Scan();
+  SIM_Dma2dQueue();
+  SIM_Dma2dCache();
+  SIM_RasterBench();
+  SIM_AntiAlias();
+  SIM_Blit();
+  SIM_Palette();
+  SIM_Tile();
+  SIM_Window();
+  SIM_Canvas();
+  SIM_Prof();
+  SIM_Chart();
+  SIM_Sprite();
+  SIM_DisplayList();
+  SIM_Heap();
+  SIM_SdramTune();
+
+  printf("%lu failed checks\n", (unsigned long)Failures);
+  return (Failures != 0U) ? 1 : 0;
+}
+
+/**
+  * @brief  输出一个场景的画面和统计，然后清除统计
+  * @param  pName: 场景名称
+  * @retval 无
+  */
+static void SIM_Report(const char *pName)
+{
+  char path[256];
+
+  LCD_DMA2D_Flush();
+  LCD_Soft_VSync();
+
+  snprintf(path, sizeof(path), "%s/%s.ppm", OutDir, pName);
+  if(LCD_Soft_DumpPPM(path) != HAL_OK)
+  {
+    printf("cannot write %s\n", path);
+    Failures++;
+  }
+
+  printf("== %s\n", pName);
+  LCD_Soft_PrintStats();
+  printf("\n");
+  LCD_Soft_ResetStats();
+}
+
+/**
+  * @brief  单层ARGB8888：清屏、矩形、直线、圆和文字
+  * @retval 无
+  */
+static void SIM_Primitives(void)
+{
+  uint16_t i;
+
+  LCD_LayerInit(0, LCD_FB_START_ADDRESS, LTDC_PIXEL_FORMAT_ARGB8888);
+  LCD_DisplayOn();
+  LCD_SelectLayer(0);
+  LCD_Clear(LCD_COLOR_BLACK);
+
+  for(i = 0; i < 8; i++)
+  {
+    LCD_SetTextColor(0xFF000000U | ((uint32_t)i * 0x1F2F3FU));
+    LCD_FillRect((uint16_t)(20 + i * 95), 20, 80, 120);
+  }
+
+  LCD_SetTextColor(LCD_COLOR_WHITE);
+  for(i = 0; i < 20; i++)
+  {
+    LCD_DrawLine(20, 160, (uint16_t)(20 + i * 40), 300);
+  }
+  LCD_SetTextColor(LCD_COLOR_YELLOW);
+  LCD_FillCircle(600, 240, 60);
+  LCD_SetTextColor(LCD_COLOR_CYAN);
+  LCD_DrawCircle(600, 240, 80);
+
+  LCD_SetColors(LCD_COLOR_WHITE, LCD_COLOR_BLUE);
+  LCD_DisplayStringAt(0, 400, (const uint8_t *)"Software LTDC/DMA2D backend", CENTER_MODE);
+
+  SIM_Report("primitives");
+}
+
+/**
+  * @brief  直线和圆的分段绘制与逐点绘制比较：同一组随机的直线(包括水平线、垂直线和单点)和圆
+  *         (包括半径0)分别用LCD_DrawLine/LCD_DrawCircle和原来的逐点Bresenham/中点画圆画出，逐字节比较
+  * @note   原来的逐点绘制不裁剪，图形都在屏幕内
+  * @retval 无
+  */
+static void SIM_Raster(void)
+{
+  int32_t  shape[6];
+  uint32_t i;
+  const void *fb;
+
+  LCD_LayerInit(0, LCD_FB_START_ADDRESS, LTDC_PIXEL_FORMAT_ARGB8888);
+  LCD_SelectLayer(0);
+  LCD_Clear(LCD_COLOR_BLACK);
+  for(i = 0; i < SIM_WIDTH * SIM_HEIGHT; i++)
+  {
+    RasterRef[i] = LCD_COLOR_BLACK;
+  }
+
+  for(i = 0; i < SIM_RASTER_SHAPES; i++)
+  {
+    SIM_RasterShape(i, shape);
+    LCD_SetTextColor((uint32_t)shape[5]);
+    if(shape[0] == 0)
+    {
+      LCD_DrawLine((uint16_t)shape[1], (uint16_t)shape[2], (uint16_t)shape[3], (uint16_t)shape[4]);
+      SIM_RefLine(shape[1], shape[2], shape[3], shape[4], (uint32_t)shape[5]);
+    }
+    else
+    {
+      LCD_DrawCircle((uint16_t)shape[1], (uint16_t)shape[2], (uint16_t)shape[3]);
+      SIM_RefCircle(shape[1], shape[2], shape[3], (uint32_t)shape[5]);
+    }
+  }
+  LCD_DMA2D_Flush();
+
+  fb = (const void *)(uintptr_t)LCD_GetDrawAddress(0);
+  i = (memcmp(fb, RasterRef, sizeof(RasterRef)) != 0) ? 1U : 0U;
+  printf("raster: %lu lines and circles, span output %s the per-pixel reference\n",
+         (unsigned long)SIM_RASTER_SHAPES, (i == 0U) ? "matches" : "differs from");
+  printf("raster check: %lu errors\n", (unsigned long)i);
+  Failures += i;
+  SIM_Report("raster");
+}
+
+/**
+  * @brief  抗锯齿图形的覆盖率：直线、实心圆和多边形(包括凹多边形和部分在屏幕外的图形)画在黑色背景上，
+  *         白色的亮度就是覆盖率，与每像素SIM_AA_SAMPLES×SIM_AA_SAMPLES点超采样的参考比较；
+  *         ARGB8888由DMA2D混合，AL88由LCD_BlendSpan逐行混合
+  * @retval 无
+  */
+static void SIM_AntiAlias(void)
+{
+  static const uint32_t formats[] = {LTDC_PIXEL_FORMAT_ARGB8888, LTDC_PIXEL_FORMAT_AL88};
+  static const LCD_AA_PointTypeDef triangle[] = {{520.0f, 20.0f}, {700.0f, 60.0f}, {560.0f, 150.5f}};
+  static const LCD_AA_PointTypeDef arrow[] = {{420.2f, 300.0f}, {500.0f, 260.7f}, {480.0f, 300.0f}, {500.0f, 339.3f}};
+  static LCD_AA_PointTypeDef star[10];
+  static const SIM_AAShapeTypeDef shapes[] =
+  {
+    {0, {20.3f, 30.7f, 180.6f, 95.2f, 1.0f}, NULL, 0},
+    {0, {20.0f, 120.0f, 200.0f, 125.5f, 3.5f}, NULL, 0},
+    {0, {30.5f, 150.0f, 30.5f, 230.0f, 2.0f}, NULL, 0},
+    {0, {60.0f, 240.0f, 190.0f, 160.0f, 0.6f}, NULL, 0},
+    {0, {-20.0f, 300.0f, 150.0f, 420.0f, 6.0f}, NULL, 0},
+    {1, {300.25f, 80.5f, 40.3f}, NULL, 0},
+    {1, {400.5f, 60.0f, 3.7f}, NULL, 0},
+    {1, {450.0f, 60.3f, 0.8f}, NULL, 0},
+    {1, {300.7f, 250.2f, 70.6f}, NULL, 0},
+    {1, {790.0f, 470.0f, 30.0f}, NULL, 0},
+    {2, {0}, triangle, 3},
+    {2, {0}, arrow, 4},
+    {2, {0}, star, 10},
+  };
+  static uint8_t expect[SIM_WIDTH * SIM_HEIGHT];
+  static uint8_t limit[SIM_WIDTH * SIM_HEIGHT];
+  const uint8_t *fb;
+  const SIM_AAShapeTypeDef *s;
+  uint32_t errors = 0, edges, f, i, n, x, y, v, diff, worst;
+  uint64_t total;
+  float    c;
+
+  /* 五角星的外轮廓，内外顶点交替，是一个凹多边形 */
+  for(i = 0; i < 10U; i++)
+  {
+    c = ((i & 1U) != 0U) ? 34.4f : 90.0f;
+    star[i].X = 620.3f + c * cosf((-90.0f + 36.0f * (float)i) * 3.14159265f / 180.0f);
+    star[i].Y = 300.6f + c * sinf((-90.0f + 36.0f * (float)i) * 3.14159265f / 180.0f);
+  }
+
+  /* 图形互不重叠，参考覆盖率直接写入；圆按弦高不超过1/16像素转换为多边形，误差放宽一倍 */
+  memset(expect, 0, sizeof(expect));
+  memset(limit, SIM_AA_ERROR, sizeof(limit));
+  for(n = 0; n < sizeof(shapes) / sizeof(shapes[0]); n++)
+  {
+    for(y = 0; y < SIM_HEIGHT; y++)
+    {
+      for(x = 0; x < SIM_WIDTH; x++)
+      {
+        c = SIM_AACoverage(&shapes[n], (int32_t)x, (int32_t)y);
+        if(c > 0.0f)
+        {
+          expect[y * SIM_WIDTH + x] = (uint8_t)(c * 255.0f + 0.5f);
+          limit[y * SIM_WIDTH + x]  = (uint8_t)((shapes[n].Type == 1U) ? 2U * SIM_AA_ERROR : SIM_AA_ERROR);
+        }
+      }
+    }
+  }
+
+  for(f = 0; f < sizeof(formats) / sizeof(formats[0]); f++)
+  {
+    LCD_LayerInit(0, LCD_FB_START_ADDRESS, formats[f]);
+    LCD_SelectLayer(0);
+    LCD_Clear(LCD_COLOR_BLACK);
+    LCD_SetTextColor(LCD_COLOR_WHITE);
+    for(n = 0; n < sizeof(shapes) / sizeof(shapes[0]); n++)
+    {
+      s = &shapes[n];
+      if(s->Type == 0U)
+      {
+        LCD_DrawLineAA(s->P[0], s->P[1], s->P[2], s->P[3], s->P[4]);
+      }
+      else if(s->Type == 1U)
+      {
+        LCD_FillCircleAA(s->P[0], s->P[1], s->P[2]);
+      }
+      else
+      {
+        LCD_FillPolygonAA(s->pPoints, s->Count);
+      }
+    }
+    LCD_DMA2D_Flush();
+
+    /* ARGB8888取红色分量，AL88取低字节的亮度 */
+    fb = (const uint8_t *)(uintptr_t)LCD_GetDrawAddress(0);
+    worst = edges = 0;
+    total = 0;
+    for(i = 0; i < SIM_WIDTH * SIM_HEIGHT; i++)
+    {
+      v = (formats[f] == LTDC_PIXEL_FORMAT_AL88) ? fb[i * 2U] : fb[i * 4U + 2U];
+      diff = (v > expect[i]) ? (v - expect[i]) : (expect[i] - v);
+      worst = (diff > worst) ? diff : worst;
+      errors += (diff > limit[i]) ? 1U : 0U;
+      if(((expect[i] != 0U) && (expect[i] != 255U)) || (v != expect[i]))
+      {
+        edges++;
+        total += diff;
+      }
+    }
+    errors += (total > (uint64_t)edges * SIM_AA_BIAS) ? 1U : 0U;
+    printf("antialias %s: %lu edge pixels, max error %lu/255, mean error %.2f/255\n", (f == 0U) ? "ARGB8888" : "AL88",
+           (unsigned long)edges, (unsigned long)worst, (double)total / (double)edges);
+    SIM_Report((f == 0U) ? "antialias_argb8888" : "antialias_al88");
+  }
+
+  printf("antialias check: %lu errors\n", (unsigned long)errors);
+  Failures += errors;
+}
+
+/**
+  * @brief  超采样计算图形对一个像素的覆盖率，像素(X, Y)覆盖[X-0.5, X+0.5)×[Y-0.5, Y+0.5)
+  * @param  pShape: 图形
+  * @param  X, Y: 像素
+  * @retval 覆盖率0~1
+  */
+static float SIM_AACoverage(const SIM_AAShapeTypeDef *pShape, int32_t X, int32_t Y)
+{
+  LCD_AA_PointTypeDef quad[4];
+  const LCD_AA_PointTypeDef *points = pShape->pPoints;
+  uint32_t count = pShape->Count, inside = 0, i, j, k;
+  float    minx, miny, maxx, maxy, px, py, dx, dy, len, nx, ny;
+
+  if(pShape->Type == 0U)
+  {
+    /* 与LCD_DrawLineAA相同，两端为平头的四边形 */
+    dx  = pShape->P[2] - pShape->P[0];
+    dy  = pShape->P[3] - pShape->P[1];
+    len = sqrtf(dx * dx + dy * dy);
+    nx  = -dy / len * pShape->P[4] * 0.5f;
+    ny  =  dx / len * pShape->P[4] * 0.5f;
+    quad[0].X = pShape->P[0] + nx;  quad[0].Y = pShape->P[1] + ny;
+    quad[1].X = pShape->P[2] + nx;  quad[1].Y = pShape->P[3] + ny;
+    quad[2].X = pShape->P[2] - nx;  quad[2].Y = pShape->P[3] - ny;
+    quad[3].X = pShape->P[0] - nx;  quad[3].Y = pShape->P[1] - ny;
+    points = quad;
+    count  = 4;
+  }
+
+  /* 像素不在外接矩形内时覆盖率为0 */
+  if(pShape->Type == 1U)
+  {
+    minx = pShape->P[0] - pShape->P[2];
+    maxx = pShape->P[0] + pShape->P[2];
+    miny = pShape->P[1] - pShape->P[2];
+    maxy = pShape->P[1] + pShape->P[2];
+  }
+  else
+  {
+    minx = maxx = points[0].X;
+    miny = maxy = points[0].Y;
+    for(k = 1; k < count; k++)
+    {
+      minx = (points[k].X < minx) ? points[k].X : minx;
+      maxx = (points[k].X > maxx) ? points[k].X : maxx;
+      miny = (points[k].Y < miny) ? points[k].Y : miny;
+      maxy = (points[k].Y > maxy) ? points[k].Y : maxy;
+    }
+  }
+  if(((float)X + 0.5f <= minx) || ((float)X - 0.5f >= maxx) || ((float)Y + 0.5f <= miny) || ((float)Y - 0.5f >= maxy))
+  {
+    return 0.0f;
+  }
+
+  for(j = 0; j < SIM_AA_SAMPLES; j++)
+  {
+    py = (float)Y - 0.5f + ((float)j + 0.5f) / (float)SIM_AA_SAMPLES;
+    for(i = 0; i < SIM_AA_SAMPLES; i++)
+    {
+      px = (float)X - 0.5f + ((float)i + 0.5f) / (float)SIM_AA_SAMPLES;
+      if(pShape->Type == 1U)
+      {
+        dx = px - pShape->P[0];
+        dy = py - pShape->P[1];
+        inside += ((dx * dx + dy * dy) <= (pShape->P[2] * pShape->P[2])) ? 1U : 0U;
+      }
+      else
+      {
+        inside += (SIM_Winding(points, count, px, py) != 0) ? 1U : 0U;
+      }
+    }
+  }
+  return (float)inside / (float)(SIM_AA_SAMPLES * SIM_AA_SAMPLES);
+}
+
+/**
+  * @brief  计算闭合多边形绕一个点的环绕数
+  * @param  pPoints: 顶点数组，首尾相连
+  * @param  Count: 顶点个数
+  * @param  X, Y: 点
+  * @retval 环绕数，0表示在多边形外
+  */
+static int32_t SIM_Winding(const LCD_AA_PointTypeDef *pPoints, uint32_t Count, float X, float Y)
+{
+  const LCD_AA_PointTypeDef *a, *b;
+  int32_t  winding = 0;
+  uint32_t i;
+  float    cross;
+
+  for(i = 0; i < Count; i++)
+  {
+    a = &pPoints[i];
+    b = &pPoints[(i + 1U == Count) ? 0U : i + 1U];
+    cross = (b->X - a->X) * (Y - a->Y) - (X - a->X) * (b->Y - a->Y);
+    if(a->Y <= Y)
+    {
+      winding += ((b->Y > Y) && (cross > 0.0f)) ? 1 : 0;
+    }
+    else
+    {
+      winding -= ((b->Y <= Y) && (cross < 0.0f)) ? 1 : 0;
+    }
+  }
+  return winding;
+}
+
+/**
+  * @brief  直线和圆的绘制速度：每种像素格式分别画SIM_RASTER_ROUNDS轮SIM_Raster的随机图形，
+  *         像素数按逐点绘制的点数计算(圆的对称点重复计数)
+  * @retval 无
+  */
+static void SIM_RasterBench(void)
+{
+  static const struct
+  {
+    uint32_t    Format;
+    const char *pName;
+  }formats[] =
+  {
+    {LTDC_PIXEL_FORMAT_ARGB8888, "ARGB8888"}, {LTDC_PIXEL_FORMAT_RGB888, "RGB888"},
+    {LTDC_PIXEL_FORMAT_RGB565, "RGB565"},     {LTDC_PIXEL_FORMAT_ARGB1555, "ARGB1555"},
+    {LTDC_PIXEL_FORMAT_ARGB4444, "ARGB4444"}, {LTDC_PIXEL_FORMAT_AL88, "AL88"},
+    {LTDC_PIXEL_FORMAT_L8, "L8"},             {LTDC_PIXEL_FORMAT_AL44, "AL44"},
+  };
+  static int32_t shapes[SIM_RASTER_SHAPES][6];
+  uint64_t line_pixels = 0, circle_pixels = 0;
+  uint32_t f, i, round;
+  int32_t  x, y, d;
+  double   start, lines, circles;
+
+  for(i = 0; i < SIM_RASTER_SHAPES; i++)
+  {
+    SIM_RasterShape(i, shapes[i]);
+    if(shapes[i][0] == 0)
+    {
+      x = ABS(shapes[i][3] - shapes[i][1]);
+      y = ABS(shapes[i][4] - shapes[i][2]);
+      line_pixels += (uint64_t)((x > y) ? x : y) + 1U;
+    }
+    else
+    {
+      /* 与SIM_RefCircle相同的迭代次数，每次8个点 */
+      d = 3 - (shapes[i][3] << 1);
+      for(x = 0, y = shapes[i][3]; x <= y; x++)
+      {
+        circle_pixels += 8U;
+        if(d < 0)
+        {
+          d += (x << 2) + 6;
+        }
+        else
+        {
+          d += ((x - y) << 2) + 10;
+          y--;
+        }
+      }
+    }
+  }
+
+  for(f = 0; f < sizeof(formats) / sizeof(formats[0]); f++)
+  {
+    LCD_LayerInit(0, LCD_FB_START_ADDRESS, formats[f].Format);
+    LCD_SelectLayer(0);
+    LCD_Clear(LCD_COLOR_BLACK);
+    LCD_DMA2D_Flush();
+
+    start = SIM_Seconds();
+    for(round = 0; round < SIM_RASTER_ROUNDS; round++)
+    {
+      for(i = 0; i < SIM_RASTER_SHAPES; i++)
+      {
+        if(shapes[i][0] == 0)
+        {
+          LCD_SetTextColor((uint32_t)shapes[i][5]);
+          LCD_DrawLine((uint16_t)shapes[i][1], (uint16_t)shapes[i][2], (uint16_t)shapes[i][3], (uint16_t)shapes[i][4]);
+        }
+      }
+    }
+    LCD_DMA2D_Flush();
+    lines = SIM_Seconds() - start;
+
+    start = SIM_Seconds();
+    for(round = 0; round < SIM_RASTER_ROUNDS; round++)
+    {
+      for(i = 0; i < SIM_RASTER_SHAPES; i++)
+      {
+        if(shapes[i][0] != 0)
+        {
+          LCD_SetTextColor((uint32_t)shapes[i][5]);
+          LCD_DrawCircle((uint16_t)shapes[i][1], (uint16_t)shapes[i][2], (uint16_t)shapes[i][3]);
+        }
+      }
+    }
+    LCD_DMA2D_Flush();
+    circles = SIM_Seconds() - start;
+
+    printf("raster bench %-8s: lines %.1f Mpixels/s, circles %.1f Mpixels/s\n", formats[f].pName,
+           (double)(line_pixels * SIM_RASTER_ROUNDS) / lines / 1e6,
+           (double)(circle_pixels * SIM_RASTER_ROUNDS) / circles / 1e6);
+  }
+  LCD_Soft_ResetStats();
+}
+
+/**
+  * @brief  生成第Index个随机图形，与绘制的格式无关，各场景得到相同的图形
+  * @param  Index: 序号
+  * @param  pShape: 输出{0, x1, y1, x2, y2, 颜色}表示直线，{1, x, y, 半径, 0, 颜色}表示圆
+  * @retval 无
+  */
+static void SIM_RasterShape(uint32_t Index, int32_t *pShape)
+{
+  uint32_t seed = Index * 2654435761U + 1U;
+  uint32_t r[5], i;
+
+  for(i = 0; i < 5U; i++)
+  {
+    seed = seed * 1103515245U + 12345U;
+    r[i] = seed >> 8;
+  }
+  pShape[5] = (int32_t)(0xFF000000U | r[4]);
+
+  if((Index % 4U) == 3U)
+  {
+    pShape[0] = 1;
+    pShape[3] = (int32_t)(r[2] % 120U);
+    pShape[1] = pShape[3] + (int32_t)(r[0] % (SIM_WIDTH - 2U * (uint32_t)pShape[3]));
+    pShape[2] = pShape[3] + (int32_t)(r[1] % (SIM_HEIGHT - 2U * (uint32_t)pShape[3]));
+    pShape[4] = 0;
+    return;
+  }
+
+  pShape[0] = 0;
+  pShape[1] = (int32_t)(r[0] % SIM_WIDTH);
+  pShape[2] = (int32_t)(r[1] % SIM_HEIGHT);
+  pShape[3] = (int32_t)(r[2] % SIM_WIDTH);
+  pShape[4] = (int32_t)(r[3] % SIM_HEIGHT);
+  switch((Index / 4U) % 8U)
+  {
+  case 0:
+    pShape[4] = pShape[2];        /* 水平线 */
+    break;
+  case 1:
+    pShape[3] = pShape[1];        /* 垂直线 */
+    break;
+  case 2:
+    /* 短线，可能只有一个点 */
+    pShape[3] = pShape[1] + (int32_t)(r[2] % 8U) - 4;
+    pShape[3] = (pShape[3] < 0) ? 0 : ((pShape[3] >= SIM_WIDTH) ? (SIM_WIDTH - 1) : pShape[3]);
+    pShape[4] = pShape[2] + (int32_t)(r[3] % 8U) - 4;
+    pShape[4] = (pShape[4] < 0) ? 0 : ((pShape[4] >= SIM_HEIGHT) ? (SIM_HEIGHT - 1) : pShape[4]);
+    break;
+  default:
+    break;
+  }
+}
+
+/**
+  * @brief  原来的逐点Bresenham画线，写入参考画面
+  * @param  x1, y1, x2, y2: 两个端点
+  * @param  Color: ARGB8888颜色
+  * @retval 无
+  */
+static void SIM_RefLine(int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint32_t Color)
+{
+  int32_t deltax = ABS(x2 - x1), deltay = ABS(y2 - y1);
+  int32_t x = x1, y = y1;
+  int32_t xinc1 = (x2 >= x1) ? 1 : -1, xinc2 = xinc1;
+  int32_t yinc1 = (y2 >= y1) ? 1 : -1, yinc2 = yinc1;
+  int32_t den, num, num_add, num_pixels, curpixel;
+
+  if(deltax >= deltay)
+  {
+    xinc1 = 0;
+    yinc2 = 0;
+    den = deltax;
+    num = deltax / 2;
+    num_add = deltay;
+    num_pixels = deltax;
+  }
+  else
+  {
+    xinc2 = 0;
+    yinc1 = 0;
+    den = deltay;
+    num = deltay / 2;
+    num_add = deltax;
+    num_pixels = deltay;
+  }
+
+  for(curpixel = 0; curpixel <= num_pixels; curpixel++)
+  {
+    RasterRef[y * SIM_WIDTH + x] = Color;
+    num += num_add;
+    if(num >= den)
+    {
+      num -= den;
+      x += xinc1;
+      y += yinc1;
+    }
+    x += xinc2;
+    y += yinc2;
+  }
+}
+
+/**
+  * @brief  原来的逐点中点画圆，写入参考画面
+  * @param  Xpos, Ypos: 圆心
+  * @param  Radius: 半径
+  * @param  Color: ARGB8888颜色
+  * @retval 无
+  */
+static void SIM_RefCircle(int32_t Xpos, int32_t Ypos, int32_t Radius, uint32_t Color)
+{
+  int32_t decision = 3 - (Radius << 1);
+  int32_t current_x = 0, current_y = Radius;
+
+  while(current_x <= current_y)
+  {
+    RasterRef[(Ypos - current_y) * SIM_WIDTH + Xpos + current_x] = Color;
+    RasterRef[(Ypos - current_y) * SIM_WIDTH + Xpos - current_x] = Color;
+    RasterRef[(Ypos - current_x) * SIM_WIDTH + Xpos + current_y] = Color;
+    RasterRef[(Ypos - current_x) * SIM_WIDTH + Xpos - current_y] = Color;
+    RasterRef[(Ypos + current_y) * SIM_WIDTH + Xpos + current_x] = Color;
+    RasterRef[(Ypos + current_y) * SIM_WIDTH + Xpos - current_x] = Color;
+    RasterRef[(Ypos + current_x) * SIM_WIDTH + Xpos + current_y] = Color;
+    RasterRef[(Ypos + current_x) * SIM_WIDTH + Xpos - current_y] = Color;
+    if(decision < 0)
+    {
+      decision += (current_x << 2) + 6;
+    }
+    else
+    {
+      decision += ((current_x - current_y) << 2) + 10;
+      current_y--;
+    }
+    current_x++;
+  }
+}
+
+/**
+  * @brief  图像复制和格式转换：每种源格式复制到每种层格式，位置部分超出屏幕的左上、右下和完全在屏幕外，
+  *         源地址和行跨度有对齐和不对齐两种；层中像素与逐点转换的参考相同，图像以外的像素没有被改写，
+  *         DMA2D命令数与选择的路径(M2M_PFC、M2M或CPU)相符
+  * @retval 无
+  */
+static void SIM_Blit(void)
+{
+  static const struct
+  {
+    uint32_t    Format;
+    const char *pName;
+  }formats[] =
+  {
+    {LTDC_PIXEL_FORMAT_ARGB8888, "ARGB8888"}, {LTDC_PIXEL_FORMAT_RGB888, "RGB888"},
+    {LTDC_PIXEL_FORMAT_RGB565, "RGB565"},     {LTDC_PIXEL_FORMAT_ARGB1555, "ARGB1555"},
+    {LTDC_PIXEL_FORMAT_ARGB4444, "ARGB4444"}, {LTDC_PIXEL_FORMAT_AL88, "AL88"},
+    {LTDC_PIXEL_FORMAT_L8, "L8"},             {LTDC_PIXEL_FORMAT_AL44, "AL44"},
+  };
+  static const uint8_t bpp[] = {4, 3, 2, 2, 2, 1, 1, 2};     /* 按LTDC格式值索引 */
+  static const uint32_t layouts[][2] = {{0, 0}, {1, 1}, {0, 4}, {1, 12}};   /* 源地址偏移和行尾填充的字节数 */
+  static const int32_t positions[][2] =
+  {
+    {-17, -9}, {SIM_WIDTH - 23, SIM_HEIGHT - 11}, {300, 200}, {-(int32_t)SIM_BLIT_WIDTH - 3, 100},
+  };
+  static uint32_t blit_clut[256], layer_clut[256];
+  const uint8_t *src, *p;
+  LCD_SoftStatsTypeDef before, after;
+  uint32_t errors = 0, seed = 4242, cpu = 0, pfc = 0, m2m = 0, blits = 0;
+  uint32_t l, f, k, n, i, layer, format, stride, pixel, expect_pfc, expect_m2m, drawn, inside, layer_bpp;
+  int32_t  x, y, x0, y0, x1, y1;
+  uint8_t *row;
+
+  for(i = 0; i < sizeof(BlitImage) / sizeof(BlitImage[0]); i++)
+  {
+    seed = seed * 1103515245U + 12345U;
+    BlitImage[i] = seed ^ (seed >> 13);
+  }
+  for(i = 0; i < 256U; i++)
+  {
+    seed = seed * 1103515245U + 12345U;
+    blit_clut[i]  = seed ^ (seed >> 11);
+    seed = seed * 1103515245U + 12345U;
+    layer_clut[i] = (seed ^ (seed >> 9)) & 0x00FFFFFF;
+  }
+  LCD_SetBlitPalette(blit_clut, 256);
+
+  for(l = 0; l < sizeof(formats) / sizeof(formats[0]); l++)
+  {
+    layer = formats[l].Format;
+    layer_bpp = bpp[layer];
+    LCD_LayerInit(0, LCD_FB_START_ADDRESS, layer);
+    LCD_SelectLayer(0);
+    if((layer == LTDC_PIXEL_FORMAT_L8) || (layer == LTDC_PIXEL_FORMAT_AL44))
+    {
+      LCD_SetPalette(0, layer_clut, (layer == LTDC_PIXEL_FORMAT_L8) ? 256U : 16U);
+    }
+
+    for(f = 0; f < sizeof(formats) / sizeof(formats[0]); f++)
+    {
+      format = formats[f].Format;
+      for(k = 0; k < sizeof(layouts) / sizeof(layouts[0]); k++)
+      {
+        src    = (const uint8_t *)BlitImage + layouts[k][0];
+        stride = SIM_BLIT_WIDTH * bpp[format] + layouts[k][1];
+        expect_pfc = ((layer <= LTDC_PIXEL_FORMAT_ARGB4444) && (format != LTDC_PIXEL_FORMAT_AL88) &&
+                      ((stride % bpp[format]) == 0U) &&
+                      ((bpp[format] == 3U) || ((LCD_DMA2D_Address(src) % bpp[format]) == 0U))) ? 1U : 0U;
+        expect_m2m = ((expect_pfc == 0U) && (format == layer) && ((stride % bpp[format]) == 0U) &&
+                      ((LCD_DMA2D_Address(src) % bpp[format]) == 0U)) ? 1U : 0U;
+
+        for(n = 0; n < sizeof(positions) / sizeof(positions[0]); n++)
+        {
+          /* 图像和四周的边框先填成标记值 */
+          x0 = positions[n][0] - SIM_BLIT_MARGIN;
+          y0 = positions[n][1] - SIM_BLIT_MARGIN;
+          x1 = positions[n][0] + (int32_t)SIM_BLIT_WIDTH + SIM_BLIT_MARGIN;
+          y1 = positions[n][1] + (int32_t)SIM_BLIT_HEIGHT + SIM_BLIT_MARGIN;
+          x0 = (x0 < 0) ? 0 : x0;
+          y0 = (y0 < 0) ? 0 : y0;
+          x1 = (x1 > (int32_t)SIM_WIDTH) ? (int32_t)SIM_WIDTH : x1;
+          y1 = (y1 > (int32_t)SIM_HEIGHT) ? (int32_t)SIM_HEIGHT : y1;
+          LCD_DMA2D_Flush();
+          for(y = y0; y < y1; y++)
+          {
+            memset((void *)(uintptr_t)LCD_GetPixelAddress(0, (uint16_t)x0, (uint16_t)y), 0xA5, (uint32_t)(x1 - x0) * layer_bpp);
+          }
+
+          LCD_Soft_GetStats(&before);
+          LCD_DMA2D_Wait(LCD_BlitImage(src, format, stride, (int16_t)positions[n][0], (int16_t)positions[n][1],
+                                       (uint16_t)SIM_BLIT_WIDTH, (uint16_t)SIM_BLIT_HEIGHT));
+          LCD_Soft_GetStats(&after);
+
+          for(drawn = 0, y = y0; y < y1; y++)
+          {
+            row = (uint8_t *)(uintptr_t)LCD_GetPixelAddress(0, 0, (uint16_t)y);
+            for(x = x0; x < x1; x++)
+            {
+              pixel = 0;
+              memcpy(&pixel, row + (uint32_t)x * layer_bpp, layer_bpp);
+              inside = ((x >= positions[n][0]) && (x < positions[n][0] + (int32_t)SIM_BLIT_WIDTH) &&
+                        (y >= positions[n][1]) && (y < positions[n][1] + (int32_t)SIM_BLIT_HEIGHT)) ? 1U : 0U;
+              if(inside == 0U)
+              {
+                errors += (memcmp(row + (uint32_t)x * layer_bpp, "\xA5\xA5\xA5\xA5", layer_bpp) != 0) ? 1U : 0U;
+                continue;
+              }
+              drawn++;
+              p = src + (uint32_t)(y - positions[n][1]) * stride + (uint32_t)(x - positions[n][0]) * bpp[format];
+              if(format == layer)
+              {
+                /* 同格式原样复制，索引格式也不经过调色板 */
+                errors += (memcmp(row + (uint32_t)x * layer_bpp, p, layer_bpp) != 0) ? 1U : 0U;
+              }
+              else
+              {
+                errors += SIM_BlitCheck(layer, SIM_BlitUnpack(format, p, blit_clut), pixel, layer_clut);
+              }
+            }
+          }
+
+          /* 没有画出像素时不能提交命令 */
+          errors += ((after.Commands[LCD_SOFT_M2M_PFC] - before.Commands[LCD_SOFT_M2M_PFC]) != ((drawn != 0U) ? expect_pfc : 0U)) ? 1U : 0U;
+          errors += ((after.Commands[LCD_SOFT_M2M] - before.Commands[LCD_SOFT_M2M]) != ((drawn != 0U) ? expect_m2m : 0U)) ? 1U : 0U;
+          if(drawn != 0U)
+          {
+            blits++;
+            pfc += expect_pfc;
+            m2m += expect_m2m;
+            cpu += ((expect_pfc | expect_m2m) == 0U) ? 1U : 0U;
+          }
+        }
+      }
+    }
+  }
+
+  printf("blit: %lu clipped copies, %lu DMA2D M2M_PFC, %lu M2M, %lu CPU\n",
+         (unsigned long)blits, (unsigned long)pfc, (unsigned long)m2m, (unsigned long)cpu);
+  printf("blit check: %lu errors\n", (unsigned long)errors);
+  Failures += errors;
+  SIM_Report("blit");
+}
+
+/**
+  * @brief  读取一个源像素并转换为ARGB8888，与硬件DMA2D的输入转换相同
+  * @note   低位用高位填充；AL88的低8位为亮度；L8/AL44的颜色取复制调色板，L8的透明度也取调色板
+  * @param  Format: LTDC像素格式
+  * @param  pPixel: 像素地址
+  * @param  pCLUT: 复制调色板
+  * @retval ARGB8888颜色
+  */
+static uint32_t SIM_BlitUnpack(uint32_t Format, const uint8_t *pPixel, const uint32_t *pCLUT)
+{
+  uint32_t v = (uint32_t)pPixel[0] | ((uint32_t)pPixel[1] << 8);
+  uint32_t r, g, b;
+
+  switch(Format)
+  {
+  case LTDC_PIXEL_FORMAT_ARGB8888:
+    return v | ((uint32_t)pPixel[2] << 16) | ((uint32_t)pPixel[3] << 24);
+  case LTDC_PIXEL_FORMAT_RGB888:
+    return 0xFF000000U | v | ((uint32_t)pPixel[2] << 16);
+  case LTDC_PIXEL_FORMAT_RGB565:
+    r = v >> 11;
+    g = (v >> 5) & 0x3FU;
+    b = v & 0x1FU;
+    return 0xFF000000U | (((r << 3) | (r >> 2)) << 16) | (((g << 2) | (g >> 4)) << 8) | ((b << 3) | (b >> 2));
+  case LTDC_PIXEL_FORMAT_ARGB1555:
+    r = (v >> 10) & 0x1FU;
+    g = (v >> 5) & 0x1FU;
+    b = v & 0x1FU;
+    return (((v & 0x8000U) != 0U) ? 0xFF000000U : 0U) |
+           (((r << 3) | (r >> 2)) << 16) | (((g << 3) | (g >> 2)) << 8) | ((b << 3) | (b >> 2));
+  case LTDC_PIXEL_FORMAT_ARGB4444:
+    return ((v >> 12) * 0x11000000U) | (((v >> 8) & 0xFU) * 0x110000U) | (((v >> 4) & 0xFU) * 0x1100U) | ((v & 0xFU) * 0x11U);
+  case LTDC_PIXEL_FORMAT_L8:
+    return pCLUT[pPixel[0]];
+  case LTDC_PIXEL_FORMAT_AL44:
+    return ((uint32_t)(pPixel[0] >> 4) * 0x11000000U) | (pCLUT[pPixel[0] & 0xFU] & 0x00FFFFFFU);
+  default:
+    return ((uint32_t)pPixel[1] << 24) | ((uint32_t)pPixel[0] * 0x010101U);
+  }
+}
+
+/**
+  * @brief  检查层中的一个像素是否是颜色按层格式截断的结果
+  * @note   L8/AL44允许距离相同的任意调色板项
+  * @param  Format: 层的LTDC像素格式
+  * @param  Color: ARGB8888颜色
+  * @param  Pixel: 层中的像素值
+  * @param  pPalette: 层的调色板，L8为256项，AL44为16项
+  * @retval 0相同，1不同
+  */
+static uint32_t SIM_BlitCheck(uint32_t Format, uint32_t Color, uint32_t Pixel, const uint32_t *pPalette)
+{
+  uint32_t a = Color >> 24, r = (Color >> 16) & 0xFFU, g = (Color >> 8) & 0xFFU, b = Color & 0xFFU;
+  uint32_t count = (Format == LTDC_PIXEL_FORMAT_L8) ? 256U : 16U;
+  uint32_t expect, best = 0xFFFFFFFFU, dist, i;
+
+  switch(Format)
+  {
+  case LTDC_PIXEL_FORMAT_ARGB8888:
+    expect = Color;
+    break;
+  case LTDC_PIXEL_FORMAT_RGB888:
+    expect = Color & 0x00FFFFFFU;
+    break;
+  case LTDC_PIXEL_FORMAT_RGB565:
+    expect = ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3);
+    break;
+  case LTDC_PIXEL_FORMAT_ARGB1555:
+    expect = ((a >> 7) << 15) | ((r >> 3) << 10) | ((g >> 3) << 5) | (b >> 3);
+    break;
+  case LTDC_PIXEL_FORMAT_ARGB4444:
+    expect = ((a >> 4) << 12) | ((r >> 4) << 8) | ((g >> 4) << 4) | (b >> 4);
+    break;
+  case LTDC_PIXEL_FORMAT_AL88:
+    expect = (a << 8) | ((77U * r + 150U * g + 29U * b) >> 8);
+    break;
+  default:
+    /* 索引格式：选中的项必须是最近的之一 */
+    if((Format == LTDC_PIXEL_FORMAT_AL44) && ((Pixel >> 4) != (a >> 4)))
+    {
+      return 1;
+    }
+    for(i = 0; i < count; i++)
+    {
+      dist = SIM_BlitDistance(pPalette[i], Color);
+      best = (dist < best) ? dist : best;
+    }
+    return (SIM_BlitDistance(pPalette[Pixel & (count - 1U)], Color) != best) ? 1U : 0U;
+  }
+  return (Pixel != expect) ? 1U : 0U;
+}
+
+/**
+  * @brief  两个颜色的加权距离，绿色权重最大，与按调色板查找颜色时相同
+  * @param  Color1, Color2: 颜色，透明度不参与比较
+  * @retval 距离
+  */
+static uint32_t SIM_BlitDistance(uint32_t Color1, uint32_t Color2)
+{
+  int32_t dr = (int32_t)((Color1 >> 16) & 0xFFU) - (int32_t)((Color2 >> 16) & 0xFFU);
+  int32_t dg = (int32_t)((Color1 >> 8) & 0xFFU) - (int32_t)((Color2 >> 8) & 0xFFU);
+  int32_t db = (int32_t)(Color1 & 0xFFU) - (int32_t)(Color2 & 0xFFU);
+
+  return (uint32_t)(3 * dr * dr + 4 * dg * dg + 2 * db * db);
+}
+
+/**
+  * @brief  DMA2D不能输出的L8/AL44/AL88格式：按字打包填充的行首、行尾和矩形以外的像素，
+  *         查找调色板的缓存在换调色板后失效，复制调色板的加载命令与使用它的复制命令按提交顺序执行
+  * @note   行宽不是4字节的倍数时整行由CPU写入；层后面的字节用来检查清屏没有越界
+  * @retval 无
+  */
+static void SIM_Palette(void)
+{
+  static const uint32_t formats[] = {LTDC_PIXEL_FORMAT_L8, LTDC_PIXEL_FORMAT_AL44, LTDC_PIXEL_FORMAT_AL88};
+  static const uint32_t widths[] = {SIM_WIDTH, SIM_WIDTH - 3U};
+  static uint32_t palettes[SIM_PALETTES][256], colors[64];
+  LCD_SoftStatsTypeDef before, after;
+  uint32_t errors = 0, seed = 8086, fills = 0, cpu_rows = 0;
+  uint32_t f, k, i, n, r, format, width, bpp, size, count, color, pixel, first;
+  int32_t  x, y, w, h, x0, y0, x1, y1;
+  uint8_t *fb = (uint8_t *)(uintptr_t)LCD_FB_START_ADDRESS;
+
+  for(i = 0; i < SIM_PALETTES * 256U; i++)
+  {
+    seed = seed * 1103515245U + 12345U;
+    palettes[i / 256U][i % 256U] = seed ^ (seed >> 11);
+  }
+  for(i = 0; i < 64U; i++)
+  {
+    seed = seed * 1103515245U + 12345U;
+    colors[i] = seed ^ (seed >> 7);
+  }
+
+  /* 清屏和填充矩形，矩形四周和层后面的字节预先填成标记值 */
+  for(f = 0; f < sizeof(formats) / sizeof(formats[0]); f++)
+  {
+    format = formats[f];
+    bpp    = (format == LTDC_PIXEL_FORMAT_AL88) ? 2U : 1U;
+    count  = (format == LTDC_PIXEL_FORMAT_L8) ? 256U : 16U;
+    for(k = 0; k < sizeof(widths) / sizeof(widths[0]); k++)
+    {
+      width = widths[k];
+      size  = width * SIM_HEIGHT * bpp;
+      LCD_DMA2D_Flush();
+      LCD_LayerInitSize(0, LCD_FB_START_ADDRESS, format, (uint16_t)width, SIM_HEIGHT);
+      LCD_SelectLayer(0);
+      if(format != LTDC_PIXEL_FORMAT_AL88)
+      {
+        LCD_SetPalette(0, palettes[0], count);
+      }
+      memset(fb, 0xA5, size + 64U);
+
+      LCD_Clear(colors[0]);
+      LCD_DMA2D_Flush();
+      first = LCD_ReadPixel(0, 0);
+      errors += SIM_BlitCheck(format, colors[0], first, palettes[0]);
+      for(i = 0; i < size; i += bpp)
+      {
+        errors += (memcmp(fb + i, &first, bpp) != 0) ? 1U : 0U;
+      }
+      for(i = size; i < size + 64U; i++)
+      {
+        errors += (fb[i] != 0xA5U) ? 1U : 0U;
+      }
+
+      for(n = 0; n < SIM_PACKED_RECTS; n++)
+      {
+        seed = seed * 1103515245U + 12345U;
+        x = (int32_t)((seed >> 8) % width);
+        y = (int32_t)((seed >> 20) % (SIM_HEIGHT - 24U));
+        seed = seed * 1103515245U + 12345U;
+        /* 一半是不足几个字的窄矩形，只有行首行尾 */
+        w = (int32_t)(((n & 1U) != 0U) ? ((seed >> 8) % 9U) : ((seed >> 8) % 300U)) + 1;
+        w = (w > (int32_t)width - x) ? ((int32_t)width - x) : w;
+        h = (int32_t)((seed >> 20) % 20U) + 1;
+        color = colors[(seed >> 4) % 64U];
+
+        x0 = (x < SIM_BLIT_MARGIN) ? 0 : (x - SIM_BLIT_MARGIN);
+        y0 = (y == 0) ? 0 : (y - 1);
+        x1 = (x + w + SIM_BLIT_MARGIN > (int32_t)width) ? (int32_t)width : (x + w + SIM_BLIT_MARGIN);
+        y1 = y + h + 1;
+        LCD_DMA2D_Flush();
+        for(i = (uint32_t)y0; i < (uint32_t)y1; i++)
+        {
+          memset(fb + (i * width + (uint32_t)x0) * bpp, 0xA5, (uint32_t)(x1 - x0) * bpp);
+        }
+
+        LCD_SetTextColor(color);
+        LCD_FillRect((uint16_t)x, (uint16_t)y, (uint16_t)w, (uint16_t)h);
+        first = LCD_ReadPixel((uint16_t)x, (uint16_t)y);
+        errors += SIM_BlitCheck(format, color, first, palettes[0]);
+        for(i = (uint32_t)y0; i < (uint32_t)y1; i++)
+        {
+          for(r = (uint32_t)x0; r < (uint32_t)x1; r++)
+          {
+            pixel = 0xA5A5U;
+            if(((int32_t)r >= x) && ((int32_t)r < x + w) && ((int32_t)i >= y) && ((int32_t)i < y + h))
+            {
+              pixel = first;
+            }
+            errors += (memcmp(fb + (i * width + r) * bpp, &pixel, bpp) != 0) ? 1U : 0U;
+          }
+        }
+        fills++;
+        cpu_rows += (((width * bpp) & 3U) != 0U) ? (uint32_t)h : 0U;
+      }
+    }
+  }
+
+  /* 同一组颜色在两个调色板下查找，换调色板后缓存中的旧结果不能再用 */
+  LCD_LayerInit(0, LCD_FB_START_ADDRESS, LTDC_PIXEL_FORMAT_L8);
+  LCD_SelectLayer(0);
+  for(r = 0; r < 2U; r++)
+  {
+    LCD_SetPalette(0, palettes[r + 1U], 256);
+    for(n = 0; n < SIM_PACK_COLORS; n++)
+    {
+      seed = seed * 1103515245U + 12345U;
+      color = (((n & 3U) != 0U) ? colors[(seed >> 8) % 64U] : (seed ^ (seed >> 9))) & 0x00FFFFFFU;
+      LCD_DrawPixel((uint16_t)(n % SIM_WIDTH), (uint16_t)(n / SIM_WIDTH), color);
+      errors += SIM_BlitCheck(LTDC_PIXEL_FORMAT_L8, color, LCD_ReadPixel((uint16_t)(n % SIM_WIDTH), (uint16_t)(n / SIM_WIDTH)), palettes[r + 1U]);
+    }
+  }
+
+  /* 每个调色板复制一块L8和AL44图像，都不等待，最后每块必须按提交时的调色板转换 */
+  for(f = 0; f < 2U; f++)
+  {
+    format = (f == 0U) ? LTDC_PIXEL_FORMAT_ARGB8888 : LTDC_PIXEL_FORMAT_AL88;
+    LCD_LayerInit(0, LCD_FB_START_ADDRESS, format);
+    LCD_SelectLayer(0);
+    LCD_Clear(LCD_COLOR_BLACK);
+    LCD_Soft_GetStats(&before);
+    for(r = 0; r < SIM_PALETTES; r++)
+    {
+      LCD_SetBlitPalette(palettes[r], 256);
+      LCD_BlitImage(BlitImage, LTDC_PIXEL_FORMAT_L8, SIM_BLIT_WIDTH, (int16_t)(r * 90U), 20, SIM_BLIT_WIDTH, SIM_BLIT_HEIGHT);
+      LCD_BlitImage(BlitImage, LTDC_PIXEL_FORMAT_AL44, SIM_BLIT_WIDTH, (int16_t)(r * 90U), 120, SIM_BLIT_WIDTH, SIM_BLIT_HEIGHT);
+    }
+    LCD_DMA2D_Flush();
+    LCD_Soft_GetStats(&after);
+    errors += ((after.Commands[LCD_SOFT_CLUT_LOAD] - before.Commands[LCD_SOFT_CLUT_LOAD]) != SIM_PALETTES) ? 1U : 0U;
+
+    for(r = 0; r < SIM_PALETTES; r++)
+    {
+      for(i = 0; i < SIM_BLIT_WIDTH * SIM_BLIT_HEIGHT; i++)
+      {
+        x = (int32_t)(r * 90U + i % SIM_BLIT_WIDTH);
+        y = (int32_t)(i / SIM_BLIT_WIDTH);
+        for(k = 0; k < 2U; k++)
+        {
+          color = SIM_BlitUnpack((k == 0U) ? LTDC_PIXEL_FORMAT_L8 : LTDC_PIXEL_FORMAT_AL44, (const uint8_t *)BlitImage + i, palettes[r]);
+          pixel = LCD_ReadPixel((uint16_t)x, (uint16_t)(y + 20 + (int32_t)k * 100));
+          errors += SIM_BlitCheck(format, color, pixel, NULL);
+        }
+      }
+    }
+  }
+
+  printf("palette: %lu packed fills (%lu rows by CPU), %lu colors looked up in 2 palettes, %lu CLUT loads queued\n",
+         (unsigned long)fills, (unsigned long)cpu_rows, (unsigned long)SIM_PACK_COLORS, (unsigned long)(SIM_PALETTES * 2U));
+  printf("palette check: %lu errors\n", (unsigned long)errors);
+  Failures += errors;
+  SIM_Report("palette");
+}
+
+/**
+  * @brief  分块绘制：同样的图元用LCD_Tile_xxx和直接的LCD_xxx各画一次，两个缓冲区必须相同，
+  *         层大小不是图块的整数倍，图元超出层的边缘，图元表和分箱表在一帧中用尽；
+  *         重绘多的一帧中被完全覆盖的图块不读显存，读写的字节数少于直接绘制
+  * @note   文字直接绘制时由DMA2D混合，舍入不同，带文字的一帧按SIM_TILE_ERROR比较
+  * @retval 无
+  */
+static void SIM_Tile(void)
+{
+  static const uint32_t formats[] = {LTDC_PIXEL_FORMAT_ARGB8888, LTDC_PIXEL_FORMAT_RGB565};
+  static const uint16_t sizes[][2] = {{SIM_WIDTH, SIM_HEIGHT}, {SIM_WIDTH - 10U, SIM_HEIGHT - 10U}};
+  /* 每帧的图元个数、图元类型的掩码(bit0不透明矩形，bit1半透明矩形，bit2圆，bit3图像，bit4文字，bit5整层半透明矩形)；
+     最后一帧先清屏，重绘多 */
+  static const uint32_t frames[][2] = {{SIM_TILE_PRIMS, 0x0FU}, {60, 0x24U}, {80, 0x1FU}, {300, 0x05U}, {150, 0x03U}};
+  const uint32_t overdraw = sizeof(frames) / sizeof(frames[0]) - 1U;
+  LCD_TileStatsTypeDef stats;
+  uint32_t errors = 0, seed = 2024, tiles, f, k, n, i, buffer, diff, tolerance;
+  uint32_t *image = QueueImage[0];
+
+  for(i = 0; i < SIM_QUEUE_SIZE * SIM_QUEUE_SIZE; i++)
+  {
+    seed = seed * 1103515245U + 12345U;
+    image[i] = seed ^ (seed >> 13);
+  }
+
+  for(f = 0; f < sizeof(formats) / sizeof(formats[0]); f++)
+  {
+    for(k = 0; k < sizeof(sizes) / sizeof(sizes[0]); k++)
+    {
+      tiles = ((sizes[k][0] + LCD_TILE_WIDTH - 1U) / LCD_TILE_WIDTH) * ((sizes[k][1] + LCD_TILE_HEIGHT - 1U) / LCD_TILE_HEIGHT);
+      for(n = 0; n < sizeof(frames) / sizeof(frames[0]); n++)
+      {
+        /* 缓冲区0分块绘制，缓冲区1直接绘制，背景相同 */
+        for(buffer = 0; buffer < 2U; buffer++)
+        {
+          LCD_DMA2D_Flush();
+          LCD_LayerInitSize(0, LCD_FB_START_ADDRESS + buffer * SIM_WIDTH * SIM_HEIGHT * 4U, formats[f], sizes[k][0], sizes[k][1]);
+          LCD_SelectLayer(0);
+          LCD_Clear(0xFF204060);
+          SIM_TilePrims(40, 77U + n, 0x0FU, 0);
+          LCD_DMA2D_Flush();
+          LCD_Tile_ResetStats();
+          if(buffer == 0U)
+          {
+            errors += (LCD_Tile_Begin(0) != HAL_OK) ? 1U : 0U;
+          }
+          if(n == overdraw)
+          {
+            if(buffer == 0U)
+            {
+              LCD_Tile_Clear(LCD_COLOR_DARKGRAY);
+            }
+            else
+            {
+              LCD_Clear(LCD_COLOR_DARKGRAY);
+            }
+          }
+          SIM_TilePrims(frames[n][0], 1000U + n, frames[n][1], (buffer == 0U) ? 1U : 0U);
+          if(buffer == 0U)
+          {
+            LCD_Tile_End();
+            LCD_Tile_GetStats(&stats);
+          }
+          LCD_DMA2D_Flush();
+        }
+
+        /* 直接绘制RGB565时每次混合后都截断，分块绘制在ARGB8888中混合，写回时截断一次 */
+        tolerance = ((frames[n][1] & 0x10U) != 0U) ? SIM_TILE_ERROR : 0U;
+        if(formats[f] == LTDC_PIXEL_FORMAT_RGB565)
+        {
+          tolerance = ((frames[n][1] & 0x2AU) != 0U) ? SIM_TILE_ERROR565 : ((tolerance != 0U) ? 1U : 0U);
+        }
+        diff = SIM_TileCompare(formats[f], sizes[k][0], sizes[k][1], tolerance);
+        errors += diff;
+        errors += (stats.Frames != 1U) ? 1U : 0U;
+        /* 第一帧图元表用尽，第二帧分箱表用尽 */
+        errors += ((n < 2U) && (stats.Flushes == 0U)) ? 1U : 0U;
+        if(n == overdraw)
+        {
+          errors += ((stats.Flushes != 0U) || (stats.TilesCovered != tiles) || (stats.TilesLoaded != 0U)) ? 1U : 0U;
+          errors += ((stats.BytesRead + stats.BytesWritten) >= stats.DirectBytes) ? 1U : 0U;
+          printf("tile %s %ux%u: %lu primitives, %lu tiles written, %lu covered, read %lu + written %lu bytes, direct %lu bytes\n",
+                 (f == 0U) ? "ARGB8888" : "RGB565", sizes[k][0], sizes[k][1], (unsigned long)stats.Primitives,
+                 (unsigned long)stats.TilesWritten, (unsigned long)stats.TilesCovered, (unsigned long)stats.BytesRead,
+                 (unsigned long)stats.BytesWritten, (unsigned long)stats.DirectBytes);
+        }
+        else
+        {
+          printf("tile %s %ux%u frame %lu: %lu primitives, %lu flushes, %lu tiles loaded, %lu pixels beyond %lu\n",
+                 (f == 0U) ? "ARGB8888" : "RGB565", sizes[k][0], sizes[k][1], (unsigned long)n,
+                 (unsigned long)stats.Primitives, (unsigned long)stats.Flushes, (unsigned long)stats.TilesLoaded,
+                 (unsigned long)diff, (unsigned long)tolerance);
+        }
+      }
+    }
+  }
+
+  printf("tile check: %lu errors\n", (unsigned long)errors);
+  Failures += errors;
+  SIM_Report("tile");
+}
+
+/**
+  * @brief  生成一组随机图元，分块绘制或直接绘制
+  * @note   直接绘制时矩形先裁剪到层内，半透明的矩形和图像由LCD_BlendSpan逐行、逐点混合
+  * @param  Count: 图元个数
+  * @param  Seed: 随机数种子，相同的种子得到相同的图元
+  * @param  Mask: 允许的图元类型，见SIM_Tile
+  * @param  Tiled: 1用LCD_Tile_xxx绘制
+  * @retval 无
+  */
+static void SIM_TilePrims(uint32_t Count, uint32_t Seed, uint32_t Mask, uint32_t Tiled)
+{
+  static const char *texts[] = {"Tile 0123", "Hello, world!", "AVAWAy Tj", "{[(#$%&)]}"};
+  static uint8_t ones[SIM_WIDTH];
+  const uint32_t *image = QueueImage[0];
+  int32_t  xsize = (int32_t)LCD_GetXSize(), ysize = (int32_t)LCD_GetYSize();
+  int32_t  x, y, w, h, x0, y0, x1, y1, px, py;
+  uint32_t type, color, alpha, i;
+  uint8_t  a;
+
+  memset(ones, 0xFF, sizeof(ones));
+  for(i = 0; i < Count; i++)
+  {
+    do
+    {
+      Seed = Seed * 1103515245U + 12345U;
+      type = (Seed >> 16) % 6U;
+    }while(((Mask >> type) & 1U) == 0U);
+    Seed = Seed * 1103515245U + 12345U;
+    x = (int32_t)((Seed >> 4) % (uint32_t)(xsize + 80)) - 40;
+    y = (int32_t)((Seed >> 16) % (uint32_t)(ysize + 80)) - 40;
+    Seed = Seed * 1103515245U + 12345U;
+    w = (int32_t)((Seed >> 4) % 200U) + 1;
+    h = (int32_t)((Seed >> 16) % 200U) + 1;
+    Seed = Seed * 1103515245U + 12345U;
+    color = Seed ^ (Seed >> 11);
+    alpha = ((color >> 24) % 254U) + 1U;
+
+    switch(type)
+    {
+    case 0:
+    case 1:
+    case 5:
+      color = (type == 0U) ? (color | 0xFF000000U) : ((color & 0x00FFFFFFU) | (alpha << 24));
+      if(type == 5U)
+      {
+        x = y = -1;
+        w = xsize + 2;
+        h = ysize + 2;
+      }
+      if(Tiled != 0U)
+      {
+        LCD_Tile_FillRect((int16_t)x, (int16_t)y, (uint16_t)w, (uint16_t)h, color);
+        break;
+      }
+      x0 = (x < 0) ? 0 : x;
+      y0 = (y < 0) ? 0 : y;
+      x1 = (x + w > xsize) ? xsize : (x + w);
+      y1 = (y + h > ysize) ? ysize : (y + h);
+      if((x0 >= x1) || (y0 >= y1))
+      {
+        break;
+      }
+      if(type == 0U)
+      {
+        LCD_SetTextColor(color);
+        LCD_FillRect((uint16_t)x0, (uint16_t)y0, (uint16_t)(x1 - x0), (uint16_t)(y1 - y0));
+        break;
+      }
+      LCD_DMA2D_Flush();
+      for(py = y0; py < y1; py++)
+      {
+        LCD_BlendSpan((uint16_t)x0, (uint16_t)py, ones, (uint16_t)(x1 - x0), color);
+      }
+      break;
+
+    case 2:
+      /* 圆心在层内，半径可以超出层 */
+      x = (x < 0) ? 0 : ((x >= xsize) ? (xsize - 1) : x);
+      y = (y < 0) ? 0 : ((y >= ysize) ? (ysize - 1) : y);
+      color |= 0xFF000000U;
+      if(Tiled != 0U)
+      {
+        LCD_Tile_FillCircle((int16_t)x, (int16_t)y, (uint16_t)(w / 3), color);
+      }
+      else
+      {
+        LCD_SetTextColor(color);
+        LCD_FillCircle((uint16_t)x, (uint16_t)y, (uint16_t)(w / 3));
+      }
+      break;
+
+    case 3:
+      w = (w > (int32_t)SIM_QUEUE_SIZE) ? (int32_t)SIM_QUEUE_SIZE : w;
+      h = (h > (int32_t)SIM_QUEUE_SIZE) ? (int32_t)SIM_QUEUE_SIZE : h;
+      if(Tiled != 0U)
+      {
+        LCD_Tile_BlendImage(image, SIM_QUEUE_SIZE, (int16_t)x, (int16_t)y, (uint16_t)w, (uint16_t)h, (uint8_t)alpha);
+        break;
+      }
+      LCD_DMA2D_Flush();
+      a = (uint8_t)alpha;
+      for(py = (y < 0) ? 0 : y; (py < y + h) && (py < ysize); py++)
+      {
+        for(px = (x < 0) ? 0 : x; (px < x + w) && (px < xsize); px++)
+        {
+          LCD_BlendSpan((uint16_t)px, (uint16_t)py, &a, 1, image[(py - y) * (int32_t)SIM_QUEUE_SIZE + (px - x)]);
+        }
+      }
+      break;
+
+    default:
+      /* 文字整行在层内 */
+      x = (x < 0) ? 0 : ((x > xsize - 240) ? (xsize - 240) : x);
+      y = (y < 0) ? 0 : ((y > ysize - (int32_t)LCD_DEFAULT_FONT.Height) ? (ysize - (int32_t)LCD_DEFAULT_FONT.Height) : y);
+      color |= 0xFF000000U;
+      if(Tiled != 0U)
+      {
+        LCD_Tile_DisplayString((int16_t)x, (int16_t)y, (const uint8_t *)texts[w % 4], &LCD_DEFAULT_FONT, color);
+      }
+      else
+      {
+        LCD_SetFont(&LCD_DEFAULT_FONT);
+        LCD_SetTextColor(color);
+        LCD_SetBackColor(LCD_COLOR_TRANSPARENT);
+        LCD_DisplayStringAt((uint16_t)x, (uint16_t)y, (const uint8_t *)texts[w % 4], LEFT_MODE);
+      }
+      break;
+    }
+  }
+}
+
+/**
+  * @brief  比较分块绘制(缓冲区0)和直接绘制(缓冲区1)的结果
+  * @param  Format: 层的像素格式，ARGB8888或RGB565
+  * @param  Width, Height: 层大小
+  * @param  Tolerance: 每个通道允许的误差，ARGB8888按8位计，RGB565按各分量的最低位计
+  * @retval 超出误差的像素数
+  */
+static uint32_t SIM_TileCompare(uint32_t Format, uint32_t Width, uint32_t Height, uint32_t Tolerance)
+{
+  static const uint8_t shift565[] = {0, 5, 11}, mask565[] = {0x1F, 0x3F, 0x1F};
+  const uint8_t *tiled  = (const uint8_t *)(uintptr_t)LCD_FB_START_ADDRESS;
+  const uint8_t *direct = tiled + SIM_WIDTH * SIM_HEIGHT * 4U;
+  uint32_t bpp = (Format == LTDC_PIXEL_FORMAT_ARGB8888) ? 4U : 2U;
+  uint32_t count = 0, i, c, p0, p1, d;
+
+  for(i = 0; i < Width * Height; i++)
+  {
+    p0 = p1 = 0;
+    memcpy(&p0, tiled + i * bpp, bpp);
+    memcpy(&p1, direct + i * bpp, bpp);
+    for(c = 0, d = 0; (p0 != p1) && (c < 4U); c++)
+    {
+      if(bpp == 4U)
+      {
+        d |= ((uint32_t)ABS((int32_t)((p0 >> (c * 8U)) & 0xFFU) - (int32_t)((p1 >> (c * 8U)) & 0xFFU)) > Tolerance) ? 1U : 0U;
+      }
+      else if(c < 3U)
+      {
+        d |= ((uint32_t)ABS((int32_t)((p0 >> shift565[c]) & mask565[c]) - (int32_t)((p1 >> shift565[c]) & mask565[c])) > Tolerance) ? 1U : 0U;
+      }
+    }
+    count += d;
+  }
+  return count;
+}
+
+/**
+  * @brief  窗口裁剪：层1的图像大于屏幕，窗口移到屏幕外(包括负坐标)、滚动超出图像、隐藏后再显示，
+  *         提交后扫描输出的每个像素必须是按窗口参数独立算出的图像像素或层0的背景；
+  *         层序号越界的设置必须被忽略
+  * @retval 无
+  */
+static void SIM_Window(void)
+{
+  static const uint32_t formats[] = {LTDC_PIXEL_FORMAT_ARGB8888, LTDC_PIXEL_FORMAT_RGB565};
+  /* X, Y, 宽, 高, 滚动X, 滚动Y, 可见 */
+  static const int32_t cases[][7] =
+  {
+    {0, 0, SIM_WIDTH, SIM_HEIGHT, 0, 0, 1},
+    {-50, -30, 400, 300, 10, 20, 1},
+    {-500, -10, 400, 300, 0, 0, 1},
+    {700, 400, 300, 200, 0, 0, 1},
+    {100, 50, 500, 400, SIM_WIN_WIDTH - 300, SIM_WIN_HEIGHT - 250, 1},
+    {100, 50, 500, 400, SIM_WIN_WIDTH, 0, 1},
+    {100, 50, 300, 200, 0, 0, 0},
+    {100, 50, 300, 200, 0, 0, 1},
+    {-20, 300, 900, 400, SIM_WIN_WIDTH - 50, SIM_WIN_HEIGHT - 100, 1},
+  };
+  const uint32_t background = LCD_COLOR_DARKBLUE;
+  const uint32_t *frame;
+  LCD_WindowStatsTypeDef before, after;
+  uint32_t errors = 0, seed = 1999, hidden = 0, configs = 0, f, n, i, bpp, expect, ix, iy, in;
+  int32_t  c[7], x, y;
+  uint8_t  *image = (uint8_t *)(uintptr_t)(LCD_FB_START_ADDRESS + SIM_WIDTH * SIM_HEIGHT * 4U);
+
+  LCD_LayerInit(0, LCD_FB_START_ADDRESS, LTDC_PIXEL_FORMAT_ARGB8888);
+  LCD_SelectLayer(0);
+  LCD_Clear(background);
+  LCD_DMA2D_Flush();
+
+  for(f = 0; f < sizeof(formats) / sizeof(formats[0]); f++)
+  {
+    bpp = (formats[f] == LTDC_PIXEL_FORMAT_ARGB8888) ? 4U : 2U;
+    errors += (LCD_Window_Create(1, LCD_DMA2D_Address(image), formats[f], SIM_WIN_WIDTH, SIM_WIN_HEIGHT) != HAL_OK) ? 1U : 0U;
+    for(i = 0; i < (uint32_t)SIM_WIN_WIDTH * SIM_WIN_HEIGHT; i++)
+    {
+      expect = 0xFF000000U | (i * 2654435761U >> 8);
+      memcpy(image + i * bpp, &expect, bpp);
+    }
+
+    for(n = 0; n < (sizeof(cases) / sizeof(cases[0])) + SIM_WIN_CASES; n++)
+    {
+      if(n < sizeof(cases) / sizeof(cases[0]))
+      {
+        memcpy(c, cases[n], sizeof(c));
+      }
+      else
+      {
+        seed = seed * 1103515245U + 12345U;
+        c[0] = (int32_t)((seed >> 4) % 1100U) - 300;
+        c[1] = (int32_t)((seed >> 18) % 680U) - 200;
+        seed = seed * 1103515245U + 12345U;
+        c[2] = (int32_t)((seed >> 4) % 900U) + 1;
+        c[3] = (int32_t)((seed >> 18) % 560U) + 1;
+        seed = seed * 1103515245U + 12345U;
+        c[4] = (int32_t)((seed >> 4) % (SIM_WIN_WIDTH + 50U));
+        c[5] = (int32_t)((seed >> 18) % (SIM_WIN_HEIGHT + 50U));
+        c[6] = ((seed & 7U) != 0U) ? 1 : 0;
+      }
+
+      LCD_Window_SetPosition(1, (int16_t)c[0], (int16_t)c[1]);
+      LCD_Window_SetSize(1, (uint16_t)c[2], (uint16_t)c[3]);
+      LCD_Window_Scroll(1, (uint16_t)c[4], (uint16_t)c[5]);
+      LCD_Window_SetVisible(1, (c[6] != 0) ? ENABLE : DISABLE);
+      LCD_Window_Commit();
+      LCD_Soft_VSync();
+      LCD_Soft_VSync();
+      frame = LCD_Soft_GetFrame();
+
+      for(in = 0, y = 0; y < (int32_t)SIM_HEIGHT; y++)
+      {
+        for(x = 0; x < (int32_t)SIM_WIDTH; x++)
+        {
+          ix = (uint32_t)(c[4] + x - c[0]);
+          iy = (uint32_t)(c[5] + y - c[1]);
+          expect = background;
+          if((c[6] != 0) && (x >= c[0]) && (x < c[0] + c[2]) && (y >= c[1]) && (y < c[1] + c[3]) &&
+             (ix < SIM_WIN_WIDTH) && (iy < SIM_WIN_HEIGHT))
+          {
+            expect = SIM_BlitUnpack(formats[f], image + (iy * SIM_WIN_WIDTH + ix) * bpp, NULL) | 0xFF000000U;
+            in++;
+          }
+          errors += (frame[y * SIM_WIDTH + x] != expect) ? 1U : 0U;
+        }
+      }
+      hidden += (in == 0U) ? 1U : 0U;
+      configs++;
+    }
+
+    /* 越界的层序号不能改写窗口表之外的内存，也不能改变层1 */
+    LCD_Window_GetStats(&before);
+    LCD_Window_SetPosition(MAX_LAYER_NUMBER, 0, 0);
+    LCD_Window_SetSize(MAX_LAYER_NUMBER, 1, 1);
+    LCD_Window_Scroll(MAX_LAYER_NUMBER, 0, 0);
+    LCD_Window_SetAlpha(MAX_LAYER_NUMBER, 0);
+    LCD_Window_SetColorKey(MAX_LAYER_NUMBER, 0, ENABLE);
+    LCD_Window_SetVisible(MAX_LAYER_NUMBER, DISABLE);
+    LCD_Window_SetAddress(MAX_LAYER_NUMBER, 0);
+    LCD_Window_Update(MAX_LAYER_NUMBER, LCD_RELOAD_NONE);
+    LCD_Window_Release(MAX_LAYER_NUMBER);
+    LCD_Window_Commit();
+    LCD_Window_GetStats(&after);
+    errors += ((after.LayerUpdates != before.LayerUpdates) || (LCD_Window_IsActive(1) == 0U)) ? 1U : 0U;
+  }
+
+  LCD_LayerInit(1, LCD_FB_START_ADDRESS + SIM_WIDTH * SIM_HEIGHT * 4U, LTDC_PIXEL_FORMAT_ARGB8888);
+  LCD_SetLayerVisible(1, DISABLE);
+  printf("window: %lu configurations, %lu with nothing visible\n", (unsigned long)configs, (unsigned long)hidden);
+  printf("window check: %lu errors\n", (unsigned long)errors);
+  Failures += errors;
+  SIM_Report("window");
+}
+
+/**
+  * @brief  虚拟画布：两个方向各随机滚动和平移，每次滚动后扫描输出必须是屏幕对应的虚拟内容；
+  *         连续小步滚动越过缓冲区末端和起点(窗口移回另一份并等待重载)，
+  *         超过一屏的跳转整屏重绘，其余滚动只绘制新露出的行(列)
+  * @note   随机的四分之一滚动后不等垂直消隐就继续滚动，驱动等待重载期间LTDC输出的每一帧
+  *         也必须是某个滚动位置的完整画面，镜像复制或绘制早于地址切换时会露出错误的行(列)
+  * @retval 无
+  */
+static void SIM_Canvas(void)
+{
+  /* 滚动方向, 像素格式, 另一个方向上画布的长度 */
+  static const uint32_t configs[][3] =
+  {
+    {LCD_CANVAS_VERTICAL, LTDC_PIXEL_FORMAT_ARGB8888, 1000},
+    {LCD_CANVAS_HORIZONTAL, LTDC_PIXEL_FORMAT_RGB565, 600},
+  };
+  LCD_CanvasStatsTypeDef before, after;
+  uint32_t errors = 0, seed = 316, k, n, op, view, crossview, pan, drawn, scrolls, full, mismatch, wraps[2];
+  int32_t  delta, pos, start, rest, step;
+
+  for(k = 0; k < sizeof(configs) / sizeof(configs[0]); k++)
+  {
+    view      = (configs[k][0] == LCD_CANVAS_VERTICAL) ? SIM_HEIGHT : SIM_WIDTH;
+    crossview = (configs[k][0] == LCD_CANVAS_VERTICAL) ? SIM_WIDTH : SIM_HEIGHT;
+    LCD_Canvas_GetStats(&before);
+    errors += (LCD_Canvas_Init(1, LCD_FB_START_ADDRESS + SIM_WIDTH * SIM_HEIGHT * 4U, configs[k][1], configs[k][0],
+                               (uint16_t)configs[k][2], SIM_CanvasDraw, (void *)(uintptr_t)configs[k]) != HAL_OK) ? 1U : 0U;
+    pos      = 0;
+    start    = 0;
+    pan      = 0;
+    wraps[0] = 0;
+    wraps[1] = 0;
+    drawn    = view;
+    scrolls  = 0;
+    full     = 0;
+    mismatch = 0;
+    memset(&CanvasCheck, 0, sizeof(CanvasCheck));
+    CanvasCheck.pConfig = configs[k];
+    LCD_Soft_SetFrameHook(SIM_CanvasFrame);
+
+    /* 前4 * view / STEP次连续向后滚过两份的末端，接着同样向前滚回，之后随机 */
+    for(n = 0; n < (8U * view / SIM_CANVAS_STEP) + SIM_CANVAS_OPS; n++)
+    {
+      seed  = seed * 1103515245U + 12345U;
+      op    = (seed >> 16) % 16U;
+      delta = 0;
+      if(n < 4U * view / SIM_CANVAS_STEP)
+      {
+        delta = SIM_CANVAS_STEP;
+      }
+      else if(n < 8U * view / SIM_CANVAS_STEP)
+      {
+        delta = -SIM_CANVAS_STEP;
+      }
+      else if(op == 0U)
+      {
+        delta = (int32_t)(view + (seed >> 4) % (2U * view));
+        delta = ((seed & 1U) != 0U) ? -delta : delta;
+      }
+      else if(op == 1U)
+      {
+        pan = (seed >> 4) % configs[k][2];
+        pan = (pan < configs[k][2] - crossview) ? pan : (configs[k][2] - crossview);
+        CanvasCheck.Pan[1] = pan;
+        LCD_Canvas_Pan((uint16_t)((seed >> 4) % configs[k][2]));
+      }
+      else
+      {
+        delta = (int32_t)(((op < 12U) ? ((seed >> 4) % 40U) : ((seed >> 4) % view)) + 1U);
+        delta = ((seed & 1U) != 0U) ? -delta : delta;
+      }
+
+      if(delta != 0)
+      {
+        /* 窗口起点的参考模型，统计越过缓冲区末端(起点)的次数 */
+        if((delta >= (int32_t)view) || (delta <= -(int32_t)view))
+        {
+          start = ((pos + delta) % (int32_t)view + (int32_t)view) % (int32_t)view;
+          full++;
+          drawn += view;
+          CanvasCheck.Mixed = 1;
+        }
+        else
+        {
+          for(rest = delta; rest != 0; rest -= step)
+          {
+            if((rest > 0) && (start == (int32_t)view))
+            {
+              start = 0;
+              wraps[0]++;
+            }
+            else if((rest < 0) && (start == 0))
+            {
+              start = (int32_t)view;
+              wraps[1]++;
+            }
+            step = (rest > 0) ? ((rest < (int32_t)view - start) ? rest : ((int32_t)view - start)) :
+                                ((rest > -start) ? rest : -start);
+            start += step;
+          }
+          drawn += (uint32_t)((delta < 0) ? -delta : delta);
+        }
+        CanvasCheck.Low  = (pos + delta < CanvasCheck.Low) ? (pos + delta) : CanvasCheck.Low;
+        CanvasCheck.High = (pos + delta > CanvasCheck.High) ? (pos + delta) : CanvasCheck.High;
+
+        if((n & 1U) != 0U)
+        {
+          LCD_Canvas_Scroll(delta);
+        }
+        else
+        {
+          LCD_Canvas_ScrollTo(pos + delta);
+        }
+        pos += delta;
+        scrolls++;
+
+        if((n >= 8U * view / SIM_CANVAS_STEP) && (((seed >> 8) & 3U) == 0U))
+        {
+          errors += (LCD_Canvas_GetPosition() != pos) ? 1U : 0U;
+          continue;
+        }
+      }
+      errors += (LCD_Canvas_GetPosition() != pos) ? 1U : 0U;
+
+      LCD_Soft_VSync();
+      LCD_Soft_VSync();
+      mismatch += SIM_CanvasMatch(LCD_Soft_GetFrame(), pos, pan, view);
+      CanvasCheck.Low    = pos;
+      CanvasCheck.High   = pos;
+      CanvasCheck.Pan[0] = pan;
+      CanvasCheck.Mixed  = 0;
+    }
+    LCD_Soft_SetFrameHook(NULL);
+
+    LCD_Canvas_GetStats(&after);
+    printf("canvas %s: %lu scrolls (%lu full redraws, %lu/%lu wraps forward/back), %lu lines drawn, %lu mirrored, "
+           "a full redraw per scroll would draw %lu; %lu frames checked\n",
+           (configs[k][0] == LCD_CANVAS_VERTICAL) ? "vertical" : "horizontal", (unsigned long)scrolls, (unsigned long)full,
+           (unsigned long)wraps[0], (unsigned long)wraps[1],
+           (unsigned long)(after.LinesDrawn - before.LinesDrawn), (unsigned long)(after.LinesMirrored - before.LinesMirrored),
+           (unsigned long)(scrolls * view), (unsigned long)CanvasCheck.Frames);
+    errors += mismatch + CanvasCheck.Errors;
+    errors += ((wraps[0] == 0U) || (wraps[1] == 0U)) ? 1U : 0U;
+    errors += (after.FullRedraws - before.FullRedraws != full) ? 1U : 0U;
+    errors += (after.LinesDrawn - before.LinesDrawn != drawn) ? 1U : 0U;
+    errors += ((after.LinesDrawn - before.LinesDrawn) * 4U > scrolls * view) ? 1U : 0U;
+  }
+
+  LCD_LayerInit(1, LCD_FB_START_ADDRESS + SIM_WIDTH * SIM_HEIGHT * 4U, LTDC_PIXEL_FORMAT_ARGB8888);
+  LCD_SetLayerVisible(1, DISABLE);
+  printf("canvas check: %lu errors\n", (unsigned long)errors);
+  Failures += errors;
+  SIM_Report("canvas");
+}
+
+/**
+  * @brief  比较扫描输出的画面与虚拟画布的内容
+  * @param  pFrame: 扫描输出的画面
+  * @param  Position: 屏幕第一行(列)对应的虚拟坐标
+  * @param  Pan: 屏幕左边(上边)对应的画布坐标
+  * @param  Lines: 比较的行数(上下滚动)或列数(左右滚动)
+  * @retval 不同的像素数
+  */
+static uint32_t SIM_CanvasMatch(const uint32_t *pFrame, int32_t Position, uint32_t Pan, uint32_t Lines)
+{
+  uint32_t vertical = (CanvasCheck.pConfig[0] == LCD_CANVAS_VERTICAL) ? 1U : 0U;
+  uint32_t cross = (vertical != 0U) ? SIM_WIDTH : SIM_HEIGHT;
+  uint32_t errors = 0, i, c, pixel;
+
+  for(i = 0; i < Lines; i++)
+  {
+    for(c = 0; c < cross; c++)
+    {
+      pixel = (vertical != 0U) ? pFrame[i * SIM_WIDTH + c] : pFrame[c * SIM_WIDTH + i];
+      errors += (pixel != SIM_CanvasColor(CanvasCheck.pConfig[1], Position + (int32_t)i, Pan + c)) ? 1U : 0U;
+    }
+  }
+  return errors;
+}
+
+/**
+  * @brief  LTDC每输出一帧调用：画面必须是上次确认以来某个滚动位置和平移量的完整画面，
+  *         出错数按最接近的位置计
+  * @param  pFrame: 扫描输出的画面
+  * @retval 无
+  */
+static void SIM_CanvasFrame(const uint32_t *pFrame)
+{
+  uint32_t lines = (CanvasCheck.pConfig[0] == LCD_CANVAS_VERTICAL) ? SIM_HEIGHT : SIM_WIDTH;
+  uint32_t best = SIM_WIDTH * SIM_HEIGHT, diff, i;
+  int32_t  v;
+
+  if(CanvasCheck.Mixed != 0U)
+  {
+    return;
+  }
+
+  CanvasCheck.Frames++;
+  for(v = CanvasCheck.Low; (v <= CanvasCheck.High) && (best != 0U); v++)
+  {
+    for(i = 0; (i < 2U) && (best != 0U); i++)
+    {
+      if(SIM_CanvasMatch(pFrame, v, CanvasCheck.Pan[i], 1) == 0U)
+      {
+        diff = SIM_CanvasMatch(pFrame, v, CanvasCheck.Pan[i], lines);
+        best = (diff < best) ? diff : best;
+      }
+    }
+  }
+  CanvasCheck.Errors += best;
+}
+
+/**
+  * @brief  虚拟画布的内容：颜色由虚拟坐标和另一个方向上所在的段决定，能在该格式中精确表示
+  * @param  Format: 像素格式
+  * @param  Virtual: 虚拟坐标
+  * @param  Cross: 另一个方向上的画布坐标
+  * @retval ARGB8888颜色
+  */
+static uint32_t SIM_CanvasColor(uint32_t Format, int32_t Virtual, uint32_t Cross)
+{
+  uint32_t hash = ((uint32_t)Virtual * 2654435761U) + (Cross / SIM_CANVAS_SEG);
+  uint16_t pixel;
+
+  /* 乘法混合，使不同的虚拟坐标在RGB565中也几乎不会整行相同 */
+  hash ^= hash >> 15;
+  hash *= 0x2C1B3C6DU;
+  hash ^= hash >> 12;
+  if(Format == LTDC_PIXEL_FORMAT_RGB565)
+  {
+    pixel = (uint16_t)hash;
+    return SIM_BlitUnpack(Format, (const uint8_t *)&pixel, NULL);
+  }
+  return 0xFF000000U | hash;
+}
+
+/**
+  * @brief  虚拟画布的绘制回调：每行(列)按段填充SIM_CanvasColor
+  * @param  pArg: 画布配置{滚动方向, 像素格式, 另一个方向上画布的长度}
+  * @retval 无
+  */
+static void SIM_CanvasDraw(void *pArg, int32_t Virtual, uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height)
+{
+  const uint32_t *config = (const uint32_t *)pArg;
+  uint32_t vertical = (config[0] == LCD_CANVAS_VERTICAL) ? 1U : 0U;
+  uint32_t lines = (vertical != 0U) ? Height : Width;
+  uint32_t cross = (vertical != 0U) ? Width : Height;
+  uint32_t from  = (vertical != 0U) ? Xpos : Ypos;
+  uint32_t i, c, end;
+
+  for(i = 0; i < lines; i++)
+  {
+    for(c = from; c < from + cross; c = end)
+    {
+      end = (c / SIM_CANVAS_SEG + 1U) * SIM_CANVAS_SEG;
+      end = (end < from + cross) ? end : (from + cross);
+      LCD_SetTextColor(SIM_CanvasColor(config[1], Virtual + (int32_t)i, c));
+      if(vertical != 0U)
+      {
+        LCD_FillRect((uint16_t)c, (uint16_t)(Ypos + i), (uint16_t)(end - c), 1);
+      }
+      else
+      {
+        LCD_FillRect((uint16_t)(Xpos + i), (uint16_t)c, 1, (uint16_t)(end - c));
+      }
+    }
+  }
+}
+
+/**
+  * @brief  性能计数：画已知内容的一帧，LCD_Prof_GetLastFrame的调用次数和像素数必须与绘制的内容一致；
+  *         字符串内部的每个字符计调用次数，耗时和像素计入字符串
+  * @retval 无
+  */
+static void SIM_Prof(void)
+{
+  static const uint16_t rects[][4] = {{10, 10, 10, 20}, {100, 40, 30, 5}, {300, 200, 7, 7}};
+  LCD_ProfFrameTypeDef frame;
+  uint32_t errors = 0, ticks = 0, pixels = 0, i;
+
+  LCD_LayerInit(0, LCD_FB_START_ADDRESS, LTDC_PIXEL_FORMAT_ARGB8888);
+  LCD_SelectLayer(0);
+  LCD_SetFont(&Font16);
+  LCD_SetBackColor(LCD_COLOR_TRANSPARENT);
+  LCD_SetTextColor(LCD_COLOR_WHITE);
+  LCD_DMA2D_Flush();
+
+  /* 结束之前的统计，下一帧只包含下面的绘制 */
+  LCD_Prof_FrameEnd();
+  for(i = 0; i < sizeof(rects) / sizeof(rects[0]); i++)
+  {
+    LCD_FillRect(rects[i][0], rects[i][1], rects[i][2], rects[i][3]);
+    pixels += (uint32_t)rects[i][2] * rects[i][3];
+  }
+  LCD_FillCircle(400, 240, 30);
+  LCD_DisplayStringAt(20, 300, (const uint8_t *)"ABCD", LEFT_MODE);
+  LCD_DMA2D_Flush();
+  LCD_Prof_FrameEnd();
+  LCD_Prof_GetLastFrame(&frame);
+
+  for(i = 0; i < LCD_PROF_COUNT; i++)
+  {
+    ticks += frame.Counter[i].Ticks;
+  }
+  errors += (frame.Counter[LCD_PROF_FILL_RECT].Calls != sizeof(rects) / sizeof(rects[0])) ? 1U : 0U;
+  errors += (frame.Counter[LCD_PROF_FILL_RECT].Pixels != pixels) ? 1U : 0U;
+  errors += (frame.Counter[LCD_PROF_FILL_CIRCLE].Calls != 1U) ? 1U : 0U;
+  errors += (frame.Counter[LCD_PROF_STRING].Calls != 1U) ? 1U : 0U;
+  errors += (frame.Counter[LCD_PROF_STRING].Pixels == 0U) ? 1U : 0U;
+  errors += (frame.Counter[LCD_PROF_STRING].Ticks == 0U) ? 1U : 0U;
+  errors += (frame.Counter[LCD_PROF_CHAR].Calls != 4U) ? 1U : 0U;
+  errors += ((frame.Counter[LCD_PROF_CHAR].Ticks != 0U) || (frame.Counter[LCD_PROF_CHAR].Pixels != 0U)) ? 1U : 0U;
+  errors += (frame.Counter[LCD_PROF_BLIT].Calls != 0U) ? 1U : 0U;
+  errors += (ticks > frame.FrameTicks) ? 1U : 0U;
+
+  printf("prof: %lu rect px, %lu string px, %lu char calls, %lu of %lu ticks in counters\n",
+         (unsigned long)frame.Counter[LCD_PROF_FILL_RECT].Pixels, (unsigned long)frame.Counter[LCD_PROF_STRING].Pixels,
+         (unsigned long)frame.Counter[LCD_PROF_CHAR].Calls, (unsigned long)ticks, (unsigned long)frame.FrameTicks);
+  printf("prof check: %lu errors\n", (unsigned long)errors);
+  Failures += errors;
+  SIM_Report("prof");
+}
+
+/**
+  * @brief  两层叠加：层1为半透明ARGB8888，层0保持上一场景的内容
+  * @retval 无
+  */
+static void SIM_Overlay(void)
+{
+  LCD_LayerInit(1, LCD_FB_START_ADDRESS + SIM_WIDTH * SIM_HEIGHT * 4U, LTDC_PIXEL_FORMAT_ARGB8888);
+  LCD_SelectLayer(1);
+  LCD_Clear(LCD_COLOR_TRANSPARENT);
+
+  LCD_SetTextColor(0x80FF0000U);
+  LCD_FillRect(100, 100, 300, 200);
+  LCD_SetTextColor(0xC00000FFU);
+  LCD_FillCircle(400, 240, 120);
+  LCD_SetTransparency(1, 200);
+
+  SIM_Report("overlay");
+
+  LCD_SetLayerVisible(1, DISABLE);
+}
+
+/**
+  * @brief  流式JPEG解码：三幅不同抽样格式的测试图像，部分超出层的边界，逐像素与原图比较
+  * @note   软件解码器的输入是MCU数据而不是真正的JPEG文件，检验的是分块读取、
+  *         暂停/恢复、MCU到行带的转换和DMA2D写入
+  * @retval 无
+  */
+static void SIM_Jpeg(void)
+{
+  static const struct
+  {
+    int16_t  X, Y;
+    uint32_t Width, Height, ColorSpace, Subsampling, Chunk;
+  }Images[] =
+  {
+    { -24,  40, 432, 300, LCD_JPEG_YCBCR,     LCD_JPEG_420, 0   },
+    { 420,  40, 300, 200, LCD_JPEG_YCBCR,     LCD_JPEG_422, 777 },
+    { 600, 300, 300, 250, LCD_JPEG_GRAYSCALE, LCD_JPEG_444, 100 },
+    { 200, 380, 160,  90, LCD_JPEG_YCBCR,     LCD_JPEG_444, 0   },
+  };
+  LCD_JPEG_InfoTypeDef info, decoded;
+  LCD_JPEG_StatsTypeDef stats;
+  SIM_FileTypeDef file;
+  HAL_StatusTypeDef status;
+  uint32_t i, size, error, errors = 0;
+
+  LCD_SetLayerVisible(1, DISABLE);
+  LCD_SelectLayer(0);
+  LCD_Clear(LCD_COLOR_BLACK);
+  LCD_JPEG_ResetStats();
+
+  for(i = 0; i < sizeof(Images) / sizeof(Images[0]); i++)
+  {
+    info.Width             = Images[i].Width;
+    info.Height            = Images[i].Height;
+    info.ColorSpace        = Images[i].ColorSpace;
+    info.ChromaSubsampling = Images[i].Subsampling;
+    size = LCD_JPEG_Soft_Encode(&info, SIM_JpegPixel, JpegFile, sizeof(JpegFile));
+
+    if(Images[i].Chunk == 0U)
+    {
+      status = LCD_JPEG_DrawMemory(Images[i].X, Images[i].Y, JpegFile, size, &decoded);
+    }
+    else
+    {
+      file.pData  = JpegFile;
+      file.Size   = size;
+      file.Offset = 0;
+      file.Chunk  = Images[i].Chunk;
+      status = LCD_JPEG_Draw(Images[i].X, Images[i].Y, SIM_JpegRead, &file, &decoded);
+    }
+    LCD_DMA2D_Flush();
+    error = SIM_JpegCheck(&info, Images[i].X, Images[i].Y);
+    printf("jpeg %lux%lu cs %lu ss %lu at (%d,%d): status %d, %lu bytes, max error %lu\n",
+           (unsigned long)decoded.Width, (unsigned long)decoded.Height, (unsigned long)decoded.ColorSpace,
+           (unsigned long)decoded.ChromaSubsampling, Images[i].X, Images[i].Y, (int)status,
+           (unsigned long)size, (unsigned long)error);
+    errors += ((status != HAL_OK) || (error > SIM_JPEG_ERROR) ||
+               (decoded.Width != info.Width) || (decoded.Height != info.Height)) ? 1U : 0U;
+  }
+
+  /* 文件头错误和文件被截断 */
+  JpegFile[0] = 'X';
+  status = LCD_JPEG_DrawMemory(0, 0, JpegFile, size, NULL);
+  printf("jpeg bad header: status %d\n", (int)status);
+  errors += (status == HAL_OK) ? 1U : 0U;
+  JpegFile[0] = 'M';
+  status = LCD_JPEG_DrawMemory(0, 0, JpegFile, size / 2U, NULL);
+  printf("jpeg truncated: status %d\n", (int)status);
+  errors += (status == HAL_OK) ? 1U : 0U;
+
+  LCD_JPEG_GetStats(&stats);
+  printf("jpeg: %lu images, %lu errors, %lu bytes in %lu chunks, %lu output chunks, %lu mcus, %lu skipped, "
+         "%lu strips, stalls in %lu out %lu\n",
+         (unsigned long)stats.Images, (unsigned long)stats.Errors, (unsigned long)stats.InputBytes,
+         (unsigned long)stats.InputChunks, (unsigned long)stats.OutputChunks, (unsigned long)stats.Mcus,
+         (unsigned long)stats.McusSkipped, (unsigned long)stats.Strips,
+         (unsigned long)stats.InputStalls, (unsigned long)stats.OutputStalls);
+
+  /* 两次出错是上面故意制造的 */
+  errors += ((stats.Images != (sizeof(Images) / sizeof(Images[0]))) || (stats.Errors != 2U)) ? 1U : 0U;
+  printf("jpeg check: %lu errors\n", (unsigned long)errors);
+  Failures += errors;
+  SIM_Report("jpeg");
+}
+
+/**
+  * @brief  大字库文本：6763字的压缩字体按字频分布排版20万字，测量每秒字数和字模缓存命中率
+  * @note   先只查缓存(展开字模)，再整行绘制；最后检查缓存中的字模与生成的点阵一致
+  * @retval 无
+  */
+static void SIM_Text(void)
+{
+  static sFONT cjk;
+  LCD_FontCacheStatsTypeDef stats;
+  const uint8_t *text, *line;
+  uint8_t  pixels[SIM_CJK_SIZE * SIM_CJK_SIZE];
+  uint8_t  buffer[SIM_CJK_LINE * 3U + 1U];
+  uint8_t  *corpus, *mask;
+  uint32_t raw, size, code, count, errors, i, k;
+  uint16_t y;
+  double   start, seconds;
+
+  if(LCD_Font_Soft_CJK(&cjk, 0x4E00, 3, SIM_CJK_COUNT, SIM_CJK_SIZE, &raw) != HAL_OK)
+  {
+    printf("cannot build cjk font\n");
+    Failures++;
+    return;
+  }
+  corpus = SIM_Corpus(&cjk, SIM_CJK_CORPUS, &size);
+  if(corpus == NULL)
+  {
+    printf("cannot build corpus\n");
+    Failures++;
+    return;
+  }
+  printf("cjk font: %lu glyphs %lux%lu, %lu bytes compressed, %lu bytes raw A4 (%lu%%)\n",
+         (unsigned long)SIM_CJK_COUNT, (unsigned long)SIM_CJK_SIZE, (unsigned long)SIM_CJK_SIZE,
+         (unsigned long)cjk.Glyphs[SIM_CJK_COUNT - 1U].Offset, (unsigned long)raw,
+         (unsigned long)((uint64_t)cjk.Glyphs[SIM_CJK_COUNT - 1U].Offset * 100U / raw));
+
+  /* 只查缓存，从空缓存开始 */
+  LCD_Font_CacheFlush();
+  LCD_Font_ResetCacheStats();
+  count = 0;
+  start = SIM_Seconds();
+  for(text = corpus; (code = LCD_Font_DecodeUTF8(&text)) != 0U; count++)
+  {
+    (void)LCD_Font_GetGlyphA8(&cjk, code);
+  }
+  seconds = SIM_Seconds() - start;
+  LCD_Font_GetCacheStats(&stats);
+  printf("cjk lookup: %lu glyphs (%lu bytes utf-8) in %.3f s, %.0f glyphs/s, hit rate %lu.%lu%%, "
+         "%lu misses, %lu evictions, %lu bytes cached\n",
+         (unsigned long)count, (unsigned long)size, seconds, count / seconds,
+         (unsigned long)(stats.HitRate / 10U), (unsigned long)(stats.HitRate % 10U),
+         (unsigned long)stats.Misses, (unsigned long)stats.Evictions, (unsigned long)stats.BytesUsed);
+
+  /* 整行绘制，每个字符单元先填背景 */
+  LCD_SetLayerVisible(1, DISABLE);
+  LCD_SelectLayer(0);
+  LCD_Clear(LCD_COLOR_BLACK);
+  LCD_SetFont(&cjk);
+  LCD_SetColors(LCD_COLOR_WHITE, LCD_COLOR_BLACK);
+  LCD_Font_ResetCacheStats();
+  count = 0;
+  y = 0;
+  start = SIM_Seconds();
+  for(line = corpus; *line != 0U; )
+  {
+    for(i = 0, k = 0; (k < SIM_CJK_LINE) && (*line != 0U); k++)
+    {
+      text = line;
+      (void)LCD_Font_DecodeUTF8(&text);
+      while(line < text)
+      {
+        buffer[i++] = *line++;
+      }
+    }
+    buffer[i] = 0;
+    LCD_DisplayStringAt(0, y, buffer, LEFT_MODE);
+    count += k;
+    y = (uint16_t)(y + cjk.Height);
+    if((y + cjk.Height) > (SIM_HEIGHT - 2U * Font24.Height))
+    {
+      y = 0;
+    }
+  }
+  LCD_DMA2D_Flush();
+  seconds = SIM_Seconds() - start;
+  LCD_Font_GetCacheStats(&stats);
+  printf("cjk draw: %lu glyphs in %.3f s, %.0f glyphs/s, hit rate %lu.%lu%%, %lu evictions\n",
+         (unsigned long)count, seconds, count / seconds,
+         (unsigned long)(stats.HitRate / 10U), (unsigned long)(stats.HitRate % 10U),
+         (unsigned long)stats.Evictions);
+
+  /* 缓存中的A8字模与生成的A4点阵比较 */
+  errors = 0;
+  for(i = 0; i < SIM_CJK_COUNT; i += 7U)
+  {
+    mask = (uint8_t *)(uintptr_t)LCD_Font_GetGlyphA8(&cjk, cjk.Codes[i]);
+    LCD_Font_Soft_Glyph(cjk.Codes[i], SIM_CJK_SIZE, pixels);
+    for(k = 0; k < (SIM_CJK_SIZE * SIM_CJK_SIZE); k++)
+    {
+      errors += (mask[k] != (uint8_t)(pixels[k] * 17U)) ? 1U : 0U;
+    }
+  }
+  printf("cjk check: %lu pixel errors\n", (unsigned long)errors);
+  Failures += errors;
+
+  /* 带字距调整的拉丁字母和UTF-8，字体中没有的字符显示为'?' */
+  LCD_SetFont(&Font24);
+  LCD_SetColors(LCD_COLOR_YELLOW, LCD_COLOR_DARKBLUE);
+  LCD_DisplayStringAt(0, (uint16_t)(SIM_HEIGHT - 2U * Font24.Height), (const uint8_t *)"AVATAR Typography WAVE To", LEFT_MODE);
+  LCD_DisplayStringAt(0, (uint16_t)(SIM_HEIGHT - Font24.Height), (const uint8_t *)"UTF-8: caf\xC3\xA9 \xE2\x82\xAC \xE4\xB8\xAD", LEFT_MODE);
+  printf("kerning: \"AVATAR\" %lu px, %ld px from pairs\n",
+         (unsigned long)LCD_Font_GetStringWidth(&Font24, (const uint8_t *)"AVATAR"),
+         (long)(LCD_Font_GetKerning(&Font24, 'A', 'V') + LCD_Font_GetKerning(&Font24, 'V', 'A') +
+                LCD_Font_GetKerning(&Font24, 'A', 'T') + LCD_Font_GetKerning(&Font24, 'T', 'A')));
+  LCD_SetFont(&Font16);
+
+  free(corpus);
+  SIM_Report("text");
+}
+
+/**
+  * @brief  抗锯齿文字的黄金图像：ARGB8888和RGB565层上按三种对齐方式绘制几行文字，
+  *         每行所在的条带与记录的校验和比较；改动字体或混合代码后重新生成这些值
+  * @retval 无
+  */
+static void SIM_TextGolden(void)
+{
+  static const SIM_GoldenTextTypeDef lines[] =
+  {
+    {&Font16, LCD_COLOR_WHITE,  LCD_COLOR_BLACK,    0,   8,   LEFT_MODE,   "The quick brown fox jumps over the lazy dog"},
+    {&Font16, LCD_COLOR_GREEN,  LCD_COLOR_BLACK,    0,   40,  CENTER_MODE, "0123456789 !\"#$%&'()*+,-./:;<=>?@[\\]^_`{|}~"},
+    {&Font24, LCD_COLOR_YELLOW, LCD_COLOR_DARKBLUE, 0,   80,  RIGHT_MODE,  "AVATAR Typography WAVE To"},
+    {&Font24, LCD_COLOR_BLACK,  LCD_COLOR_WHITE,    0,   130, CENTER_MODE, "Hello, world"},
+    {&Font24, LCD_COLOR_RED,    LCD_COLOR_GRAY,     37,  180, LEFT_MODE,   "caf\xC3\xA9 \xE2\x82\xAC \xE4\xB8\xAD"},
+    {&Font24, LCD_COLOR_CYAN,   LCD_COLOR_BLACK,    700, 230, LEFT_MODE,   "clipped at the edge"},
+  };
+  static const struct
+  {
+    uint32_t    Format;
+    uint32_t    BytesPerPixel;
+    const char *pName;
+    uint32_t    Golden[sizeof(lines) / sizeof(lines[0])];
+  }formats[] =
+  {
+    {LTDC_PIXEL_FORMAT_ARGB8888, 4, "text_golden_argb8888",
+     {0x262CA7CBU, 0x72CD7021U, 0x53B8B412U, 0x4E74B085U, 0x56B4CD13U, 0x7FFD4525U}},
+    {LTDC_PIXEL_FORMAT_RGB565,   2, "text_golden_rgb565",
+     {0x4E5F8A35U, 0x878F3E7BU, 0x2D2DBF5CU, 0x1A6EEA37U, 0x1E5D5A28U, 0x02F67FF9U}},
+  };
+  const uint8_t *fb;
+  uint32_t errors = 0, f, i, stride, hash;
+
+  for(f = 0; f < sizeof(formats) / sizeof(formats[0]); f++)
+  {
+    LCD_LayerInit(0, LCD_FB_START_ADDRESS, formats[f].Format);
+    LCD_SelectLayer(0);
+    LCD_Clear(LCD_COLOR_BLACK);
+    for(i = 0; i < sizeof(lines) / sizeof(lines[0]); i++)
+    {
+      LCD_SetFont(lines[i].pFont);
+      LCD_SetColors(lines[i].TextColor, lines[i].BackColor);
+      LCD_DisplayStringAt(lines[i].X, lines[i].Y, (const uint8_t *)lines[i].pText, lines[i].Mode);
+    }
+    LCD_DMA2D_Flush();
+
+    fb = (const uint8_t *)(uintptr_t)LCD_GetDrawAddress(0);
+    stride = SIM_WIDTH * formats[f].BytesPerPixel;
+    for(i = 0; i < sizeof(lines) / sizeof(lines[0]); i++)
+    {
+      hash = SIM_Checksum(fb + lines[i].Y * stride, lines[i].pFont->Height * stride, 2166136261U);
+      if(hash != formats[f].Golden[i])
+      {
+        printf("%s line %lu: checksum 0x%08lX, expected 0x%08lX\n", formats[f].pName,
+               (unsigned long)i, (unsigned long)hash, (unsigned long)formats[f].Golden[i]);
+        errors++;
+      }
+    }
+    SIM_Report(formats[f].pName);
+  }
+  LCD_SetFont(&LCD_DEFAULT_FONT);
+  printf("text golden check: %lu errors\n", (unsigned long)errors);
+  Failures += errors;
+}
+
+/**
+  * @brief  FNV-1a校验和
+  * @param  pData: 数据
+  * @param  Size: 字节数
+  * @param  Hash: 初值，接着上一段计算时传入上一段的结果
+  * @retval 校验和
+  */
+static uint32_t SIM_Checksum(const uint8_t *pData, uint32_t Size, uint32_t Hash)
+{
+  uint32_t i;
+
+  for(i = 0; i < Size; i++)
+  {
+    Hash = (Hash ^ pData[i]) * 16777619U;
+  }
+  return Hash;
+}
+
+/**
+  * @brief  生成UTF-8语料：字频按Zipf分布(第r常用的字出现的概率与r的-1.2次方成正比)，
+  *         与现代汉语相近，最常用的一千字约占九成；字频排名与编码无关
+  * @param  pFont: 字体，语料中的字取自其编码表
+  * @param  Count: 字数
+  * @param  pSize: 输出语料的字节数
+  * @retval 以0结尾的语料，用free释放；内存不足时返回NULL
+  */
+static uint8_t *SIM_Corpus(const sFONT *pFont, uint32_t Count, uint32_t *pSize)
+{
+  uint32_t n = pFont->GlyphCount;
+  uint32_t seed = 12345;
+  uint32_t *rank;
+  double   *cdf, sum = 0.0, u;
+  uint8_t  *text, *p;
+  uint32_t i, j, lo, hi, code, tmp;
+
+  cdf  = (double *)malloc(n * sizeof(double));
+  rank = (uint32_t *)malloc(n * sizeof(uint32_t));
+  text = (uint8_t *)malloc(Count * 3U + 1U);
+  if((cdf == NULL) || (rank == NULL) || (text == NULL))
+  {
+    free(cdf);
+    free(rank);
+    free(text);
+    return NULL;
+  }
+
+  for(i = 0; i < n; i++)
+  {
+    sum += pow((double)(i + 1U), -1.2);
+    cdf[i] = sum;
+    rank[i] = i;
+  }
+  for(i = n - 1U; i > 0U; i--)
+  {
+    seed = seed * 1103515245U + 12345U;
+    j = (seed >> 8) % (i + 1U);
+    tmp = rank[i];
+    rank[i] = rank[j];
+    rank[j] = tmp;
+  }
+
+  p = text;
+  for(i = 0; i < Count; i++)
+  {
+    seed = seed * 1103515245U + 12345U;
+    u = ((double)(seed >> 8) / 16777216.0) * sum;
+    for(lo = 0, hi = n - 1U; lo < hi; )
+    {
+      j = (lo + hi) / 2U;
+      if(cdf[j] < u)
+      {
+        lo = j + 1U;
+      }
+      else
+      {
+        hi = j;
+      }
+    }
+    code = pFont->Codes[rank[lo]];
+    *p++ = (uint8_t)(0xE0U | (code >> 12));
+    *p++ = (uint8_t)(0x80U | ((code >> 6) & 0x3FU));
+    *p++ = (uint8_t)(0x80U | (code & 0x3FU));
+  }
+  *p = 0;
+  *pSize = (uint32_t)(p - text);
+
+  free(cdf);
+  free(rank);
+  return text;
+}
+
+/**
+  * @brief  读取单调时钟
+  * @retval 秒
+  */
+static double SIM_Seconds(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+/**
+  * @brief  测试图像：平滑渐变加上8像素的棋盘格
+  * @param  X, Y: 像素坐标
+  * @retval RGB888颜色
+  */
+static uint32_t SIM_JpegPixel(uint32_t X, uint32_t Y)
+{
+  uint32_t r = (X * 2U) & 0xFFU;
+  uint32_t g = ((Y * 3U) / 4U) & 0xFFU;
+  uint32_t b = ((((X >> 3) ^ (Y >> 3)) & 1U) != 0U) ? 200U : 40U;
+
+  return (r << 16) | (g << 8) | b;
+}
+
+/**
+  * @brief  分块读取测试文件
+  * @param  pArg: SIM_FileTypeDef
+  * @param  pBuffer: 输出缓冲区
+  * @param  Size: 最多读取的字节数
+  * @retval 读取的字节数
+  */
+static uint32_t SIM_JpegRead(void *pArg, uint8_t *pBuffer, uint32_t Size)
+{
+  SIM_FileTypeDef *file = (SIM_FileTypeDef *)pArg;
+
+  if(Size > file->Chunk)
+  {
+    Size = file->Chunk;
+  }
+  if(Size > file->Size - file->Offset)
+  {
+    Size = file->Size - file->Offset;
+  }
+  memcpy(pBuffer, file->pData + file->Offset, Size);
+  file->Offset += Size;
+  return Size;
+}
+
+/**
+  * @brief  比较层0中可见的图像像素与原图
+  * @note   色度抽样使颜色突变处误差较大，只比较亮度
+  * @param  pInfo: 图像信息
+  * @param  Xpos, Ypos: 图像在层中的位置
+  * @retval 最大亮度误差
+  */
+static uint32_t SIM_JpegCheck(const LCD_JPEG_InfoTypeDef *pInfo, int32_t Xpos, int32_t Ypos)
+{
+  const uint32_t *fb = (const uint32_t *)(uintptr_t)LCD_GetDrawAddress(0);
+  uint32_t x, y, expect, actual, error = 0;
+  int32_t  px, py, ye, ya, d;
+
+  for(y = 0; y < pInfo->Height; y++)
+  {
+    for(x = 0; x < pInfo->Width; x++)
+    {
+      px = Xpos + (int32_t)x;
+      py = Ypos + (int32_t)y;
+      if((px < 0) || (py < 0) || (px >= SIM_WIDTH) || (py >= SIM_HEIGHT))
+      {
+        continue;
+      }
+      expect = SIM_JpegPixel(x, y);
+      actual = fb[py * SIM_WIDTH + px];
+      ye = (int32_t)((19595U * ((expect >> 16) & 0xFFU) + 38470U * ((expect >> 8) & 0xFFU) + 7471U * (expect & 0xFFU)) >> 16);
+      ya = (int32_t)((19595U * ((actual >> 16) & 0xFFU) + 38470U * ((actual >> 8) & 0xFFU) + 7471U * (actual & 0xFFU)) >> 16);
+      d  = abs(ye - ya);
+      if((uint32_t)d > error)
+      {
+        error = (uint32_t)d;
+      }
+    }
+  }
+  return error;
+}
+
+/**
+  * @brief  RGB565双缓冲和三缓冲动画，每帧移动一个方块并翻转交换链，绘制一帧用去一帧的扫描时间
+  * @note   每次翻转后检查：提交的缓冲区是翻转前的后台缓冲区，新的后台缓冲区不是正在扫描的缓冲区；
+  *         双缓冲等到翻转生效才返回，每帧等待一次垂直消隐，帧率减半；三缓冲翻转后仍在扫描上一个
+  *         缓冲区，绘制期间翻转生效，不需要等待
+  * @retval 无
+  */
+static void SIM_SwapChain(void)
+{
+  static const char *const names[] = {"swapchain_double", "swapchain_triple"};
+  LCD_FrameStatsTypeDef frames;
+  uint32_t errors = 0, count, back, scanned, pending, presented, i;
+  uint16_t x;
+
+  for(count = 2; count <= 3U; count++)
+  {
+    LCD_LayerInit(0, LCD_FB_START_ADDRESS, LTDC_PIXEL_FORMAT_RGB565);
+    LCD_SwapChainInit(0, LCD_FB_START_ADDRESS, count);
+    LCD_SelectLayer(0);
+    for(i = 0; i < count; i++)
+    {
+      LCD_Clear(LCD_COLOR_DARKBLUE);
+      LCD_SwapBuffers();
+    }
+    LCD_Soft_VSync();
+    LCD_ResetFrameStats();
+    LCD_Soft_ResetStats();
+    presented = LCD_Soft_GetScanAddress(0);
+
+    for(i = 0; i < SIM_FRAMES; i++)
+    {
+      x = (uint16_t)(i * 10U);
+      LCD_SetTextColor(LCD_COLOR_DARKBLUE);
+      LCD_FillRect((x >= 10U) ? (uint16_t)(x - 10U) : 0U, 200, 10, 80);
+      LCD_SetTextColor(LCD_COLOR_ORANGE);
+      LCD_FillRect(x, 200, 80, 80);
+      LCD_DMA2D_Flush();
+      LCD_Soft_Advance(hltdc.Init.TotalHeigh + 1U);
+
+      /* 绘制期间上一次翻转已经生效 */
+      back    = LCD_GetDrawAddress(0);
+      scanned = LCD_Soft_GetScanAddress(0);
+      errors += ((back == scanned) || (scanned != presented) || (LCD_GetBackend()->ReloadPending() != 0U)) ? 1U : 0U;
+      LCD_SwapBuffers();
+      presented = back;
+
+      /* 提交的是原来的后台缓冲区 */
+      pending = LCD_GetBackend()->ReloadPending();
+      errors += (hltdc.LayerCfg[0].FBStartAdress != back) ? 1U : 0U;
+      errors += ((LCD_GetDrawAddress(0) == back) || (LCD_GetDrawAddress(0) == LCD_Soft_GetScanAddress(0))) ? 1U : 0U;
+      if(count == 2U)
+      {
+        /* 已生效，两个缓冲区互换 */
+        errors += ((pending != 0U) || (LCD_Soft_GetScanAddress(0) != back) || (LCD_GetDrawAddress(0) != scanned)) ? 1U : 0U;
+      }
+      else
+      {
+        /* 仍在扫描上一帧，下一次垂直消隐生效 */
+        errors += ((pending == 0U) || (LCD_Soft_GetScanAddress(0) != scanned)) ? 1U : 0U;
+      }
+    }
+
+    LCD_Soft_VSync();
+    LCD_GetFrameStats(&frames);
+    errors += ((frames.Frames != SIM_FRAMES) || (frames.VSyncWaits != ((count == 2U) ? SIM_FRAMES : 0U))) ? 1U : 0U;
+    printf("swapchain %lu buffers: %u frames presented, %u vsync waits, avg %u ms\n",
+           (unsigned long)count, frames.Frames, frames.VSyncWaits, frames.AvgFrameTime);
+    SIM_Report(names[count - 2U]);
+  }
+
+  printf("swapchain check: %lu errors\n", (unsigned long)errors);
+  Failures += errors;
+}
+
+/**
+  * @brief  交换时的脏区域复制：每帧画几条相互交叉的横条和竖条，交换后新的后台缓冲区必须与刚提交的画面相同，
+  *         统计的复制像素数必须等于最近几帧脏矩形并集的像素数，列表中的矩形互不重叠
+  * @retval 无
+  */
+static void SIM_Dirty(void)
+{
+  static uint8_t mask[SIM_WIDTH * SIM_HEIGHT];
+  static const uint32_t colors[] = {LCD_COLOR_RED, LCD_COLOR_GREEN, LCD_COLOR_YELLOW, LCD_COLOR_WHITE, LCD_COLOR_CYAN};
+  LCD_DirtyListTypeDef history[LCD_SWAPCHAIN_MAX_BUFFERS - 1U], current, stale;
+  LCD_DirtyStatsTypeDef stats;
+  const LCD_RectTypeDef *rect;
+  uint32_t errors = 0, seed = 31337, full = (uint32_t)SIM_WIDTH * SIM_HEIGHT;
+  uint32_t count, frame, bars, covered, saved, copied, i, j, k, x, y, w, h;
+
+  for(count = 2; count <= 3U; count++)
+  {
+    LCD_LayerInit(0, LCD_FB_START_ADDRESS, LTDC_PIXEL_FORMAT_ARGB8888);
+    LCD_SwapChainInit(0, LCD_FB_START_ADDRESS, count);
+    LCD_SelectLayer(0);
+    for(i = 0; i < (LCD_SWAPCHAIN_MAX_BUFFERS - 1U); i++)
+    {
+      LCD_Dirty_Clear(&history[i]);
+      LCD_Dirty_Add(&history[i], 0, 0, SIM_WIDTH, SIM_HEIGHT);
+    }
+    for(i = 0; i < SIM_WIDTH * SIM_HEIGHT; i++)
+    {
+      RasterRef[i] = LCD_COLOR_DARKBLUE;
+    }
+    LCD_ResetDirtyStats();
+    saved = copied = 0;
+
+    for(frame = 0; frame < SIM_FRAMES; frame++)
+    {
+      /* 第一帧清屏；之后每隔几帧不画任何东西，只需要复制前几帧的区域 */
+      if(frame == 0U)
+      {
+        LCD_Clear(LCD_COLOR_DARKBLUE);
+      }
+      seed = seed * 1103515245U + 12345U;
+      bars = ((frame % 7U) == 6U) ? 0U : 1U + (seed >> 16) % 6U;
+      for(k = 0; k < bars; k++)
+      {
+        seed = seed * 1103515245U + 12345U;
+        if((seed >> 30) & 1U)
+        {
+          w = 100U + (seed >> 4) % 500U;
+          h = 8U + (seed >> 12) % 32U;
+        }
+        else
+        {
+          w = 8U + (seed >> 4) % 32U;
+          h = 60U + (seed >> 12) % 300U;
+        }
+        seed = seed * 1103515245U + 12345U;
+        x = (seed >> 4) % (SIM_WIDTH - w);
+        y = (seed >> 16) % (SIM_HEIGHT - h);
+        LCD_SetTextColor(colors[(seed >> 28) % 5U]);
+        LCD_FillRect((uint16_t)x, (uint16_t)y, (uint16_t)w, (uint16_t)h);
+        for(j = y; j < y + h; j++)
+        {
+          for(i = x; i < x + w; i++)
+          {
+            RasterRef[j * SIM_WIDTH + i] = colors[(seed >> 28) % 5U];
+          }
+        }
+      }
+
+      /* 需要复制的区域：本帧和之前BufferCount-2帧的脏区域 */
+      current = *LCD_GetDirtyList(0);
+      stale = current;
+      for(i = 0; i < (count - 2U); i++)
+      {
+        LCD_Dirty_Merge(&stale, &history[i]);
+      }
+      for(i = LCD_SWAPCHAIN_MAX_BUFFERS - 2U; i > 0U; i--)
+      {
+        history[i] = history[i - 1U];
+      }
+      history[0] = current;
+
+      LCD_SwapBuffers();
+      LCD_DMA2D_Flush();
+
+      memset(mask, 0, sizeof(mask));
+      for(k = 0; k < stale.Count; k++)
+      {
+        rect = &stale.Rect[k];
+        for(j = rect->Y0; j < rect->Y1; j++)
+        {
+          memset(&mask[j * SIM_WIDTH + rect->X0], 1, rect->X1 - rect->X0);
+        }
+        for(i = k + 1U; i < stale.Count; i++)
+        {
+          errors += (LCD_Rect_Intersect(rect, &stale.Rect[i], NULL) != 0U) ? 1U : 0U;
+        }
+      }
+      for(covered = 0, i = 0; i < full; i++)
+      {
+        covered += mask[i];
+      }
+
+      LCD_GetDirtyStats(&stats);
+      errors += ((stats.LastCopiedPixels != covered) || (stats.LastSavedPixels != (full - covered))) ? 1U : 0U;
+      errors += (memcmp((const void *)(uintptr_t)LCD_GetDrawAddress(0), RasterRef, sizeof(RasterRef)) != 0) ? 1U : 0U;
+      saved  += full - covered;
+      copied += covered;
+    }
+
+    LCD_GetDirtyStats(&stats);
+    errors += ((stats.Frames != SIM_FRAMES) || (stats.TotalSavedPixels != saved)) ? 1U : 0U;
+    printf("dirty %lu buffers: %lu swaps, %lu pixels copied, %lu saved against full copies\n",
+           (unsigned long)count, (unsigned long)stats.Frames, (unsigned long)copied, (unsigned long)saved);
+  }
+
+  printf("dirty check: %lu errors\n", (unsigned long)errors);
+  Failures += errors;
+  LCD_Soft_ResetStats();
+}
+
+/**
+  * @brief  扫描线调度：在模拟的扫描线的不同位置提交复制和回调更新，提交时不能更新，
+  *         只能在行中断中更新；全部完成后显存和扫描输出的画面都与预期相同，没有撕裂
+  * @retval 无
+  */
+static void SIM_Scan(void)
+{
+  static SIM_ScanFillTypeDef fill;
+  LCD_ScanStatsTypeDef stats;
+  uint32_t *image, *expect;
+  const uint32_t *fb, *frame;
+  uint32_t errors = 0, seed = 2024, round, lines, dispatched, x, y, w, h, i;
+
+  image  = malloc((size_t)SIM_WIDTH * SIM_HEIGHT * 4U);
+  expect = malloc((size_t)SIM_WIDTH * SIM_HEIGHT * 4U);
+  if((image == NULL) || (expect == NULL))
+  {
+    printf("cannot allocate scan images\n");
+    Failures++;
+    free(image);
+    free(expect);
+    return;
+  }
+  for(i = 0; i < (uint32_t)SIM_WIDTH * SIM_HEIGHT; i++)
+  {
+    image[i] = 0xFF000000U | (i * 2654435761U >> 8);
+  }
+
+  LCD_LayerInit(0, LCD_FB_START_ADDRESS, LTDC_PIXEL_FORMAT_ARGB8888);
+  LCD_SetLayerVisible(1, DISABLE);
+  LCD_SelectLayer(0);
+  LCD_Clear(LCD_COLOR_BLACK);
+  LCD_DMA2D_Flush();
+  LCD_Soft_VSync();
+  fb = (const uint32_t *)(uintptr_t)LCD_GetDrawAddress(0);
+  memcpy(expect, fb, (size_t)SIM_WIDTH * SIM_HEIGHT * 4U);
+
+  if(LCD_Scan_Init(0) != HAL_OK)
+  {
+    printf("cannot init scan\n");
+    Failures++;
+    free(image);
+    free(expect);
+    return;
+  }
+  fill.Address = LCD_GetDrawAddress(0);
+
+  for(round = 0; round < SIM_SCAN_ROUNDS; round++)
+  {
+    /* 扫描线停在随机的位置，包括消隐期 */
+    seed = seed * 1103515245U + 12345U;
+    LCD_Soft_Advance((seed >> 8) % (hltdc.Init.TotalHeigh + 1U));
+
+    seed = seed * 1103515245U + 12345U;
+    w = 16U + (seed >> 8) % (SIM_WIDTH - 16U);
+    x = (seed >> 20) % (SIM_WIDTH - w + 1U);
+    seed = seed * 1103515245U + 12345U;
+    h = 1U + (seed >> 8) % SIM_HEIGHT;
+    y = (seed >> 20) % (SIM_HEIGHT - h + 1U);
+
+    if((round % 2U) == 0U)
+    {
+      LCD_Scan_GetStats(&stats);
+      dispatched = stats.Dispatched;
+      errors += (LCD_Scan_Copy(image + y * SIM_WIDTH + x, SIM_WIDTH * 4U, (uint16_t)x, (uint16_t)y,
+                               (uint16_t)w, (uint16_t)h) != HAL_OK) ? 1U : 0U;
+      for(lines = y; lines < y + h; lines++)
+      {
+        memcpy(expect + lines * SIM_WIDTH + x, image + lines * SIM_WIDTH + x, w * 4U);
+      }
+    }
+    else
+    {
+      /* 回调参数在更新完成前保持不变 */
+      while(LCD_Scan_Pending() != 0U)
+      {
+        LCD_Soft_Advance(1);
+      }
+      fill.X = (uint16_t)x;
+      fill.Width = (uint16_t)w;
+      fill.Color = 0xFF000000U | (round * 0x0A1B2CU);
+      LCD_Scan_GetStats(&stats);
+      dispatched = stats.Dispatched;
+      errors += (LCD_Scan_Update((uint16_t)y, (uint16_t)h, (uint16_t)w, SIM_ScanFill, &fill) != HAL_OK) ? 1U : 0U;
+      for(lines = y; lines < y + h; lines++)
+      {
+        for(i = x; i < x + w; i++)
+        {
+          expect[lines * SIM_WIDTH + i] = fill.Color;
+        }
+      }
+    }
+
+    /* 提交只设置行中断，不能在关中断时直接更新 */
+    LCD_Scan_GetStats(&stats);
+    errors += (stats.Dispatched != dispatched) ? 1U : 0U;
+  }
+
+  /* 所有条带最多等一帧多就能更新 */
+  for(lines = 0; (LCD_Scan_Pending() != 0U) && (lines < 3U * (hltdc.Init.TotalHeigh + 1U)); lines++)
+  {
+    LCD_Soft_Advance(1);
+  }
+  LCD_Soft_VSync();
+  LCD_Soft_VSync();
+
+  LCD_Scan_GetStats(&stats);
+  frame = LCD_Soft_GetFrame();
+  errors += ((LCD_Scan_Pending() != 0U) || (stats.Dispatched != stats.Submitted) ||
+             (stats.Tears != 0U) || (fill.Masked != 0U)) ? 1U : 0U;
+  errors += (memcmp(fb, expect, (size_t)SIM_WIDTH * SIM_HEIGHT * 4U) != 0) ? 1U : 0U;
+  errors += (memcmp(frame, expect, (size_t)SIM_WIDTH * SIM_HEIGHT * 4U) != 0) ? 1U : 0U;
+  printf("scan: %lu bands submitted, %lu dispatched in %lu line events, %lu deferred, %lu tears, max latency %lu lines\n",
+         (unsigned long)stats.Submitted, (unsigned long)stats.Dispatched, (unsigned long)stats.Events,
+         (unsigned long)stats.Deferred, (unsigned long)stats.Tears, (unsigned long)stats.MaxLatency);
+  printf("scan check: %lu errors\n", (unsigned long)errors);
+  Failures += errors;
+
+  free(image);
+  free(expect);
+  SIM_Report("scan");
+}
+
+/**
+  * @brief  扫描线调度的绘制回调，只用CPU写显存
+  * @param  pArg: SIM_ScanFillTypeDef
+  * @param  Y0, Y1: 行范围
+  * @retval 无
+  */
+static void SIM_ScanFill(void *pArg, uint16_t Y0, uint16_t Y1)
+{
+  SIM_ScanFillTypeDef *fill = (SIM_ScanFillTypeDef *)pArg;
+  uint32_t *row;
+  uint32_t x, y;
+
+  fill->Masked += (__get_PRIMASK() != 0U) ? 1U : 0U;
+  for(y = Y0; y < Y1; y++)
+  {
+    row = (uint32_t *)(uintptr_t)fill->Address + y * SIM_WIDTH;
+    for(x = fill->X; x < (uint32_t)fill->X + fill->Width; x++)
+    {
+      row[x] = fill->Color;
+    }
+  }
+}
+
+/**
+  * @brief  DMA2D命令队列：交替提交目标区域相互重叠的R2M、M2M和混合命令，随机地让DMA2D完成一条命令，
+  *         每次检查已完成的栅栏是按提交顺序连续的；全部完成后与每条命令都等待完成的同步执行结果逐像素比较
+  * @retval 无
+  */
+static void SIM_Dma2dQueue(void)
+{
+  static uint32_t fences[SIM_QUEUE_CMDS];
+  LCD_DMA2D_CmdTypeDef cmd;
+  LCD_DMA2D_StatsTypeDef stats;
+  uint32_t errors = 0, seed = 777, done = 0, completed, i, k;
+  double   start, seconds;
+
+  for(i = 0; i < SIM_QUEUE_SIZE * SIM_QUEUE_SIZE; i++)
+  {
+    QueueImage[0][i] = (((i * 2654435761U) >> 24) << 24) | (i * 40503U);
+  }
+  memset(QueueImage[1], 0, sizeof(QueueImage[1]));
+  memset(QueueImage[2], 0, sizeof(QueueImage[2]));
+
+  /* 同步参考 */
+  for(i = 0; i < SIM_QUEUE_CMDS; i++)
+  {
+    SIM_QueueCommand(i, QueueImage[2], &cmd);
+    LCD_DMA2D_Wait(LCD_DMA2D_Submit(&cmd));
+  }
+
+  /* Completed是队列建立以来的总数，不随统计清除 */
+  LCD_DMA2D_ResetStats();
+  LCD_DMA2D_GetStats(&stats);
+  completed = stats.Completed;
+  start = SIM_Seconds();
+  for(i = 0; i < SIM_QUEUE_CMDS; i++)
+  {
+    SIM_QueueCommand(i, QueueImage[1], &cmd);
+    fences[i] = LCD_DMA2D_Submit(&cmd);
+    errors += ((i > 0U) && (fences[i] != (fences[i - 1U] + 1U))) ? 1U : 0U;
+
+    seed = seed * 1103515245U + 12345U;
+    for(k = (seed >> 8) % 3U; k > 0U; k--)
+    {
+      LCD_GetBackend()->Dma2dPoll();
+    }
+
+    /* 已完成的命令是提交顺序的前缀 */
+    while((done <= i) && (LCD_DMA2D_IsDone(fences[done]) != 0U))
+    {
+      done++;
+    }
+    for(k = done + 1U; k <= i; k++)
+    {
+      errors += (LCD_DMA2D_IsDone(fences[k]) != 0U) ? 1U : 0U;
+    }
+  }
+  LCD_DMA2D_Flush();
+  seconds = SIM_Seconds() - start;
+
+  LCD_DMA2D_GetStats(&stats);
+  errors += ((stats.Submitted != SIM_QUEUE_CMDS) || ((stats.Completed - completed) != SIM_QUEUE_CMDS) || (stats.Errors != 0U)) ? 1U : 0U;
+  errors += (LCD_DMA2D_IsDone(fences[SIM_QUEUE_CMDS - 1U]) == 0U) ? 1U : 0U;
+  errors += (memcmp(QueueImage[1], QueueImage[2], sizeof(QueueImage[1])) != 0) ? 1U : 0U;
+  printf("dma2d queue: %lu commands in %.3f s, %.0f commands/s, max depth %lu, %lu full stalls\n",
+         (unsigned long)SIM_QUEUE_CMDS, seconds, SIM_QUEUE_CMDS / seconds,
+         (unsigned long)stats.MaxDepth, (unsigned long)stats.FullStalls);
+  printf("dma2d queue check: %lu errors\n", (unsigned long)errors);
+  Failures += errors;
+  LCD_Soft_ResetStats();
+}
+
+/**
+  * @brief  DMA2D寄存器缓存：同一随机命令流一边用DMA2D_ConfigOutput/ConfigInput/ConfigCLUT写一组寄存器桩，
+  *         一边用不带缓存的HAL_DMA2D_Init/HAL_DMA2D_ConfigLayer写另一组，每条命令之后两组寄存器必须相同，
+  *         包括CLUT加载留在PFCCR中的CS/CCM位；配置与上一次相同的次数必须等于统计中省去的次数
+  * @retval 无
+  */
+static void SIM_Dma2dCache(void)
+{
+  static const uint32_t modes[]   = {DMA2D_R2M, DMA2D_M2M, DMA2D_M2M_PFC, DMA2D_M2M_BLEND};
+  static const uint32_t outputs[] = {DMA2D_OUTPUT_ARGB8888, DMA2D_OUTPUT_RGB565, DMA2D_OUTPUT_ARGB4444};
+  static const uint32_t inputs[]  = {DMA2D_INPUT_ARGB8888, DMA2D_INPUT_RGB565, DMA2D_INPUT_L8, DMA2D_INPUT_A8, DMA2D_INPUT_A4};
+  static const uint32_t alphas[]  = {0x000000FFU, 0x00000080U, 0xFF00FF00U, 0x80FF0000U};
+  static uint32_t clut[256];
+  DMA2D_TypeDef regs[2];              /* 带缓存和不带缓存的寄存器桩 */
+  DMA2D_HandleTypeDef ref;
+  DMA2D_CLUTCfgTypeDef cfg;
+  DMA2D_CacheStatsTypeDef stats;
+  uint32_t out[3] = {0}, in[2][4] = {{0}};   /* 当前命令的输出配置和两个输入层配置 */
+  uint32_t last[3] = {0}, lastIn[2][4] = {{0}};
+  uint32_t valid = 0, validIn[2] = {0, 0};   /* 缓存中上一次的配置是否有效 */
+  uint32_t initSkips = 0, layerSkips = 0, outputCount = 0, layerCount = 0, clutLoads = 0;
+  uint32_t errors = 0, seed = 4242, i, k, l, n, r;
+
+  memset((void *)regs, 0, sizeof(regs));
+  memset(&ref, 0, sizeof(ref));
+  memset(&hdma2d, 0, sizeof(hdma2d));
+  hdma2d.Instance = &regs[0];
+  ref.Instance    = &regs[1];
+  /* 已初始化状态，HAL_DMA2D_Init不调用访问RCC的MSP函数 */
+  ref.State       = HAL_DMA2D_STATE_READY;
+  cfg.pCLUT       = (uint32_t *)(uintptr_t)LCD_DMA2D_Address(clut);
+
+  DMA2D_CacheInvalidate();
+  DMA2D_ResetCacheStats();
+  for(i = 0; i < SIM_CACHE_CMDS; i++)
+  {
+    seed = seed * 1103515245U + 12345U;
+    r = seed >> 4;
+
+    /* 偶尔加载CLUT，或者像直接调用HAL_DMA2D_Init之后那样使缓存失效 */
+    if((r % 32U) == 0U)
+    {
+      l = (r >> 5) & 1U;
+      cfg.CLUTColorMode = (r >> 6) & 1U;
+      cfg.Size          = (r >> 7) & 0xFFU;
+      DMA2D_ConfigCLUT(l, cfg.CLUTColorMode, cfg.Size);
+      HAL_DMA2D_CLUTStartLoad(&hdma2d, &cfg, l);
+      HAL_DMA2D_CLUTStartLoad(&ref, &cfg, l);
+      validIn[l] = 0;
+      clutLoads++;
+    }
+    else
+    {
+      if((r % 32U) == 1U)
+      {
+        DMA2D_CacheInvalidate();
+        valid = validIn[0] = validIn[1] = 0;
+      }
+
+      /* 界面绘制中相邻命令的配置大多相同，每部分只以1/4的概率改变 */
+      if((i == 0U) || (((r >> 5) & 3U) == 0U))
+      {
+        out[0] = modes[(r >> 7) % 4U];
+        out[1] = outputs[(r >> 9) % 3U];
+        out[2] = ((r >> 11) % 3U) * 16U;
+      }
+      for(l = 0; l < 2U; l++)
+      {
+        if((i == 0U) || (((r >> (13U + l * 2U)) & 3U) == 0U))
+        {
+          seed = seed * 1103515245U + 12345U;
+          in[l][0] = inputs[(seed >> 8) % 5U];
+          in[l][1] = ((seed >> 12) & 1U) * 8U;
+          in[l][2] = (seed >> 13) % 3U;
+          in[l][3] = alphas[(seed >> 16) % 4U];
+          if((in[l][0] != DMA2D_INPUT_A8) && (in[l][0] != DMA2D_INPUT_A4))
+          {
+            in[l][3] &= 0xFFU;
+          }
+        }
+      }
+
+      DMA2D_ConfigOutput(out[0], out[1], out[2]);
+      ref.Init.Mode         = out[0];
+      ref.Init.ColorMode    = out[1];
+      ref.Init.OutputOffset = out[2];
+      HAL_DMA2D_Init(&ref);
+      initSkips += ((valid != 0U) && (memcmp(last, out, sizeof(out)) == 0)) ? 1U : 0U;
+      memcpy(last, out, sizeof(out));
+      valid = 1;
+      outputCount++;
+
+      /* 与lcd_hw.c相同：R2M不用输入层，只有混合模式使用背景层 */
+      n = (out[0] == DMA2D_R2M) ? 0U : ((out[0] == DMA2D_M2M_BLEND) ? 2U : 1U);
+      for(k = 0; k < n; k++)
+      {
+        l = (k == 0U) ? DMA2D_FOREGROUND_LAYER : DMA2D_BACKGROUND_LAYER;
+        DMA2D_ConfigInput(l, in[l][0], in[l][1], in[l][2], in[l][3]);
+        ref.LayerCfg[l].InputColorMode = in[l][0];
+        ref.LayerCfg[l].InputOffset    = in[l][1];
+        ref.LayerCfg[l].AlphaMode      = in[l][2];
+        ref.LayerCfg[l].InputAlpha     = in[l][3];
+        HAL_DMA2D_ConfigLayer(&ref, l);
+        layerSkips += ((validIn[l] != 0U) && (memcmp(lastIn[l], in[l], sizeof(in[l])) == 0)) ? 1U : 0U;
+        memcpy(lastIn[l], in[l], sizeof(in[l]));
+        validIn[l] = 1;
+        layerCount++;
+      }
+    }
+
+    /* 命令完成：硬件清除启动位，HAL在中断中解锁 */
+    for(l = 0; l < 2U; l++)
+    {
+      CLEAR_BIT(regs[l].CR, DMA2D_CR_START);
+      CLEAR_BIT(regs[l].FGPFCCR, DMA2D_FGPFCCR_START);
+      CLEAR_BIT(regs[l].BGPFCCR, DMA2D_BGPFCCR_START);
+    }
+    hdma2d.State = ref.State = HAL_DMA2D_STATE_READY;
+    hdma2d.Lock  = ref.Lock  = HAL_UNLOCKED;
+
+    errors += (memcmp((const void *)&regs[0], (const void *)&regs[1], sizeof(regs[0])) != 0) ? 1U : 0U;
+  }
+
+  DMA2D_GetCacheStats(&stats);
+  errors += ((stats.OutputConfigs != outputCount) || (stats.InitSkipped != initSkips)) ? 1U : 0U;
+  errors += ((stats.LayerConfigs != layerCount) || (stats.LayerSkipped != layerSkips)) ? 1U : 0U;
+  errors += ((initSkips == 0U) || (layerSkips == 0U)) ? 1U : 0U;
+  printf("dma2d cache: %lu commands, %lu CLUT loads, %lu/%lu output and %lu/%lu layer configs skipped, %lu register writes\n",
+         (unsigned long)SIM_CACHE_CMDS, (unsigned long)clutLoads,
+         (unsigned long)stats.InitSkipped, (unsigned long)stats.OutputConfigs,
+         (unsigned long)stats.LayerSkipped, (unsigned long)stats.LayerConfigs, (unsigned long)stats.RegWrites);
+  printf("dma2d cache check: %lu errors\n", (unsigned long)errors);
+  Failures += errors;
+  memset(&hdma2d, 0, sizeof(hdma2d));
+}
+
+/**
+  * @brief  精灵的局部合成与整屏重绘比较：几个精灵移动、换图像、改透明度和叠加顺序、隐藏和移出屏幕，
+  *         背景也局部修改；每帧LCD_Sprite_Render的结果与按同样状态整屏合成的参考逐字节比较，
+  *         有变化的帧搬运的数据量必须少于整屏重绘
+  * @retval 无
+  */
+static void SIM_Sprite(void)
+{
+  static SIM_SpriteTypeDef sprites[SIM_SPRITES] =
+  {
+    {0, DMA2D_INPUT_RGB565,   2, 96, 40, 300, 200, 0, 0xFF, 1, 0},   /* 不透明，改透明度和隐藏 */
+    {0, DMA2D_INPUT_ARGB8888, 4, 96, 96, 10,  10,  1, 0xFF, 1, 0},   /* 圆形，斜向反弹 */
+    {0, DMA2D_INPUT_ARGB8888, 4, 64, 64, -40, 300, 2, 0xFF, 1, 0},   /* 半透明方格，水平移动并移出屏幕 */
+    {0, DMA2D_INPUT_ARGB8888, 4, 48, 48, 600, 100, 1, 0xFF, 1, 0},   /* 原地换图像，与精灵1的Z值相同 */
+  };
+  LCD_SpriteStatsTypeDef stats;
+  SIM_SpriteTypeDef *sp;
+  uint32_t errors = 0, saved = 0, frame, i, x, y, dx, dy;
+  int32_t  vx = 7, vy = 5;
+
+  LCD_LayerInit(0, LCD_FB_START_ADDRESS, LTDC_PIXEL_FORMAT_ARGB8888);
+  LCD_SelectLayer(0);
+  for(i = 0; i < SIM_WIDTH * SIM_HEIGHT; i++)
+  {
+    x = i % SIM_WIDTH;
+    y = i / SIM_WIDTH;
+    SpriteBack[i] = 0xFF000000U | ((x * 255U / SIM_WIDTH) << 16) | ((y * 255U / SIM_HEIGHT) << 8) | (((x ^ y) & 16U) ? 0x60U : 0x20U);
+  }
+  for(i = 0; i < SIM_SPRITE_SIZE * SIM_SPRITE_SIZE; i++)
+  {
+    x = i % SIM_SPRITE_SIZE;
+    y = i / SIM_SPRITE_SIZE;
+    dx = (x > 48U) ? (x - 48U) : (48U - x);
+    dy = (y > 48U) ? (y - 48U) : (48U - y);
+    ((uint16_t *)SpriteImage[0])[i] = (uint16_t)(0xF800U | (x << 5));
+    SpriteImage[1][i] = ((dx * dx + dy * dy) < 48U * 48U) ? (((255U - (dx * dx + dy * dy) / 10U) << 24) | 0x00FFFF00U) : 0U;
+    SpriteImage[2][i] = ((((x / 8U) ^ (y / 8U)) & 1U) != 0U) ? 0x80FF00FFU : 0xC00000FFU;
+    SpriteImage[3][i] = 0xFF00FF00U | (y << 3);
+    SpriteImage[4][i] = 0x8000FFFFU | (x << 19);
+  }
+
+  if(LCD_Sprite_Init(0, LCD_DMA2D_Address(SpriteBack)) != HAL_OK)
+  {
+    printf("cannot init sprites\n");
+    Failures++;
+    return;
+  }
+  for(i = 0; i < SIM_SPRITES; i++)
+  {
+    sp = &sprites[i];
+    sp->Address = LCD_DMA2D_Address(SpriteImage[i]);
+    sp->Id = LCD_Sprite_Create(sp->Address, sp->ColorMode, sp->Width, sp->Height);
+    if(sp->Id < 0)
+    {
+      printf("cannot create sprite %lu\n", (unsigned long)i);
+      Failures++;
+      return;
+    }
+    LCD_Sprite_SetZOrder(sp->Id, sp->Z);
+    LCD_Sprite_SetPosition(sp->Id, sp->X, sp->Y);
+    LCD_Sprite_SetVisible(sp->Id, ENABLE);
+  }
+  LCD_Sprite_ResetStats();
+
+  for(frame = 0; frame < SIM_FRAMES; frame++)
+  {
+    /* 精灵1斜向反弹 */
+    sp = &sprites[1];
+    if(((sp->X + vx) < 0) || ((sp->X + vx + sp->Width) > SIM_WIDTH))
+    {
+      vx = -vx;
+    }
+    if(((sp->Y + vy) < 0) || ((sp->Y + vy + sp->Height) > SIM_HEIGHT))
+    {
+      vy = -vy;
+    }
+    sp->X = (int16_t)(sp->X + vx);
+    sp->Y = (int16_t)(sp->Y + vy);
+
+    /* 精灵2水平移动，从左边出去后从右边进来 */
+    sp = &sprites[2];
+    sp->X = (int16_t)(sp->X + 11);
+    if(sp->X > SIM_WIDTH)
+    {
+      sp->X = (int16_t)-sp->Width;
+    }
+    sp->Z = (frame >= 30U) ? 0U : 2U;
+
+    sprites[0].Alpha   = (frame >= 20U) ? 0xC0U : 0xFFU;
+    sprites[0].Visible = ((frame >= 35U) && (frame < 45U)) ? 0U : 1U;
+    sprites[3].Address = LCD_DMA2D_Address(SpriteImage[((frame / 10U) & 1U) ? SIM_SPRITES : 3U]);
+
+    for(i = 0; i < SIM_SPRITES; i++)
+    {
+      sp = &sprites[i];
+      LCD_Sprite_SetPosition(sp->Id, sp->X, sp->Y);
+      LCD_Sprite_SetZOrder(sp->Id, sp->Z);
+      LCD_Sprite_SetAlpha(sp->Id, sp->Alpha);
+      LCD_Sprite_SetVisible(sp->Id, (sp->Visible != 0U) ? ENABLE : DISABLE);
+      LCD_Sprite_SetImage(sp->Id, sp->Address);
+    }
+    if(frame == 50U)
+    {
+      for(y = 400; y < 440U; y++)
+      {
+        for(x = 100; x < 500U; x++)
+        {
+          SpriteBack[y * SIM_WIDTH + x] = 0xFFFFFFFFU;
+        }
+      }
+      LCD_Sprite_Invalidate(100, 400, 400, 40);
+    }
+
+    LCD_Sprite_Render();
+    LCD_DMA2D_Flush();
+    LCD_Sprite_GetStats(&stats);
+    SIM_SpriteReference(sprites);
+    errors += (memcmp((const void *)(uintptr_t)LCD_GetDrawAddress(0), RasterRef, sizeof(RasterRef)) != 0) ? 1U : 0U;
+    /* 第一帧画整个背景，之后每帧都有精灵移动 */
+    if(frame > 0U)
+    {
+      errors += ((stats.LastBytes == 0U) || (stats.LastBytes >= stats.LastFullBytes)) ? 1U : 0U;
+      saved += stats.LastFullBytes - stats.LastBytes;
+    }
+  }
+
+  /* 没有变化的帧不搬运数据 */
+  LCD_Sprite_Render();
+  LCD_Sprite_GetStats(&stats);
+  errors += ((stats.LastBytes != 0U) || (stats.LastRects != 0U)) ? 1U : 0U;
+
+  printf("sprite: %lu frames, %lu bytes moved, %lu bytes saved against full redraws\n",
+         (unsigned long)stats.Frames, (unsigned long)stats.TotalBytes, (unsigned long)saved);
+  printf("sprite check: %lu errors\n", (unsigned long)errors);
+  Failures += errors;
+  for(i = 0; i < SIM_SPRITES; i++)
+  {
+    LCD_Sprite_Destroy(sprites[i].Id);
+  }
+  SIM_Report("sprite");
+}
+
+/**
+  * @brief  整屏重绘的参考：复制整个背景，再把可见的精灵按Z值(相同时按编号)裁剪后逐个混合到RasterRef
+  * @param  pSprites: SIM_SPRITES个精灵的状态
+  * @retval 无
+  */
+static void SIM_SpriteReference(const SIM_SpriteTypeDef *pSprites)
+{
+  LCD_DMA2D_CmdTypeDef cmd;
+  const SIM_SpriteTypeDef *sp;
+  int32_t  x0, y0, x1, y1;
+  uint32_t z, i;
+
+  memset(&cmd, 0, sizeof(cmd));
+  cmd.Mode         = DMA2D_M2M;
+  cmd.OutColorMode = DMA2D_OUTPUT_ARGB8888;
+  cmd.DstAddress   = LCD_DMA2D_Address(RasterRef);
+  cmd.FgAddress    = LCD_DMA2D_Address(SpriteBack);
+  cmd.FgColorMode  = DMA2D_INPUT_ARGB8888;
+  cmd.FgAlpha      = 0xFF;
+  cmd.Width        = SIM_WIDTH;
+  cmd.Height       = SIM_HEIGHT;
+  LCD_DMA2D_Wait(LCD_DMA2D_Submit(&cmd));
+
+  for(z = 0; z < 256U; z++)
+  {
+    for(i = 0; i < SIM_SPRITES; i++)
+    {
+      sp = &pSprites[i];
+      x0 = (sp->X < 0) ? 0 : sp->X;
+      y0 = (sp->Y < 0) ? 0 : sp->Y;
+      x1 = ((sp->X + sp->Width) > SIM_WIDTH) ? SIM_WIDTH : (sp->X + sp->Width);
+      y1 = ((sp->Y + sp->Height) > SIM_HEIGHT) ? SIM_HEIGHT : (sp->Y + sp->Height);
+      if((sp->Z != z) || (sp->Visible == 0U) || (sp->Alpha == 0U) || (x0 >= x1) || (y0 >= y1))
+      {
+        continue;
+      }
+
+      memset(&cmd, 0, sizeof(cmd));
+      cmd.Mode         = DMA2D_M2M_BLEND;
+      cmd.OutColorMode = DMA2D_OUTPUT_ARGB8888;
+      cmd.OutOffset    = SIM_WIDTH - (uint32_t)(x1 - x0);
+      cmd.DstAddress   = LCD_DMA2D_Address(RasterRef + y0 * SIM_WIDTH + x0);
+      cmd.FgAddress    = sp->Address + ((uint32_t)(y0 - sp->Y) * sp->Width + (uint32_t)(x0 - sp->X)) * sp->BytesPerPixel;
+      cmd.FgColorMode  = sp->ColorMode;
+      cmd.FgOffset     = sp->Width - (uint32_t)(x1 - x0);
+      cmd.FgAlphaMode  = DMA2D_COMBINE_ALPHA;
+      cmd.FgAlpha      = sp->Alpha;
+      cmd.BgAddress    = cmd.DstAddress;
+      cmd.BgColorMode  = DMA2D_INPUT_ARGB8888;
+      cmd.BgOffset     = cmd.OutOffset;
+      cmd.BgAlphaMode  = DMA2D_NO_MODIF_ALPHA;
+      cmd.BgAlpha      = 0xFF;
+      cmd.Width        = (uint16_t)(x1 - x0);
+      cmd.Height       = (uint16_t)(y1 - y0);
+      LCD_DMA2D_Wait(LCD_DMA2D_Submit(&cmd));
+    }
+  }
+}
+
+/**
+  * @brief  显示列表：同一个网格界面分别直接绘制、记录后重放和预光栅化后重放，
+  *         比较每帧的耗时和DMA2D命令数，三种方式的画面必须逐字节相同
+  * @retval 无
+  */
+static void SIM_DisplayList(void)
+{
+  static uint32_t words[4096];
+  LCD_DisplayListTypeDef list;
+  LCD_DMA2D_StatsTypeDef stats;
+  uint32_t errors = 0, calls, frame, cmds[3];
+  double   start, seconds[3];
+  const void *fb;
+
+  LCD_LayerInit(0, LCD_FB_START_ADDRESS, LTDC_PIXEL_FORMAT_ARGB8888);
+  LCD_SelectLayer(0);
+  fb = (const void *)(uintptr_t)LCD_GetDrawAddress(0);
+
+  /* 直接绘制 */
+  LCD_DMA2D_ResetStats();
+  start = SIM_Seconds();
+  for(frame = 0; frame < SIM_FRAMES; frame++)
+  {
+    calls = SIM_Grid(NULL);
+  }
+  LCD_DMA2D_Flush();
+  seconds[0] = SIM_Seconds() - start;
+  LCD_DMA2D_GetStats(&stats);
+  cmds[0] = stats.Submitted;
+  memcpy(RasterRef, fb, sizeof(RasterRef));
+
+  /* 记录后重放，重放前先把画面弄乱 */
+  LCD_DL_Init(&list, words, sizeof(words));
+  (void)SIM_Grid(&list);
+  errors += (list.Overflow != 0U) ? 1U : 0U;
+  LCD_Clear(LCD_COLOR_MAGENTA);
+  LCD_DMA2D_Flush();
+  LCD_DMA2D_ResetStats();
+  start = SIM_Seconds();
+  for(frame = 0; frame < SIM_FRAMES; frame++)
+  {
+    LCD_DL_Replay(&list);
+  }
+  LCD_DMA2D_Flush();
+  seconds[1] = SIM_Seconds() - start;
+  LCD_DMA2D_GetStats(&stats);
+  cmds[1] = stats.Submitted;
+  errors += (memcmp(fb, RasterRef, sizeof(RasterRef)) != 0) ? 1U : 0U;
+
+  /* 预光栅化，缓存放在层1显存之后 */
+  errors += (LCD_DL_Cache(&list, LCD_FB_START_ADDRESS + SIM_WIDTH * SIM_HEIGHT * 8U) != HAL_OK) ? 1U : 0U;
+  LCD_Clear(LCD_COLOR_MAGENTA);
+  LCD_DMA2D_Flush();
+  LCD_DMA2D_ResetStats();
+  start = SIM_Seconds();
+  for(frame = 0; frame < SIM_FRAMES; frame++)
+  {
+    LCD_DL_Replay(&list);
+  }
+  LCD_DMA2D_Flush();
+  seconds[2] = SIM_Seconds() - start;
+  LCD_DMA2D_GetStats(&stats);
+  cmds[2] = stats.Submitted;
+  errors += (memcmp(fb, RasterRef, sizeof(RasterRef)) != 0) ? 1U : 0U;
+  LCD_DL_DropCache(&list);
+
+  /* 合并后的命令少于直接绘制 */
+  errors += ((cmds[1] >= cmds[0]) || (cmds[2] >= cmds[1])) ? 1U : 0U;
+
+  printf("display list: %lu calls recorded to %lu words, %lu merged\n",
+         (unsigned long)calls, (unsigned long)list.Used, (unsigned long)list.Merged);
+  printf("display list: immediate %.1f us, replay %.1f us, cached %.1f us per frame; "
+         "%lu, %lu, %lu dma2d commands per frame\n",
+         seconds[0] * 1e6 / SIM_FRAMES, seconds[1] * 1e6 / SIM_FRAMES, seconds[2] * 1e6 / SIM_FRAMES,
+         (unsigned long)(cmds[0] / SIM_FRAMES), (unsigned long)(cmds[1] / SIM_FRAMES), (unsigned long)(cmds[2] / SIM_FRAMES));
+  printf("display list check: %lu errors\n", (unsigned long)errors);
+  Failures += errors;
+  SIM_Report("dlist");
+}
+
+/**
+  * @brief  网格界面：标题栏、按行分色的单元格、逐格画的网格线、状态圆点、行标签和45度折线，
+  *         与实际界面一样逐格调用，有大量可以合并的命令
+  * @param  pList: 记录到的显示列表，NULL时直接绘制
+  * @retval 绘图调用次数
+  */
+static uint32_t SIM_Grid(LCD_DisplayListTypeDef *pList)
+{
+  /* 显示列表只保存字符串指针 */
+  static const char *const labels[SIM_GRID_ROWS] =
+  {
+    "R00", "R01", "R02", "R03", "R04", "R05", "R06", "R07", "R08", "R09", "R10", "R11"
+  };
+  static const uint32_t band[] = {LCD_COLOR_DARKBLUE, LCD_COLOR_DARKGREEN, LCD_COLOR_DARKCYAN};
+  uint32_t calls = 0, r, c;
+  uint16_t x, y;
+
+  if(pList == NULL)
+  {
+    LCD_Clear(LCD_COLOR_DARKGRAY);
+    LCD_SetTextColor(LCD_COLOR_BLUE);
+    LCD_FillRect(0, 0, SIM_WIDTH, 40);
+    LCD_SetFont(&Font24);
+    LCD_SetColors(LCD_COLOR_WHITE, LCD_COLOR_BLUE);
+    LCD_DisplayStringAt(0, 8, (const uint8_t *)"Grid", CENTER_MODE);
+    LCD_SetFont(&Font16);
+  }
+  else
+  {
+    (void)LCD_DL_Clear(pList, LCD_COLOR_DARKGRAY);
+    (void)LCD_DL_SetTextColor(pList, LCD_COLOR_BLUE);
+    (void)LCD_DL_FillRect(pList, 0, 0, SIM_WIDTH, 40);
+    (void)LCD_DL_SetFont(pList, &Font24);
+    (void)LCD_DL_SetColors(pList, LCD_COLOR_WHITE, LCD_COLOR_BLUE);
+    (void)LCD_DL_DisplayStringAt(pList, 0, 8, (const uint8_t *)"Grid", CENTER_MODE);
+    (void)LCD_DL_SetFont(pList, &Font16);
+  }
+  calls += 7U;
+
+  /* 单元格：每格都设置颜色，同一行的格子相接 */
+  for(r = 0; r < SIM_GRID_ROWS; r++)
+  {
+    for(c = 0; c < SIM_GRID_COLS; c++)
+    {
+      x = (uint16_t)(60U + c * 36U);
+      y = (uint16_t)(60U + r * 30U);
+      if(pList == NULL)
+      {
+        LCD_SetTextColor(band[(r / 2U) % 3U]);
+        LCD_FillRect(x, y, 36, 30);
+      }
+      else
+      {
+        (void)LCD_DL_SetTextColor(pList, band[(r / 2U) % 3U]);
+        (void)LCD_DL_FillRect(pList, x, y, 36, 30);
+      }
+      calls += 2U;
+    }
+  }
+
+  /* 网格线：逐格画水平线，再逐格画垂直线 */
+  for(r = 0; r <= SIM_GRID_ROWS; r++)
+  {
+    for(c = 0; c < SIM_GRID_COLS; c++)
+    {
+      x = (uint16_t)(60U + c * 36U);
+      y = (uint16_t)(60U + r * 30U);
+      if(pList == NULL)
+      {
+        LCD_SetTextColor(LCD_COLOR_GRAY);
+        LCD_DrawHLine(x, y, 36);
+      }
+      else
+      {
+        (void)LCD_DL_SetTextColor(pList, LCD_COLOR_GRAY);
+        (void)LCD_DL_DrawHLine(pList, x, y, 36);
+      }
+      calls += 2U;
+    }
+  }
+  for(c = 0; c <= SIM_GRID_COLS; c++)
+  {
+    for(r = 0; r < SIM_GRID_ROWS; r++)
+    {
+      x = (uint16_t)(60U + c * 36U);
+      y = (uint16_t)(60U + r * 30U);
+      if(pList == NULL)
+      {
+        LCD_DrawVLine(x, y, 30);
+      }
+      else
+      {
+        (void)LCD_DL_DrawVLine(pList, x, y, 30);
+      }
+      calls++;
+    }
+  }
+
+  /* 行标签和状态圆点 */
+  for(r = 0; r < SIM_GRID_ROWS; r++)
+  {
+    y = (uint16_t)(60U + r * 30U);
+    if(pList == NULL)
+    {
+      LCD_SetColors(LCD_COLOR_WHITE, LCD_COLOR_DARKGRAY);
+      LCD_DisplayStringAt(8, (uint16_t)(y + 7U), (const uint8_t *)labels[r], LEFT_MODE);
+      LCD_SetTextColor((r & 1U) ? LCD_COLOR_RED : LCD_COLOR_GREEN);
+      LCD_FillCircle(SIM_WIDTH - 40U, (uint16_t)(y + 15U), 10);
+      LCD_DrawCircle(SIM_WIDTH - 40U, (uint16_t)(y + 15U), 13);
+    }
+    else
+    {
+      (void)LCD_DL_SetColors(pList, LCD_COLOR_WHITE, LCD_COLOR_DARKGRAY);
+      (void)LCD_DL_DisplayStringAt(pList, 8, (uint16_t)(y + 7U), (const uint8_t *)labels[r], LEFT_MODE);
+      (void)LCD_DL_SetTextColor(pList, (r & 1U) ? LCD_COLOR_RED : LCD_COLOR_GREEN);
+      (void)LCD_DL_FillCircle(pList, SIM_WIDTH - 40U, (uint16_t)(y + 15U), 10);
+      (void)LCD_DL_DrawCircle(pList, SIM_WIDTH - 40U, (uint16_t)(y + 15U), 13);
+    }
+    calls += 5U;
+  }
+
+  /* 首尾相接的45度折线 */
+  for(c = 0; c < 30U; c++)
+  {
+    x = (uint16_t)(60U + c * 12U);
+    if(pList == NULL)
+    {
+      LCD_SetTextColor(LCD_COLOR_YELLOW);
+      LCD_DrawLine(x, (uint16_t)(60U + c * 12U), (uint16_t)(x + 12U), (uint16_t)(72U + c * 12U));
+    }
+    else
+    {
+      (void)LCD_DL_SetTextColor(pList, LCD_COLOR_YELLOW);
+      (void)LCD_DL_DrawLine(pList, x, (uint16_t)(60U + c * 12U), (uint16_t)(x + 12U), (uint16_t)(72U + c * 12U));
+    }
+    calls += 2U;
+  }
+  return calls;
+}
+
+/**
+  * @brief  滚动曲线的负载：先按目标速率在两次LCD_Chart_Update之间写入几百个采样，不能丢弃采样；
+  *         再一次写入超过一屏的积压，检查跳过的采样和光标位置
+  * @retval 无
+  */
+static void SIM_Chart(void)
+{
+  static int16_t ring[SIM_CHART_RING];
+  static LCD_ChartTypeDef chart;
+  LCD_ChartStatsTypeDef stats;
+  uint32_t errors = 0, seed = 4242, pushed = 0, count, frame, i;
+  uint32_t samples, skipped, expect;
+  double   start, seconds;
+
+  LCD_LayerInit(0, LCD_FB_START_ADDRESS, LTDC_PIXEL_FORMAT_ARGB8888);
+  LCD_SelectLayer(0);
+  LCD_Clear(LCD_COLOR_BLACK);
+  if(LCD_Chart_Init(&chart, ring, SIM_CHART_RING, 0, 40, 40, 720, 400) != HAL_OK)
+  {
+    printf("cannot init chart\n");
+    Failures++;
+    return;
+  }
+  LCD_Chart_SetRange(&chart, -2048, 2047, SIM_CHART_SPC);
+
+  /* 目标速率：每帧采样数在平均值附近随机变化 */
+  seconds = 0;
+  for(frame = 0; frame < 10U * SIM_FRAMES; frame++)
+  {
+    seed = seed * 1103515245U + 12345U;
+    count = SIM_CHART_RATE / 2U + (seed >> 8) % SIM_CHART_RATE;
+    for(i = 0; i < count; i++, pushed++)
+    {
+      (void)LCD_Chart_Push(&chart, (int16_t)(1800.0 * sin(pushed * 0.01) + (int32_t)((seed >> (i % 16U)) & 0xFFU) - 128));
+    }
+    start = SIM_Seconds();
+    LCD_Chart_Update(&chart);
+    LCD_DMA2D_Flush();
+    seconds += SIM_Seconds() - start;
+    errors += SIM_ChartCheck(&chart);
+  }
+  LCD_Chart_GetStats(&chart, &stats);
+  errors += ((chart.Ring.Overruns != 0U) || (stats.Skipped != 0U) || (stats.Samples != pushed) ||
+             (stats.MaxBacklog >= SIM_CHART_RING)) ? 1U : 0U;
+  printf("chart: %lu samples in %lu updates, %.1f us per update, max backlog %lu, %lu overruns\n",
+         (unsigned long)stats.Samples, (unsigned long)stats.Updates, seconds * 1e6 / stats.Updates,
+         (unsigned long)stats.MaxBacklog, (unsigned long)chart.Ring.Overruns);
+
+  /* 积压超过一屏：按整列跳过最旧的采样，一次最多画一屏，光标照样前进 */
+  for(frame = 0; frame < 4U; frame++)
+  {
+    samples = stats.Samples;
+    skipped = stats.Skipped;
+    count = (uint32_t)chart.Width * SIM_CHART_SPC + 1U + frame * 7U + ((frame == 3U) ? 900U : 0U);
+    for(i = 0; i < count; i++, pushed++)
+    {
+      (void)LCD_Chart_Push(&chart, (int16_t)(1800.0 * sin(pushed * 0.01)));
+    }
+    LCD_Chart_Update(&chart);
+    errors += SIM_ChartCheck(&chart);
+    LCD_Chart_GetStats(&chart, &stats);
+
+    expect = ((count - (uint32_t)chart.Width * SIM_CHART_SPC + SIM_CHART_SPC - 1U) / SIM_CHART_SPC) * SIM_CHART_SPC;
+    errors += ((stats.Skipped - skipped) != expect) ? 1U : 0U;
+    errors += ((stats.Samples - samples) != (count - expect)) ? 1U : 0U;
+    errors += ((stats.Samples - samples) > (uint32_t)chart.Width * SIM_CHART_SPC) ? 1U : 0U;
+  }
+  LCD_DMA2D_Flush();
+  errors += (chart.Ring.Overruns != 0U) ? 1U : 0U;
+  printf("chart backlog: %lu samples skipped, cursor %u\n", (unsigned long)stats.Skipped, (unsigned)chart.Cursor);
+  printf("chart check: %lu errors\n", (unsigned long)errors);
+  Failures += errors;
+  SIM_Report("chart");
+}
+
+/**
+  * @brief  检查曲线的计数和光标一致：读出的采样都被处理或跳过，跳过的是整列，
+  *         光标位置等于画过和跳过的列数
+  * @param  pChart: 曲线
+  * @retval 不一致的项数
+  */
+static uint32_t SIM_ChartCheck(const LCD_ChartTypeDef *pChart)
+{
+  const LCD_ChartStatsTypeDef *stats = &pChart->Stats;
+  uint32_t errors = 0;
+
+  errors += (pChart->Ring.Tail != pChart->Ring.Head) ? 1U : 0U;
+  errors += ((stats->Samples + stats->Skipped) != pChart->Ring.Tail) ? 1U : 0U;
+  errors += ((stats->Skipped % pChart->SamplesPerColumn) != 0U) ? 1U : 0U;
+  errors += ((stats->Columns * pChart->SamplesPerColumn + pChart->Count) != stats->Samples) ? 1U : 0U;
+  errors += (pChart->Cursor != ((stats->Columns + stats->Skipped / pChart->SamplesPerColumn) % pChart->Width)) ? 1U : 0U;
+  return errors;
+}
+
+/**
+  * @brief  生成DMA2D队列测试的第Seed条命令：依次为填充、从源图像复制和把源图像混合到目标上，
+  *         区域随机，相互重叠
+  * @param  Seed: 命令序号
+  * @param  pDst: 目标缓冲区
+  * @param  pCmd: 输出命令
+  * @retval 无
+  */
+static void SIM_QueueCommand(uint32_t Seed, uint32_t *pDst, LCD_DMA2D_CmdTypeDef *pCmd)
+{
+  uint32_t r = (Seed + 1U) * 2654435761U;
+  uint32_t w = 1U + (r >> 4) % 64U;
+  uint32_t h = 1U + (r >> 12) % 64U;
+  uint32_t x = (r >> 18) % (SIM_QUEUE_SIZE - w);
+  uint32_t y = ((r >> 25) * 3U) % (SIM_QUEUE_SIZE - h);
+  uint32_t src = ((y + 7U) % (SIM_QUEUE_SIZE - h)) * SIM_QUEUE_SIZE + ((x + 13U) % (SIM_QUEUE_SIZE - w));
+
+  memset(pCmd, 0, sizeof(*pCmd));
+  pCmd->OutColorMode = DMA2D_OUTPUT_ARGB8888;
+  pCmd->OutOffset    = SIM_QUEUE_SIZE - w;
+  pCmd->DstAddress   = LCD_DMA2D_Address(pDst + y * SIM_QUEUE_SIZE + x);
+  pCmd->Width        = (uint16_t)w;
+  pCmd->Height       = (uint16_t)h;
+
+  switch(Seed % 3U)
+  {
+  case 0:
+    pCmd->Mode      = DMA2D_R2M;
+    pCmd->FgAddress = 0xFF000000U | (r >> 8);
+    break;
+
+  case 1:
+    pCmd->Mode        = DMA2D_M2M;
+    pCmd->FgAddress   = LCD_DMA2D_Address(QueueImage[0] + src);
+    pCmd->FgColorMode = DMA2D_INPUT_ARGB8888;
+    pCmd->FgOffset    = SIM_QUEUE_SIZE - w;
+    break;
+
+  default:
+    /* 背景就是目标，结果依赖之前写入该区域的命令 */
+    pCmd->Mode        = DMA2D_M2M_BLEND;
+    pCmd->FgAddress   = LCD_DMA2D_Address(QueueImage[0] + src);
+    pCmd->FgColorMode = DMA2D_INPUT_ARGB8888;
+    pCmd->FgOffset    = SIM_QUEUE_SIZE - w;
+    pCmd->FgAlphaMode = DMA2D_COMBINE_ALPHA;
+    pCmd->FgAlpha     = r & 0xFFU;
+    pCmd->BgAddress   = pCmd->DstAddress;
+    pCmd->BgColorMode = DMA2D_INPUT_ARGB8888;
+    pCmd->BgOffset    = SIM_QUEUE_SIZE - w;
+    pCmd->BgAlphaMode = DMA2D_NO_MODIF_ALPHA;
+    break;
+  }
+}
+
+/**
+  * @brief  在普通内存上检验SDRAM分配器：区域分配器的对齐和复位、内存池的块数和无效释放、
+  *         TLSF的随机分配释放(每块填入编号，释放时核对，定期检查块链)，输出每次操作的平均时间
+  * @retval 无
+  */
+static void SIM_Heap(void)
+{
+  static uint8_t  *live[SIM_HEAP_LIVE];
+  static uint32_t size[SIM_HEAP_LIVE];
+  MEM_ArenaTypeDef arena;
+  MEM_PoolTypeDef  pool;
+  MEM_TlsfTypeDef  heap;
+  uint8_t  *region, *p, *q;
+  uint32_t errors = 0, seed = 12345, count, mark, i, k, n, bytes, avail, largest, checks = 0;
+  double   start, t = 0.0, total = 0.0;
+
+  region = malloc(SIM_HEAP_SIZE + 8U);
+  if(region == NULL)
+  {
+    printf("cannot allocate heap region\n");
+    Failures++;
+    return;
+  }
+
+  memset(region, 0, SIM_HEAP_SIZE + 8U);
+
+  /* 区域分配器：不对齐的起始地址，各种对齐，Mark/Release，空间不足 */
+  MEM_Arena_Init(&arena, region + 3, 1000);
+  errors += ((arena.Stats.Size % MEM_ALIGN) != 0U) ? 1U : 0U;
+  p = MEM_Arena_Alloc(&arena, 10, 0);
+  q = MEM_Arena_Alloc(&arena, 100, 64);
+  errors += ((((uintptr_t)p % MEM_ALIGN) != 0U) || (((uintptr_t)q % 64U) != 0U) || (q < (p + 10))) ? 1U : 0U;
+  mark = MEM_Arena_Mark(&arena);
+  errors += (MEM_Arena_Alloc(&arena, 500, 0) == NULL) ? 1U : 0U;
+  errors += (MEM_Arena_Alloc(&arena, 500, 0) != NULL) ? 1U : 0U;
+  errors += (MEM_Arena_Alloc(&arena, 8, 3) != NULL) ? 1U : 0U;
+  MEM_Arena_Release(&arena, mark);
+  errors += (MEM_Arena_Alloc(&arena, 500, 0) == NULL) ? 1U : 0U;
+  bytes = arena.Stats.HighWater;
+  MEM_Arena_Reset(&arena);
+  errors += ((arena.Stats.Used != 0U) || (arena.Stats.HighWater != bytes) || (arena.Stats.Failures != 2U)) ? 1U : 0U;
+  errors += (MEM_Arena_Alloc(&arena, arena.Stats.Size, 0) != arena.Base) ? 1U : 0U;
+  printf("heap arena: size %lu, peak %lu, %lu failures\n", (unsigned long)arena.Stats.Size,
+         (unsigned long)arena.Stats.HighWater, (unsigned long)arena.Stats.Failures);
+
+  /* 内存池：分配完所有块，地址各不相同，释放一半再分配，无效地址不释放 */
+  count = MEM_Pool_Init(&pool, region + 1, 100000, 100);
+  errors += ((pool.BlockSize != 104U) || (count != (99992U / 104U))) ? 1U : 0U;
+  for(i = 0; i < count; i++)
+  {
+    live[i] = MEM_Pool_Alloc(&pool);
+    errors += ((live[i] == NULL) || (live[i] != (pool.Base + i * pool.BlockSize))) ? 1U : 0U;
+    memset(live[i], (int)i, pool.BlockSize);
+  }
+  errors += (MEM_Pool_Alloc(&pool) != NULL) ? 1U : 0U;
+  for(i = 0; i < count; i += 2U)
+  {
+    MEM_Pool_Free(&pool, live[i]);
+  }
+  MEM_Pool_Free(&pool, live[1] + 8);
+  MEM_Pool_Free(&pool, region + SIM_HEAP_SIZE);
+  for(i = 1; i < count; i += 2U)
+  {
+    errors += (live[i][pool.BlockSize - 1U] != (uint8_t)i) ? 1U : 0U;
+  }
+  for(i = 0; i < count; i += 2U)
+  {
+    errors += (MEM_Pool_Alloc(&pool) == NULL) ? 1U : 0U;
+  }
+  errors += ((pool.Stats.Used != pool.Stats.Size) || (pool.Stats.Failures != 3U)) ? 1U : 0U;
+  printf("heap pool: %lu blocks of %lu bytes, peak %lu, %lu failures\n", (unsigned long)count,
+         (unsigned long)pool.BlockSize, (unsigned long)pool.Stats.HighWater, (unsigned long)pool.Stats.Failures);
+
+  /* TLSF：大小按对数均匀分布在1~64K之间，随机选择分配或释放 */
+  if(MEM_TLSF_Init(&heap, region + 5, SIM_HEAP_SIZE) != HAL_OK)
+  {
+    printf("cannot init tlsf\n");
+    Failures++;
+    free(region);
+    return;
+  }
+  memset(live, 0, sizeof(live));
+  n = 0;
+  for(i = 0; i < SIM_HEAP_OPS; i++)
+  {
+    seed = seed * 1103515245U + 12345U;
+    k = (seed >> 8) % SIM_HEAP_LIVE;
+    start = SIM_Seconds();
+    if(live[k] == NULL)
+    {
+      seed = seed * 1103515245U + 12345U;
+      bytes = 1U + ((1U << ((seed >> 8) % 16U)) - 1U) + ((seed >> 4) & 0xFU);
+      live[k] = MEM_TLSF_Alloc(&heap, bytes);
+      t = SIM_Seconds() - start;
+      if(live[k] != NULL)
+      {
+        size[k] = bytes;
+        errors += ((((uintptr_t)live[k] % MEM_ALIGN) != 0U) || (MEM_TLSF_BlockSize(&heap, live[k]) < bytes)) ? 1U : 0U;
+        memset(live[k], (int)k, bytes);
+        n++;
+      }
+    }
+    else
+    {
+      for(bytes = 0; bytes < size[k]; bytes++)
+      {
+        errors += (live[k][bytes] != (uint8_t)k) ? 1U : 0U;
+      }
+      start = SIM_Seconds();
+      MEM_TLSF_Free(&heap, live[k]);
+      t = SIM_Seconds() - start;
+      live[k] = NULL;
+      n--;
+    }
+    total += t;
+    if((i % 50000U) == 0U)
+    {
+      errors += (MEM_TLSF_Check(&heap, NULL, NULL) != HAL_OK) ? 1U : 0U;
+      checks++;
+    }
+  }
+  errors += (MEM_TLSF_Check(&heap, &avail, &largest) != HAL_OK) ? 1U : 0U;
+  printf("heap tlsf: %lu ops, %lu live, peak %lu of %lu bytes, %lu failures, avail %lu largest %lu, "
+         "%.0f ns per op\n",
+         (unsigned long)SIM_HEAP_OPS, (unsigned long)n, (unsigned long)heap.Stats.HighWater,
+         (unsigned long)heap.Stats.Size, (unsigned long)heap.Stats.Failures, (unsigned long)avail,
+         (unsigned long)largest, total / SIM_HEAP_OPS * 1e9);
+
+  /* 全部释放后合并成一块，但按大小类上界查找，不能一次分配整个区域；重复释放和区域外的地址不释放 */
+  for(k = 0; k < SIM_HEAP_LIVE; k++)
+  {
+    MEM_TLSF_Free(&heap, live[k]);
+  }
+  bytes = heap.Stats.Failures;
+  p = MEM_TLSF_Alloc(&heap, 100);
+  MEM_TLSF_Free(&heap, p);
+  MEM_TLSF_Free(&heap, p);
+  MEM_TLSF_Free(&heap, region);
+  errors += (heap.Stats.Failures != (bytes + 2U)) ? 1U : 0U;
+  errors += ((MEM_TLSF_Check(&heap, &avail, &largest) != HAL_OK) || (avail != heap.Stats.Size) ||
+             (largest != heap.Stats.Size) || (heap.Stats.Used != 0U)) ? 1U : 0U;
+  errors += ((MEM_TLSF_Alloc(&heap, heap.Stats.Size) != NULL) || (MEM_TLSF_Alloc(&heap, heap.Stats.Size / 2U) == NULL)) ? 1U : 0U;
+  printf("heap check: %lu errors, %lu consistency checks\n", (unsigned long)errors, (unsigned long)checks + 2U);
+  Failures += errors;
+
+  free(region);
+}
+
+/**
+  * @brief  用时序模型检验SDRAM_Tune：从MX_FMC_Init的配置开始搜索，结果必须在模型中稳定、
+  *         各时序在最小值和最小值加余量之间、选项组合最快，并且已经应用；不随机出错时结果和应用、失败的次数
+  *         与推算的相同；原配置不稳定时必须放弃并恢复原配置
+  * @retval 无
+  */
+static void SIM_SdramTune(void)
+{
+  /* MX_FMC_Init中的时序：CAS 3，关闭突发读，流水线延迟0，模式寄存器突发长度2 */
+  static const SDRAM_ConfigTypeDef baseline = {{2, 9, 6, 8, 3, 3, 3}, 3, 0, 0, 2};
+  static const SDRAM_ConfigTypeDef expect   = {{2, 9, 5, 7, 3, 3, 3}, 2, 1, 1, 2};
+  SDRAM_ModelTypeDef model = {{0, 0, 4, 6, 2, 2, 2}, 2, 3, 2, 16384};
+  SDRAM_TuneResultTypeDef result;
+  SDRAM_ConfigTypeDef config;
+  uint32_t errors = 0, applied = 0, failed = 0;
+  uint32_t run, i, limit, cas, pipe, burst, length;
+  uint8_t index;
+
+  for(run = 0; run < SIM_TUNE_RUNS; run++)
+  {
+    SDRAM_Model_Init(&model, &baseline, run + 1U);
+    errors += (SDRAM_Tune(&SDRAM_ModelOps, &baseline, &result) != HAL_OK) ? 1U : 0U;
+    errors += ((SDRAM_Model_IsStable(&result.Best) == 0U) ||
+               (memcmp(SDRAM_Model_Current(), &result.Best, sizeof(result.Best)) != 0)) ? 1U : 0U;
+    errors += ((result.Best.CASLatency != 2U) || (result.Best.ReadPipeDelay != 1U) || (result.Best.ReadBurst != 1U)) ? 1U : 0U;
+    errors += ((result.Best.Timing[SDRAM_TMRD] != baseline.Timing[SDRAM_TMRD]) ||
+               (result.Best.Timing[SDRAM_TXSR] != baseline.Timing[SDRAM_TXSR])) ? 1U : 0U;
+    for(index = SDRAM_TRAS; index <= SDRAM_TRCD; index++)
+    {
+      limit = model.Minimum[index] + 1U + SDRAM_TUNE_MARGIN;
+      limit = (limit < baseline.Timing[index]) ? limit : baseline.Timing[index];
+      errors += ((result.Best.Timing[index] < model.Minimum[index]) || (result.Best.Timing[index] > limit)) ? 1U : 0U;
+    }
+    errors += ((result.BestCycles >= result.BaselineCycles) ||
+               (result.BestCycles != SDRAM_Model_Cycles(&result.Best))) ? 1U : 0U;
+
+    /* 同样的时序下，没有更快的稳定选项组合 */
+    config = result.Best;
+    for(cas = 1; cas <= 3U; cas++)
+    {
+      for(pipe = 0; pipe <= 2U; pipe++)
+      {
+        for(burst = 0; burst <= 1U; burst++)
+        {
+          for(length = 1; length <= SDRAM_TUNE_MAX_BURST; length <<= 1)
+          {
+            config.CASLatency = (uint8_t)cas;
+            config.ReadPipeDelay = (uint8_t)pipe;
+            config.ReadBurst = (uint8_t)burst;
+            config.BurstLength = (uint8_t)length;
+            errors += ((SDRAM_Model_IsStable(&config) != 0U) &&
+                       (SDRAM_Model_Cycles(&config) < result.BestCycles)) ? 1U : 0U;
+          }
+        }
+      }
+    }
+    applied += result.Applied;
+    failed += result.Failed;
+  }
+
+  printf("sdram tune: %lu runs, %lu configs applied, %lu failed, reference load %lu -> %lu cycles\n",
+         (unsigned long)SIM_TUNE_RUNS, (unsigned long)(applied / SIM_TUNE_RUNS), (unsigned long)(failed / SIM_TUNE_RUNS),
+         (unsigned long)result.BaselineCycles, (unsigned long)result.BestCycles);
+  SDRAM_Tune_Print(&result.Best);
+
+  /* 不随机出错时结果确定：时序为最小值加余量，TWR/TRP/TRCD受原配置限制；
+   * 36种选项组合中CAS 1、CAS 2无流水线延迟的16种不稳定，各应用一次并失败；
+   * 其余20种各应用13次(起点1次，逐个减小TRAS/TRC各3次、TRCD/TRP各2次、TWR 1次，加余量后1次)，
+   * 其中减到最小值以下的4次失败；再加上原配置和最终配置各一次 */
+  model.FlakeRate = 0U;
+  SDRAM_Model_Init(&model, &baseline, 1U);
+  errors += (SDRAM_Tune(&SDRAM_ModelOps, &baseline, &result) != HAL_OK) ? 1U : 0U;
+  errors += (memcmp(&result.Best, &expect, sizeof(expect)) != 0) ? 1U : 0U;
+  errors += (memcmp(SDRAM_Model_Current(), &expect, sizeof(expect)) != 0) ? 1U : 0U;
+  errors += ((result.Candidates != 20U) || (result.Applied != (1U + 16U + 20U * 13U + 1U)) ||
+             (result.Failed != (16U + 20U * 4U))) ? 1U : 0U;
+  errors += ((result.BaselineCycles != SDRAM_Model_Cycles(&baseline)) ||
+             (result.BestCycles != SDRAM_Model_Cycles(&expect))) ? 1U : 0U;
+  printf("sdram tune exact: %lu configs applied, %lu failed, %lu candidates\n",
+         (unsigned long)result.Applied, (unsigned long)result.Failed, (unsigned long)result.Candidates);
+
+  /* 原配置的TRCD比模型的最小值小 */
+  model.Minimum[SDRAM_TRCD] = 4U;
+  SDRAM_Model_Init(&model, &baseline, 1U);
+  errors += (SDRAM_Tune(&SDRAM_ModelOps, &baseline, &result) != HAL_ERROR) ? 1U : 0U;
+  errors += (memcmp(SDRAM_Model_Current(), &baseline, sizeof(baseline)) != 0) ? 1U : 0U;
+  errors += (memcmp(&result.Best, &baseline, sizeof(baseline)) != 0) ? 1U : 0U;
+
+  /* FMC_SDTR的约束 */
+  config = baseline;
+  config.Timing[SDRAM_TWR] = 1U;
+  errors += (SDRAM_Tune_IsLegal(&config) != 0U) ? 1U : 0U;
+  config = baseline;
+  config.Timing[SDRAM_TRCD] = 17U;
+  errors += (SDRAM_Tune_IsLegal(&config) != 0U) ? 1U : 0U;
+  config = baseline;
+  config.BurstLength = 3U;
+  errors += (SDRAM_Tune_IsLegal(&config) != 0U) ? 1U : 0U;
+  for(i = 0; i < SDRAM_TIMINGS; i++)
+  {
+    config = baseline;
+    config.Timing[i] = 0U;
+    errors += (SDRAM_Tune_IsLegal(&config) != 0U) ? 1U : 0U;
+  }
+  printf("sdram tune check: %lu errors\n", (unsigned long)errors);
+  Failures += errors;
+}
@@ -0,0 +1,195 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+读取GNU ld的map文件，报告各存储器区域的占用，以及放进ITCM/DTCM/SDRAM的代码和数据。
+
+用法:
+    python3 Tools/mapreport.py build/rock_lcd.map [--top N] [--section NAME ...]
+
+    --top N        另外列出每个区域中最大的N个输入段，默认0(不列出)
+    --section NAME 逐项列出的输出段，可重复，默认为.itcm_text .dtcm_data .dtcm_bss .sdram_bss
+
+FLASH的占用包括.data、.itcm_text、.dtcm_data等段的加载映像；名称含bss或heap的段不占FLASH。
+"""
+import argparse
+import re
+import sys
+
+DEFAULT_SECTIONS = ['.itcm_text', '.dtcm_data', '.dtcm_bss', '.sdram_bss']
+
+# 不占用存储器的段
+NON_ALLOC = ('.debug', '.comment', '.ARM.attributes', '.stab', '.note', '.gnu.attributes')
+
+RE_REGION = re.compile(r'^(\S+)\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)')
+RE_OUTPUT = re.compile(r'^(\S+)?\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)(?:\s+load address 0x([0-9a-fA-F]+))?\s*$')
+RE_INPUT = re.compile(r'^ (\S+)?\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)\s+(\S.*)$')
+RE_SYMBOL = re.compile(r'^\s+0x([0-9a-fA-F]+)\s+([A-Za-z_][\w.$]*)\s*$')
+
+
+class Section:
+    def __init__(self, name, address, size, load):
+        self.name = name
+        self.address = address
+        self.size = size
+        self.load = load
+        self.inputs = []
+
+
+class Input:
+    def __init__(self, name, address, size, origin):
+        self.name = name
+        self.address = address
+        self.size = size
+        self.origin = origin
+        self.symbols = []
+
+
+def parse(lines):
+    regions = []
+    sections = []
+    i = 0
+    while i < len(lines) and not lines[i].startswith('Memory Configuration'):
+        i += 1
+    while i < len(lines) and not lines[i].startswith('Linker script and memory map'):
+        m = RE_REGION.match(lines[i])
+        if m and m.group(1) not in ('Name', '*default*'):
+            regions.append((m.group(1), int(m.group(2), 16), int(m.group(3), 16)))
+        i += 1
+
+    section = None
+    pending = None      # 名称太长、地址在下一行的输出段或输入段
+    for line in lines[i:]:
+        if line.startswith('LOAD ') or line.startswith('OUTPUT('):
+            continue
+        if line and not line[0].isspace():
+            m = RE_OUTPUT.match(line)
+            if m and m.group(1):
+                section = new_section(m.group(1), m, sections)
+                pending = None
+            else:
+                pending = ('output', line.strip())
+            continue
+        if pending and pending[0] == 'output':
+            m = RE_OUTPUT.match(line)
+            pending_name = pending[1]
+            pending = None
+            if m and not m.group(1):
+                section = new_section(pending_name, m, sections)
+                continue
+        if section is None:
+            continue
+        m = RE_INPUT.match(line)
+        if m and m.group(1):
+            add_input(section, m.group(1), m)
+            pending = None
+            continue
+        if m and pending and pending[0] == 'input':
+            add_input(section, pending[1], m)
+            pending = None
+            continue
+        stripped = line.strip()
+        if line.startswith(' ') and not line.startswith('  ') and stripped and ' ' not in stripped:
+            if stripped.startswith('*'):
+                continue
+            pending = ('input', stripped)
+            continue
+        m = RE_SYMBOL.match(line)
+        if m and section.inputs and '=' not in line:
+            section.inputs[-1].symbols.append(m.group(2))
+    return regions, sections
+
+
+def new_section(name, m, sections):
+    section = Section(name, int(m.group(2), 16), int(m.group(3), 16),
+                      int(m.group(4), 16) if m.group(4) else None)
+    if not name.startswith(NON_ALLOC) and name != '/DISCARD/':
+        sections.append(section)
+    return section
+
+
+def add_input(section, name, m):
+    origin = m.group(4).strip()
+    if name == '*fill*':
+        origin = '(fill)'
+    section.inputs.append(Input(name, int(m.group(2), 16), int(m.group(3), 16), origin))
+
+
+def region_of(regions, address):
+    for name, origin, length in regions:
+        if origin <= address < origin + length:
+            return name
+    return None
+
+
+def loaded(section):
+    return 'bss' not in section.name and 'heap' not in section.name
+
+
+def short(origin):
+    # 库成员显示为 库名(目标文件)，其余只保留文件名
+    m = re.match(r'.*/([^/]+\.a)\((.*)\)$', origin)
+    if m:
+        return '%s(%s)' % (m.group(1), m.group(2))
+    return origin.rsplit('/', 1)[-1]
+
+
+def report(regions, sections, detail, top, out):
+    used = {name: 0 for name, _, _ in regions}
+    for s in sections:
+        if s.size == 0:
+            continue
+        region = region_of(regions, s.address)
+        if region:
+            used[region] += s.size
+        if s.load is not None and s.load != s.address and loaded(s):
+            region = region_of(regions, s.load)
+            if region:
+                used[region] += s.size
+
+    out.write('%-10s %10s %10s %10s %10s %6s\n' % ('region', 'origin', 'size', 'used', 'free', 'use'))
+    for name, origin, length in regions:
+        out.write('%-10s 0x%08x %10d %10d %10d %5.1f%%\n'
+                  % (name, origin, length, used[name], length - used[name], 100.0 * used[name] / length))
+
+    for s in sections:
+        if s.name not in detail:
+            continue
+        out.write('\n%s -> %s 0x%08x, %d bytes' % (s.name, region_of(regions, s.address) or '?', s.address, s.size))
+        if s.load is not None and s.load != s.address and loaded(s):
+            out.write(', loaded from 0x%08x' % s.load)
+        out.write('\n')
+        for item in s.inputs:
+            if item.size == 0 or item.name == '*fill*':
+                continue
+            out.write('  %8d  %-48s %s\n' % (item.size, short(item.origin), ' '.join(item.symbols)))
+
+    if top > 0:
+        for name, _, _ in regions:
+            items = [(item, s) for s in sections if region_of(regions, s.address) == name
+                     for item in s.inputs if item.name != '*fill*' and item.size]
+            if not items:
+                continue
+            items.sort(key=lambda x: -x[0].size)
+            out.write('\nlargest in %s\n' % name)
+            for item, s in items[:top]:
+                label = ' '.join(item.symbols) or item.name
+                out.write('  %8d  %-12s %-40s %s\n' % (item.size, s.name, short(item.origin), label))
+
+
+def main():
+    parser = argparse.ArgumentParser(description='report memory placement from a GNU ld map file')
+    parser.add_argument('map')
+    parser.add_argument('--top', type=int, default=0)
+    parser.add_argument('--section', action='append')
+    args = parser.parse_args()
+
+    with open(args.map, encoding='utf-8', errors='replace') as f:
+        lines = f.read().splitlines()
+    regions, sections = parse(lines)
+    if not regions:
+        sys.exit('%s: no Memory Configuration, not a GNU ld map file' % args.map)
+    report(regions, sections, args.section or DEFAULT_SECTIONS, args.top, sys.stdout)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,456 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+把TrueType字体光栅化为lcd_font.h使用的A4/A8抗锯齿点阵字体(sFONT)。
+
+只依赖Python标准库：解析glyf轮廓，二次贝塞尔曲线拆成折线后按像素面积计算覆盖率。
+
+用法:
+    python3 Tools/ttf2font.py FONT.ttf NAME HEIGHT BPP [FIRST LAST] [--chars FILE] [--rle] [--kern] > Core/Src/name.c
+
+    NAME    生成的sFONT变量名，如Font16
+    HEIGHT  行高(像素)，字号按 行高 = ascender - descender 换算
+    BPP     4(A4) 或 8(A8)
+    FIRST/LAST  字符范围，默认0x20~0x7E
+    --chars FILE  另外加入UTF-8文本文件中出现的所有字符(如常用汉字表)，生成按编码排序的稀疏字体
+    --rle   字模按LCD_FONT_RLE格式压缩(与上一行的差值游程编码)，大字库的点阵通常缩小到一半以下
+    --kern  从kern表(版本0格式0)读取字距调整对，不支持GPOS
+"""
+import argparse
+import struct
+import sys
+import math
+
+
+class TrueType:
+    def __init__(self, data):
+        self.data = data
+        self.tables = {}
+        num = struct.unpack('>H', data[4:6])[0]
+        for i in range(num):
+            tag, _, off, length = struct.unpack('>4sIII', data[12 + 16 * i:28 + 16 * i])
+            self.tables[tag.decode('latin-1')] = (off, length)
+        head = self.tables['head'][0]
+        self.units_per_em = self.u16(head + 18)
+        self.loca_long = self.s16(head + 50) == 1
+        hhea = self.tables['hhea'][0]
+        self.ascender = self.s16(hhea + 4)
+        self.descender = self.s16(hhea + 6)
+        self.num_hmetrics = self.u16(hhea + 34)
+        self.num_glyphs = self.u16(self.tables['maxp'][0] + 4)
+        self.cmap = self.parse_cmap()
+
+    def u16(self, o):
+        return struct.unpack('>H', self.data[o:o + 2])[0]
+
+    def s16(self, o):
+        return struct.unpack('>h', self.data[o:o + 2])[0]
+
+    def u32(self, o):
+        return struct.unpack('>I', self.data[o:o + 4])[0]
+
+    def parse_cmap(self):
+        base = self.tables['cmap'][0]
+        cmap = {}
+        for i in range(self.u16(base + 2)):
+            pid, eid, off = struct.unpack('>HHI', self.data[base + 4 + 8 * i:base + 12 + 8 * i])
+            sub = base + off
+            if pid == 3 and eid == 1 and self.u16(sub) == 4:
+                segx2 = self.u16(sub + 6)
+                ends = sub + 14
+                starts = ends + segx2 + 2
+                deltas = starts + segx2
+                ranges = deltas + segx2
+                for s in range(segx2 // 2):
+                    end = self.u16(ends + 2 * s)
+                    start = self.u16(starts + 2 * s)
+                    delta = self.s16(deltas + 2 * s)
+                    roff = self.u16(ranges + 2 * s)
+                    for c in range(start, end + 1):
+                        if c == 0xFFFF:
+                            continue
+                        if roff == 0:
+                            g = (c + delta) & 0xFFFF
+                        else:
+                            g = self.u16(ranges + 2 * s + roff + 2 * (c - start))
+                            if g:
+                                g = (g + delta) & 0xFFFF
+                        cmap[c] = g
+        return cmap
+
+    def kerning(self):
+        """读取kern表中水平方向的字距调整对，返回{(左字形, 右字形): 值}"""
+        if 'kern' not in self.tables:
+            return {}
+        base = self.tables['kern'][0]
+        if self.u16(base) != 0:
+            return {}
+        pairs, p = {}, base + 4
+        for _ in range(self.u16(base + 2)):
+            length, coverage = self.u16(p + 2), self.u16(p + 4)
+            # 格式0、水平、非交叉方向
+            if (coverage >> 8) == 0 and (coverage & 0x05) == 0x01:
+                for i in range(self.u16(p + 6)):
+                    left, right, value = struct.unpack('>HHh', self.data[p + 14 + 6 * i:p + 20 + 6 * i])
+                    pairs[(left, right)] = value
+            p += length
+        return pairs
+
+    def name(self, name_id):
+        """读取name表中的字符串，如0为版权声明"""
+        base = self.tables['name'][0]
+        count, strings = self.u16(base + 2), base + self.u16(base + 4)
+        for i in range(count):
+            pid, eid, _, nid, length, off = struct.unpack('>6H', self.data[base + 6 + 12 * i:base + 18 + 12 * i])
+            if nid == name_id and pid == 3 and eid == 1:
+                return self.data[strings + off:strings + off + length].decode('utf-16-be')
+        return ''
+
+    def advance(self, gid):
+        hmtx = self.tables['hmtx'][0]
+        return self.u16(hmtx + 4 * min(gid, self.num_hmetrics - 1))
+
+    def glyph_offset(self, gid):
+        loca = self.tables['loca'][0]
+        if self.loca_long:
+            a, b = self.u32(loca + 4 * gid), self.u32(loca + 4 * gid + 4)
+        else:
+            a, b = self.u16(loca + 2 * gid) * 2, self.u16(loca + 2 * gid + 2) * 2
+        return (self.tables['glyf'][0] + a) if b > a else None
+
+    def contours(self, gid, xform=(1, 0, 0, 1, 0, 0)):
+        """返回轮廓列表，每个轮廓为[(x, y, on_curve), ...]"""
+        off = self.glyph_offset(gid)
+        if off is None:
+            return []
+        n = self.s16(off)
+        if n >= 0:
+            return [self.transform(c, xform) for c in self.simple(off, n)]
+        result = []
+        p = off + 10
+        while True:
+            flags, sub = self.u16(p), self.u16(p + 2)
+            p += 4
+            if flags & 1:
+                dx, dy = self.s16(p), self.s16(p + 2)
+                p += 4
+            else:
+                dx, dy = struct.unpack('>bb', self.data[p:p + 2])
+                p += 2
+            a, b, c, d = 1.0, 0.0, 0.0, 1.0
+            if flags & 0x08:
+                a = d = self.s16(p) / 16384.0
+                p += 2
+            elif flags & 0x40:
+                a, d = self.s16(p) / 16384.0, self.s16(p + 2) / 16384.0
+                p += 4
+            elif flags & 0x80:
+                a, b, c, d = [self.s16(p + 2 * k) / 16384.0 for k in range(4)]
+                p += 8
+            xa, xb, xc, xd, xe, xf = xform
+            m = (a * xa + b * xc, a * xb + b * xd, c * xa + d * xc, c * xb + d * xd,
+                 dx * xa + dy * xc + xe, dx * xb + dy * xd + xf)
+            result += self.contours(sub, m)
+            if not flags & 0x20:
+                break
+        return result
+
+    @staticmethod
+    def transform(contour, m):
+        a, b, c, d, e, f = m
+        return [(x * a + y * c + e, x * b + y * d + f, on) for x, y, on in contour]
+
+    def simple(self, off, n):
+        ends = [self.u16(off + 10 + 2 * i) for i in range(n)]
+        count = ends[-1] + 1 if ends else 0
+        p = off + 10 + 2 * n
+        p += 2 + self.u16(p)
+        flags = []
+        while len(flags) < count:
+            f = self.data[p]
+            p += 1
+            flags.append(f)
+            if f & 8:
+                r = self.data[p]
+                p += 1
+                flags += [f] * r
+        xs, ys = [], []
+        for coords, short, same in ((xs, 2, 16), (ys, 4, 32)):
+            v = 0
+            for f in flags:
+                if f & short:
+                    dv = self.data[p]
+                    p += 1
+                    v += dv if f & same else -dv
+                elif not f & same:
+                    v += self.s16(p)
+                    p += 2
+                coords.append(v)
+        pts = [(xs[i], ys[i], flags[i] & 1) for i in range(count)]
+        result, start = [], 0
+        for e in ends:
+            result.append(pts[start:e + 1])
+            start = e + 1
+        return result
+
+
+def flatten(contour, steps=8):
+    """二次贝塞尔轮廓转为闭合折线"""
+    if not contour:
+        return []
+    pts = list(contour)
+    # 以一个曲线上的点开始
+    if not pts[0][2]:
+        if pts[-1][2]:
+            pts = [pts[-1]] + pts[:-1]
+        else:
+            mid = ((pts[0][0] + pts[-1][0]) / 2, (pts[0][1] + pts[-1][1]) / 2, 1)
+            pts = [mid] + pts
+    out = [(pts[0][0], pts[0][1])]
+    n = len(pts)
+    i = 1
+    cur = pts[0]
+    while i <= n:
+        p = pts[i % n]
+        if p[2]:
+            out.append((p[0], p[1]))
+            cur = p
+            i += 1
+            continue
+        nxt = pts[(i + 1) % n]
+        if nxt[2]:
+            end = nxt
+            i += 2
+        else:
+            end = ((p[0] + nxt[0]) / 2, (p[1] + nxt[1]) / 2, 1)
+            i += 1
+        for k in range(1, steps + 1):
+            t = k / steps
+            x = (1 - t) ** 2 * cur[0] + 2 * (1 - t) * t * p[0] + t * t * end[0]
+            y = (1 - t) ** 2 * cur[1] + 2 * (1 - t) * t * p[1] + t * t * end[1]
+            out.append((x, y))
+        cur = end
+    return out
+
+
+def rasterize(polys, w, h):
+    """按像素面积计算非零环绕覆盖率，返回h行w列的0~1浮点数"""
+    acc = [[0.0] * (w + 2) for _ in range(h)]
+    for poly in polys:
+        for k in range(len(poly)):
+            x0, y0 = poly[k]
+            x1, y1 = poly[(k + 1) % len(poly)]
+            if y0 == y1:
+                continue
+            d0 = 1.0
+            if y0 > y1:
+                d0 = -1.0
+                x0, y0, x1, y1 = x1, y1, x0, y0
+            dxdy = (x1 - x0) / (y1 - y0)
+            x = x0
+            if y0 < 0:
+                x -= y0 * dxdy
+                y0 = 0.0
+            for y in range(int(y0), min(h, int(math.ceil(y1)))):
+                row = acc[y]
+                dy = min(y + 1.0, y1) - max(float(y), y0)
+                xn = x + dxdy * dy
+                d = dy * d0
+                xa, xb = min(x, xn), max(x, xn)
+                xa, xb = min(max(xa, 0.0), w), min(max(xb, 0.0), w)
+                ia, ib = int(math.floor(xa)), int(math.ceil(xb))
+                if ib <= ia + 1:
+                    xm = 0.5 * (xa + xb) - ia
+                    row[ia] += d - d * xm
+                    row[ia + 1] += d * xm
+                else:
+                    s = 1.0 / (xb - xa)
+                    xaf = xa - ia
+                    a0 = 0.5 * s * (1 - xaf) ** 2
+                    xbf = xb - ib + 1
+                    am = 0.5 * s * xbf * xbf
+                    row[ia] += d * a0
+                    if ib == ia + 2:
+                        row[ia + 1] += d * (1 - a0 - am)
+                    else:
+                        a1 = s * (1.5 - xaf)
+                        row[ia + 1] += d * (a1 - a0)
+                        for xi in range(ia + 2, ib - 1):
+                            row[xi] += d * s
+                        a2 = a1 + (ib - ia - 3) * s
+                        row[ib - 1] += d * (1 - a2 - am)
+                    row[ib] += d * am
+                x = xn
+    out = []
+    for row in acc:
+        s, line = 0.0, []
+        for i in range(w):
+            s += row[i]
+            line.append(min(1.0, abs(s)))
+        out.append(line)
+    return out
+
+
+def rle(vals, width, bpp):
+    """按LCD_Font_Decode的LCD_FONT_RLE格式压缩一个字模，vals为逐像素的值"""
+    mask = (1 << bpp) - 1
+    res = [(v - (vals[i - width] if i >= width else 0)) & mask for i, v in enumerate(vals)]
+    # 连续几个0差值以上才值得结束直接给出的差值，改用游程
+    brk = 3 if bpp == 4 else 2
+    out, i = [], 0
+    while i < len(res):
+        n = 0
+        while i + n < len(res) and res[i + n] == 0 and n < 128:
+            n += 1
+        if n >= brk or i + n == len(res):
+            out.append(n - 1)
+            i += n
+            continue
+        j = i
+        while j < len(res) and j - i < 128 and any(res[j:j + brk]):
+            j += 1
+        lit = res[i:j]
+        out.append(0x80 | (len(lit) - 1))
+        if bpp == 8:
+            out += lit
+        else:
+            lit += [0] * (len(lit) & 1)
+            out += [(lit[k] << 4) | lit[k + 1] for k in range(0, len(lit), 2)]
+        i = j
+    return out
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument('font')
+    ap.add_argument('name')
+    ap.add_argument('height', type=int)
+    ap.add_argument('bpp', type=int, choices=(4, 8))
+    ap.add_argument('first', nargs='?', default='0x20')
+    ap.add_argument('last', nargs='?', default='0x7E')
+    ap.add_argument('--chars')
+    ap.add_argument('--rle', action='store_true')
+    ap.add_argument('--kern', action='store_true')
+    args = ap.parse_args()
+    path, name, height, bpp = args.font, args.name, args.height, args.bpp
+    first, last = int(args.first, 0), int(args.last, 0)
+    tt = TrueType(open(path, 'rb').read())
+    scale = height / float(tt.ascender - tt.descender)
+    ascent = int(round(tt.ascender * scale))
+    levels = (1 << bpp) - 1
+
+    codes = list(range(first, last + 1))
+    sparse = args.chars is not None
+    if sparse:
+        text = open(args.chars, encoding='utf-8').read()
+        extra = set(ord(c) for c in text if ord(c) >= 0x20 and ord(c) in tt.cmap)
+        codes = sorted(set(codes) | extra)
+        # 编码表为16位，只支持基本多文种平面
+        codes = [c for c in codes if c <= 0xFFFF]
+    assert len(codes) <= 0xFFFF
+
+    table, glyphs, max_adv, raw_size = [], [], 0, 0
+    for ch in codes:
+        gid = tt.cmap.get(ch, 0)
+        adv = int(round(tt.advance(gid) * scale))
+        max_adv = max(max_adv, adv)
+        polys = []
+        for c in tt.contours(gid):
+            polys.append([(x * scale, ascent - y * scale) for x, y in flatten(c)])
+        pts = [p for poly in polys for p in poly]
+        if not pts:
+            glyphs.append((len(table), 0, 0, 0, 0, adv, ch))
+            continue
+        x0 = int(math.floor(min(p[0] for p in pts)))
+        x1 = int(math.ceil(max(p[0] for p in pts)))
+        y0 = int(math.floor(min(p[1] for p in pts)))
+        y1 = int(math.ceil(max(p[1] for p in pts)))
+        w, h = x1 - x0, y1 - y0
+        cov = rasterize([[(x - x0, y - y0) for x, y in poly] for poly in polys], w, h)
+        offset = len(table)
+        raw_size += h * (w if bpp == 8 else (w + 1) // 2)
+        if args.rle:
+            table += rle([int(round(c * levels)) for row in cov for c in row], w, bpp)
+        else:
+            for row in cov:
+                vals = [int(round(c * levels)) for c in row]
+                if bpp == 8:
+                    table += vals
+                else:
+                    # A4每行按字节对齐，高4位为左边的像素
+                    vals += [0] * (len(vals) & 1)
+                    table += [(vals[i] << 4) | vals[i + 1] for i in range(0, len(vals), 2)]
+        glyphs.append((offset, w, h, x0, y0, adv, ch))
+
+    kerning = []
+    if args.kern:
+        chars = {}
+        for ch in codes:
+            chars.setdefault(tt.cmap.get(ch, 0), []).append(ch)
+        for (left, right), value in tt.kerning().items():
+            adjust = int(round(value * scale))
+            if adjust != 0:
+                kerning += [(l, r, adjust) for l in chars.get(left, []) for r in chars.get(right, [])]
+        kerning.sort()
+
+    out = sys.stdout
+    fmt = 'A4' if bpp == 4 else 'A8'
+    out.write('/**\n')
+    out.write('  ******************************************************************************\n')
+    out.write('  * @file    %s.c\n' % name.lower())
+    if sparse:
+        out.write('  * @brief   %d像素行高%s抗锯齿字体，%d个字符\n' % (height, fmt, len(codes)))
+    else:
+        out.write('  * @brief   %d像素行高%s抗锯齿字体，字符0x%02X~0x%02X\n' % (height, fmt, first, last))
+    if args.rle:
+        out.write('  *          点阵按LCD_FONT_RLE压缩，%d字节，未压缩%d字节\n' % (len(table), raw_size))
+    out.write('  *          由Tools/ttf2font.py从%s生成，请勿手工修改\n' % path.replace('\\', '/').split('/')[-1])
+    # 版权声明(名称0)缺失时用许可说明(名称13)的第一句
+    copyright = tt.name(0)
+    if 'opyright' not in copyright and '\u00a9' not in copyright:
+        copyright = tt.name(13).split('. ')[0].strip()
+    if copyright:
+        out.write('  *          %s\n' % copyright)
+    out.write('  ******************************************************************************\n')
+    out.write('  */\n')
+    out.write('#include "lcd_font.h"\n\n')
+    out.write('static const uint8_t %s_Table[] =\n{\n' % name)
+    for i in range(0, len(table), 16):
+        out.write('  ' + ', '.join('0x%02X' % v for v in table[i:i + 16]) + ',\n')
+    out.write('};\n\n')
+    out.write('static const LCD_GlyphTypeDef %s_Glyphs[] =\n{\n' % name)
+    out.write('  /* Offset, Width, Height, XOffset, YOffset, Advance */\n')
+    for offset, w, h, xo, yo, adv, ch in glyphs:
+        c = chr(ch)
+        label = c if c.isprintable() and c not in '\\*/' else '0x%02X' % ch
+        out.write('  {%5d, %2d, %2d, %3d, %3d, %2d},  /* %s */\n' % (offset, w, h, xo, yo, adv, label))
+    out.write('};\n\n')
+    if sparse:
+        out.write('static const uint16_t %s_Codes[] =\n{\n' % name)
+        for i in range(0, len(codes), 12):
+            out.write('  ' + ', '.join('0x%04X' % c for c in codes[i:i + 12]) + ',\n')
+        out.write('};\n\n')
+    if kerning:
+        out.write('static const LCD_KernTypeDef %s_Kerning[] =\n{\n' % name)
+        for left, right, adjust in kerning:
+            out.write('  {0x%04X, 0x%04X, %3d},\n' % (left, right, adjust))
+        out.write('};\n\n')
+    out.write('sFONT %s =\n{\n' % name)
+    out.write('  %s_Table,\n' % name)
+    out.write('  %d,    /* Width */\n' % max_adv)
+    out.write('  %d,    /* Height */\n' % height)
+    out.write('  %s_Glyphs,\n' % name)
+    out.write('  %d,    /* Ascent */\n' % ascent)
+    out.write('  0x%02X,  /* FirstChar */\n' % codes[0])
+    out.write('  %d,    /* GlyphCount */\n' % len(glyphs))
+    out.write('  %d,     /* Bpp */\n' % bpp)
+    if sparse or args.rle or kerning:
+        out.write('  %s,  /* Encoding */\n' % ('LCD_FONT_RLE' if args.rle else 'LCD_FONT_RAW'))
+        out.write('  %s,\n' % (name + '_Codes' if sparse else 'NULL'))
+        out.write('  %s,\n' % (name + '_Kerning' if kerning else 'NULL'))
+        out.write('  %d,     /* KernCount */\n' % len(kerning))
+    out.write('};\n')
+
+
+if __name__ == '__main__':
+    main()